@@ -22,18 +22,20 @@
 #include <luci/IR/Module.h>
 #include <mio/circle/schema_generated.h>
 
+#include <fstream>
 #include <memory>
 #include <string>
 
 struct CircleExpContract : public luci::CircleExporter::Contract
 {
 public:
-  CircleExpContract(luci::Module *module, const std::string &filename)
-      : _module(module), _filepath(filename)
+  CircleExpContract(luci::Module *module, const std::string &filename,
+                    bool external_buffers = false)
+      : _module(module), _filepath(filename), _external_buffers(external_buffers)
   {
     // NOTHING TO DO
   }
-  virtual ~CircleExpContract() = default;
+  virtual ~CircleExpContract();
 
 public:
   loco::Graph *graph(void) const final { return nullptr; }
@@ -42,9 +44,24 @@ public:
 public:
   bool store(const char *ptr, const size_t size) const final;
 
+public:
+  bool external_buffers(void) const final { return _external_buffers; }
+  bool append(const char *ptr, const size_t size) const final;
+
+public:
+  // Replace the output file with what is exported, which is written to a temporary file until
+  // then. So the output can be the input file, whose buffers imported constants may refer to.
+  bool commit(void) const;
+
+private:
+  std::string temp_filepath(void) const { return _filepath + ".tmp"; }
+
 private:
   luci::Module *_module;
   const std::string _filepath;
+  const bool _external_buffers;
+  // Kept open after store for data to be appended
+  mutable std::ofstream _fs;
 };
 
 #endif // __CIRCLE2CIRCLE_CIRCLEXPCONTRACT_H__
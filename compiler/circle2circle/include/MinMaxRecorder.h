@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __CIRCLE2CIRCLE_MINMAX_RECORDER_H__
+#define __CIRCLE2CIRCLE_MINMAX_RECORDER_H__
+
+#include <luci/IR/Module.h>
+
+#include <string>
+
+/**
+ * @brief Run a module on calibration data with luci-interpreter, and record min/max of each
+ *        float activation to its CircleQuantParam
+ *
+ * The data file is a raw array of float32 records. Each record has data of all the inputs of
+ * the graph in order. Min/max are accumulated over all the records, which are run in parallel
+ * over hardware threads.
+ *
+ * @return Number of records which are run
+ */
+uint32_t record_minmax(luci::Module *module, const std::string &data_path);
+
+#endif // __CIRCLE2CIRCLE_MINMAX_RECORDER_H__
@@ -29,6 +29,10 @@ struct Model
   virtual ~Model() = default;
 
   virtual const ::circle::Model *model(void) = 0;
+
+  // Whole file which model(void) is read from, where data out of the flatbuffer is stored
+  virtual const uint8_t *data(void) const = 0;
+  virtual size_t size(void) const = 0;
 };
 
 /**
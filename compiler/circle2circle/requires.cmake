@@ -8,3 +8,4 @@ require("oops")
 require("hermes")
 require("hermes-std")
 require("luci")
+require("luci-interpreter")
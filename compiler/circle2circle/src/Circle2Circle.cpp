@@ -16,6 +16,7 @@
 
 #include "Model.h"
 #include "CircleExpContract.h"
+#include "MinMaxRecorder.h"
 
 #include <luci/Importer.h>
 #include <luci/CircleOptimizer.h>
@@ -46,6 +47,17 @@ void print_help(const char *progname)
   std::cerr << "Require two following parameters (input_dtype, output_dtype)" << std::endl;
   std::cerr << "                            ";
   std::cerr << "Ex: --quantize_with_minmax float32 uint8" << std::endl;
+  std::cerr << "                            ";
+  std::cerr << "Output dtype is uint8 (asymmetric) or int8 (per-channel weights)" << std::endl;
+  std::cerr << "   --calibration_data : Record min/max of activations running the model on data"
+            << std::endl;
+  std::cerr << "                        ";
+  std::cerr << "Require a raw float32 file of records, each of which has all inputs in order"
+            << std::endl;
+  std::cerr << "   --external_buffers : Store constants after the flatbuffer rather than in it"
+            << std::endl;
+  std::cerr << "                        ";
+  std::cerr << "Required for models larger than 2GB" << std::endl;
   std::cerr << std::endl;
 }
 
@@ -62,8 +74,13 @@ int entry(int argc, char **argv)
   // Simple argument parser (based on map)
   std::map<std::string, OptionHook> argparse;
   luci::CircleOptimizer optimizer;
+  // Quantization runs separately after calibration of the optimized graph
+  luci::CircleOptimizer quantizer;
+  std::string calibration_data;
+  bool external_buffers = false;
 
   auto options = optimizer.options();
+  auto quantize_options = quantizer.options();
 
   // TODO merge this with help message
   argparse["--fuse_instnorm"] = [&options](const char **) {
@@ -76,8 +93,8 @@ int entry(int argc, char **argv)
   };
 
   // TODO use better parsing library (ex: boost.program_options)
-  argparse["--quantize_with_minmax"] = [&options](const char **argv) {
-    options->enable(Algorithms::QuantizeWithMinMax);
+  argparse["--quantize_with_minmax"] = [&quantize_options](const char **argv) {
+    quantize_options->enable(Algorithms::QuantizeWithMinMax);
 
     if (argv[0] == nullptr || argv[1] == nullptr)
       throw std::runtime_error("--quantize_with_minmax must have two following parameters.");
@@ -89,10 +106,21 @@ int entry(int argc, char **argv)
         input_dtype.substr(0, 2).compare("--") == 0 || output_dtype.substr(0, 2).compare("--") == 0)
       throw std::runtime_error("Wrong algorithm parameters for --quantize_with_minmax.");
 
-    options->param(AlgorithmParameters::QuantizeWithMinMax_input_dtype, input_dtype);
-    options->param(AlgorithmParameters::QuantizeWithMinMax_output_dtype, output_dtype);
+    quantize_options->param(AlgorithmParameters::QuantizeWithMinMax_input_dtype, input_dtype);
+    quantize_options->param(AlgorithmParameters::QuantizeWithMinMax_output_dtype, output_dtype);
     return 2;
   };
+  argparse["--calibration_data"] = [&calibration_data](const char **argv) {
+    if (argv[0] == nullptr || std::string(argv[0]).substr(0, 2).compare("--") == 0)
+      throw std::runtime_error("--calibration_data must have a following parameter.");
+
+    calibration_data = argv[0];
+    return 1;
+  };
+  argparse["--external_buffers"] = [&external_buffers](const char **) {
+    external_buffers = true;
+    return 0;
+  };
 
   for (int n = 1; n < argc - 2; ++n)
   {
@@ -128,7 +156,10 @@ int entry(int argc, char **argv)
   }
 
   // Import from input Circle file
+  // Constants refer to the mapped file until they are modified, as 'model' outlives 'module'
   luci::Importer importer;
+  importer.share_buffers(true);
+  importer.model_file(model->data(), model->size());
   auto module = importer.importModule(input_model);
 
   for (size_t idx = 0; idx < module->size(); ++idx)
@@ -145,12 +176,32 @@ int entry(int argc, char **argv)
     }
   }
 
+  if (!calibration_data.empty())
+    record_minmax(module.get(), calibration_data);
+
+  if (quantize_options->query(Algorithms::QuantizeWithMinMax))
+  {
+    for (size_t idx = 0; idx < module->size(); ++idx)
+    {
+      auto graph = module->graph(idx);
+
+      quantizer.optimize(graph);
+
+      if (!luci::validate(graph))
+      {
+        std::cerr << "ERROR: Quantized graph is invalid" << std::endl;
+        return 255;
+      }
+    }
+  }
+
   // Export to output Circle file
   luci::CircleExporter exporter;
 
-  CircleExpContract contract(module.get(), output_path);
+  CircleExpContract contract(module.get(), output_path, external_buffers);
 
-  if (!exporter.invoke(&contract))
+  // NOTE Constants may still refer to the input file until export is committed
+  if (!exporter.invoke(&contract) || !contract.commit())
   {
     std::cerr << "ERROR: Failed to export '" << output_path << "'" << std::endl;
     return 255;
@@ -15,9 +15,73 @@
  */
 
 #include "TestHelper.h"
+#include "CircleExpContract.h"
+#include "Model.h"
+
+#include <luci/Importer.h>
+#include <luci/IR/CircleNodes.h>
 
 #include <gtest/gtest.h>
 
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+
+// Large enough for constants to span pages beyond the flatbuffer
+const uint32_t N = 64 * 1024;
+
+float value_at(uint32_t i) { return static_cast<float>(i % 1000) / 8.f; }
+
+// Graph: output = Add(input, const)
+std::unique_ptr<luci::Module> createModule(void)
+{
+  auto g = loco::make_graph();
+
+  auto input = g->nodes()->create<luci::CircleInput>();
+  input->dtype(loco::DataType::FLOAT32);
+  input->rank(1);
+  input->dim(0) = N;
+  auto graph_input = g->inputs()->create();
+  graph_input->name("input");
+  graph_input->dtype(loco::DataType::FLOAT32);
+  graph_input->shape({N});
+  luci::link(graph_input, input);
+
+  auto addend = g->nodes()->create<luci::CircleConst>();
+  addend->dtype(loco::DataType::FLOAT32);
+  addend->rank(1);
+  addend->dim(0) = N;
+  addend->size<loco::DataType::FLOAT32>(N);
+  for (uint32_t i = 0; i < N; ++i)
+    addend->at<loco::DataType::FLOAT32>(i) = value_at(i);
+
+  auto add = g->nodes()->create<luci::CircleAdd>();
+  add->x(input);
+  add->y(addend);
+  add->fusedActivationFunction(luci::FusedActFunc::NONE);
+
+  auto output = g->nodes()->create<luci::CircleOutput>();
+  output->from(add);
+  auto graph_output = g->outputs()->create();
+  graph_output->name("output");
+  graph_output->dtype(loco::DataType::FLOAT32);
+  graph_output->shape({N});
+  luci::link(graph_output, output);
+
+  auto module = luci::make_module();
+  module->add(std::move(g));
+  return module;
+}
+
+bool exists(const std::string &path) { return std::ifstream(path).good(); }
+
+} // namespace
+
 TEST(Circle2CircleTest, NoArg_NEG)
 {
   Argv<1> argv;
@@ -27,3 +91,50 @@ TEST(Circle2CircleTest, NoArg_NEG)
   int result = entry(1, argv.argv());
   ASSERT_EQ(255, result);
 }
+
+TEST(Circle2CircleTest, external_buffers_in_place)
+{
+  std::string path{"circle2circle_test_XXXXXX"};
+  const int fd = mkstemp(&path[0]);
+  ASSERT_GE(fd, 0);
+  close(fd);
+
+  {
+    auto module = createModule();
+    luci::CircleExporter exporter;
+    CircleExpContract contract(module.get(), path, true);
+    ASSERT_TRUE(exporter.invoke(&contract));
+    ASSERT_TRUE(contract.commit());
+  }
+
+  // Output overwrites the input, whose constants are still referred to while export
+  Argv<4> argv;
+  argv.add("circle2circle");
+  argv.add("--external_buffers");
+  argv.add(path.c_str());
+  argv.add(path.c_str());
+  EXPECT_EQ(0, entry(4, argv.argv()));
+  EXPECT_FALSE(exists(path + ".tmp"));
+
+  auto model = luci::load_model(path);
+  ASSERT_NE(model->model(), nullptr);
+  luci::Importer importer;
+  importer.model_file(model->data(), model->size());
+  auto module = importer.importModule(model->model());
+
+  uint32_t num_consts = 0;
+  for (auto node : loco::all_nodes(module->graph()))
+  {
+    auto const_node = dynamic_cast<luci::CircleConst *>(node);
+    if (const_node == nullptr)
+      continue;
+
+    ++num_consts;
+    ASSERT_EQ(const_node->size<loco::DataType::FLOAT32>(), N);
+    for (uint32_t i = 0; i < N; ++i)
+      ASSERT_EQ(const_node->at<loco::DataType::FLOAT32>(i), value_at(i)) << "at " << i;
+  }
+  EXPECT_EQ(num_consts, 1);
+
+  std::remove(path.c_str());
+}
@@ -18,16 +18,52 @@
 
 #include <oops/InternalExn.h>
 
+#include <cstdio>
 #include <fstream>
 #include <iostream>
 
+CircleExpContract::~CircleExpContract()
+{
+  // Export has failed or is not committed
+  if (_fs.is_open())
+  {
+    _fs.close();
+    std::remove(temp_filepath().c_str());
+  }
+}
+
 bool CircleExpContract::store(const char *ptr, const size_t size) const
 {
   if (!ptr)
     INTERNAL_EXN("Graph was not serialized by FlatBuffer for some reason");
 
-  std::ofstream fs(_filepath.c_str(), std::ofstream::binary);
-  fs.write(ptr, size);
+  _fs.open(temp_filepath().c_str(), std::ofstream::binary);
+  _fs.write(ptr, size);
+
+  return _fs.good();
+}
+
+bool CircleExpContract::append(const char *ptr, const size_t size) const
+{
+  if (!_fs.is_open())
+    INTERNAL_EXN("Data is appended before the graph is stored");
+
+  _fs.write(ptr, size);
+
+  return _fs.good();
+}
+
+bool CircleExpContract::commit(void) const
+{
+  if (!_fs.is_open())
+    INTERNAL_EXN("Nothing is stored to commit");
+
+  _fs.close();
+  if (_fs.fail() || std::rename(temp_filepath().c_str(), _filepath.c_str()) != 0)
+  {
+    std::remove(temp_filepath().c_str());
+    return false;
+  }
 
-  return fs.good();
+  return true;
 }
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MinMaxRecorder.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci_interpreter/BatchInterpreter.h>
+
+#include <loco/IR/Algorithm.h>
+
+#include <stdex/Memory.h>
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+
+struct MinMax
+{
+  float min = std::numeric_limits<float>::max();
+  float max = std::numeric_limits<float>::lowest();
+};
+
+class MinMaxObserver final : public luci_interpreter::ExecutionObserver
+{
+public:
+  void postTensorWrite(const luci::CircleNode *node,
+                       const luci_interpreter::Tensor *tensor) override
+  {
+    if (tensor == nullptr || tensor->element_type() != loco::DataType::FLOAT32)
+      return;
+
+    const float *data = tensor->data<float>();
+    const int32_t num_elements = tensor->shape().num_elements();
+    if (num_elements == 0)
+      return;
+
+    const auto minmax = std::minmax_element(data, data + num_elements);
+    update(node, *minmax.first, *minmax.second);
+  }
+
+  void merge(const MinMaxObserver &other)
+  {
+    for (const auto &item : other._minmax)
+      update(item.first, item.second.min, item.second.max);
+  }
+
+  const MinMax *find(const luci::CircleNode *node) const
+  {
+    auto it = _minmax.find(node);
+    return it == _minmax.end() ? nullptr : &it->second;
+  }
+
+private:
+  void update(const luci::CircleNode *node, float min, float max)
+  {
+    auto &record = _minmax[node];
+    record.min = std::min(record.min, min);
+    record.max = std::max(record.max, max);
+  }
+
+private:
+  std::map<const luci::CircleNode *, MinMax> _minmax;
+};
+
+uint32_t tensor_size(const luci::CircleNode *node)
+{
+  uint32_t size = loco::size(node->dtype());
+  for (uint32_t i = 0; i < node->rank(); ++i)
+    size *= node->dim(i).value();
+  return size;
+}
+
+} // namespace
+
+uint32_t record_minmax(luci::Module *module, const std::string &data_path)
+{
+  loco::Graph *graph = module->graph();
+
+  const auto input_nodes = loco::input_nodes(graph);
+  size_t record_size = 0;
+  for (auto node : input_nodes)
+  {
+    auto input_node = loco::must_cast<const luci::CircleInput *>(node);
+    if (input_node->dtype() != loco::DataType::FLOAT32)
+      throw std::runtime_error("Calibration supports float32 inputs only");
+    record_size += tensor_size(input_node);
+  }
+
+  std::ifstream fs(data_path, std::ifstream::binary);
+  if (fs.fail())
+    throw std::runtime_error("Cannot open calibration data \"" + data_path + "\"");
+  std::vector<char> data((std::istreambuf_iterator<char>(fs)), std::istreambuf_iterator<char>());
+  if (record_size == 0 || data.empty() || data.size() % record_size != 0)
+    throw std::runtime_error("Size of calibration data \"" + data_path +
+                             "\" is not a multiple of the size of inputs");
+
+  // Records are run in parallel, each worker recording min/max of its own
+  luci_interpreter::BatchInterpreter batch(module);
+  luci_interpreter::WorkerObservers<MinMaxObserver> worker_observers(batch);
+
+  const auto num_records = static_cast<uint32_t>(data.size() / record_size);
+  batch.run(num_records, [&](luci_interpreter::Interpreter &interpreter, size_t n) {
+    const char *record = data.data() + n * record_size;
+    for (auto node : input_nodes)
+    {
+      auto input_node = loco::must_cast<const luci::CircleInput *>(node);
+      const auto size = tensor_size(input_node);
+      interpreter.writeInputTensor(input_node, record, size);
+      record += size;
+    }
+  });
+
+  MinMaxObserver observer;
+  worker_observers.mergeInto(observer);
+
+  // Record to nodes, keeping quantization parameters which nodes already have
+  for (auto node : loco::active_nodes(loco::output_nodes(graph)))
+  {
+    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+    auto minmax = observer.find(circle_node);
+    if (minmax == nullptr)
+      continue;
+
+    if (circle_node->quantparam() == nullptr)
+      circle_node->quantparam(stdex::make_unique<luci::CircleQuantParam>());
+    circle_node->quantparam()->min = {minmax->min};
+    circle_node->quantparam()->max = {minmax->max};
+  }
+
+  return num_records;
+}
@@ -16,11 +16,9 @@
 
 #include "Model.h"
 
-#include <fstream>
-#include <vector>
-
 #include <fcntl.h>
 #include <unistd.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 
 namespace
@@ -31,6 +29,12 @@ class FileModel final : public luci::Model
 public:
   explicit FileModel(const std::string &filename) : _filename(filename) {}
 
+  ~FileModel()
+  {
+    if (_data != MAP_FAILED)
+      munmap(_data, _size);
+  }
+
 public:
   FileModel(const FileModel &) = delete;
   FileModel(FileModel &&) = delete;
@@ -38,31 +42,41 @@ public:
 public:
   const ::circle::Model *model(void) override
   {
-    std::ifstream file(_filename, std::ios::binary | std::ios::in);
-    if (!file.good())
-      return nullptr;
-
-    file.unsetf(std::ios::skipws);
-
-    std::streampos fileSize;
-    file.seekg(0, std::ios::end);
-    fileSize = file.tellg();
-    file.seekg(0, std::ios::beg);
-
-    // reserve capacity
-    _data.reserve(fileSize);
-
-    // read the data
-    file.read(_data.data(), fileSize);
-    if (file.fail())
-      return nullptr;
+    // The file is mapped in memory read-only, so that buffers of the model are read on demand
+    // and imported constants can refer to them without copying.
+    if (_data == MAP_FAILED)
+    {
+      int fd = open(_filename.c_str(), O_RDONLY);
+      if (fd < 0)
+        return nullptr;
+
+      struct stat st;
+      if (fstat(fd, &st) < 0 || st.st_size == 0)
+      {
+        close(fd);
+        return nullptr;
+      }
+      _size = static_cast<size_t>(st.st_size);
+      _data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+      // The mapping is kept after the file is closed
+      close(fd);
+      if (_data == MAP_FAILED)
+        return nullptr;
+    }
+
+    return ::circle::GetModel(_data);
+  }
 
-    return ::circle::GetModel(_data.data());
+  const uint8_t *data(void) const override
+  {
+    return _data == MAP_FAILED ? nullptr : static_cast<const uint8_t *>(_data);
   }
+  size_t size(void) const override { return _size; }
 
 private:
   const std::string _filename;
-  std::vector<char> _data;
+  void *_data = MAP_FAILED;
+  size_t _size = 0;
 };
 
 } // namespace
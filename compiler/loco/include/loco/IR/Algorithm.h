@@ -38,6 +38,13 @@ namespace loco
  */
 std::vector<loco::Node *> postorder_traversal(const std::vector<loco::Node *> &roots);
 
+/**
+ * @brief Generate postorder traversal sequence of "nodes"
+ *
+ * Only edges between the given nodes are followed, so that no node out of "nodes" is visited.
+ */
+std::vector<loco::Node *> postorder_traversal_within(const std::set<loco::Node *> &nodes);
+
 /**
  * @brief Enumerate all the nodes required to compute "roots"
  */
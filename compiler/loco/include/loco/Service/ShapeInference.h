@@ -20,6 +20,8 @@
 #include "loco/Service/ShapeInferenceRule.h"
 #include "loco/IR/Graph.h"
 
+#include <set>
+
 /**
  * @file This file implements dialect-agnostic shape inference framework
  *
@@ -43,6 +45,12 @@ public:
 
 public:
   bool to(Graph *g) const;
+  /**
+   * @brief Infer only "nodes", for example nodes which a transformation has changed
+   *
+   * @note Inference of a node whose arguments are not known yet is deferred as "to(g)" does.
+   */
+  bool to(const std::set<Node *> &nodes) const;
 
 private:
   const ShapeInferenceRule *_rule;
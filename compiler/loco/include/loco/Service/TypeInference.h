@@ -24,6 +24,7 @@
 #include "loco/IR/Graph.h"
 
 #include <map>
+#include <set>
 
 /**
  * @file This file implements dialect-agnostic type inference framework.
@@ -91,6 +92,12 @@ public:
 
 public:
   bool to(Graph *g) const;
+  /**
+   * @brief Infer only "nodes", for example nodes which a transformation has changed
+   *
+   * @note Inference of a node whose arguments are not known yet is deferred as "to(g)" does.
+   */
+  bool to(const std::set<Node *> &nodes) const;
 
 private:
   const TypeInferenceRule *_rule;
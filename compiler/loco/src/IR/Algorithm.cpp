@@ -50,7 +50,9 @@ namespace loco
 {
 
 // TODO Support cyclic graphs
-std::vector<loco::Node *> postorder_traversal(const std::vector<loco::Node *> &roots)
+template <typename Filter>
+std::vector<loco::Node *> postorder_traversal(const std::vector<loco::Node *> &roots,
+                                              Filter &&filter)
 {
   std::vector<loco::Node *> res;
 
@@ -92,7 +94,8 @@ std::vector<loco::Node *> postorder_traversal(const std::vector<loco::Node *> &r
       // Let's visit the next argument
       //
       // NOTE "next" may be nullptr if a graph is under construction.
-      if (auto next = top_frame.node().arg(top_frame.pos()))
+      auto next = top_frame.node().arg(top_frame.pos());
+      if (next != nullptr && filter(next))
       {
         frames.push(Frame{next});
       }
@@ -109,6 +112,17 @@ std::vector<loco::Node *> postorder_traversal(const std::vector<loco::Node *> &r
   return res;
 }
 
+std::vector<loco::Node *> postorder_traversal(const std::vector<loco::Node *> &roots)
+{
+  return postorder_traversal(roots, [](loco::Node *) { return true; });
+}
+
+std::vector<loco::Node *> postorder_traversal_within(const std::set<loco::Node *> &nodes)
+{
+  std::vector<loco::Node *> roots{nodes.begin(), nodes.end()};
+  return postorder_traversal(roots, [&nodes](loco::Node *node) { return nodes.count(node) > 0; });
+}
+
 std::set<loco::Node *> active_nodes(const std::vector<loco::Node *> &roots)
 {
   // This implementation works but may be inefficient
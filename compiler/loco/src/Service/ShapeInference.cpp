@@ -30,7 +30,10 @@ bool inputs_shape_ready(loco::Node *node)
 
   for (uint32_t arity = 0; arity < node->arity(); ++arity)
   {
-    if (!loco::ShapeInference::known(node->arg(arity)))
+    // NOTE An argument may be nullptr if a node is under construction, which happens to be
+    //      inferred when all the nodes of a graph are given.
+    auto arg = node->arg(arity);
+    if (arg == nullptr || !loco::ShapeInference::known(arg))
     {
       return false;
     }
@@ -61,26 +64,21 @@ private:
   loco::NodeShape _shape;
 };
 
-} // namespace
-
-namespace loco
+bool infer_shapes(const loco::ShapeInferenceRule *rule, const std::vector<loco::Node *> &nodes)
 {
-
-bool ShapeInferenceSession::to(Graph *g) const
-{
-  assert(_rule->support(ShapeInferenceRule::API::V1) && "API v1 is unavailable");
+  assert(rule->support(loco::ShapeInferenceRule::API::V1) && "API v1 is unavailable");
 
   bool changed = false;
 
-  for (auto node : loco::postorder_traversal(loco::output_nodes(g)))
+  for (auto node : nodes)
   {
-    if (_rule->recognize(node->dialect()))
+    if (rule->recognize(node->dialect()))
     {
       loco::NodeShape shape;
 
-      if (!shape_known(node) && inputs_shape_ready(node))
+      if (!loco::shape_known(node) && inputs_shape_ready(node))
       {
-        if (_rule->infer(node, shape))
+        if (rule->infer(node, shape))
         {
           node->annot(stdex::make_unique<ShapeAnnotation>(shape));
           changed = true;
@@ -92,6 +90,21 @@ bool ShapeInferenceSession::to(Graph *g) const
   return changed;
 }
 
+} // namespace
+
+namespace loco
+{
+
+bool ShapeInferenceSession::to(Graph *g) const
+{
+  return infer_shapes(_rule, loco::postorder_traversal(loco::output_nodes(g)));
+}
+
+bool ShapeInferenceSession::to(const std::set<Node *> &nodes) const
+{
+  return infer_shapes(_rule, loco::postorder_traversal_within(nodes));
+}
+
 bool ShapeInference::known(const Node *node) { return node->annot<ShapeAnnotation>() != nullptr; }
 
 NodeShape ShapeInference::get(const Node *node)
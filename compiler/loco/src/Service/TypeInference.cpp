@@ -46,7 +46,10 @@ bool inputs_dtype_ready(loco::Node *node)
 
   for (uint32_t arity = 0; arity < node->arity(); ++arity)
   {
-    if (!loco::TypeInference::known(node->arg(arity)))
+    // NOTE An argument may be nullptr if a node is under construction, which happens to be
+    //      inferred when all the nodes of a graph are given.
+    auto arg = node->arg(arity);
+    if (arg == nullptr || !loco::TypeInference::known(arg))
     {
       return false;
     }
@@ -54,24 +57,19 @@ bool inputs_dtype_ready(loco::Node *node)
   return true;
 }
 
-} // namespace
-
-namespace loco
-{
-
-bool TypeInferenceSession::to(Graph *g) const
+bool infer_dtypes(const loco::TypeInferenceRule *rule, const std::vector<loco::Node *> &nodes)
 {
   bool changed = false;
 
-  for (auto node : postorder_traversal(output_nodes(g)))
+  for (auto node : nodes)
   {
-    if (_rule->recognize(node->dialect()))
+    if (rule->recognize(node->dialect()))
     {
-      DataType dtype = DataType::Unknown;
+      loco::DataType dtype = loco::DataType::Unknown;
 
-      if (!dtype_known(node) && inputs_dtype_ready(node))
+      if (!loco::dtype_known(node) && inputs_dtype_ready(node))
       {
-        if (_rule->infer(node, dtype))
+        if (rule->infer(node, dtype))
         {
           node->annot(stdex::make_unique<DataTypeAnnotation>(dtype));
           changed = true;
@@ -83,6 +81,21 @@ bool TypeInferenceSession::to(Graph *g) const
   return changed;
 }
 
+} // namespace
+
+namespace loco
+{
+
+bool TypeInferenceSession::to(Graph *g) const
+{
+  return infer_dtypes(_rule, postorder_traversal(output_nodes(g)));
+}
+
+bool TypeInferenceSession::to(const std::set<Node *> &nodes) const
+{
+  return infer_dtypes(_rule, postorder_traversal_within(nodes));
+}
+
 bool TypeInference::known(const Node *node) { return node->annot<DataTypeAnnotation>() != nullptr; }
 
 DataType TypeInference::get(const Node *node)
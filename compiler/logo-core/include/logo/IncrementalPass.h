@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LOGO_INCREMENTAL_PASS_H__
+#define __LOGO_INCREMENTAL_PASS_H__
+
+#include <logo/Pass.h>
+
+#include <loco.h>
+
+#include <set>
+
+namespace logo
+{
+
+/**
+ * @brief Pass which can revisit a part of a graph, and reports nodes it has changed
+ *
+ * PhaseRunner<PhaseStrategy::Worklist> revisits only the neighborhood of changed nodes, instead
+ * of the whole graph.
+ */
+class IncrementalPass : public Pass
+{
+public:
+  using NodeSet = std::set<loco::Node *>;
+
+  struct Changes
+  {
+    // Nodes which the pass has created, or whose arguments, users or annotations have changed
+    // (ex: a replaced node, users of the replacement)
+    NodeSet touched;
+    // Nodes which the pass has destroyed, which SHOULD NOT be in "touched"
+    NodeSet destroyed;
+  };
+
+public:
+  virtual ~IncrementalPass() = default;
+
+public:
+  /**
+   * @brief  Run the pass over all the nodes of a graph
+   */
+  bool run(loco::Graph *graph) override;
+
+public:
+  /**
+   * @brief  Run the pass over "nodes" only
+   *
+   * @note   The pass SHOULD handle all the matches among "nodes", as "nodes" will not be given
+   *         again unless something changes around them.
+   *
+   * @return false if there was nothing changed
+   */
+  virtual bool revisit(loco::Graph *graph, const NodeSet &nodes, Changes &changes) = 0;
+};
+
+} // namespace logo
+
+#endif // __LOGO_INCREMENTAL_PASS_H__
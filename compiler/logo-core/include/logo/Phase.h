@@ -153,6 +153,8 @@ enum class PhaseStrategy
   Saturate,
   // Same as Saturate but will restart from the first when there is a change
   Restart,
+  // Same as Saturate but IncrementalPass(es) revisit only the neighborhood of changed nodes
+  Worklist,
 };
 
 template <PhaseStrategy S> class PhaseRunner;
@@ -187,6 +189,29 @@ private:
   loco::Graph *_graph;
 };
 
+/**
+ * @brief Phase runner which keeps the nodes each pass should revisit
+ *
+ * Nodes which an IncrementalPass has touched, together with their arguments and users, are
+ * given to the passes (including itself) at the next visit. A pass which is not incremental
+ * runs over the whole graph while any node is pending for it, and makes every pass revisit
+ * the whole graph when it changes something, as Saturate does.
+ */
+template <> class PhaseRunner<PhaseStrategy::Worklist> final : public PhaseRunnerMixinObservable
+{
+public:
+  PhaseRunner(loco::Graph *graph) : _graph{graph}
+  {
+    // DO NOTHING
+  }
+
+public:
+  void run(const Phase &) const;
+
+private:
+  loco::Graph *_graph;
+};
+
 } // namespace logo
 
 #endif // __LOGO_PHASE_H__
@@ -15,6 +15,10 @@
  */
 
 #include <logo/Phase.h>
+#include <logo/IncrementalPass.h>
+
+#include <algorithm>
+#include <cassert>
 
 namespace logo
 {
@@ -68,4 +72,95 @@ void PhaseRunner<PhaseStrategy::Restart>::run(const Phase &phase) const
   notifyPhaseEnd();
 }
 
+void PhaseRunner<PhaseStrategy::Worklist>::run(const Phase &phase) const
+{
+  // Nodes that each pass should revisit
+  struct Work
+  {
+    bool whole_graph = false;
+    IncrementalPass::NodeSet nodes;
+
+    bool pending(void) const { return whole_graph || !nodes.empty(); }
+  };
+
+  std::vector<Work> works(phase.size());
+  for (auto &w : works)
+    w.whole_graph = true;
+
+  auto pending = [&works](void) {
+    return std::any_of(works.begin(), works.end(), [](const Work &w) { return w.pending(); });
+  };
+
+  notifyPhaseBegin();
+
+  while (pending())
+  {
+    for (uint32_t n = 0; n < phase.size(); ++n)
+    {
+      if (!works.at(n).pending())
+        continue;
+
+      auto pass = phase.at(n).get();
+      auto incremental = dynamic_cast<IncrementalPass *>(pass);
+
+      notifyPassBegin(pass);
+
+      Work work;
+      std::swap(work, works.at(n));
+
+      bool pass_changed = false;
+      IncrementalPass::Changes changes;
+      if (incremental == nullptr)
+        pass_changed = pass->run(_graph);
+      else if (work.whole_graph)
+        pass_changed = incremental->revisit(_graph, loco::all_nodes(_graph), changes);
+      else
+        pass_changed = incremental->revisit(_graph, work.nodes, changes);
+
+      notifyPassEnd(pass, pass_changed);
+
+      if (!pass_changed)
+        continue;
+
+      if (incremental == nullptr)
+      {
+        // Nodes which the pass has changed are unknown, and some may be destroyed
+        for (auto &w : works)
+        {
+          w.whole_graph = true;
+          w.nodes.clear();
+        }
+        continue;
+      }
+
+      IncrementalPass::NodeSet neighbors;
+      for (auto node : changes.touched)
+      {
+        assert(changes.destroyed.find(node) == changes.destroyed.end());
+
+        neighbors.insert(node);
+        for (uint32_t i = 0; i < node->arity(); ++i)
+        {
+          if (auto arg = node->arg(i))
+            neighbors.insert(arg);
+        }
+        auto users = loco::succs(node);
+        neighbors.insert(users.begin(), users.end());
+      }
+
+      for (auto &w : works)
+      {
+        if (w.whole_graph)
+          continue;
+
+        for (auto node : changes.destroyed)
+          w.nodes.erase(node);
+        w.nodes.insert(neighbors.begin(), neighbors.end());
+      }
+    }
+  }
+
+  notifyPhaseEnd();
+}
+
 } // namespace logo
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <logo/Phase.h>
+#include <logo/IncrementalPass.h>
+
+#include <loco/IR/CanonicalDialect.h>
+#include <loco/Service/CanonicalShapeInferenceRule.h>
+#include <loco/Service/ShapeInference.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+
+/**
+ * Pull -- Forward x N -- Push
+ */
+std::vector<loco::Forward *> make_forward_chain(loco::Graph *g, uint32_t n)
+{
+  auto pull = g->nodes()->create<loco::Pull>();
+  pull->dtype(loco::DataType::FLOAT32);
+  pull->rank(1);
+  pull->dim(0) = 4;
+  auto graph_input = g->inputs()->create();
+  loco::link(graph_input, pull);
+
+  std::vector<loco::Forward *> forwards;
+  loco::Node *last = pull;
+  for (uint32_t i = 0; i < n; ++i)
+  {
+    auto forward = g->nodes()->create<loco::Forward>();
+    forward->input(last);
+    forwards.emplace_back(forward);
+    last = forward;
+  }
+
+  auto push = g->nodes()->create<loco::Push>();
+  push->from(last);
+  auto graph_output = g->outputs()->create();
+  loco::link(graph_output, push);
+
+  return forwards;
+}
+
+struct CountingPass final : public logo::Pass
+{
+  const char *name(void) const final { return "CountingPass"; }
+
+  bool run(loco::Graph *) final { return ++count < 4; }
+
+  uint32_t count = 0;
+};
+
+struct TouchOncePass final : public logo::IncrementalPass
+{
+  const char *name(void) const final { return "TouchOncePass"; }
+
+  bool revisit(loco::Graph *, const NodeSet &nodes, Changes &changes) final
+  {
+    visits.emplace_back(nodes);
+    if (visits.size() > 1)
+      return false;
+
+    changes.touched.insert(target);
+    return true;
+  }
+
+  loco::Node *target = nullptr;
+  std::vector<NodeSet> visits;
+};
+
+/**
+ * Infer shapes of nodes which are not known yet
+ */
+struct ShapePass final : public logo::IncrementalPass
+{
+  const char *name(void) const final { return "ShapePass"; }
+
+  bool revisit(loco::Graph *, const NodeSet &nodes, Changes &changes) final
+  {
+    NodeSet unknown_nodes;
+    for (auto node : nodes)
+    {
+      if (!loco::shape_known(node))
+        unknown_nodes.insert(node);
+    }
+
+    loco::CanonicalShapeInferenceRule rule;
+    if (!loco::apply(&rule).to(unknown_nodes))
+      return false;
+
+    for (auto node : unknown_nodes)
+    {
+      if (loco::shape_known(node))
+        changes.touched.insert(node);
+    }
+    return true;
+  }
+};
+
+/**
+ * Replace a Forward with ReLU once the shape of its input is known
+ *
+ * Each replacement enables the next one after ShapePass, which makes a cascade through the chain.
+ */
+struct ForwardToReLUPass final : public logo::IncrementalPass
+{
+  const char *name(void) const final { return "ForwardToReLUPass"; }
+
+  bool revisit(loco::Graph *g, const NodeSet &nodes, Changes &changes) final
+  {
+    bool changed = false;
+    for (auto node : nodes)
+    {
+      auto forward = dynamic_cast<loco::Forward *>(node);
+      if (forward == nullptr || changes.destroyed.count(forward) > 0)
+        continue;
+
+      auto input = forward->input();
+      if (dynamic_cast<loco::Forward *>(input) != nullptr || !loco::shape_known(input))
+        continue;
+
+      auto relu = g->nodes()->create<loco::ReLU>();
+      relu->input(input);
+      loco::replace(forward).with(relu);
+
+      forward->drop();
+      g->nodes()->destroy(forward);
+
+      changes.touched.insert(relu);
+      changes.destroyed.insert(forward);
+      changed = true;
+    }
+    return changed;
+  }
+};
+
+logo::Phase make_cascade_phase(void)
+{
+  logo::Phase phase;
+  phase.emplace_back(std::make_unique<ShapePass>());
+  phase.emplace_back(std::make_unique<ForwardToReLUPass>());
+  return phase;
+}
+
+template <logo::PhaseStrategy S> void run_cascade(loco::Graph *g)
+{
+  auto phase = make_cascade_phase();
+  logo::PhaseRunner<S> runner{g};
+  runner.run(phase);
+}
+
+bool all_relu_with_shape(loco::Graph *g, uint32_t n)
+{
+  uint32_t num_relus = 0;
+  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  {
+    if (dynamic_cast<loco::Forward *>(node) != nullptr)
+      return false;
+    if (!loco::shape_known(node))
+      return false;
+    if (dynamic_cast<loco::ReLU *>(node) != nullptr)
+      ++num_relus;
+  }
+  return num_relus == n;
+}
+
+} // namespace
+
+TEST(PhaseRunnerTest, worklist_plain_pass)
+{
+  auto g = loco::make_graph();
+  make_forward_chain(g.get(), 2);
+
+  logo::Phase phase;
+  phase.emplace_back(std::make_unique<CountingPass>());
+  auto pass = dynamic_cast<CountingPass *>(phase.at(0).get());
+
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist> runner{g.get()};
+  runner.run(phase);
+
+  // Same as Saturate, the pass runs until it makes no change
+  ASSERT_EQ(4, pass->count);
+}
+
+TEST(PhaseRunnerTest, worklist_revisit_neighborhood)
+{
+  auto g = loco::make_graph();
+  auto forwards = make_forward_chain(g.get(), 3);
+
+  logo::Phase phase;
+  phase.emplace_back(std::make_unique<TouchOncePass>());
+  auto pass = dynamic_cast<TouchOncePass *>(phase.at(0).get());
+  pass->target = forwards.at(1);
+
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist> runner{g.get()};
+  runner.run(phase);
+
+  // The first visit is over the whole graph, and the second one over the neighborhood only
+  ASSERT_EQ(2, pass->visits.size());
+  ASSERT_EQ(loco::all_nodes(g.get()), pass->visits.at(0));
+  logo::IncrementalPass::NodeSet expected{forwards.at(0), forwards.at(1), forwards.at(2)};
+  ASSERT_EQ(expected, pass->visits.at(1));
+}
+
+TEST(PhaseRunnerTest, worklist_cascade)
+{
+  const uint32_t n = 16;
+
+  auto saturate_g = loco::make_graph();
+  make_forward_chain(saturate_g.get(), n);
+  run_cascade<logo::PhaseStrategy::Saturate>(saturate_g.get());
+
+  auto worklist_g = loco::make_graph();
+  make_forward_chain(worklist_g.get(), n);
+  run_cascade<logo::PhaseStrategy::Worklist>(worklist_g.get());
+
+  ASSERT_TRUE(all_relu_with_shape(saturate_g.get(), n));
+  ASSERT_TRUE(all_relu_with_shape(worklist_g.get(), n));
+  ASSERT_EQ(saturate_g->nodes()->size(), worklist_g->nodes()->size());
+}
+
+/**
+ * Run with --gtest_also_run_disabled_tests to compare Saturate and Worklist on a large graph
+ */
+TEST(PhaseRunnerTest, DISABLED_benchmark_cascade)
+{
+  const uint32_t n = 2000;
+
+  auto measure = [n](void (*run)(loco::Graph *)) {
+    auto g = loco::make_graph();
+    make_forward_chain(g.get(), n);
+
+    auto begin = std::chrono::steady_clock::now();
+    run(g.get());
+    auto end = std::chrono::steady_clock::now();
+
+    EXPECT_TRUE(all_relu_with_shape(g.get(), n));
+    return std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count();
+  };
+
+  auto saturate_ms = measure(run_cascade<logo::PhaseStrategy::Saturate>);
+  auto worklist_ms = measure(run_cascade<logo::PhaseStrategy::Worklist>);
+
+  std::cout << "Cascade over " << n << " nodes" << std::endl;
+  std::cout << "  Saturate : " << saturate_ms << " ms" << std::endl;
+  std::cout << "  Worklist : " << worklist_ms << " ms" << std::endl;
+}
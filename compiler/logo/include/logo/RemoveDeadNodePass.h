@@ -17,16 +17,17 @@
 #ifndef __LOGO_REMOVE_DEAD_NODE_PASS_H__
 #define __LOGO_REMOVE_DEAD_NODE_PASS_H__
 
-#include <logo/Pass.h>
+#include <logo/IncrementalPass.h>
 
 namespace logo
 {
 
-struct RemoveDeadNodePass final : public Pass
+struct RemoveDeadNodePass final : public IncrementalPass
 {
   const char *name(void) const final { return "RemoveDeadNodePass"; }
 
-  bool run(loco::Graph *g);
+  bool run(loco::Graph *g) final;
+  bool revisit(loco::Graph *g, const NodeSet &nodes, Changes &changes) final;
 };
 
 } // namespace logo
@@ -17,16 +17,17 @@
 #ifndef __LOGO_REMOVE_DEAD_NODE_WITH_QUERY_PASS_H__
 #define __LOGO_REMOVE_DEAD_NODE_WITH_QUERY_PASS_H__
 
-#include <logo/Pass.h>
+#include <logo/IncrementalPass.h>
 
 namespace logo
 {
 
-struct RemoveDeadNodeWithQueryPass final : public Pass
+struct RemoveDeadNodeWithQueryPass final : public IncrementalPass
 {
   const char *name(void) const final { return "RemoveDeadNodeWithQueryPass"; }
 
-  bool run(loco::Graph *g);
+  bool run(loco::Graph *g) final;
+  bool revisit(loco::Graph *g, const NodeSet &nodes, Changes &changes) final;
 };
 
 } // namespace logo
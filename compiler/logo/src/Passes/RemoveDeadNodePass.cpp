@@ -21,6 +21,7 @@
 #include <loco/IR/CanonicalNode.h>
 
 #include <set>
+#include <vector>
 
 namespace logo
 {
@@ -74,4 +75,54 @@ bool RemoveDeadNodePass::run(loco::Graph *g)
   return candidates.size() > 0;
 }
 
+bool RemoveDeadNodePass::revisit(loco::Graph *g, const NodeSet &nodes, Changes &changes)
+{
+  auto outputs = loco::output_nodes(g);
+  std::set<loco::Node *> roots{outputs.begin(), outputs.end()};
+
+  // A node is dead if it is not an output and has no user. Removing it may make its arguments
+  // dead as well.
+  std::vector<loco::Node *> worklist{nodes.begin(), nodes.end()};
+  std::set<loco::Node *> dead_nodes;
+  std::set<loco::Node *> args;
+
+  while (!worklist.empty())
+  {
+    auto node = worklist.back();
+    worklist.pop_back();
+
+    if (dead_nodes.find(node) != dead_nodes.end() || roots.find(node) != roots.end())
+      continue;
+    if (!loco::succs(node).empty())
+      continue;
+
+    for (uint32_t n = 0; n < node->arity(); ++n)
+    {
+      if (auto arg = node->arg(n))
+      {
+        args.insert(arg);
+        worklist.emplace_back(arg);
+      }
+    }
+
+    // Dropping references first makes users of arguments up to date
+    node->drop();
+    dead_nodes.insert(node);
+  }
+
+  for (auto node : args)
+  {
+    if (dead_nodes.find(node) == dead_nodes.end())
+      changes.touched.insert(node);
+  }
+
+  for (auto node : dead_nodes)
+  {
+    g->nodes()->destroy(node);
+    changes.destroyed.insert(node);
+  }
+
+  return dead_nodes.size() > 0;
+}
+
 } // namespace logo
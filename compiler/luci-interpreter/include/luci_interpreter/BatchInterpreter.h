@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LUCI_INTERPRETER_BATCH_INTERPRETER_H
+#define LUCI_INTERPRETER_BATCH_INTERPRETER_H
+
+#include "luci_interpreter/Interpreter.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace luci_interpreter
+{
+
+// Interprets a module over many samples with a pool of workers running in parallel.
+//
+// Each worker has its own interpreter, that is its own activation tensors, while constant tensors
+// are shared by all the workers. Workers take samples one by one in the order of their indices,
+// so the order in which samples are processed across workers is not deterministic.
+class BatchInterpreter
+{
+public:
+  // Function called in a worker thread with the interpreter of the worker and a sample index.
+  using SampleFunc = std::function<void(Interpreter &interpreter, size_t sample)>;
+
+  // Creates 'num_workers' workers, or as many as hardware threads if it is 0.
+  explicit BatchInterpreter(const luci::Module *module, uint32_t num_workers = 0);
+
+  ~BatchInterpreter();
+
+  uint32_t num_workers() const { return static_cast<uint32_t>(_interpreters.size()); }
+
+  // Interpreter of a worker, e.g. to attach an observer to it.
+  Interpreter &worker(uint32_t n) { return *_interpreters.at(n); }
+
+  // Interprets samples [0, num_samples). For each sample, 'write_inputs' writes the inputs before
+  // interpretation and 'read_outputs' (if given) reads the outputs after that.
+  // If any of the workers throws, the first exception is rethrown after all the workers stop.
+  void run(size_t num_samples, const SampleFunc &write_inputs, const SampleFunc &read_outputs = {});
+
+private:
+  std::vector<std::unique_ptr<Interpreter>> _interpreters;
+};
+
+// Observers of the workers of a BatchInterpreter, one for each.
+//
+// ObserverT must be default-constructible and have 'void merge(const ObserverT &other)', which
+// adds the results of 'other' (e.g. min/max of tensors) to its own.
+// The BatchInterpreter must not run after this is destroyed, as interpreters do not own observers.
+template <typename ObserverT> class WorkerObservers
+{
+public:
+  explicit WorkerObservers(BatchInterpreter &batch)
+  {
+    for (uint32_t n = 0; n < batch.num_workers(); ++n)
+    {
+      _observers.emplace_back(std::make_unique<ObserverT>());
+      batch.worker(n).attachObserver(_observers.back().get());
+    }
+  }
+
+  // Merges the results of all the workers into 'result'.
+  void mergeInto(ObserverT &result) const
+  {
+    for (const auto &observer : _observers)
+    {
+      result.merge(*observer);
+    }
+  }
+
+private:
+  std::vector<std::unique_ptr<ObserverT>> _observers;
+};
+
+} // namespace luci_interpreter
+
+#endif // LUCI_INTERPRETER_BATCH_INTERPRETER_H
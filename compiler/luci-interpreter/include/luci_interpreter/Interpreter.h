@@ -17,6 +17,8 @@
 #ifndef LUCI_INTERPRETER_INTERPRETER_H
 #define LUCI_INTERPRETER_INTERPRETER_H
 
+#include "luci_interpreter/core/Tensor.h"
+
 #include <luci/IR/Nodes/CircleInput.h>
 #include <luci/IR/Nodes/CircleOutput.h>
 
@@ -30,10 +32,28 @@ namespace luci_interpreter
 
 class TensorMap;
 class Kernel;
+class MemoryPlanner;
+
+class ExecutionObserver
+{
+public:
+  virtual ~ExecutionObserver();
+
+  // Called when the value of a tensor has been updated during execution.
+  virtual void postTensorWrite(const luci::CircleNode *node, const Tensor *tensor);
+
+  // Called before / after executing an operator.
+  // Note that these methods are not called for auxiliary operators (CircleInput, CircleOutput,
+  // CircleConst).
+  virtual void preOperatorExecute(const luci::CircleNode *node);
+  virtual void postOperatorExecute(const luci::CircleNode *node);
+};
 
 class Interpreter
 {
 public:
+  // The module must outlive the interpreter and must not change while in use, as constant tensors
+  // refer to its data. So interpreters of the same module share constants.
   explicit Interpreter(const luci::Module *module);
 
   ~Interpreter();
@@ -44,12 +64,21 @@ public:
 
   void interpret();
 
+  // Observers are not owned by the interpreter and must outlive it.
+  void attachObserver(ExecutionObserver *observer);
+
 private:
   void createTensors(const loco::Graph *graph);
   void createExecutionSequence(const loco::Graph *main_graph);
+  void planMemory();
 
   std::unique_ptr<TensorMap> _tensor_map;
+  // Arena for intermediate tensors and scratch tensors of kernels.
+  std::unique_ptr<MemoryPlanner> _memory_planner;
   std::vector<std::unique_ptr<Kernel>> _execution_sequence;
+  // Node of each kernel in '_execution_sequence'.
+  std::vector<const luci::CircleNode *> _execution_nodes;
+  std::vector<ExecutionObserver *> _observers;
 };
 
 } // namespace luci_interpreter
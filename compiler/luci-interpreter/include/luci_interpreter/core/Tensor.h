@@ -17,12 +17,13 @@
 #ifndef LUCI_INTERPRETER_CORE_TENSOR_H
 #define LUCI_INTERPRETER_CORE_TENSOR_H
 
-#include "core/DataType.h"
+#include "luci_interpreter/core/DataType.h"
 
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace luci_interpreter
@@ -107,23 +108,35 @@ public:
     return _quantization.zero_point[0];
   }
 
-  template <typename T> const T *data() const { return reinterpret_cast<const T *>(_data.get()); }
+  template <typename T> const T *data() const { return reinterpret_cast<const T *>(_data); }
 
-  template <typename T> T *data() { return reinterpret_cast<T *>(_data.get()); }
+  template <typename T> T *data() { return reinterpret_cast<T *>(_data); }
 
-  const std::string &name() { return _name; }
+  const std::string &name() const { return _name; }
 
   void readData(void *data_ptr, size_t data_size) const;
 
   void writeData(const void *data_ptr, size_t data_size);
 
+  // Changes the shape. The tensor gets new memory for the shape unless it uses external memory.
   void resize(const Shape &new_shape);
 
+  // Size of the data for the current shape in bytes.
+  size_t byte_size() const;
+
+  // Makes the tensor use memory owned by others (e.g. an arena of MemoryPlanner), which must be
+  // large enough for the current shape. 'data' may be nullptr until the memory is planned.
+  void setExternalData(uint8_t *data);
+
+  bool is_data_external() const { return _own_data == nullptr; }
+
 private:
   DataType _element_type;
   Shape _shape;
   AffineQuantization _quantization;
-  std::unique_ptr<uint8_t[]> _data;
+  // Memory allocated by the tensor itself, which is nullptr if the tensor uses external memory.
+  std::unique_ptr<uint8_t[]> _own_data;
+  uint8_t *_data = nullptr;
   std::string _name;
 };
 
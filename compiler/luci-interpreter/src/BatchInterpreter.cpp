@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci_interpreter/BatchInterpreter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace luci_interpreter
+{
+
+BatchInterpreter::BatchInterpreter(const luci::Module *module, uint32_t num_workers)
+{
+  if (num_workers == 0)
+  {
+    num_workers = std::max(1u, std::thread::hardware_concurrency());
+  }
+
+  _interpreters.reserve(num_workers);
+  for (uint32_t n = 0; n < num_workers; ++n)
+  {
+    _interpreters.emplace_back(std::make_unique<Interpreter>(module));
+  }
+}
+
+BatchInterpreter::~BatchInterpreter() = default;
+
+void BatchInterpreter::run(size_t num_samples, const SampleFunc &write_inputs,
+                           const SampleFunc &read_outputs)
+{
+  std::atomic<size_t> next_sample{0};
+  std::atomic<bool> failed{false};
+  std::exception_ptr first_error;
+  std::mutex error_mutex;
+
+  auto work = [&](Interpreter &interpreter) {
+    try
+    {
+      while (!failed)
+      {
+        const size_t sample = next_sample++;
+        if (sample >= num_samples)
+          break;
+
+        write_inputs(interpreter, sample);
+        interpreter.interpret();
+        if (read_outputs)
+          read_outputs(interpreter, sample);
+      }
+    }
+    catch (...)
+    {
+      std::lock_guard<std::mutex> lock(error_mutex);
+      if (!first_error)
+        first_error = std::current_exception();
+      failed = true;
+    }
+  };
+
+  // The calling thread works as the first worker
+  std::vector<std::thread> threads;
+  for (size_t n = 1; n < _interpreters.size(); ++n)
+  {
+    threads.emplace_back(work, std::ref(*_interpreters[n]));
+  }
+  work(*_interpreters[0]);
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  if (first_error)
+    std::rethrow_exception(first_error);
+}
+
+} // namespace luci_interpreter
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci_interpreter/BatchInterpreter.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <stdexcept>
+
+namespace luci_interpreter
+{
+namespace
+{
+
+struct AddOneModule
+{
+  std::unique_ptr<luci::Module> module = std::make_unique<luci::Module>();
+  luci::CircleInput *input = nullptr;
+  luci::CircleOutput *output = nullptr;
+};
+
+// Input [4] -- Add (+1) -- Output [4]
+AddOneModule makeAddOneModule()
+{
+  AddOneModule result;
+
+  auto g = loco::make_graph();
+
+  auto graph_input = g->inputs()->create();
+  result.input = g->nodes()->create<luci::CircleInput>();
+  result.input->index(graph_input->index());
+  result.input->dtype(loco::DataType::FLOAT32);
+  result.input->rank(1);
+  result.input->dim(0) = 4;
+
+  auto one = g->nodes()->create<luci::CircleConst>();
+  one->dtype(loco::DataType::FLOAT32);
+  one->rank(1);
+  one->dim(0) = 4;
+  one->size<loco::DataType::FLOAT32>(4);
+  for (uint32_t i = 0; i < 4; ++i)
+    one->at<loco::DataType::FLOAT32>(i) = 1.0f;
+
+  auto add = g->nodes()->create<luci::CircleAdd>();
+  add->x(result.input);
+  add->y(one);
+  add->fusedActivationFunction(luci::FusedActFunc::NONE);
+  add->dtype(loco::DataType::FLOAT32);
+
+  auto graph_output = g->outputs()->create();
+  result.output = g->nodes()->create<luci::CircleOutput>();
+  result.output->index(graph_output->index());
+  result.output->from(add);
+
+  result.module->add(std::move(g));
+  return result;
+}
+
+// Counts the operators executed
+struct CountObserver : public ExecutionObserver
+{
+  void postOperatorExecute(const luci::CircleNode *) override { ++count; }
+  void merge(const CountObserver &other) { count += other.count; }
+
+  size_t count = 0;
+};
+
+TEST(BatchInterpreterTest, Run)
+{
+  auto add_one = makeAddOneModule();
+
+  const size_t num_samples = 100;
+  BatchInterpreter batch(add_one.module.get(), 4);
+  ASSERT_EQ(batch.num_workers(), 4);
+
+  WorkerObservers<CountObserver> observers(batch);
+
+  std::vector<std::array<float, 4>> results(num_samples);
+  batch.run(num_samples,
+            [&](Interpreter &interpreter, size_t sample) {
+              std::array<float, 4> input;
+              input.fill(static_cast<float>(sample));
+              interpreter.writeInputTensor(add_one.input, input.data(), sizeof(input));
+            },
+            [&](Interpreter &interpreter, size_t sample) {
+              interpreter.readOutputTensor(add_one.output, results[sample].data(),
+                                           sizeof(results[sample]));
+            });
+
+  for (size_t sample = 0; sample < num_samples; ++sample)
+  {
+    for (float value : results[sample])
+      EXPECT_FLOAT_EQ(value, sample + 1.0f);
+  }
+
+  CountObserver merged;
+  observers.mergeInto(merged);
+  EXPECT_EQ(merged.count, num_samples);
+}
+
+TEST(BatchInterpreterTest, Error_NEG)
+{
+  auto add_one = makeAddOneModule();
+
+  BatchInterpreter batch(add_one.module.get(), 2);
+  EXPECT_THROW(batch.run(10,
+                         [](Interpreter &, size_t sample) {
+                           if (sample == 5)
+                             throw std::runtime_error("Invalid sample");
+                         }),
+               std::runtime_error);
+}
+
+} // namespace
+} // namespace luci_interpreter
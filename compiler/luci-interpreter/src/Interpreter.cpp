@@ -18,10 +18,13 @@
 
 #include "TensorMap.h"
 #include "KernelBuilder.h"
+#include "core/MemoryPlanner.h"
 
 #include <loco/IR/Algorithm.h>
 
+#include <algorithm>
 #include <stdexcept>
+#include <unordered_map>
 
 namespace luci_interpreter
 {
@@ -97,9 +100,17 @@ void Interpreter::createTensors(const loco::Graph *graph)
 
     if (const auto *const_node = dynamic_cast<const luci::CircleConst *>(node))
     {
+      // Constant tensors refer to the data of the module, which is shared by all the interpreters
+      // of the module. Kernels never write to their input tensors.
       size_t data_size{};
       const void *const_data = getNodeData(const_node, &data_size);
-      tensor->writeData(const_data, data_size);
+      assert(data_size == tensor->byte_size());
+      tensor->setExternalData(static_cast<uint8_t *>(const_cast<void *>(const_data)));
+    }
+    else if (node->opcode() != luci::CircleOpcode::CIRCLEINPUT)
+    {
+      // Intermediate tensors get memory from the planned arena after kernels are configured.
+      tensor->setExternalData(nullptr);
     }
 
     _tensor_map->setTensor(node, std::move(tensor));
@@ -124,7 +135,49 @@ void Interpreter::createExecutionSequence(const loco::Graph *main_graph)
     }
 
     _execution_sequence.push_back(node->accept(&kernel_builder));
+    _execution_nodes.push_back(node);
+  }
+}
+
+void Interpreter::planMemory()
+{
+  std::unordered_map<const loco::Node *, size_t> steps;
+  for (size_t i = 0; i < _execution_nodes.size(); ++i)
+  {
+    steps.emplace(_execution_nodes[i], i);
+  }
+  // Graph outputs are read after the last step.
+  const size_t end_step = _execution_nodes.size();
+
+  _memory_planner = std::make_unique<MemoryPlanner>();
+  for (size_t i = 0; i < _execution_nodes.size(); ++i)
+  {
+    const luci::CircleNode *node = _execution_nodes[i];
+
+    size_t last_use = i;
+    for (const loco::Node *user : loco::succs(node))
+    {
+      const auto *user_node = dynamic_cast<const luci::CircleNode *>(user);
+      assert(user_node != nullptr);
+      if (user_node->opcode() == luci::CircleOpcode::CIRCLEOUTPUT)
+      {
+        last_use = end_step;
+        continue;
+      }
+      const auto it = steps.find(user);
+      if (it != steps.cend())
+      {
+        last_use = std::max(last_use, it->second);
+      }
+    }
+    _memory_planner->addTensor(_tensor_map->getTensor(node), i, last_use);
+
+    for (Tensor *scratch : _execution_sequence[i]->getScratchTensors())
+    {
+      _memory_planner->addTensor(scratch, i, i);
+    }
   }
+  _memory_planner->allocate();
 }
 
 Interpreter::Interpreter(const luci::Module *module)
@@ -144,6 +197,8 @@ Interpreter::Interpreter(const luci::Module *module)
   {
     kernel->configure();
   }
+
+  planMemory();
 }
 
 Interpreter::~Interpreter() = default;
@@ -158,6 +213,11 @@ void Interpreter::writeInputTensor(const luci::CircleInput *input_node, const vo
     throw std::runtime_error("Cannot find tensor for input node named \"" + name + "\".");
   }
   tensor->writeData(data, data_size);
+
+  for (ExecutionObserver *observer : _observers)
+  {
+    observer->postTensorWrite(input_node, tensor);
+  }
 }
 
 void Interpreter::readOutputTensor(const luci::CircleOutput *output_node, void *data,
@@ -174,10 +234,38 @@ void Interpreter::readOutputTensor(const luci::CircleOutput *output_node, void *
 
 void Interpreter::interpret()
 {
-  for (const auto &kernel : _execution_sequence)
+  for (size_t i = 0; i < _execution_sequence.size(); ++i)
   {
-    kernel->execute();
+    const luci::CircleNode *node = _execution_nodes[i];
+
+    for (ExecutionObserver *observer : _observers)
+    {
+      observer->preOperatorExecute(node);
+    }
+
+    _execution_sequence[i]->execute();
+
+    for (ExecutionObserver *observer : _observers)
+    {
+      observer->postOperatorExecute(node);
+      observer->postTensorWrite(node, _tensor_map->getTensor(node));
+    }
   }
 }
 
+void Interpreter::attachObserver(ExecutionObserver *observer)
+{
+  if (std::find(_observers.cbegin(), _observers.cend(), observer) != _observers.cend())
+    throw std::runtime_error("Observer is already attached.");
+  _observers.push_back(observer);
+}
+
+ExecutionObserver::~ExecutionObserver() = default;
+
+void ExecutionObserver::postTensorWrite(const luci::CircleNode *, const Tensor *) {}
+
+void ExecutionObserver::preOperatorExecute(const luci::CircleNode *) {}
+
+void ExecutionObserver::postOperatorExecute(const luci::CircleNode *) {}
+
 } // namespace luci_interpreter
@@ -17,6 +17,10 @@
 #ifndef LUCI_INTERPRETER_CORE_KERNEL_H
 #define LUCI_INTERPRETER_CORE_KERNEL_H
 
+#include "luci_interpreter/core/Tensor.h"
+
+#include <vector>
+
 namespace luci_interpreter
 {
 
@@ -33,6 +37,10 @@ public:
 
   // Executes the kernel.
   virtual void execute() const = 0;
+
+  // Returns temporary tensors (e.g. im2col buffer) which are used only during 'execute'.
+  // Their memory may be shared with other tensors which are not in use at that time.
+  virtual std::vector<Tensor *> getScratchTensors() const { return {}; }
 };
 
 // Base class for kernels with parameters.
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/MemoryPlanner.h"
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+namespace luci_interpreter
+{
+
+constexpr size_t MemoryPlanner::kAlignment;
+
+static size_t alignSize(size_t size)
+{
+  return (size + MemoryPlanner::kAlignment - 1) / MemoryPlanner::kAlignment *
+         MemoryPlanner::kAlignment;
+}
+
+void MemoryPlanner::addTensor(Tensor *tensor, size_t first_use, size_t last_use)
+{
+  assert(tensor != nullptr);
+  if (first_use > last_use)
+    throw std::invalid_argument("Invalid tensor lifetime.");
+
+  _usages.push_back({tensor, first_use, last_use, alignSize(tensor->byte_size()), 0});
+}
+
+void MemoryPlanner::allocate()
+{
+  std::vector<Usage *> order;
+  order.reserve(_usages.size());
+  for (Usage &usage : _usages)
+    order.push_back(&usage);
+
+  std::stable_sort(order.begin(), order.end(),
+                   [](const Usage *a, const Usage *b) { return a->size > b->size; });
+
+  std::vector<const Usage *> placed;
+  _arena_size = 0;
+  for (Usage *usage : order)
+  {
+    // Tensors in use at the same time, in the order of offset
+    std::vector<const Usage *> live;
+    for (const Usage *other : placed)
+    {
+      if (other->first_use <= usage->last_use && usage->first_use <= other->last_use)
+        live.push_back(other);
+    }
+    std::sort(live.begin(), live.end(),
+              [](const Usage *a, const Usage *b) { return a->offset < b->offset; });
+
+    // Take the first gap which is large enough
+    size_t offset = 0;
+    for (const Usage *other : live)
+    {
+      if (other->offset >= offset + usage->size)
+        break;
+      offset = std::max(offset, other->offset + other->size);
+    }
+
+    usage->offset = offset;
+    _arena_size = std::max(_arena_size, offset + usage->size);
+    placed.push_back(usage);
+  }
+
+  _arena = std::make_unique<uint8_t[]>(_arena_size);
+  for (const Usage &usage : _usages)
+    usage.tensor->setExternalData(_arena.get() + usage.offset);
+}
+
+} // namespace luci_interpreter
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LUCI_INTERPRETER_CORE_MEMORYPLANNER_H
+#define LUCI_INTERPRETER_CORE_MEMORYPLANNER_H
+
+#include "luci_interpreter/core/Tensor.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace luci_interpreter
+{
+
+// Places tensors in a single arena so that tensors which are not in use at the same time share
+// memory.
+//
+// The lifetime of a tensor is a range of execution steps. Offsets are assigned greedily, from
+// the largest tensor to the smallest, at the lowest offset which does not overlap any tensor
+// already placed with an overlapping lifetime.
+class MemoryPlanner
+{
+public:
+  // Offsets in the arena are multiples of this.
+  static constexpr size_t kAlignment = 16;
+
+  // Adds a tensor which is in use from step 'first_use' to step 'last_use' (both inclusive).
+  // The tensor must have its final shape.
+  void addTensor(Tensor *tensor, size_t first_use, size_t last_use);
+
+  // Allocates the arena and makes the tensors use it.
+  void allocate();
+
+  size_t arena_size() const { return _arena_size; }
+
+private:
+  struct Usage
+  {
+    Tensor *tensor;
+    size_t first_use;
+    size_t last_use;
+    size_t size;
+    size_t offset;
+  };
+
+  std::vector<Usage> _usages;
+  std::unique_ptr<uint8_t[]> _arena;
+  size_t _arena_size = 0;
+};
+
+} // namespace luci_interpreter
+
+#endif // LUCI_INTERPRETER_CORE_MEMORYPLANNER_H
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/MemoryPlanner.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <stdexcept>
+
+namespace luci_interpreter
+{
+namespace
+{
+
+Tensor makeTensor(int32_t num_elements)
+{
+  return Tensor(DataType::FLOAT32, Shape{num_elements}, {}, "");
+}
+
+bool overlap(const Tensor &a, const Tensor &b)
+{
+  const auto *a_begin = a.data<uint8_t>();
+  const auto *b_begin = b.data<uint8_t>();
+  return a_begin < b_begin + b.byte_size() && b_begin < a_begin + a.byte_size();
+}
+
+TEST(MemoryPlannerTest, Chain)
+{
+  // t0 -> t1 -> t2 -> t3, where each tensor is in use while the next one is computed
+  Tensor t0 = makeTensor(16);
+  Tensor t1 = makeTensor(32);
+  Tensor t2 = makeTensor(16);
+  Tensor t3 = makeTensor(32);
+
+  MemoryPlanner planner;
+  planner.addTensor(&t0, 0, 1);
+  planner.addTensor(&t1, 1, 2);
+  planner.addTensor(&t2, 2, 3);
+  planner.addTensor(&t3, 3, 3);
+  planner.allocate();
+
+  EXPECT_TRUE(t0.is_data_external());
+  EXPECT_FALSE(overlap(t0, t1));
+  EXPECT_FALSE(overlap(t1, t2));
+  EXPECT_FALSE(overlap(t2, t3));
+  // Only two tensors are in use at a time
+  EXPECT_EQ(planner.arena_size(), (32 + 16) * sizeof(float));
+}
+
+TEST(MemoryPlannerTest, Alignment)
+{
+  Tensor t0 = makeTensor(1);
+  Tensor t1 = makeTensor(3);
+
+  MemoryPlanner planner;
+  planner.addTensor(&t0, 0, 0);
+  planner.addTensor(&t1, 0, 0);
+  planner.allocate();
+
+  const auto distance = std::abs(t0.data<uint8_t>() - t1.data<uint8_t>());
+  EXPECT_EQ(static_cast<size_t>(distance), MemoryPlanner::kAlignment);
+  EXPECT_EQ(planner.arena_size(), 2 * MemoryPlanner::kAlignment);
+}
+
+TEST(MemoryPlannerTest, ResizeKeepsExternalData)
+{
+  Tensor t0 = makeTensor(4);
+  t0.setExternalData(nullptr);
+  t0.resize(Shape{8});
+
+  EXPECT_TRUE(t0.is_data_external());
+  EXPECT_EQ(t0.data<float>(), nullptr);
+}
+
+TEST(MemoryPlannerTest, InvalidLifetime_NEG)
+{
+  Tensor t0 = makeTensor(4);
+
+  MemoryPlanner planner;
+  EXPECT_THROW(planner.addTensor(&t0, 2, 1), std::invalid_argument);
+}
+
+} // namespace
+} // namespace luci_interpreter
@@ -14,7 +14,7 @@
  * limitations under the License.
  */
 
-#include "core/Tensor.h"
+#include "luci_interpreter/core/Tensor.h"
 
 #include <cstring>
 #include <stdexcept>
@@ -27,9 +27,8 @@ Tensor::Tensor(DataType element_type, Shape shape, AffineQuantization quantizati
     : _element_type(element_type), _shape(std::move(shape)), _quantization(std::move(quantization)),
       _name(std::move(name))
 {
-  const size_t element_size = getDataTypeSize(_element_type);
-  const int32_t num_elements = _shape.num_elements();
-  _data = std::make_unique<uint8_t[]>(num_elements * element_size);
+  _own_data = std::make_unique<uint8_t[]>(byte_size());
+  _data = _own_data.get();
 }
 
 void Tensor::readData(void *data_ptr, size_t data_size) const
@@ -57,9 +56,24 @@ void Tensor::writeData(const void *data_ptr, size_t data_size)
 void Tensor::resize(const Shape &new_shape)
 {
   _shape = new_shape;
+  if (is_data_external())
+    return;
+
+  _own_data = std::make_unique<uint8_t[]>(byte_size());
+  _data = _own_data.get();
+}
+
+size_t Tensor::byte_size() const
+{
   const size_t element_size = getDataTypeSize(_element_type);
   const int32_t num_elements = _shape.num_elements();
-  _data = std::make_unique<uint8_t[]>(num_elements * element_size);
+  return num_elements * element_size;
+}
+
+void Tensor::setExternalData(uint8_t *data)
+{
+  _own_data.reset();
+  _data = data;
 }
 
 } // namespace luci_interpreter
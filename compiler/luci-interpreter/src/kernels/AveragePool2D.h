@@ -19,7 +19,7 @@
 
 #include "core/Kernel.h"
 #include "core/KernelParams.h"
-#include "core/Tensor.h"
+#include "luci_interpreter/core/Tensor.h"
 
 namespace luci_interpreter
 {
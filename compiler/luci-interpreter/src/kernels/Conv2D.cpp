@@ -18,7 +18,7 @@
 
 #include "kernels/Utils.h"
 
-#include <tensorflow/lite/kernels/internal/reference/conv.h>
+#include <tensorflow/lite/kernels/internal/optimized/legacy_optimized_ops.h>
 
 #include <stdexcept>
 
@@ -27,6 +27,15 @@ namespace luci_interpreter
 namespace kernels
 {
 
+// gemmlowp context of the calling thread, which is shared by all the Conv2D kernels.
+// The context runs GEMM in the calling thread only. Interpreters running in parallel
+// do not share a context.
+static gemmlowp::GemmContext *getGemmLowpContext()
+{
+  static thread_local gemmlowp::GemmContext context;
+  return &context;
+}
+
 Conv2D::Conv2D(const Tensor *input, const Tensor *filter, const Tensor *bias, Tensor *output,
                const Conv2DParams &params)
     : KernelWithParams<Conv2DParams>(params), _input(input), _filter(filter), _bias(bias),
@@ -87,6 +96,31 @@ void Conv2D::configure()
                                   filter_width, output_width);
 
   _output->resize({batches, output_height, output_width, output_depth});
+
+  // The conditions should be the same as those of the optimized kernel.
+  const bool need_dilated_im2col =
+      _params.dilation_height_factor != 1 || _params.dilation_width_factor != 1;
+  const bool need_non_dilated_im2col = _params.stride_height != 1 || _params.stride_width != 1 ||
+                                       filter_height != 1 || filter_width != 1;
+  if (need_dilated_im2col || need_non_dilated_im2col)
+  {
+    const int32_t input_depth = input_shape.dim(3);
+    Shape im2col_shape{batches, output_height, output_width,
+                       input_depth * filter_height * filter_width};
+    _im2col = std::make_unique<Tensor>(_input->element_type(), std::move(im2col_shape),
+                                       AffineQuantization{}, "");
+  }
+  else
+  {
+    _im2col.reset();
+  }
+}
+
+std::vector<Tensor *> Conv2D::getScratchTensors() const
+{
+  if (_im2col == nullptr)
+    return {};
+  return {_im2col.get()};
 }
 
 void Conv2D::execute() const
@@ -124,10 +158,11 @@ void Conv2D::evalFloat() const
   params.float_activation_min = activation_min;
   params.float_activation_max = activation_max;
 
-  tflite::reference_ops::Conv(
-      params, getTensorShape(_input), getTensorData<float>(_input), getTensorShape(_filter),
-      getTensorData<float>(_filter), getTensorShape(_bias), getTensorData<float>(_bias),
-      getTensorShape(_output), getTensorData<float>(_output), tflite::RuntimeShape(), nullptr);
+  tflite::optimized_ops::Conv(params, getTensorShape(_input), getTensorData<float>(_input),
+                              getTensorShape(_filter), getTensorData<float>(_filter),
+                              getTensorShape(_bias), getTensorData<float>(_bias),
+                              getTensorShape(_output), getTensorData<float>(_output),
+                              getTensorShape(_im2col.get()), getTensorData<float>(_im2col.get()));
 }
 
 void Conv2D::evalQuantized() const
@@ -161,11 +196,12 @@ void Conv2D::evalQuantized() const
   params.quantized_activation_min = activation_min;
   params.quantized_activation_max = activation_max;
 
-  tflite::reference_ops::Conv(params, getTensorShape(_input), getTensorData<uint8_t>(_input),
+  tflite::optimized_ops::Conv(params, getTensorShape(_input), getTensorData<uint8_t>(_input),
                               getTensorShape(_filter), getTensorData<uint8_t>(_filter),
                               getTensorShape(_bias), getTensorData<int32_t>(_bias),
                               getTensorShape(_output), getTensorData<uint8_t>(_output),
-                              tflite::RuntimeShape(), nullptr, nullptr);
+                              getTensorShape(_im2col.get()), getTensorData<uint8_t>(_im2col.get()),
+                              getGemmLowpContext());
 }
 
 } // namespace kernels
@@ -19,7 +19,9 @@
 
 #include "core/Kernel.h"
 #include "core/KernelParams.h"
-#include "core/Tensor.h"
+#include "luci_interpreter/core/Tensor.h"
+
+#include <memory>
 
 namespace luci_interpreter
 {
@@ -35,6 +37,7 @@ public:
 
   void configure() override;
   void execute() const override;
+  std::vector<Tensor *> getScratchTensors() const override;
 
 private:
   void evalFloat() const;
@@ -45,6 +48,8 @@ private:
   const Tensor *const _filter;
   const Tensor *const _bias;
   Tensor *const _output;
+  // Patches of the input, which the optimized kernel multiplies with the filter as matrices.
+  std::unique_ptr<Tensor> _im2col;
   int32_t _padding_height{};
   int32_t _padding_width{};
 };
@@ -69,6 +69,48 @@ TEST(Conv2DTest, Float)
               ElementsAreArray(ArrayFloatNear(ref_output_data)));
 }
 
+TEST(Conv2DTest, FloatPointwise)
+{
+  // 1x1 filter with stride 1 is computed without im2col
+  Shape input_shape{1, 2, 2, 2};
+  Shape filter_shape{2, 1, 1, 2};
+  Shape bias_shape{2};
+  std::vector<float> input_data{
+      1, 2, 3, 4, // row = 0
+      5, 6, 7, 8, // row = 1
+  };
+  std::vector<float> filter_data{
+      1, -1,  // out = 0
+      2, 0.5, // out = 1
+  };
+  std::vector<float> bias_data{0.5, -1};
+  Tensor input_tensor = makeInputTensor<DataType::FLOAT32>(input_shape, input_data);
+  Tensor filter_tensor = makeInputTensor<DataType::FLOAT32>(filter_shape, filter_data);
+  Tensor bias_tensor = makeInputTensor<DataType::FLOAT32>(bias_shape, bias_data);
+  Tensor output_tensor = makeOutputTensor(DataType::FLOAT32);
+
+  Conv2DParams params{};
+  params.padding = Padding::VALID;
+  params.stride_height = 1;
+  params.stride_width = 1;
+  params.dilation_height_factor = 1;
+  params.dilation_width_factor = 1;
+  params.activation = Activation::NONE;
+
+  Conv2D kernel(&input_tensor, &filter_tensor, &bias_tensor, &output_tensor, params);
+  kernel.configure();
+  kernel.execute();
+
+  EXPECT_TRUE(kernel.getScratchTensors().empty());
+  std::vector<float> ref_output_data{
+      -0.5, 2,  -0.5, 7,  // row = 0
+      -0.5, 12, -0.5, 17, // row = 1
+  };
+  EXPECT_THAT(extractTensorData<float>(output_tensor),
+              ElementsAreArray(ArrayFloatNear(ref_output_data)));
+  EXPECT_EQ(output_tensor.shape(), (Shape{1, 2, 2, 2}));
+}
+
 } // namespace
 } // namespace kernels
 } // namespace luci_interpreter
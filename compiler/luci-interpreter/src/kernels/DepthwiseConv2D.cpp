@@ -18,8 +18,7 @@
 
 #include "kernels/Utils.h"
 
-#include <tensorflow/lite/kernels/internal/reference/depthwiseconv_float.h>
-#include <tensorflow/lite/kernels/internal/reference/depthwiseconv_uint8.h>
+#include <tensorflow/lite/kernels/internal/optimized/legacy_optimized_ops.h>
 
 #include <stdexcept>
 
@@ -128,7 +127,7 @@ void DepthwiseConv2D::evalFloat() const
   params.float_activation_min = activation_min;
   params.float_activation_max = activation_max;
 
-  tflite::reference_ops::DepthwiseConv(params, getTensorShape(_input), getTensorData<float>(_input),
+  tflite::optimized_ops::DepthwiseConv(params, getTensorShape(_input), getTensorData<float>(_input),
                                        getTensorShape(_filter), getTensorData<float>(_filter),
                                        getTensorShape(_bias), getTensorData<float>(_bias),
                                        getTensorShape(_output), getTensorData<float>(_output));
@@ -166,7 +165,7 @@ void DepthwiseConv2D::evalQuantized() const
   params.quantized_activation_min = activation_min;
   params.quantized_activation_max = activation_max;
 
-  tflite::reference_ops::DepthwiseConv(
+  tflite::optimized_ops::DepthwiseConv(
       params, getTensorShape(_input), getTensorData<uint8_t>(_input), getTensorShape(_filter),
       getTensorData<uint8_t>(_filter), getTensorShape(_bias), getTensorData<int32_t>(_bias),
       getTensorShape(_output), getTensorData<uint8_t>(_output));
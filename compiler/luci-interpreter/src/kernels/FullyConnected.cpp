@@ -18,7 +18,7 @@
 
 #include "kernels/Utils.h"
 
-#include <tensorflow/lite/kernels/internal/reference/fully_connected.h>
+#include <tensorflow/lite/kernels/internal/optimized/legacy_optimized_ops.h>
 
 #include <stdexcept>
 
@@ -70,7 +70,7 @@ void FullyConnected::evalFloat() const
   params.float_activation_max = activation_max;
   params.weights_format = tflite::FullyConnectedWeightsFormat::kDefault;
 
-  tflite::reference_ops::FullyConnected(
+  tflite::optimized_ops::FullyConnected(
       params, getTensorShape(_input), getTensorData<float>(_input), getTensorShape(_weights),
       getTensorData<float>(_weights), getTensorShape(_bias), getTensorData<float>(_bias),
       getTensorShape(_output), getTensorData<float>(_output));
@@ -18,7 +18,7 @@
 #define LUCI_INTERPRETER_KERNELS_RESHAPE_H
 
 #include "core/Kernel.h"
-#include "core/Tensor.h"
+#include "luci_interpreter/core/Tensor.h"
 
 namespace luci_interpreter
 {
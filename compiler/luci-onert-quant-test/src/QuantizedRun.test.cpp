@@ -0,0 +1,354 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <luci/CircleExporter.h>
+#include <luci/IR/CircleNodes.h>
+#include <luci/Pass/QuantizeWithMinMaxPass.h>
+
+#include <loco.h>
+
+#include <nnfw.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+
+// Shape of input in NHWC
+const uint32_t H = 4, W = 4, C = 2;
+// Number of output channels of Conv2D
+const uint32_t O = 3;
+
+const std::vector<float> kFilter{0.5f, -1.f, 0.25f, 0.75f, -0.5f, -0.25f};
+const std::vector<float> kBias{0.1f, -0.2f, 0.3f};
+const std::vector<float> kAddend{0.5f, -1.f, 0.25f};
+
+struct Graph
+{
+  std::unique_ptr<loco::Graph> g;
+  luci::CircleInput *input = nullptr;
+  luci::CircleConv2D *conv = nullptr;
+  luci::CircleAdd *add = nullptr;
+  luci::CircleMaxPool2D *maxpool = nullptr;
+  luci::CircleAveragePool2D *avgpool = nullptr;
+  luci::CircleSoftmax *softmax = nullptr;
+};
+
+luci::CircleConst *createConst(loco::Graph *g, const std::vector<uint32_t> &shape,
+                               const std::vector<float> &values)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::FLOAT32);
+  node->rank(shape.size());
+  for (uint32_t r = 0; r < shape.size(); ++r)
+    node->dim(r) = shape[r];
+  node->size<loco::DataType::FLOAT32>(values.size());
+  for (uint32_t i = 0; i < values.size(); ++i)
+    node->at<loco::DataType::FLOAT32>(i) = values[i];
+  return node;
+}
+
+// Graph: Softmax(AveragePool2D(MaxPool2D(Add(Conv2D(input), addend))))
+Graph createGraph(void)
+{
+  Graph t;
+  t.g = loco::make_graph();
+  auto g = t.g.get();
+
+  t.input = g->nodes()->create<luci::CircleInput>();
+  t.input->dtype(loco::DataType::FLOAT32);
+  t.input->name("input");
+  t.input->rank(4);
+  t.input->dim(0) = 1;
+  t.input->dim(1) = H;
+  t.input->dim(2) = W;
+  t.input->dim(3) = C;
+  auto graph_input = g->inputs()->create();
+  graph_input->name("input");
+  graph_input->dtype(loco::DataType::FLOAT32);
+  graph_input->shape({1, H, W, C});
+  luci::link(graph_input, t.input);
+
+  // 1x1 convolution
+  t.conv = g->nodes()->create<luci::CircleConv2D>();
+  t.conv->dtype(loco::DataType::FLOAT32);
+  t.conv->name("conv");
+  t.conv->input(t.input);
+  t.conv->filter(createConst(g, {O, 1, 1, C}, kFilter));
+  t.conv->bias(createConst(g, {O}, kBias));
+  t.conv->padding(luci::Padding::VALID);
+  t.conv->fusedActivationFunction(luci::FusedActFunc::NONE);
+
+  // Addend is broadcast to every pixel
+  t.add = g->nodes()->create<luci::CircleAdd>();
+  t.add->dtype(loco::DataType::FLOAT32);
+  t.add->name("add");
+  t.add->x(t.conv);
+  t.add->y(createConst(g, {O}, kAddend));
+  t.add->fusedActivationFunction(luci::FusedActFunc::NONE);
+
+  t.maxpool = g->nodes()->create<luci::CircleMaxPool2D>();
+  t.maxpool->dtype(loco::DataType::FLOAT32);
+  t.maxpool->name("maxpool");
+  t.maxpool->value(t.add);
+  t.maxpool->padding(luci::Padding::VALID);
+  t.maxpool->filter()->h(2);
+  t.maxpool->filter()->w(2);
+  t.maxpool->stride()->h(2);
+  t.maxpool->stride()->w(2);
+  t.maxpool->fusedActivationFunction(luci::FusedActFunc::NONE);
+
+  t.avgpool = g->nodes()->create<luci::CircleAveragePool2D>();
+  t.avgpool->dtype(loco::DataType::FLOAT32);
+  t.avgpool->name("avgpool");
+  t.avgpool->value(t.maxpool);
+  t.avgpool->padding(luci::Padding::VALID);
+  t.avgpool->filter()->h(2);
+  t.avgpool->filter()->w(2);
+  t.avgpool->stride()->h(2);
+  t.avgpool->stride()->w(2);
+  t.avgpool->fusedActivationFunction(luci::FusedActFunc::NONE);
+
+  t.softmax = g->nodes()->create<luci::CircleSoftmax>();
+  t.softmax->dtype(loco::DataType::FLOAT32);
+  t.softmax->name("softmax");
+  t.softmax->logits(t.avgpool);
+  t.softmax->beta(1.f);
+
+  auto output = g->nodes()->create<luci::CircleOutput>();
+  output->dtype(loco::DataType::FLOAT32);
+  output->from(t.softmax);
+  auto graph_output = g->outputs()->create();
+  graph_output->name("output");
+  graph_output->dtype(loco::DataType::FLOAT32);
+  graph_output->shape({1, 1, 1, O});
+  luci::link(graph_output, output);
+
+  return t;
+}
+
+std::vector<float> inputValues(void)
+{
+  std::vector<float> input(H * W * C);
+  for (uint32_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>(static_cast<int>(i * 7 % 13) - 6) / 4.f;
+  return input;
+}
+
+// Values of activations computed in float32, which are used for calibration as well
+struct Activations
+{
+  std::vector<float> conv;
+  std::vector<float> add;
+  std::vector<float> output;
+};
+
+Activations reference(const std::vector<float> &input)
+{
+  Activations act;
+  act.conv.resize(H * W * O);
+  act.add.resize(H * W * O);
+  for (uint32_t p = 0; p < H * W; ++p)
+  {
+    for (uint32_t o = 0; o < O; ++o)
+    {
+      float acc = kBias[o];
+      for (uint32_t c = 0; c < C; ++c)
+        acc += input[p * C + c] * kFilter[o * C + c];
+      act.conv[p * O + o] = acc;
+      act.add[p * O + o] = acc + kAddend[o];
+    }
+  }
+
+  // MaxPool2D of 2x2 gives 2x2 pixels, which AveragePool2D of 2x2 averages
+  std::vector<float> logits(O, 0.f);
+  for (uint32_t y = 0; y < H; y += 2)
+  {
+    for (uint32_t x = 0; x < W; x += 2)
+    {
+      for (uint32_t o = 0; o < O; ++o)
+      {
+        float max = act.add[(y * W + x) * O + o];
+        for (uint32_t dy = 0; dy < 2; ++dy)
+          for (uint32_t dx = 0; dx < 2; ++dx)
+            max = std::max(max, act.add[((y + dy) * W + x + dx) * O + o]);
+        logits[o] += max / 4;
+      }
+    }
+  }
+
+  const float max_logit = *std::max_element(logits.begin(), logits.end());
+  float sum = 0.f;
+  act.output.resize(O);
+  for (uint32_t o = 0; o < O; ++o)
+  {
+    act.output[o] = std::exp(logits[o] - max_logit);
+    sum += act.output[o];
+  }
+  for (auto &value : act.output)
+    value /= sum;
+  return act;
+}
+
+void setMinMax(luci::CircleNode *node, const std::vector<float> &values)
+{
+  const auto minmax = std::minmax_element(values.begin(), values.end());
+  auto quantparam = std::make_unique<luci::CircleQuantParam>();
+  quantparam->min = {*minmax.first};
+  quantparam->max = {*minmax.second};
+  node->quantparam(std::move(quantparam));
+}
+
+class FileContract final : public luci::CircleExporter::Contract
+{
+public:
+  FileContract(loco::Graph *graph, const std::string &path) : _graph{graph}, _path{path}
+  {
+    // DO NOTHING
+  }
+
+public:
+  loco::Graph *graph(void) const final { return _graph; }
+
+  bool store(const char *ptr, const size_t size) const final
+  {
+    std::ofstream fs(_path, std::ofstream::binary);
+    fs.write(ptr, size);
+    return fs.good();
+  }
+
+private:
+  loco::Graph *_graph;
+  std::string _path;
+};
+
+// nnpackage of a circle model in a temporary directory
+class NNPackage
+{
+public:
+  explicit NNPackage(loco::Graph *graph) : _dir{"luci_onert_quant_test_XXXXXX"}
+  {
+    if (mkdtemp(&_dir[0]) == nullptr || mkdir(metadata_dir().c_str(), 0700) != 0)
+      throw std::runtime_error("Failed to create a temporary nnpackage");
+
+    FileContract contract(graph, model_path());
+    luci::CircleExporter exporter;
+    if (!exporter.invoke(&contract))
+      throw std::runtime_error("Failed to export a circle model");
+
+    std::ofstream manifest(manifest_path());
+    manifest << R"({ "major-version" : "1", "minor-version" : "0", "patch-version" : "0", )"
+             << R"("models" : [ "model.circle" ], "model-types" : [ "circle" ] })";
+  }
+
+  ~NNPackage()
+  {
+    std::remove(manifest_path().c_str());
+    std::remove(model_path().c_str());
+    rmdir(metadata_dir().c_str());
+    rmdir(_dir.c_str());
+  }
+
+public:
+  const std::string &path(void) const { return _dir; }
+
+private:
+  std::string metadata_dir(void) const { return _dir + "/metadata"; }
+  std::string manifest_path(void) const { return metadata_dir() + "/MANIFEST"; }
+  std::string model_path(void) const { return _dir + "/model.circle"; }
+
+private:
+  std::string _dir;
+};
+
+// Run the nnpackage on cpu backend of onert
+template <typename T>
+std::vector<T> run(const NNPackage &package, NNFW_TYPE type, const std::vector<T> &input)
+{
+  nnfw_session *session = nullptr;
+  EXPECT_EQ(nnfw_create_session(&session), NNFW_STATUS_NO_ERROR);
+  EXPECT_EQ(nnfw_load_model_from_file(session, package.path().c_str()), NNFW_STATUS_NO_ERROR);
+  EXPECT_EQ(nnfw_set_available_backends(session, "cpu"), NNFW_STATUS_NO_ERROR);
+  EXPECT_EQ(nnfw_prepare(session), NNFW_STATUS_NO_ERROR);
+
+  std::vector<T> output(O);
+  EXPECT_EQ(nnfw_set_input(session, 0, type, input.data(), input.size() * sizeof(T)),
+            NNFW_STATUS_NO_ERROR);
+  EXPECT_EQ(nnfw_set_output(session, 0, type, output.data(), output.size() * sizeof(T)),
+            NNFW_STATUS_NO_ERROR);
+  EXPECT_EQ(nnfw_run(session), NNFW_STATUS_NO_ERROR);
+  EXPECT_EQ(nnfw_close_session(session), NNFW_STATUS_NO_ERROR);
+  return output;
+}
+
+} // namespace
+
+TEST(LuciOnertQuantTest, float32)
+{
+  const auto input = inputValues();
+  const auto expected = reference(input).output;
+
+  auto t = createGraph();
+  NNPackage package(t.g.get());
+  const auto output = run(package, NNFW_TYPE_TENSOR_FLOAT32, input);
+
+  for (uint32_t o = 0; o < O; ++o)
+    EXPECT_NEAR(output[o], expected[o], 1e-5f) << "at " << o;
+}
+
+TEST(LuciOnertQuantTest, int8_same_as_float32)
+{
+  const auto input = inputValues();
+  const auto act = reference(input);
+
+  // Calibrate with the input itself, where MaxPool2D, AveragePool2D and Softmax take fixed ones
+  auto t = createGraph();
+  setMinMax(t.input, input);
+  setMinMax(t.conv, act.conv);
+  setMinMax(t.add, act.add);
+
+  luci::QuantizeWithMinMaxPass pass(loco::DataType::FLOAT32, loco::DataType::S8);
+  ASSERT_TRUE(pass.run(t.g.get()));
+  ASSERT_EQ(t.input->dtype(), loco::DataType::S8);
+  ASSERT_EQ(t.softmax->dtype(), loco::DataType::S8);
+
+  const float input_scale = t.input->quantparam()->scale.at(0);
+  const auto input_zerop = t.input->quantparam()->zerop.at(0);
+  std::vector<int8_t> quantized_input(input.size());
+  for (uint32_t i = 0; i < input.size(); ++i)
+  {
+    const auto quantized = std::round(input[i] / input_scale) + input_zerop;
+    quantized_input[i] = static_cast<int8_t>(std::min(std::max(quantized, -128.f), 127.f));
+  }
+
+  NNPackage package(t.g.get());
+  const auto output = run(package, NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED, quantized_input);
+
+  // Output of Softmax is of scale 1/256 and zero point -128
+  for (uint32_t o = 0; o < O; ++o)
+    EXPECT_NEAR((output[o] + 128) / 256.f, act.output[o], 0.02f) << "at " << o;
+}
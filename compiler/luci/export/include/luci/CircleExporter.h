@@ -49,6 +49,17 @@ public:
     // Exporter calls store for export data
     // Notice: Please DO NOT STORE ptr and size when implementing this in Client
     virtual bool store(const char *ptr, const size_t size) const = 0;
+
+  public: // Client -> Exporter
+    // Exporter stores data of constants after the flatbuffer rather than in it, if this is true.
+    // Then models can be larger than the limit of flatbuffers (2GB) and exporter does not hold
+    // another copy of constants in memory.
+    virtual bool external_buffers(void) const { return false; }
+
+  public: // Exporter -> Client
+    // Exporter calls append after store for data following the flatbuffer, chunk by chunk
+    // Notice: Please DO NOT STORE ptr and size when implementing this in Client
+    virtual bool append(const char *, const size_t) const { return false; }
   };
 
 public:
@@ -20,9 +20,42 @@
 
 #include <oops/InternalExn.h>
 
+#include <cassert>
 #include <fstream>
 #include <memory>
 
+namespace
+{
+
+bool store(const luci::CircleExporterImpl &impl, luci::CircleExporter::Contract *contract)
+{
+  const char *ptr = impl.getBufferPointer();
+  const size_t size = impl.getBufferSize();
+
+  if (!contract->store(ptr, size))
+    return false;
+
+  // Data of constants follows with padding for alignment, which are streamed one by one
+  static const char padding[64] = {0};
+  uint64_t written = size;
+  for (const auto &external : impl.getExternalBuffers())
+  {
+    assert(external.offset >= written && external.offset - written <= sizeof(padding));
+    if (external.offset > written &&
+        !contract->append(padding, static_cast<size_t>(external.offset - written)))
+      return false;
+
+    if (!contract->append(reinterpret_cast<const char *>(external.data),
+                          static_cast<size_t>(external.size)))
+      return false;
+    written = external.offset + external.size;
+  }
+
+  return true;
+}
+
+} // namespace
+
 namespace luci
 {
 
@@ -39,26 +72,18 @@ bool CircleExporter::invoke(Contract *contract) const
   auto module = contract->module();
   if (module != nullptr)
   {
-    CircleExporterImpl impl(module);
+    CircleExporterImpl impl(module, contract->external_buffers());
 
-    const char *ptr = impl.getBufferPointer();
-    const size_t size = impl.getBufferSize();
-
-    // we just send one time
-    return contract->store(ptr, size);
+    return store(impl, contract);
   }
 
   auto graph = contract->graph();
   if (graph == nullptr)
     return false;
 
-  CircleExporterImpl impl(graph);
-
-  const char *ptr = impl.getBufferPointer();
-  const size_t size = impl.getBufferSize();
+  CircleExporterImpl impl(graph, contract->external_buffers());
 
-  // we just send one time
-  return contract->store(ptr, size);
+  return store(impl, contract);
 }
 
 } // namespace luci
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/CircleExporter.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/Importer.h>
+
+#include <mio/circle/schema_generated.h>
+
+#include <loco.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+
+class TestContract final : public luci::CircleExporter::Contract
+{
+public:
+  TestContract(loco::Graph *graph, bool external_buffers)
+      : _graph{graph}, _external_buffers{external_buffers}
+  {
+    // DO NOTHING
+  }
+
+public:
+  loco::Graph *graph(void) const final { return _graph; }
+
+  bool store(const char *ptr, const size_t size) const final
+  {
+    _data.assign(ptr, ptr + size);
+    _model_size = size;
+    return true;
+  }
+
+  bool external_buffers(void) const final { return _external_buffers; }
+
+  bool append(const char *ptr, const size_t size) const final
+  {
+    _data.insert(_data.end(), ptr, ptr + size);
+    return true;
+  }
+
+public:
+  const std::vector<char> &data(void) const { return _data; }
+  size_t model_size(void) const { return _model_size; }
+
+private:
+  loco::Graph *_graph;
+  bool _external_buffers;
+  mutable std::vector<char> _data;
+  mutable size_t _model_size = 0;
+};
+
+const uint32_t N = 5;
+
+luci::CircleConst *createConst(loco::Graph *g, float base)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::FLOAT32);
+  node->rank(1);
+  node->dim(0) = N;
+  node->size<loco::DataType::FLOAT32>(N);
+  for (uint32_t i = 0; i < N; ++i)
+    node->at<loco::DataType::FLOAT32>(i) = base + i;
+  return node;
+}
+
+// Graph: output = Add(Add(input, const_1), const_2)
+std::unique_ptr<loco::Graph> createGraph(void)
+{
+  auto g = loco::make_graph();
+
+  auto input = g->nodes()->create<luci::CircleInput>();
+  input->dtype(loco::DataType::FLOAT32);
+  input->rank(2);
+  input->dim(0) = 1;
+  input->dim(1) = N;
+  auto graph_input = g->inputs()->create();
+  graph_input->name("input");
+  graph_input->dtype(loco::DataType::FLOAT32);
+  graph_input->shape({1, N});
+  luci::link(graph_input, input);
+
+  auto add_1 = g->nodes()->create<luci::CircleAdd>();
+  add_1->x(input);
+  add_1->y(createConst(g.get(), 1.f));
+  add_1->fusedActivationFunction(luci::FusedActFunc::NONE);
+
+  auto add_2 = g->nodes()->create<luci::CircleAdd>();
+  add_2->x(add_1);
+  add_2->y(createConst(g.get(), -10.f));
+  add_2->fusedActivationFunction(luci::FusedActFunc::NONE);
+
+  auto output = g->nodes()->create<luci::CircleOutput>();
+  output->from(add_2);
+  auto graph_output = g->outputs()->create();
+  graph_output->name("output");
+  graph_output->dtype(loco::DataType::FLOAT32);
+  graph_output->shape({1, N});
+  luci::link(graph_output, output);
+
+  return g;
+}
+
+// Return values of constants of the graph imported from the exported data
+std::vector<std::vector<float>> importConsts(const std::vector<char> &data)
+{
+  auto model = circle::GetModel(data.data());
+  luci::Importer importer;
+  importer.model_file(reinterpret_cast<const uint8_t *>(data.data()), data.size());
+  auto g = importer.import(model);
+
+  std::vector<std::vector<float>> consts;
+  for (auto node : loco::all_nodes(g.get()))
+  {
+    auto const_node = dynamic_cast<luci::CircleConst *>(node);
+    if (const_node == nullptr)
+      continue;
+
+    std::vector<float> values;
+    for (uint32_t i = 0; i < const_node->size<loco::DataType::FLOAT32>(); ++i)
+      values.push_back(const_node->at<loco::DataType::FLOAT32>(i));
+    consts.push_back(values);
+  }
+  // NOTE all_nodes does not keep the order of nodes
+  std::sort(consts.begin(), consts.end());
+  return consts;
+}
+
+} // namespace
+
+TEST(CircleExporterTest, external_buffers)
+{
+  auto g = createGraph();
+  TestContract contract(g.get(), true);
+  luci::CircleExporter exporter;
+  ASSERT_TRUE(exporter.invoke(&contract));
+
+  const auto &data = contract.data();
+  flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t *>(data.data()),
+                                 contract.model_size());
+  ASSERT_TRUE(circle::VerifyModelBuffer(verifier));
+
+  // Placeholders of offset are replaced with locations after the flatbuffer, aligned at 64 bytes
+  auto model = circle::GetModel(data.data());
+  uint32_t num_external = 0;
+  for (const auto buffer : *model->buffers())
+  {
+    if (buffer->offset() == 0)
+      continue;
+
+    ++num_external;
+    EXPECT_EQ(buffer->data(), nullptr);
+    EXPECT_GE(buffer->offset(), contract.model_size());
+    EXPECT_EQ(buffer->offset() % 64, 0);
+    EXPECT_EQ(buffer->size(), N * sizeof(float));
+    EXPECT_LE(buffer->offset() + buffer->size(), data.size());
+  }
+  EXPECT_EQ(num_external, 2);
+
+  const auto consts = importConsts(data);
+  ASSERT_EQ(consts.size(), 2);
+  for (const auto &values : consts)
+  {
+    ASSERT_EQ(values.size(), N);
+    const float base = values[0];
+    EXPECT_TRUE(base == 1.f || base == -10.f);
+    for (uint32_t i = 0; i < N; ++i)
+      EXPECT_EQ(values[i], base + i);
+  }
+}
+
+TEST(CircleExporterTest, external_buffers_same_as_inline)
+{
+  // NOTE A graph is exported only once as its nodes are annotated by exporter
+  auto inline_graph = createGraph();
+  auto external_graph = createGraph();
+  TestContract inline_contract(inline_graph.get(), false);
+  TestContract external_contract(external_graph.get(), true);
+  luci::CircleExporter exporter;
+  ASSERT_TRUE(exporter.invoke(&inline_contract));
+  ASSERT_TRUE(exporter.invoke(&external_contract));
+
+  // The whole model is in the flatbuffer
+  EXPECT_EQ(inline_contract.data().size(), inline_contract.model_size());
+  EXPECT_GT(external_contract.data().size(), external_contract.model_size());
+
+  EXPECT_EQ(importConsts(inline_contract.data()), importConsts(external_contract.data()));
+}
@@ -134,8 +134,17 @@ namespace luci
 using namespace circle;
 using namespace flatbuffers;
 
-CircleExporterImpl::CircleExporterImpl(loco::Graph *graph) { exportGraph(graph); }
-CircleExporterImpl::CircleExporterImpl(Module *module) { exportModule(module); }
+CircleExporterImpl::CircleExporterImpl(loco::Graph *graph, bool external_buffers)
+    : _external_buffers_enabled{external_buffers}
+{
+  exportGraph(graph);
+}
+
+CircleExporterImpl::CircleExporterImpl(Module *module, bool external_buffers)
+    : _external_buffers_enabled{external_buffers}
+{
+  exportModule(module);
+}
 
 ::flatbuffers::Offset<::circle::SubGraph>
 CircleExporterImpl::exportSubgraph(SerializedGraphData &gd)
@@ -163,6 +172,8 @@ void CircleExporterImpl::exportGraph(loco::Graph *graph)
   SerializedModelData md;
   SerializedGraphData gd;
 
+  md._external_buffers = _external_buffers_enabled;
+
   // This version is taken from comment in fbs
   constexpr uint32_t version = 0;
 
@@ -207,6 +218,8 @@ void CircleExporterImpl::exportGraph(loco::Graph *graph)
   auto model_offset = CreateModel(_builder, version, operator_codes, subgraphs, description,
                                   buffers, metadata_buffer);
   FinishModelBuffer(_builder, model_offset);
+
+  locateExternalBuffers(md);
 }
 
 void CircleExporterImpl::exportModule(Module *module)
@@ -216,6 +229,8 @@ void CircleExporterImpl::exportModule(Module *module)
 
   SerializedModelData md;
 
+  md._external_buffers = _external_buffers_enabled;
+
   _builder.Clear();
 
   // prepare model data
@@ -278,6 +293,31 @@ void CircleExporterImpl::exportModule(Module *module)
   auto model_offset = CreateModel(_builder, version, operator_codes, subgraphs, description,
                                   buffers, metadata_buffer);
   FinishModelBuffer(_builder, model_offset);
+
+  locateExternalBuffers(md);
+}
+
+void CircleExporterImpl::locateExternalBuffers(SerializedModelData &md)
+{
+  _external_buffers.clear();
+
+  // Data is stored after the buffer, each of which is aligned for mapping in memory
+  constexpr uint64_t alignment = 64;
+  uint64_t offset = _builder.GetSize();
+  for (auto &external : md._external_buffer_data)
+  {
+    offset = (offset + alignment - 1) / alignment * alignment;
+    external.offset = offset;
+    offset += external.size;
+
+    // NOTE Offset is relative to the end of the buffer while it is built
+    auto buffer_ptr = _builder.GetBufferPointer() + _builder.GetSize() - external.buffer.o;
+    auto table = reinterpret_cast<flatbuffers::Table *>(buffer_ptr);
+    if (!table->SetField<uint64_t>(circle::Buffer::VT_OFFSET, external.offset, 0))
+      INTERNAL_EXN("Failed to update offset of buffer");
+
+    _external_buffers.push_back(external);
+  }
 }
 
 const char *CircleExporterImpl::getBufferPointer() const
@@ -22,8 +22,6 @@
 
 #include "SerializedData.h"
 
-#include "SerializedData.h"
-
 #include <mio/circle/schema_generated.h>
 
 #include <loco.h>
@@ -40,8 +38,12 @@ public:
   CircleExporterImpl() = delete;
   ~CircleExporterImpl() = default;
 
-  explicit CircleExporterImpl(loco::Graph *graph);
-  explicit CircleExporterImpl(Module *module);
+  /**
+   * @note  Data of constants is not serialized into the buffer but stored after it,
+   *        if external_buffers is true (see getExternalBuffers)
+   */
+  explicit CircleExporterImpl(loco::Graph *graph, bool external_buffers = false);
+  explicit CircleExporterImpl(Module *module, bool external_buffers = false);
 
   /**
    * @return pointer to buffer with serialized graph
@@ -53,6 +55,11 @@ public:
    */
   size_t getBufferSize() const;
 
+  /**
+   * @return data of constants to be stored after serialized graph, in the order of offset
+   */
+  const std::vector<ExternalBufferData> &getExternalBuffers() const { return _external_buffers; }
+
 private:
   /**
    * @brief create Subgraph using data stored in SerializedGraphData
@@ -73,8 +80,16 @@ private:
    */
   void exportModule(Module *module);
 
+  /**
+   * @brief locate data of constants after the finished buffer and update buffers referring to it
+   * @param md
+   */
+  void locateExternalBuffers(SerializedModelData &md);
+
 private:
   flatbuffers::FlatBufferBuilder _builder;
+  bool _external_buffers_enabled;
+  std::vector<ExternalBufferData> _external_buffers;
 };
 
 } // namespace luci
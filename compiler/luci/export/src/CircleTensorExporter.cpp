@@ -149,44 +149,58 @@ flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder)
 }
 
 template <typename NodeT>
-flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder, NodeT *)
+flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder,
+                                                   SerializedModelData &, NodeT *)
 {
   return CreateBuffer(builder);
 }
 
 template <loco::DataType DT>
-flatbuffers::Offset<circle::Buffer> encodeOpBufferByDType(FlatBufferBuilder &builder,
-                                                          luci::CircleConst *c)
+flatbuffers::Offset<circle::Buffer>
+encodeOpBufferByDType(FlatBufferBuilder &builder, SerializedModelData &md, luci::CircleConst *c)
 {
   using NativeType = typename loco::DataTypeImpl<DT>::Type;
 
-  std::vector<NativeType> raw_data;
-  const uint32_t size = c->size<DT>();
-  raw_data.reserve(size);
-  for (uint32_t i = 0; i < size; ++i)
+  // NOTE Read through const node not to copy external data of the node
+  const luci::CircleConst *const_node = c;
+  const uint32_t size = const_node->size<DT>();
+  const size_t raw_size = size * sizeof(NativeType);
+  const auto *raw_data =
+      size > 0 ? reinterpret_cast<const uint8_t *>(&const_node->at<DT>(0)) : nullptr;
+
+  if (md._external_buffers && raw_size > 0)
   {
-    raw_data.push_back(c->at<DT>(i));
+    // NOTE Offset is a placeholder to be updated when the flatbuffer is finished
+    ExternalBufferData external;
+    external.buffer = CreateBuffer(builder, 0, /*offset*/ 1, raw_size);
+    external.data = raw_data;
+    external.size = raw_size;
+    md._external_buffer_data.push_back(external);
+    return external.buffer;
   }
-  const size_t raw_size = size * sizeof(NativeType);
-  auto array_offset = builder.CreateVector(reinterpret_cast<uint8_t *>(raw_data.data()), raw_size);
+
+  auto array_offset = builder.CreateVector(raw_data, raw_size);
   return CreateBuffer(builder, array_offset);
 }
 
 template <>
-flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder, luci::CircleConst *c)
+flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder,
+                                                   SerializedModelData &md, luci::CircleConst *c)
 {
   switch (c->dtype())
   {
     case loco::DataType::FLOAT32:
-      return encodeOpBufferByDType<loco::DataType::FLOAT32>(builder, c);
+      return encodeOpBufferByDType<loco::DataType::FLOAT32>(builder, md, c);
     case loco::DataType::S32:
-      return encodeOpBufferByDType<loco::DataType::S32>(builder, c);
+      return encodeOpBufferByDType<loco::DataType::S32>(builder, md, c);
     case loco::DataType::S64:
-      return encodeOpBufferByDType<loco::DataType::S64>(builder, c);
+      return encodeOpBufferByDType<loco::DataType::S64>(builder, md, c);
     case loco::DataType::U8:
-      return encodeOpBufferByDType<loco::DataType::U8>(builder, c);
+      return encodeOpBufferByDType<loco::DataType::U8>(builder, md, c);
+    case loco::DataType::S8:
+      return encodeOpBufferByDType<loco::DataType::S8>(builder, md, c);
     case loco::DataType::BOOL:
-      return encodeOpBufferByDType<loco::DataType::BOOL>(builder, c);
+      return encodeOpBufferByDType<loco::DataType::BOOL>(builder, md, c);
     default:
       break;
   }
@@ -214,7 +228,9 @@ encodeQuantizationParameters(FlatBufferBuilder &builder, luci::CircleQuantParam
     scale = builder.CreateVector(quantparam->scale);
     zero_point = builder.CreateVector(quantparam->zerop);
   }
-  return circle::CreateQuantizationParameters(builder, min, max, scale, zero_point);
+  return circle::CreateQuantizationParameters(builder, min, max, scale, zero_point,
+                                              circle::QuantizationDetails_NONE, 0,
+                                              quantparam->quantized_dimension);
 }
 
 void exportOpDefinedTensor(const CircleTensoInfo &info, FlatBufferBuilder &builder,
@@ -224,8 +240,8 @@ void exportOpDefinedTensor(const CircleTensoInfo &info, FlatBufferBuilder &build
   auto shape_offset = encodeShape(builder, info.shape());
 
   // encode and register output tensor buffer
-  auto buffer =
-      info.content() == nullptr ? encodeOpBuffer(builder) : encodeOpBuffer(builder, info.content());
+  auto buffer = info.content() == nullptr ? encodeOpBuffer(builder)
+                                          : encodeOpBuffer(builder, md, info.content());
 
   auto quantparam = encodeQuantizationParameters(builder, info.quantparam());
 
@@ -63,6 +63,19 @@ struct SubGraphContext
   circle::DataFormat _data_format{circle::DataFormat::DataFormat_CHANNELS_LAST};
 };
 
+/**
+ * @brief Data of a buffer stored after the flatbuffer in the file, instead of in the flatbuffer
+ */
+struct ExternalBufferData
+{
+  /// @brief Buffer in the flatbuffer which refers to data
+  flatbuffers::Offset<circle::Buffer> buffer;
+  const uint8_t *data = nullptr;
+  uint64_t size = 0;
+  /// @brief Location of data from the beginning of the file
+  uint64_t offset = 0;
+};
+
 // Prerequisites for circle::Model object creation
 struct SerializedModelData final
 {
@@ -72,6 +85,9 @@ struct SerializedModelData final
   std::unordered_map<OpCode, uint32_t> _operator_codes;
   std::unordered_map<OpCode, std::string> _custom_operator_codes;
   std::vector<flatbuffers::Offset<circle::Buffer>> _buffers;
+  /// @brief Store data of constants out of the flatbuffer if true
+  bool _external_buffers = false;
+  std::vector<ExternalBufferData> _external_buffer_data;
 
   /**
    * @brief if opcode is not registered in table of opcodes add it
@@ -50,13 +50,26 @@ luci_quantparam(const circle::QuantizationParametersT *quantization);
 /// @brief Copy common tensor attributes such as name, type, etc. to node.
 void copy_tensor_attributes(const circle::TensorT &tensor, CircleNode *node);
 
+/**
+ * @brief Read-only view of data of a buffer in Circle file
+ */
+struct CircleBuffer
+{
+  const uint8_t *data = nullptr;
+  size_t size = 0;
+
+  bool empty() const { return size == 0; }
+};
+
 /**
  * @brief Loads Circle file and provides helpers to access attributes
+ *
+ * @note  Buffers are not unpacked, but read from Circle file directly
  */
 class CircleReader
 {
 private:
-  using CircleBuffers_t = std::vector<std::unique_ptr<circle::BufferT>>;
+  using CircleSubGraphs_t = std::vector<std::unique_ptr<circle::SubGraphT>>;
   using CircleTensors_t = std::vector<std::unique_ptr<circle::TensorT>>;
   using CircleOperators_t = std::vector<std::unique_ptr<circle::OperatorT>>;
   using CircleOperatorCodes_t = std::vector<std::unique_ptr<circle::OperatorCodeT>>;
@@ -65,26 +78,46 @@ public:
   CircleReader() = default;
 
 public:
-  const CircleOperatorCodes_t &opcodes() const { return _model->operator_codes; }
-  const CircleBuffers_t &buffers() const { return _model->buffers; }
+  const CircleOperatorCodes_t &opcodes() const { return _opcodes; }
+  CircleBuffer buffer(uint32_t index) const;
   const CircleTensors_t &tensors() const { return _current_subgraph->tensors; }
   const CircleOperators_t &operators() const { return _current_subgraph->operators; }
   const std::vector<int32_t> &inputs() const { return _current_subgraph->inputs; }
   const std::vector<int32_t> &outputs() const { return _current_subgraph->outputs; }
   const std::string &name() const { return _current_subgraph->name; }
 
-  uint32_t num_subgraph() const { return _model->subgraphs.size(); }
+  uint32_t num_subgraph() const { return _subgraphs.size(); }
 
   circle::BuiltinOperator builtin_code(const circle::OperatorT &op) const;
   std::string opcode_name(const circle::OperatorT &op) const;
 
+  /**
+   * @brief Whether CircleConst nodes refer to buffers of Circle file instead of copying them
+   */
+  bool share_buffers() const { return _share_buffers; }
+  void share_buffers(bool share) { _share_buffers = share; }
+
+  /**
+   * @brief Whole Circle file, where data of buffers out of the flatbuffer is located
+   */
+  void model_file(const uint8_t *data, size_t size)
+  {
+    _file_data = data;
+    _file_size = size;
+  }
+
 public:
   bool parse(const circle::Model *model);
   bool select_subgraph(uint32_t subgraph);
 
 private:
-  std::unique_ptr<const circle::ModelT> _model;
+  const circle::Model *_model{nullptr};
+  CircleOperatorCodes_t _opcodes;
+  CircleSubGraphs_t _subgraphs;
   const circle::SubGraphT *_current_subgraph{nullptr};
+  bool _share_buffers{false};
+  const uint8_t *_file_data{nullptr};
+  size_t _file_size{0};
 };
 
 } // namespace luci
@@ -41,12 +41,33 @@ public:
     // DO NOTHING
   }
 
+public:
+  /**
+   * @brief Let CircleConst nodes refer to buffers of the model instead of copying them
+   * @note  Then the model should outlive imported graphs, as a constant is copied from the model
+   *        only when it is modified
+   */
+  void share_buffers(bool share) { _share_buffers = share; }
+
+  /**
+   * @brief Set the whole file that the model is read from
+   * @note  This is required to import data of buffers stored after the flatbuffer in the file
+   */
+  void model_file(const uint8_t *data, size_t size)
+  {
+    _file_data = data;
+    _file_size = size;
+  }
+
 public:
   std::unique_ptr<loco::Graph> import(const circle::Model *model) const;
   std::unique_ptr<Module> importModule(const circle::Model *model) const;
 
 private:
   const GraphBuilderSource *_source = nullptr;
+  bool _share_buffers = false;
+  const uint8_t *_file_data = nullptr;
+  size_t _file_size = 0;
 };
 
 } // namespace luci
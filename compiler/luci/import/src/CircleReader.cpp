@@ -16,6 +16,8 @@
 
 #include "luci/Import/CircleReader.h"
 
+#include <oops/UserExn.h>
+
 #include <memory>
 #include <sstream>
 #include <string>
@@ -165,6 +167,7 @@ luci_quantparam(const circle::QuantizationParametersT *quantization)
     quantparam->max = max;
     quantparam->scale = scale;
     quantparam->zerop = zero_point;
+    quantparam->quantized_dimension = quantization->quantized_dimension;
 
     return quantparam;
   }
@@ -220,24 +223,72 @@ std::string CircleReader::opcode_name(const circle::OperatorT &op) const
   return ::luci::opcode_name(opcode);
 }
 
+CircleBuffer CircleReader::buffer(uint32_t index) const
+{
+  const auto *buffers = _model->buffers();
+  if (buffers == nullptr || buffers->size() <= index)
+    throw oops::UserExn("Invalid buffer index", index);
+
+  CircleBuffer buffer;
+  const auto *circle_buffer = buffers->Get(index);
+
+  // Data is stored after the flatbuffer in the file
+  const auto offset = circle_buffer->offset();
+  if (offset > 1)
+  {
+    const auto size = circle_buffer->size();
+    if (_file_data == nullptr)
+      throw oops::UserExn("Model file is required to read buffer", index);
+    if (offset > _file_size || size > _file_size - offset)
+      throw oops::UserExn("Invalid buffer location", index);
+
+    buffer.data = _file_data + offset;
+    buffer.size = size;
+    return buffer;
+  }
+
+  const auto *data = circle_buffer->data();
+  if (data != nullptr)
+  {
+    buffer.data = data->data();
+    buffer.size = data->size();
+  }
+  return buffer;
+}
+
 bool CircleReader::parse(const circle::Model *model)
 {
   assert(model != nullptr);
 
-  _model.reset(model->UnPack());
+  // NOTE Model is not unpacked as a whole, which would copy all the buffers.
+  _model = model;
+
+  _opcodes.clear();
+  if (const auto *opcodes = model->operator_codes())
+  {
+    for (const auto *opcode : *opcodes)
+      _opcodes.emplace_back(opcode->UnPack());
+  }
+
+  _subgraphs.clear();
+  if (const auto *subgraphs = model->subgraphs())
+  {
+    for (const auto *subgraph : *subgraphs)
+      _subgraphs.emplace_back(subgraph->UnPack());
+  }
 
   return true;
 }
 
 bool CircleReader::select_subgraph(uint32_t sgindex)
 {
-  if (_model->subgraphs.size() <= sgindex)
+  if (_subgraphs.size() <= sgindex)
   {
     assert(false);
     return false;
   }
 
-  _current_subgraph = _model->subgraphs[sgindex].get();
+  _current_subgraph = _subgraphs[sgindex].get();
 
   return true;
 }
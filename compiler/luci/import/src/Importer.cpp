@@ -82,12 +82,10 @@ void convert_graph(const luci::GraphBuilderSource &source, luci::CircleReader &r
   }
 
   // Create CircleConst nodes for constant tensors.
-  const auto &buffers = reader.buffers();
   for (uint32_t i = 0; i < tensors.size(); ++i)
   {
     const circle::TensorT &tensor = *tensors[i];
-    const std::vector<uint8_t> &buffer = buffers[tensor.buffer]->data;
-    if (!buffer.empty())
+    if (!reader.buffer(tensor.buffer).empty())
     {
       luci::CircleConst *const_node = luci::create_circleconst(&gb_context, i);
       nodefinder->enroll(i, const_node);
@@ -200,6 +198,8 @@ std::unique_ptr<loco::Graph> Importer::import(const circle::Model *model) const
   }
 
   CircleReader reader;
+  reader.share_buffers(_share_buffers);
+  reader.model_file(_file_data, _file_size);
   if (!reader.parse(model))
     return nullptr;
 
@@ -237,6 +237,8 @@ std::unique_ptr<Module> Importer::importModule(const circle::Model *model) const
   }
 
   CircleReader reader;
+  reader.share_buffers(_share_buffers);
+  reader.model_file(_file_data, _file_size);
   if (!reader.parse(model))
     return nullptr;
 
@@ -23,24 +23,31 @@
 #include <oops/UserExn.h>
 
 #include <cassert>
+#include <cstdint>
+#include <cstring>
 
 namespace luci
 {
 
 template <loco::DataType DT>
-static void copy_data(const std::vector<uint8_t> &raw_data, uint32_t num_elements,
+static void copy_data(const CircleBuffer &buffer, uint32_t num_elements, bool share,
                       CircleConst *const_node)
 {
   using T = typename loco::DataTypeImpl<DT>::Type;
 
-  assert(raw_data.size() == num_elements * sizeof(T));
-  const auto *data = reinterpret_cast<const T *>(raw_data.data());
+  assert(buffer.size == num_elements * sizeof(T));
+  const auto *data = reinterpret_cast<const T *>(buffer.data);
 
-  const_node->size<DT>(num_elements);
-  for (uint32_t i = 0; i < num_elements; ++i)
+  // Data is copied when it is not aligned, e.g. when the model itself is not aligned in memory
+  if (share && reinterpret_cast<uintptr_t>(data) % alignof(T) == 0)
   {
-    const_node->at<DT>(i) = data[i];
+    const_node->external_data<DT>(data, num_elements);
+    return;
   }
+
+  const_node->size<DT>(num_elements);
+  if (num_elements > 0)
+    std::memcpy(&const_node->at<DT>(0), data, buffer.size);
 }
 
 //
@@ -70,30 +77,35 @@ CircleConst *create_circleconst(GraphBuilderContext *context, int32_t tensor_ind
   }
 
   // (3) constant values from circle buffer
-  const std::vector<uint8_t> &buffer = reader->buffers()[const_tensor.buffer]->data;
+  const CircleBuffer buffer = reader->buffer(const_tensor.buffer);
   if (buffer.empty())
     throw oops::UserExn("Empty buffer");
+  const bool share = reader->share_buffers();
 
   switch (luci_datatype(const_tensor.type))
   {
     case loco::DataType::FLOAT32:
-      copy_data<loco::DataType::FLOAT32>(buffer, num_elements, const_node);
+      copy_data<loco::DataType::FLOAT32>(buffer, num_elements, share, const_node);
       break;
 
     case loco::DataType::U8:
-      copy_data<loco::DataType::U8>(buffer, num_elements, const_node);
+      copy_data<loco::DataType::U8>(buffer, num_elements, share, const_node);
+      break;
+
+    case loco::DataType::S8:
+      copy_data<loco::DataType::S8>(buffer, num_elements, share, const_node);
       break;
 
     case loco::DataType::S32:
-      copy_data<loco::DataType::S32>(buffer, num_elements, const_node);
+      copy_data<loco::DataType::S32>(buffer, num_elements, share, const_node);
       break;
 
     case loco::DataType::S64:
-      copy_data<loco::DataType::S64>(buffer, num_elements, const_node);
+      copy_data<loco::DataType::S64>(buffer, num_elements, share, const_node);
       break;
 
     case loco::DataType::BOOL:
-      copy_data<loco::DataType::BOOL>(buffer, num_elements, const_node);
+      copy_data<loco::DataType::BOOL>(buffer, num_elements, share, const_node);
       break;
 
     default:
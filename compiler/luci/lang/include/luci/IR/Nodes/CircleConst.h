@@ -46,8 +46,28 @@ public:
   template <loco::DataType DT> const typename loco::DataTypeImpl<DT>::Type &scalar(void) const;
   template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type &scalar(void);
 
+public:
+  /**
+   * @brief Refer to read-only data of 'size' elements outside of the node without copying it
+   * @note  The data is copied into the node when it may be modified, that is on non-const access.
+   *        Until then, the data should outlive the node.
+   */
+  template <loco::DataType DT>
+  void external_data(const typename loco::DataTypeImpl<DT>::Type *data, uint32_t size);
+
+  bool is_external(void) const { return _ext_data != nullptr; }
+
+private:
+  // Copy external data into the node, if any
+  void own_data(void);
+
+  uint32_t byte_size(void) const;
+  const uint8_t *data_ptr(void) const;
+
 private:
   std::vector<uint8_t> _data;
+  const uint8_t *_ext_data = nullptr;
+  uint32_t _ext_size = 0;
 };
 
 } // namespace luci
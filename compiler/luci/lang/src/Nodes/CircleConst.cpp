@@ -17,20 +17,42 @@
 #include "luci/IR/Nodes/CircleConst.h"
 
 #include <cassert>
+#include <cstdint>
 
 namespace luci
 {
 
+void CircleConst::own_data(void)
+{
+  if (_ext_data == nullptr)
+    return;
+
+  _data.assign(_ext_data, _ext_data + _ext_size);
+  _ext_data = nullptr;
+  _ext_size = 0;
+}
+
+uint32_t CircleConst::byte_size(void) const
+{
+  return _ext_data != nullptr ? _ext_size : static_cast<uint32_t>(_data.size());
+}
+
+const uint8_t *CircleConst::data_ptr(void) const
+{
+  return _ext_data != nullptr ? _ext_data : _data.data();
+}
+
 template <loco::DataType DT> uint32_t CircleConst::size(void) const
 {
   assert(dtype() == DT);
-  assert(_data.size() % sizeof(typename loco::DataTypeImpl<DT>::Type) == 0);
-  return _data.size() / sizeof(typename loco::DataTypeImpl<DT>::Type);
+  assert(byte_size() % sizeof(typename loco::DataTypeImpl<DT>::Type) == 0);
+  return byte_size() / sizeof(typename loco::DataTypeImpl<DT>::Type);
 }
 
 template <loco::DataType DT> void CircleConst::size(uint32_t l)
 {
   assert(dtype() == DT);
+  own_data();
   _data.resize(l * sizeof(typename loco::DataTypeImpl<DT>::Type));
 }
 
@@ -39,13 +61,14 @@ const typename loco::DataTypeImpl<DT>::Type &CircleConst::at(uint32_t n) const
 {
   assert(dtype() == DT);
   assert(n < size<DT>());
-  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(_data.data()) + n);
+  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(data_ptr()) + n);
 }
 
 template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type &CircleConst::at(uint32_t n)
 {
   assert(dtype() == DT);
   assert(n < size<DT>());
+  own_data();
   return *(reinterpret_cast<typename loco::DataTypeImpl<DT>::Type *>(_data.data()) + n);
 }
 
@@ -53,27 +76,45 @@ template <loco::DataType DT>
 const typename loco::DataTypeImpl<DT>::Type &CircleConst::scalar(void) const
 {
   assert(dtype() == DT);
-  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(_data.data()));
+  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(data_ptr()));
 }
 
 template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type &CircleConst::scalar(void)
 {
   assert(dtype() == DT);
+  own_data();
   return *(reinterpret_cast<typename loco::DataTypeImpl<DT>::Type *>(_data.data()));
 }
 
-#define INSTANTIATE(DT)                                                                      \
-  template uint32_t CircleConst::size<DT>(void) const;                                       \
-  template void CircleConst::size<DT>(uint32_t);                                             \
-  template const typename loco::DataTypeImpl<DT>::Type &CircleConst::at<DT>(uint32_t) const; \
-  template typename loco::DataTypeImpl<DT>::Type &CircleConst::at<DT>(uint32_t);             \
-  template const typename loco::DataTypeImpl<DT>::Type &CircleConst::scalar<DT>(void) const; \
-  template typename loco::DataTypeImpl<DT>::Type &CircleConst::scalar<DT>(void);
+template <loco::DataType DT>
+void CircleConst::external_data(const typename loco::DataTypeImpl<DT>::Type *data, uint32_t size)
+{
+  using T = typename loco::DataTypeImpl<DT>::Type;
+
+  assert(dtype() == DT);
+  assert(data != nullptr);
+  assert(reinterpret_cast<uintptr_t>(data) % alignof(T) == 0);
+  _data.clear();
+  _data.shrink_to_fit();
+  _ext_data = reinterpret_cast<const uint8_t *>(data);
+  _ext_size = size * sizeof(T);
+}
+
+#define INSTANTIATE(DT)                                                                       \
+  template uint32_t CircleConst::size<DT>(void) const;                                        \
+  template void CircleConst::size<DT>(uint32_t);                                              \
+  template const typename loco::DataTypeImpl<DT>::Type &CircleConst::at<DT>(uint32_t) const;  \
+  template typename loco::DataTypeImpl<DT>::Type &CircleConst::at<DT>(uint32_t);              \
+  template const typename loco::DataTypeImpl<DT>::Type &CircleConst::scalar<DT>(void) const;  \
+  template typename loco::DataTypeImpl<DT>::Type &CircleConst::scalar<DT>(void);              \
+  template void CircleConst::external_data<DT>(const typename loco::DataTypeImpl<DT>::Type *, \
+                                               uint32_t);
 
 INSTANTIATE(loco::DataType::S64);
 INSTANTIATE(loco::DataType::S32);
 INSTANTIATE(loco::DataType::FLOAT32);
 INSTANTIATE(loco::DataType::U8);
+INSTANTIATE(loco::DataType::S8);
 INSTANTIATE(loco::DataType::BOOL);
 
 #undef INSTANTIATE
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/IR/Nodes/CircleConst.h"
+
+#include "luci/IR/CircleDialect.h"
+
+#include <gtest/gtest.h>
+
+TEST(CircleConstTest, constructor)
+{
+  luci::CircleConst const_node;
+
+  ASSERT_EQ(luci::CircleDialect::get(), const_node.dialect());
+  ASSERT_EQ(luci::CircleOpcode::CONST, const_node.opcode());
+  ASSERT_FALSE(const_node.is_external());
+}
+
+TEST(CircleConstTest, external_data)
+{
+  const float data[] = {1.0f, 2.0f, 3.0f};
+
+  luci::CircleConst const_node;
+  const_node.dtype(loco::DataType::FLOAT32);
+  const_node.external_data<loco::DataType::FLOAT32>(data, 3);
+
+  const luci::CircleConst &cref = const_node;
+  ASSERT_TRUE(cref.is_external());
+  ASSERT_EQ(3, cref.size<loco::DataType::FLOAT32>());
+  ASSERT_EQ(&data[1], &cref.at<loco::DataType::FLOAT32>(1));
+
+  // Modification copies the data into the node
+  const_node.at<loco::DataType::FLOAT32>(1) = 5.0f;
+  ASSERT_FALSE(const_node.is_external());
+  ASSERT_EQ(2.0f, data[1]);
+  ASSERT_EQ(1.0f, cref.at<loco::DataType::FLOAT32>(0));
+  ASSERT_EQ(5.0f, cref.at<loco::DataType::FLOAT32>(1));
+  ASSERT_EQ(3.0f, cref.at<loco::DataType::FLOAT32>(2));
+}
+
+TEST(CircleConstTest, external_data_resize)
+{
+  const int32_t data[] = {1, 2};
+
+  luci::CircleConst const_node;
+  const_node.dtype(loco::DataType::S32);
+  const_node.external_data<loco::DataType::S32>(data, 2);
+  const_node.size<loco::DataType::S32>(3);
+
+  ASSERT_FALSE(const_node.is_external());
+  ASSERT_EQ(3, const_node.size<loco::DataType::S32>());
+  ASSERT_EQ(2, const_node.at<loco::DataType::S32>(1));
+}
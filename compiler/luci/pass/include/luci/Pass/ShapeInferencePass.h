@@ -19,7 +19,7 @@
 
 #include <loco.h>
 
-#include <logo/Pass.h>
+#include <logo/IncrementalPass.h>
 
 namespace luci
 {
@@ -27,13 +27,14 @@ namespace luci
 /**
  * @brief Pass to infer shape of nodes
  */
-class ShapeInferencePass : public logo::Pass
+class ShapeInferencePass : public logo::IncrementalPass
 {
 public:
   virtual const char *name(void) const { return "luci::ShapeInferencePass"; }
 
 public:
   bool run(loco::Graph *graph);
+  bool revisit(loco::Graph *graph, const NodeSet &nodes, Changes &changes);
 };
 
 } // namespace luci
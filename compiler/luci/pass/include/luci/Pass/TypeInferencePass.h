@@ -20,7 +20,7 @@
 
 #include <loco.h>
 
-#include <logo/Pass.h>
+#include <logo/IncrementalPass.h>
 
 namespace luci
 {
@@ -28,13 +28,14 @@ namespace luci
 /**
  * @brief Pass to infer type of nodes
  */
-class TypeInferencePass : public logo::Pass
+class TypeInferencePass : public logo::IncrementalPass
 {
 public:
   virtual const char *name(void) const { return "luci::TypeInferencePass"; }
 
 public:
   bool run(loco::Graph *graph);
+  bool revisit(loco::Graph *graph, const NodeSet &nodes, Changes &changes);
 };
 
 } // namespace luci
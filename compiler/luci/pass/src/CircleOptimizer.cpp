@@ -17,6 +17,7 @@
 #include "luci/CircleOptimizer.h"
 
 #include "luci/Pass/FuseInstanceNormPass.h"
+#include "luci/Pass/QuantizeWithMinMaxPass.h"
 #include "luci/Pass/ResolveCustomOpBatchMatMulPass.h"
 // TODO add more passes
 
@@ -31,6 +32,7 @@
 #include <logo/Phase.h>
 
 #include <memory>
+#include <stdexcept>
 
 namespace
 {
@@ -79,6 +81,18 @@ bool OptimizeOptionsImpl::query(Algorithm algo)
   return true;
 }
 
+loco::DataType str_to_dtype(const std::string &str)
+{
+  if (str == "float32")
+    return loco::DataType::FLOAT32;
+  if (str == "uint8")
+    return loco::DataType::U8;
+  if (str == "int8")
+    return loco::DataType::S8;
+
+  throw std::runtime_error("Unsupported data type: " + str);
+}
+
 } // namespace
 
 namespace luci
@@ -109,7 +123,12 @@ void CircleOptimizer::optimize(loco::Graph *g) const
   }
   if (_options->query(Options::Algorithm::QuantizeWithMinMax))
   {
-    // TODO: Add QuantizeWithMinMaxPass phase with parameters
+    auto input_dtype =
+        _options->param(Options::AlgorithmParameters::QuantizeWithMinMax_input_dtype);
+    auto output_dtype =
+        _options->param(Options::AlgorithmParameters::QuantizeWithMinMax_output_dtype);
+    phase.emplace_back(std::make_unique<QuantizeWithMinMaxPass>(str_to_dtype(input_dtype),
+                                                                str_to_dtype(output_dtype)));
   }
 
   // Shape inference is needed for added nodes doing above transformations
@@ -118,8 +137,8 @@ void CircleOptimizer::optimize(loco::Graph *g) const
   phase.emplace_back(std::make_unique<logo::RemoveDeadNodeWithQueryPass>());
   /* TRANSFORM DECLARATION END */
 
-  ProgressReporter prog(g, logo::PhaseStrategy::Saturate);
-  logo::PhaseRunner<logo::PhaseStrategy::Saturate> phase_runner{g};
+  ProgressReporter prog(g, logo::PhaseStrategy::Worklist);
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist> phase_runner{g};
   phase_runner.attach(&prog);
   phase_runner.run(phase);
 }
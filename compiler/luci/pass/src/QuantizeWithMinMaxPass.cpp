@@ -0,0 +1,401 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/QuantizeWithMinMaxPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <loco/IR/Algorithm.h>
+#include <loco/Service/TypeInference.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+namespace
+{
+
+void quantized_range(loco::DataType dtype, int32_t &qmin, int32_t &qmax)
+{
+  switch (dtype)
+  {
+    case loco::DataType::U8:
+      qmin = std::numeric_limits<uint8_t>::min();
+      qmax = std::numeric_limits<uint8_t>::max();
+      break;
+    case loco::DataType::S8:
+      qmin = std::numeric_limits<int8_t>::min();
+      qmax = std::numeric_limits<int8_t>::max();
+      break;
+    default:
+      throw std::runtime_error("QuantizeWithMinMaxPass: unsupported quantized type");
+  }
+}
+
+/**
+ * @brief Compute scale and zero point which map [min, max] onto the whole range of dtype
+ *
+ * The range is extended to include 0, so that zero (ex: padding) is exactly representable.
+ */
+void asymmetric_qparam(float min, float max, loco::DataType dtype, float &scale, int64_t &zerop)
+{
+  int32_t qmin, qmax;
+  quantized_range(dtype, qmin, qmax);
+
+  min = std::min(min, 0.0f);
+  max = std::max(max, 0.0f);
+
+  scale = (max - min) / static_cast<float>(qmax - qmin);
+  if (scale == 0.0f)
+  {
+    // All values are zero
+    scale = 1.0f;
+  }
+
+  const double zerop_real = static_cast<double>(qmin) - min / scale;
+  const double zerop_clamped = std::max<double>(qmin, std::min<double>(qmax, zerop_real));
+  zerop = static_cast<int64_t>(std::round(zerop_clamped));
+}
+
+int32_t quantize_value(float value, float scale, int64_t zerop, int32_t qmin, int32_t qmax)
+{
+  const auto quantized = static_cast<int64_t>(std::round(value / scale)) + zerop;
+  return static_cast<int32_t>(std::max<int64_t>(qmin, std::min<int64_t>(qmax, quantized)));
+}
+
+// Type of a node created by other passes is only annotated until export
+loco::DataType node_dtype(const luci::CircleNode *node)
+{
+  return loco::dtype_known(node) ? loco::dtype_get(node) : node->dtype();
+}
+
+void set_dtype(luci::CircleNode *node, loco::DataType dtype)
+{
+  node->dtype(dtype);
+  // TypeInferencePass annotates the node again from the new type
+  loco::dtype_erase(node);
+}
+
+luci::CircleQuantParam *get_or_create_quantparam(luci::CircleNode *node)
+{
+  if (node->quantparam() == nullptr)
+    node->quantparam(std::make_unique<luci::CircleQuantParam>());
+  return node->quantparam();
+}
+
+std::vector<float> const_values(const luci::CircleConst *node)
+{
+  std::vector<float> values(node->size<loco::DataType::FLOAT32>());
+  for (uint32_t i = 0; i < values.size(); ++i)
+    values[i] = node->at<loco::DataType::FLOAT32>(i);
+  return values;
+}
+
+template <loco::DataType DT>
+void write_const(luci::CircleConst *node, const std::vector<int32_t> &quantized)
+{
+  using T = typename loco::DataTypeImpl<DT>::Type;
+
+  set_dtype(node, DT);
+  node->size<DT>(quantized.size());
+  for (uint32_t i = 0; i < quantized.size(); ++i)
+    node->at<DT>(i) = static_cast<T>(quantized[i]);
+}
+
+void write_const(luci::CircleConst *node, loco::DataType dtype,
+                 const std::vector<int32_t> &quantized)
+{
+  switch (dtype)
+  {
+    case loco::DataType::U8:
+      write_const<loco::DataType::U8>(node, quantized);
+      break;
+    case loco::DataType::S8:
+      write_const<loco::DataType::S8>(node, quantized);
+      break;
+    case loco::DataType::S32:
+      write_const<loco::DataType::S32>(node, quantized);
+      break;
+    default:
+      throw std::runtime_error("QuantizeWithMinMaxPass: unsupported quantized type");
+  }
+}
+
+/**
+ * @brief Quantize a float constant per-tensor asymmetrically with the range of its values
+ */
+void quantize_const_per_tensor(luci::CircleConst *node, loco::DataType dtype)
+{
+  const auto values = const_values(node);
+  const auto minmax = std::minmax_element(values.begin(), values.end());
+  const float min = values.empty() ? 0.0f : *minmax.first;
+  const float max = values.empty() ? 0.0f : *minmax.second;
+
+  float scale;
+  int64_t zerop;
+  asymmetric_qparam(min, max, dtype, scale, zerop);
+
+  int32_t qmin, qmax;
+  quantized_range(dtype, qmin, qmax);
+  std::vector<int32_t> quantized(values.size());
+  for (uint32_t i = 0; i < values.size(); ++i)
+    quantized[i] = quantize_value(values[i], scale, zerop, qmin, qmax);
+
+  auto quantparam = get_or_create_quantparam(node);
+  quantparam->min = {min};
+  quantparam->max = {max};
+  quantparam->scale = {scale};
+  quantparam->zerop = {zerop};
+  write_const(node, dtype, quantized);
+}
+
+/**
+ * @brief Quantize a float constant per-channel symmetrically to int8
+ *
+ * Values are clamped to [-127, 127] so that the range is symmetric around zero point 0.
+ */
+void quantize_const_per_channel(luci::CircleConst *node, uint32_t channel_dim)
+{
+  assert(channel_dim < node->rank());
+
+  const auto values = const_values(node);
+  const uint32_t num_channels = node->dim(channel_dim).value();
+  uint32_t inner_size = 1;
+  for (uint32_t r = channel_dim + 1; r < node->rank(); ++r)
+    inner_size *= node->dim(r).value();
+  auto channel_of = [&](uint32_t i) { return (i / inner_size) % num_channels; };
+
+  std::vector<float> min(num_channels, 0.0f);
+  std::vector<float> max(num_channels, 0.0f);
+  for (uint32_t i = 0; i < values.size(); ++i)
+  {
+    const auto c = channel_of(i);
+    min[c] = std::min(min[c], values[i]);
+    max[c] = std::max(max[c], values[i]);
+  }
+
+  const int32_t qmax = std::numeric_limits<int8_t>::max();
+  std::vector<float> scale(num_channels);
+  for (uint32_t c = 0; c < num_channels; ++c)
+  {
+    const float bound = std::max(std::abs(min[c]), std::abs(max[c]));
+    scale[c] = bound == 0.0f ? 1.0f : bound / qmax;
+  }
+
+  std::vector<int32_t> quantized(values.size());
+  for (uint32_t i = 0; i < values.size(); ++i)
+    quantized[i] = quantize_value(values[i], scale[channel_of(i)], 0, -qmax, qmax);
+
+  auto quantparam = get_or_create_quantparam(node);
+  quantparam->min = min;
+  quantparam->max = max;
+  quantparam->scale = scale;
+  quantparam->zerop = std::vector<int64_t>(num_channels, 0);
+  quantparam->quantized_dimension = channel_dim;
+  write_const(node, loco::DataType::S8, quantized);
+}
+
+/**
+ * @brief Quantize bias to int32 with scale = input_scale * weight_scale of each channel
+ */
+void quantize_bias(luci::CircleConst *node, const luci::CircleNode *input,
+                   const luci::CircleNode *weights)
+{
+  const float input_scale = input->quantparam()->scale.at(0);
+  const auto &weight_scale = weights->quantparam()->scale;
+
+  const auto values = const_values(node);
+  std::vector<float> scale(weight_scale.size());
+  for (uint32_t c = 0; c < scale.size(); ++c)
+    scale[c] = input_scale * weight_scale[c];
+
+  std::vector<int32_t> quantized(values.size());
+  for (uint32_t i = 0; i < values.size(); ++i)
+  {
+    const float s = scale.size() == 1 ? scale[0] : scale.at(i);
+    quantized[i] = quantize_value(values[i], s, 0, std::numeric_limits<int32_t>::min(),
+                                  std::numeric_limits<int32_t>::max());
+  }
+
+  auto quantparam = get_or_create_quantparam(node);
+  quantparam->scale = scale;
+  quantparam->zerop = std::vector<int64_t>(scale.size(), 0);
+  quantparam->quantized_dimension = 0;
+  write_const(node, loco::DataType::S32, quantized);
+}
+
+luci::CircleConst *float_const(loco::Node *node)
+{
+  auto const_node = dynamic_cast<luci::CircleConst *>(node);
+  if (const_node == nullptr || const_node->dtype() != loco::DataType::FLOAT32)
+    return nullptr;
+  return const_node;
+}
+
+class Quantizer
+{
+public:
+  explicit Quantizer(loco::DataType dtype) : _dtype{dtype} {}
+
+public:
+  void visit(luci::CircleNode *node)
+  {
+    if (node_dtype(node) != loco::DataType::FLOAT32)
+      return;
+
+    // Constants are quantized by their users, outputs follow what they output
+    if (dynamic_cast<luci::CircleConst *>(node) || dynamic_cast<luci::CircleOutput *>(node))
+      return;
+
+    quantize_activation(node);
+
+    if (auto conv = dynamic_cast<luci::CircleConv2D *>(node))
+      quantize_weights_bias(conv->input(), conv->filter(), conv->bias(), 0);
+    else if (auto dwconv = dynamic_cast<luci::CircleDepthwiseConv2D *>(node))
+      quantize_weights_bias(dwconv->input(), dwconv->filter(), dwconv->bias(), 3);
+    else if (auto fc = dynamic_cast<luci::CircleFullyConnected *>(node))
+      quantize_weights_bias(fc->input(), fc->weights(), fc->bias(), 0);
+
+    // Other float constants (ex: operand of Add) are quantized like activations
+    for (uint32_t i = 0; i < node->arity(); ++i)
+    {
+      if (auto const_node = float_const(node->arg(i)))
+        quantize_const_per_tensor(const_node, _dtype);
+    }
+  }
+
+private:
+  void quantize_activation(luci::CircleNode *node)
+  {
+    // Output of these must have the same quantization parameters as input
+    loco::Node *same_as = nullptr;
+    if (auto maxpool = dynamic_cast<luci::CircleMaxPool2D *>(node))
+      same_as = maxpool->value();
+    else if (auto avgpool = dynamic_cast<luci::CircleAveragePool2D *>(node))
+      same_as = avgpool->value();
+    else if (auto reshape = dynamic_cast<luci::CircleReshape *>(node))
+      same_as = reshape->tensor();
+
+    auto quantparam = node->quantparam();
+    if (same_as != nullptr)
+    {
+      auto input = loco::must_cast<luci::CircleNode *>(same_as);
+      if (input->quantparam() == nullptr)
+        throw std::runtime_error("QuantizeWithMinMaxPass: input of '" + node->name() +
+                                 "' is not quantized");
+      quantparam = get_or_create_quantparam(node);
+      quantparam->scale = input->quantparam()->scale;
+      quantparam->zerop = input->quantparam()->zerop;
+    }
+    else if (dynamic_cast<luci::CircleSoftmax *>(node))
+    {
+      // Output of Softmax is in [0, 1], which kernels expect to have a fixed scale
+      int32_t qmin, qmax;
+      quantized_range(_dtype, qmin, qmax);
+      quantparam = get_or_create_quantparam(node);
+      quantparam->scale = {1.0f / 256.0f};
+      quantparam->zerop = {qmin};
+    }
+    else
+    {
+      if (quantparam == nullptr || quantparam->min.size() != 1 || quantparam->max.size() != 1)
+        throw std::runtime_error("QuantizeWithMinMaxPass: min/max of '" + node->name() +
+                                 "' is not recorded");
+
+      float scale;
+      int64_t zerop;
+      asymmetric_qparam(quantparam->min[0], quantparam->max[0], _dtype, scale, zerop);
+      quantparam->scale = {scale};
+      quantparam->zerop = {zerop};
+    }
+
+    set_dtype(node, _dtype);
+  }
+
+  void quantize_weights_bias(loco::Node *input, loco::Node *weights, loco::Node *bias,
+                             uint32_t channel_dim)
+  {
+    if (auto weights_const = float_const(weights))
+    {
+      if (_dtype == loco::DataType::S8)
+        quantize_const_per_channel(weights_const, channel_dim);
+      else
+        quantize_const_per_tensor(weights_const, _dtype);
+    }
+
+    auto bias_const = float_const(bias);
+    auto input_node = loco::must_cast<luci::CircleNode *>(input);
+    auto weights_node = loco::must_cast<luci::CircleNode *>(weights);
+    if (bias_const != nullptr && input_node->quantparam() != nullptr &&
+        weights_node->quantparam() != nullptr)
+      quantize_bias(bias_const, input_node, weights_node);
+  }
+
+private:
+  loco::DataType _dtype;
+};
+
+} // namespace
+
+namespace luci
+{
+
+bool QuantizeWithMinMaxPass::run(loco::Graph *g)
+{
+  if (_input_dtype != loco::DataType::FLOAT32)
+    throw std::runtime_error("QuantizeWithMinMaxPass: input type must be float32");
+  if (_output_dtype != loco::DataType::U8 && _output_dtype != loco::DataType::S8)
+    throw std::runtime_error("QuantizeWithMinMaxPass: output type must be uint8 or int8");
+
+  bool changed = false;
+
+  // Visit in postorder, so that parameters of inputs are known before users of them
+  Quantizer quantizer{_output_dtype};
+  for (auto node : loco::postorder_traversal(loco::output_nodes(g)))
+  {
+    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+    if (node_dtype(circle_node) != loco::DataType::FLOAT32)
+      continue;
+
+    quantizer.visit(circle_node);
+    changed = changed || circle_node->dtype() != loco::DataType::FLOAT32;
+  }
+
+  // Update types of graph inputs and outputs as well
+  for (auto node : loco::input_nodes(g))
+  {
+    auto input = loco::must_cast<luci::CircleInput *>(node);
+    g->inputs()->at(input->index())->dtype(input->dtype());
+  }
+  for (auto node : loco::output_nodes(g))
+  {
+    auto output = loco::must_cast<luci::CircleOutput *>(node);
+    auto from = loco::must_cast<luci::CircleNode *>(output->from());
+    if (output->dtype() == loco::DataType::FLOAT32 && from->dtype() == _output_dtype)
+    {
+      set_dtype(output, _output_dtype);
+      g->outputs()->at(output->index())->dtype(_output_dtype);
+      changed = true;
+    }
+  }
+
+  return changed;
+}
+
+} // namespace luci
@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/QuantizeWithMinMaxPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <loco.h>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+
+// Graph: output = node(input, ...), where input has min/max recorded by calibration
+class TestGraph
+{
+public:
+  TestGraph()
+  {
+    g = loco::make_graph();
+
+    input = g->nodes()->create<luci::CircleInput>();
+    input->dtype(loco::DataType::FLOAT32);
+    input->name("input");
+    setMinMax(input, -2.0f, 2.0f);
+    auto graph_input = g->inputs()->create();
+    luci::link(graph_input, input);
+
+    output = g->nodes()->create<luci::CircleOutput>();
+    output->dtype(loco::DataType::FLOAT32);
+    auto graph_output = g->outputs()->create();
+    luci::link(graph_output, output);
+  }
+
+public:
+  // Float constant whose values of channel c along channel_dim are within [-(c + 1), c + 1]
+  luci::CircleConst *createConst(const std::vector<uint32_t> &shape, uint32_t channel_dim)
+  {
+    auto node = g->nodes()->create<luci::CircleConst>();
+    node->dtype(loco::DataType::FLOAT32);
+    node->rank(shape.size());
+    uint32_t size = 1;
+    for (uint32_t r = 0; r < shape.size(); ++r)
+    {
+      node->dim(r) = shape[r];
+      size *= shape[r];
+    }
+    uint32_t inner_size = 1;
+    for (uint32_t r = channel_dim + 1; r < shape.size(); ++r)
+      inner_size *= shape[r];
+
+    node->size<loco::DataType::FLOAT32>(size);
+    for (uint32_t i = 0; i < size; ++i)
+    {
+      const uint32_t outer = i / inner_size / shape[channel_dim];
+      const float bound = (i / inner_size) % shape[channel_dim] + 1;
+      // Each channel takes both signs, where only the positive one reaches the bound
+      const bool positive = (outer + i % inner_size) % 2 == 0;
+      node->at<loco::DataType::FLOAT32>(i) = positive ? bound : -bound / 2;
+    }
+    return node;
+  }
+
+  static void setMinMax(luci::CircleNode *node, float min, float max)
+  {
+    auto quantparam = std::make_unique<luci::CircleQuantParam>();
+    quantparam->min = {min};
+    quantparam->max = {max};
+    node->quantparam(std::move(quantparam));
+  }
+
+public:
+  std::unique_ptr<loco::Graph> g;
+  luci::CircleInput *input = nullptr;
+  luci::CircleOutput *output = nullptr;
+};
+
+// Weights of S8 are quantized per channel along channel_dim with scale of bound / 127
+void checkPerChannel(const luci::CircleConst *weights, uint32_t channel_dim)
+{
+  ASSERT_EQ(weights->dtype(), loco::DataType::S8);
+  auto quantparam = weights->quantparam();
+  ASSERT_NE(quantparam, nullptr);
+  EXPECT_EQ(quantparam->quantized_dimension, channel_dim);
+
+  const uint32_t num_channels = weights->dim(channel_dim).value();
+  ASSERT_EQ(quantparam->scale.size(), num_channels);
+  ASSERT_EQ(quantparam->zerop.size(), num_channels);
+  for (uint32_t c = 0; c < num_channels; ++c)
+  {
+    EXPECT_FLOAT_EQ(quantparam->scale[c], (c + 1) / 127.0f);
+    EXPECT_EQ(quantparam->zerop[c], 0);
+  }
+}
+
+// Bias is quantized to S32 with scale of input_scale * weight_scale of each channel
+void checkBias(const luci::CircleConst *bias, const luci::CircleNode *input,
+               const luci::CircleConst *weights)
+{
+  ASSERT_EQ(bias->dtype(), loco::DataType::S32);
+  auto quantparam = bias->quantparam();
+  ASSERT_NE(quantparam, nullptr);
+
+  const float input_scale = input->quantparam()->scale.at(0);
+  const auto &weight_scale = weights->quantparam()->scale;
+  ASSERT_EQ(quantparam->scale.size(), weight_scale.size());
+  for (uint32_t c = 0; c < weight_scale.size(); ++c)
+  {
+    EXPECT_FLOAT_EQ(quantparam->scale[c], input_scale * weight_scale[c]);
+    EXPECT_EQ(quantparam->zerop[c], 0);
+  }
+}
+
+} // namespace
+
+TEST(QuantizeWithMinMaxPassTest, conv2d_per_channel)
+{
+  TestGraph t;
+  auto conv = t.g->nodes()->create<luci::CircleConv2D>();
+  conv->dtype(loco::DataType::FLOAT32);
+  conv->name("conv");
+  conv->input(t.input);
+  auto filter = t.createConst({4, 3, 3, 2}, 0);
+  auto bias = t.createConst({4}, 0);
+  conv->filter(filter);
+  conv->bias(bias);
+  TestGraph::setMinMax(conv, -6.0f, 6.0f);
+  t.output->from(conv);
+
+  luci::QuantizeWithMinMaxPass pass(loco::DataType::FLOAT32, loco::DataType::S8);
+  ASSERT_TRUE(pass.run(t.g.get()));
+
+  EXPECT_EQ(conv->dtype(), loco::DataType::S8);
+  checkPerChannel(filter, 0);
+  checkBias(bias, t.input, filter);
+}
+
+TEST(QuantizeWithMinMaxPassTest, depthwise_conv2d_per_channel)
+{
+  TestGraph t;
+  auto dwconv = t.g->nodes()->create<luci::CircleDepthwiseConv2D>();
+  dwconv->dtype(loco::DataType::FLOAT32);
+  dwconv->name("dwconv");
+  dwconv->input(t.input);
+  auto filter = t.createConst({1, 3, 3, 4}, 3);
+  auto bias = t.createConst({4}, 0);
+  dwconv->filter(filter);
+  dwconv->bias(bias);
+  TestGraph::setMinMax(dwconv, -6.0f, 6.0f);
+  t.output->from(dwconv);
+
+  luci::QuantizeWithMinMaxPass pass(loco::DataType::FLOAT32, loco::DataType::S8);
+  ASSERT_TRUE(pass.run(t.g.get()));
+
+  EXPECT_EQ(dwconv->dtype(), loco::DataType::S8);
+  checkPerChannel(filter, 3);
+  checkBias(bias, t.input, filter);
+}
+
+TEST(QuantizeWithMinMaxPassTest, fully_connected_per_channel)
+{
+  TestGraph t;
+  auto fc = t.g->nodes()->create<luci::CircleFullyConnected>();
+  fc->dtype(loco::DataType::FLOAT32);
+  fc->name("fc");
+  fc->input(t.input);
+  auto weights = t.createConst({3, 5}, 0);
+  auto bias = t.createConst({3}, 0);
+  fc->weights(weights);
+  fc->bias(bias);
+  TestGraph::setMinMax(fc, -6.0f, 6.0f);
+  t.output->from(fc);
+
+  luci::QuantizeWithMinMaxPass pass(loco::DataType::FLOAT32, loco::DataType::S8);
+  ASSERT_TRUE(pass.run(t.g.get()));
+
+  EXPECT_EQ(fc->dtype(), loco::DataType::S8);
+  checkPerChannel(weights, 0);
+  checkBias(bias, t.input, weights);
+}
+
+TEST(QuantizeWithMinMaxPassTest, softmax_fixed_scale)
+{
+  for (auto dtype : {loco::DataType::U8, loco::DataType::S8})
+  {
+    TestGraph t;
+    auto softmax = t.g->nodes()->create<luci::CircleSoftmax>();
+    softmax->dtype(loco::DataType::FLOAT32);
+    softmax->name("softmax");
+    softmax->logits(t.input);
+    // Min/max recorded by calibration do not matter
+    TestGraph::setMinMax(softmax, 0.0f, 0.5f);
+    t.output->from(softmax);
+
+    luci::QuantizeWithMinMaxPass pass(loco::DataType::FLOAT32, dtype);
+    ASSERT_TRUE(pass.run(t.g.get()));
+
+    EXPECT_EQ(softmax->dtype(), dtype);
+    auto quantparam = softmax->quantparam();
+    ASSERT_NE(quantparam, nullptr);
+    ASSERT_EQ(quantparam->scale.size(), 1);
+    EXPECT_FLOAT_EQ(quantparam->scale[0], 1.0f / 256.0f);
+    ASSERT_EQ(quantparam->zerop.size(), 1);
+    EXPECT_EQ(quantparam->zerop[0], dtype == loco::DataType::U8 ? 0 : -128);
+  }
+}
+
+TEST(QuantizeWithMinMaxPassTest, maxpool_same_as_input)
+{
+  TestGraph t;
+  auto maxpool = t.g->nodes()->create<luci::CircleMaxPool2D>();
+  maxpool->dtype(loco::DataType::FLOAT32);
+  maxpool->name("maxpool");
+  maxpool->value(t.input);
+  t.output->from(maxpool);
+
+  luci::QuantizeWithMinMaxPass pass(loco::DataType::FLOAT32, loco::DataType::U8);
+  ASSERT_TRUE(pass.run(t.g.get()));
+
+  ASSERT_NE(maxpool->quantparam(), nullptr);
+  EXPECT_EQ(maxpool->quantparam()->scale, t.input->quantparam()->scale);
+  EXPECT_EQ(maxpool->quantparam()->zerop, t.input->quantparam()->zerop);
+}
+
+TEST(QuantizeWithMinMaxPassTest, avgpool_same_as_input)
+{
+  TestGraph t;
+  auto avgpool = t.g->nodes()->create<luci::CircleAveragePool2D>();
+  avgpool->dtype(loco::DataType::FLOAT32);
+  avgpool->name("avgpool");
+  avgpool->value(t.input);
+  // Min/max recorded by calibration are ignored, as kernels do not rescale the average
+  TestGraph::setMinMax(avgpool, -1.0f, 1.0f);
+  t.output->from(avgpool);
+
+  luci::QuantizeWithMinMaxPass pass(loco::DataType::FLOAT32, loco::DataType::S8);
+  ASSERT_TRUE(pass.run(t.g.get()));
+
+  ASSERT_NE(avgpool->quantparam(), nullptr);
+  EXPECT_EQ(avgpool->quantparam()->scale, t.input->quantparam()->scale);
+  EXPECT_EQ(avgpool->quantparam()->zerop, t.input->quantparam()->zerop);
+}
+
+TEST(QuantizeWithMinMaxPassTest, maxpool_input_not_quantized_NEG)
+{
+  TestGraph t;
+  // Input is not float, which is left as it is
+  t.input->dtype(loco::DataType::S32);
+  t.input->quantparam(nullptr);
+  auto maxpool = t.g->nodes()->create<luci::CircleMaxPool2D>();
+  maxpool->dtype(loco::DataType::FLOAT32);
+  maxpool->name("maxpool");
+  maxpool->value(t.input);
+  t.output->from(maxpool);
+
+  luci::QuantizeWithMinMaxPass pass(loco::DataType::FLOAT32, loco::DataType::U8);
+  EXPECT_THROW(pass.run(t.g.get()), std::runtime_error);
+}
@@ -25,10 +25,11 @@
 #include <loco/Service/ShapeInference.h>
 #include <loco/Service/MultiDialectShapeInferenceRule.h>
 
-namespace luci
+namespace
 {
 
-bool ShapeInferencePass::run(loco::Graph *g)
+// Infer a graph, or a set of nodes
+template <typename Target> bool infer(const Target &target)
 {
   loco::CanonicalShapeInferenceRule canonical_rule;
   luci::CircleShapeInferenceRule circle_rule;
@@ -38,7 +39,36 @@ bool ShapeInferencePass::run(loco::Graph *g)
   rules.bind(loco::CanonicalDialect::get(), &canonical_rule)
       .bind(luci::CircleDialect::get(), &circle_rule);
 
-  return loco::apply(&rules).to(g);
+  return loco::apply(&rules).to(target);
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool ShapeInferencePass::run(loco::Graph *g) { return infer(g); }
+
+bool ShapeInferencePass::revisit(loco::Graph *, const NodeSet &nodes, Changes &changes)
+{
+  NodeSet unknown_nodes;
+  for (auto node : nodes)
+  {
+    if (!loco::shape_known(node))
+      unknown_nodes.insert(node);
+  }
+  if (unknown_nodes.empty())
+    return false;
+
+  if (!infer(unknown_nodes))
+    return false;
+
+  for (auto node : unknown_nodes)
+  {
+    if (loco::shape_known(node))
+      changes.touched.insert(node);
+  }
+  return true;
 }
 
 } // namespace luci
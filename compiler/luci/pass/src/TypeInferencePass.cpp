@@ -23,10 +23,11 @@
 #include <loco/IR/CanonicalDialect.h>
 #include <loco/Service/TypeInference.h>
 
-namespace luci
+namespace
 {
 
-bool TypeInferencePass::run(loco::Graph *g)
+// Infer a graph, or a set of nodes
+template <typename Target> bool infer(const Target &target)
 {
   loco::CanonicalTypeInferenceRule canonical_rule;
   luci::CircleTypeInferenceRule circle_rule;
@@ -36,7 +37,36 @@ bool TypeInferencePass::run(loco::Graph *g)
   rules.bind(loco::CanonicalDialect::get(), &canonical_rule)
       .bind(luci::CircleDialect::get(), &circle_rule);
 
-  return loco::apply(&rules).to(g);
+  return loco::apply(&rules).to(target);
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool TypeInferencePass::run(loco::Graph *g) { return infer(g); }
+
+bool TypeInferencePass::revisit(loco::Graph *, const NodeSet &nodes, Changes &changes)
+{
+  NodeSet unknown_nodes;
+  for (auto node : nodes)
+  {
+    if (!loco::dtype_known(node))
+      unknown_nodes.insert(node);
+  }
+  if (unknown_nodes.empty())
+    return false;
+
+  if (!infer(unknown_nodes))
+    return false;
+
+  for (auto node : unknown_nodes)
+  {
+    if (loco::dtype_known(node))
+      changes.touched.insert(node);
+  }
+  return true;
 }
 
 } // namespace luci
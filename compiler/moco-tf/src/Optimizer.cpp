@@ -80,8 +80,8 @@ void Optimizer::optimize(loco::Graph *g) const
   }
   /* TRANSFORM DECLARATION END */
 
-  ProgressReporter prog(g, logo::PhaseStrategy::Saturate);
-  logo::PhaseRunner<logo::PhaseStrategy::Saturate> phase_runner{g};
+  ProgressReporter prog(g, logo::PhaseStrategy::Worklist);
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist> phase_runner{g};
   phase_runner.attach(&prog);
   phase_runner.run(phase);
 }
@@ -32,12 +32,11 @@
 #include <locoex/COpDialect.h>
 #include <locoex/Service/COpShapeInferenceRule.h>
 
-namespace moco
-{
-namespace tf
+namespace
 {
 
-bool ShapeInferencePass::run(loco::Graph *graph)
+// Infer a graph, or a set of nodes
+template <typename Target> bool infer(const Target &target)
 {
   loco::CanonicalShapeInferenceRule canonical_rule;
   moco::TFShapeInferenceRule tf_rule;
@@ -46,10 +45,41 @@ bool ShapeInferencePass::run(loco::Graph *graph)
   loco::MultiDialectShapeInferenceRule rules;
 
   rules.bind(loco::CanonicalDialect::get(), &canonical_rule)
-      .bind(TFDialect::get(), &tf_rule)
+      .bind(moco::TFDialect::get(), &tf_rule)
       .bind(locoex::COpDialect::get(), &cop_rule);
 
-  return loco::apply(&rules).to(graph);
+  return loco::apply(&rules).to(target);
+}
+
+} // namespace
+
+namespace moco
+{
+namespace tf
+{
+
+bool ShapeInferencePass::run(loco::Graph *graph) { return infer(graph); }
+
+bool ShapeInferencePass::revisit(loco::Graph *, const NodeSet &nodes, Changes &changes)
+{
+  NodeSet unknown_nodes;
+  for (auto node : nodes)
+  {
+    if (!loco::shape_known(node))
+      unknown_nodes.insert(node);
+  }
+  if (unknown_nodes.empty())
+    return false;
+
+  if (!infer(unknown_nodes))
+    return false;
+
+  for (auto node : unknown_nodes)
+  {
+    if (loco::shape_known(node))
+      changes.touched.insert(node);
+  }
+  return true;
 }
 
 } // namespace tf
@@ -20,6 +20,7 @@
 #include "Transform.h"
 
 #include <loco.h>
+#include <logo/IncrementalPass.h>
 
 namespace moco
 {
@@ -29,13 +30,14 @@ namespace tf
 /**
  * @brief  Run shape inference to the graph
  */
-class ShapeInferencePass : public Transform
+class ShapeInferencePass : public logo::IncrementalPass
 {
 public:
   const char *name(void) const final { return "ShapeInferencePass"; }
 
 public:
   bool run(loco::Graph *graph) override;
+  bool revisit(loco::Graph *graph, const NodeSet &nodes, Changes &changes) override;
 };
 
 } // namespace tf
@@ -181,6 +181,8 @@ void CPPCodeGenerator::formatTensorNames(const ModelAnalyzer &ma)
  * + Writes actual model class that contains:
  * network constructor, setters to feed data to network, getters to get results,
  * and doInference method that performs actual inference.
+ * Memory of tensors is allocated by network constructor, so doInference does not allocate and
+ * tensors returned by getters are overwritten by the next inference.
  */
 void CPPCodeGenerator::materializeHeader(ostream &out, const ModelAnalyzer &ma)
 {
@@ -234,9 +236,28 @@ void CPPCodeGenerator::materializeHeader(ostream &out, const ModelAnalyzer &ma)
   // pointer to NN parameters
   out << "  char* _parameters;\n";
   out << "  size_t _paramSize;\n";
+  // memory of temporary tensors, its size is known at compile time
+  out << "  float* _arena;\n";
   out << "};\n";
 }
 
+/**
+ * @brief Prints shape of artifact, e.g. "Shape{1, 2, 3}"
+ * @param out Stream to write program text
+ * @param shape Shape to print
+ */
+static void printShape(ostream &out, const mir::Shape &shape)
+{
+  out << "Shape{";
+  for (int32_t i = 0; i < shape.rank(); ++i)
+  {
+    if (i != 0)
+      out << ", ";
+    out << shape.dim(i);
+  }
+  out << "}";
+}
+
 /**
  * @brief Prints list of function arguments, separated by commas
  * @param out Stream to write program text
@@ -342,9 +363,18 @@ void CPPCodeGenerator::materializeConstructor(ostream &out, const ModelAnalyzer
   assert(constructor != nullptr);
   const TensorDescriptor &td = ma.getTensors()[constructor->tensorId];
   assert(td.type == sir::TensorDescriptor::Type::temporary);
-  (void)td;
   const string &t_name = _formattedTensors[constructor->tensorId];
-  out << "  Tensor " << t_name << ";\n";
+  const auto &offsets = ma.getArenaOffsets();
+  const auto it = offsets.find(constructor->tensorId);
+  if (it == offsets.end())
+  {
+    // constant, which refers to model parameters
+    out << "  Tensor " << t_name << "(Shape{}, nullptr);\n";
+    return;
+  }
+  out << "  Tensor " << t_name << "(";
+  printShape(out, td.shape);
+  out << ", _arena + " << it->second << ");\n";
 }
 
 void CPPCodeGenerator::materializeDestructor(ostream &out, const ModelAnalyzer &ma,
@@ -360,11 +390,6 @@ void CPPCodeGenerator::materializeDestructor(ostream &out, const ModelAnalyzer &
 
 void CPPCodeGenerator::materializeInferenceSequence(ostream &out, const ModelAnalyzer &ma)
 {
-
-  // Allocate temporary(im2col) tensor
-  out << "  Tensor " << _formattedTensors[ma.getTempTID()] << "(Shape{" << ma.getMaxTemporarySize()
-      << "});\n";
-
   for (const unique_ptr<Action> &action : ma.getInferenceSequence())
   {
     Action *ptr = action.get();
@@ -431,21 +456,35 @@ void CPPCodeGenerator::materializeCode(ostream &out, const ModelAnalyzer &ma, co
   out.write(cpp_leaky_relu, sizeof(cpp_leaky_relu));
 
   // gen NN constructor
+  const auto &inputs = ma.getInputs();
+  const auto &tensors = ma.getTensors();
   out << class_name << "::" << class_name
       << "(const string& parametersPath)\n"
          "{\n"
          "  readParameters(_parameters, _paramSize, parametersPath, "
-      << s.getFormatVersion() << ", " << s.getModelHash() << ");\n"
-                                                             "}\n\n";
+      << s.getFormatVersion() << ", " << s.getModelHash() << ");\n";
+  out << "  _arena = new float[" << ma.getArenaSize() << "];\n";
+  for (size_t input_tensor_id : inputs)
+  {
+    out << "  " << _formattedTensors[input_tensor_id] << ".reshape(";
+    printShape(out, tensors[input_tensor_id].shape);
+    out << ");\n";
+  }
+  for (size_t output_tensor_id : ma.getPersistentTensors())
+  {
+    out << "  " << _formattedTensors[output_tensor_id] << ".reset(new Tensor(";
+    printShape(out, tensors[output_tensor_id].shape);
+    out << "));\n";
+  }
+  out << "}\n\n";
   // gen NN destructor
   out << class_name << "::~" << class_name << "()\n"
                                               "{\n"
+                                              "  delete[] _arena;\n"
                                               "  releaseParameters(_parameters, _paramSize);\n"
                                               "}\n\n";
   // generate input setters
   // generate main setter if network has only one
-  const auto &inputs = ma.getInputs();
-  const auto &tensors = ma.getTensors();
   if (inputs.size() == 1)
   {
     const TensorDescriptor &td = tensors[inputs[0]];
@@ -475,11 +514,6 @@ void CPPCodeGenerator::materializeCode(ostream &out, const ModelAnalyzer &ma, co
   }
   out << "void " << class_name << "::doInference()\n"
                                   "{\n";
-  for (size_t output_tensor_id : ma.getPersistentTensors())
-  {
-    const string &output_tensor_name = _formattedTensors[output_tensor_id];
-    out << "  " << output_tensor_name << ".reset(new Tensor());\n";
-  }
 
   // gen inference sequence
   materializeInferenceSequence(out, ma);
@@ -20,6 +20,7 @@
 #include "mir/Graph.h"
 #include "mir/OpDefs.h"
 
+#include <algorithm>
 #include <stack>
 #include <map>
 
@@ -61,8 +62,9 @@ void ModelAnalyzer::appendOperationToInference(Operation *op, const string &func
     for (const auto &output : op->getOutputs())
     {
       const auto &tensor_name = output.getName();
-      const auto tensor_id =
-          tensor_name.empty() ? declareTemporaryTensor() : declarePersistentTensor(tensor_name);
+      const auto tensor_id = tensor_name.empty()
+                                 ? declareTemporaryTensor(output.getShape())
+                                 : declarePersistentTensor(tensor_name, output.getShape());
       node_output_tensors.push_back(tensor_id);
     }
   }
@@ -87,11 +89,6 @@ void ModelAnalyzer::appendOperationToInference(Operation *op, const string &func
   _opToDescr[op] = _inferenceSequence.back().get();
 }
 
-void ModelAnalyzer::updateMaxTemporarySize(const size_t size)
-{
-  _max_temp_size = std::max(_max_temp_size, size);
-}
-
 size_t ModelAnalyzer::declareInputTensor(const std::string &name, const mir::Shape &shape)
 {
   assert(!name.empty() && "Input tensor must have name");
@@ -101,11 +98,11 @@ size_t ModelAnalyzer::declareInputTensor(const std::string &name, const mir::Sha
   return id;
 }
 
-size_t ModelAnalyzer::declarePersistentTensor(const std::string &name)
+size_t ModelAnalyzer::declarePersistentTensor(const std::string &name, const mir::Shape &shape)
 {
   assert(!name.empty());
   size_t id = _allocatedTensors++;
-  _tensors.push_back({id, TensorDescriptor::Type::persistent, name, {}});
+  _tensors.push_back({id, TensorDescriptor::Type::persistent, name, shape});
   _persistent_tensors.push_back(id);
   return id;
 }
@@ -117,6 +114,14 @@ size_t ModelAnalyzer::declareTemporaryTensor()
   return id;
 }
 
+size_t ModelAnalyzer::declareTemporaryTensor(const mir::Shape &shape)
+{
+  size_t id = _allocatedTensors++;
+  _tensors.push_back({id, TensorDescriptor::Type::temporary, "", shape});
+  _arena_offsets[id] = 0;
+  return id;
+}
+
 void ModelAnalyzer::gatherDefUseInfo(const vector<unique_ptr<Action>> &post_order,
                                      map<size_t, size_t> &first_def, map<size_t, size_t> &last_use)
 {
@@ -145,6 +150,9 @@ void ModelAnalyzer::gatherDefUseInfo(const vector<unique_ptr<Action>> &post_orde
       if (td.type != TensorDescriptor::Type::temporary)
         continue;
 
+      // scratch buffers of operations are only passed as inputs
+      if (!first_def.count(input_tensor_id))
+        first_def[input_tensor_id] = pos;
       last_use[input_tensor_id] = pos;
     }
   }
@@ -184,16 +192,18 @@ void ModelAnalyzer::constructInferenceSequence(const vector<Operation *> &post_o
     assert(call);
 
     // construct required temporary tensors
-    for (size_t output_tensor_id : call->outputs)
+    vector<size_t> used_tensors(call->inputs);
+    used_tensors.insert(used_tensors.end(), call->outputs.begin(), call->outputs.end());
+    for (size_t tensor_id : used_tensors)
     {
-      const TensorDescriptor &td = _tensors[output_tensor_id];
-      assert(td.id == output_tensor_id);
+      const TensorDescriptor &td = _tensors[tensor_id];
+      assert(td.id == tensor_id);
       if (td.type != TensorDescriptor::Type::temporary)
         continue;
 
-      if (first_def[output_tensor_id] == pos)
+      if (first_def[tensor_id] == pos)
       {
-        unique_ptr<Action> tmp_constructor(new CreateTmp(output_tensor_id));
+        unique_ptr<Action> tmp_constructor(new CreateTmp(tensor_id));
         _inferenceSequence.push_back(std::move(tmp_constructor));
       }
     }
@@ -228,6 +238,85 @@ void ModelAnalyzer::collectOutputs(const mir::Graph *g)
   }
 }
 
+void ModelAnalyzer::planArena()
+{
+  // Alignment of tensors in the arena, in elements
+  const size_t alignment = 4;
+
+  struct Usage
+  {
+    size_t id;
+    size_t size;
+    size_t first_use;
+    size_t last_use;
+  };
+
+  // gather lifetimes of tensors in terms of positions of operation calls
+  map<size_t, Usage> usages;
+  for (size_t pos = 0; pos < _inferenceSequence.size(); ++pos)
+  {
+    const auto *call = dynamic_cast<const CallFunction *>(_inferenceSequence[pos].get());
+    if (call == nullptr)
+      continue;
+
+    vector<size_t> used_tensors(call->inputs);
+    used_tensors.insert(used_tensors.end(), call->outputs.begin(), call->outputs.end());
+    for (size_t tensor_id : used_tensors)
+    {
+      if (!_arena_offsets.count(tensor_id))
+        continue;
+
+      auto it = usages.find(tensor_id);
+      if (it == usages.end())
+      {
+        const auto num_elements = static_cast<size_t>(_tensors[tensor_id].shape.numElements());
+        const size_t size = (num_elements + alignment - 1) / alignment * alignment;
+        usages.emplace(tensor_id, Usage{tensor_id, size, pos, pos});
+      }
+      else
+      {
+        it->second.last_use = pos;
+      }
+    }
+  }
+
+  vector<const Usage *> order;
+  for (const auto &item : usages)
+    order.push_back(&item.second);
+  std::stable_sort(order.begin(), order.end(),
+                   [](const Usage *a, const Usage *b) { return a->size > b->size; });
+
+  vector<const Usage *> placed;
+  _arena_size = 0;
+  for (const Usage *usage : order)
+  {
+    // tensors alive at the same time, in order of offsets
+    vector<const Usage *> alive;
+    for (const Usage *other : placed)
+    {
+      if (other->first_use <= usage->last_use && usage->first_use <= other->last_use)
+        alive.push_back(other);
+    }
+    std::sort(alive.begin(), alive.end(), [this](const Usage *a, const Usage *b) {
+      return _arena_offsets[a->id] < _arena_offsets[b->id];
+    });
+
+    // take the first gap large enough
+    size_t offset = 0;
+    for (const Usage *other : alive)
+    {
+      const size_t other_offset = _arena_offsets[other->id];
+      if (other_offset >= offset + usage->size)
+        break;
+      offset = std::max(offset, other_offset + other->size);
+    }
+
+    _arena_offsets[usage->id] = offset;
+    _arena_size = std::max(_arena_size, offset + usage->size);
+    placed.push_back(usage);
+  }
+}
+
 void ModelAnalyzer::analyze(const mir::Graph *g)
 {
   // Current path through graph
@@ -246,9 +335,6 @@ void ModelAnalyzer::analyze(const mir::Graph *g)
     }
   }
 
-  // Register temporary tensor for im2col buffer
-  _temp_tensor_id = declareTemporaryTensor();
-
   // Walk all network inputs
   for (Operation *in : init_ops)
   {
@@ -295,6 +381,8 @@ void ModelAnalyzer::analyze(const mir::Graph *g)
   constructInferenceSequence(post_order);
 
   collectOutputs(g);
+
+  planArena();
 }
 
 void ModelAnalyzer::visit(ops::ConcatOp &op) { appendOperationToInference(&op, "concat"); }
@@ -306,8 +394,9 @@ void ModelAnalyzer::visit(ops::Conv2DOp &op)
   const auto &out_shape = op.getOutputShape(0);
   const int32_t tmp_size = kernel_shape.dim(1) * kernel_shape.dim(2) * kernel_shape.dim(3) *
                            out_shape.dim(0) * out_shape.dim(1) * out_shape.dim(2);
-  updateMaxTemporarySize(static_cast<size_t>(tmp_size));
-  appendOperationToInference(&op, "conv2d", {_temp_tensor_id});
+  // im2col buffer
+  const size_t tmp_id = declareTemporaryTensor(mir::Shape{tmp_size});
+  appendOperationToInference(&op, "conv2d", {tmp_id});
 }
 
 void ModelAnalyzer::visit(ops::DepthwiseConv2DOp &op)
@@ -389,8 +478,11 @@ void ModelAnalyzer::visit(mir::ops::DeConv2DOp &op)
   const auto &out_shape = op.getOutputShape(0);
   const int32_t tmp_size = kernel_shape.dim(0) * kernel_shape.dim(1) * kernel_shape.dim(3) *
                            out_shape.dim(0) * out_shape.dim(1) * out_shape.dim(2);
-  updateMaxTemporarySize(static_cast<size_t>(tmp_size));
-  appendOperationToInference(&op, "convTransposed2d", {_temp_tensor_id});
+  // im2col buffer
+  const size_t tmp_id = declareTemporaryTensor(mir::Shape{tmp_size});
+  // kernel transposed from HWOI to OHWI
+  const size_t kernel_tmp_id = declareTemporaryTensor(mir::Shape{kernel_shape.numElements()});
+  appendOperationToInference(&op, "convTransposed2d", {tmp_id, kernel_tmp_id});
 }
 
 void ModelAnalyzer::visit(ops::SqueezeOp &op) { appendOperationToInference(&op, "reshape"); }
@@ -401,7 +493,9 @@ void ModelAnalyzer::visit(mir::ops::PadOp &op) { appendOperationToInference(&op,
 
 void ModelAnalyzer::visit(mir::ops::ReduceMeanOp &op)
 {
-  appendOperationToInference(&op, "reduceMean");
+  // buffer of sums, as large as output
+  const size_t tmp_id = declareTemporaryTensor(mir::Shape{op.getOutputShape(0).numElements()});
+  appendOperationToInference(&op, "reduceMean", {tmp_id});
 }
 
 void ModelAnalyzer::visit(mir::ops::TransposeOp &op)
@@ -119,9 +119,16 @@ public:
    */
   const std::string &getModelName() const { return _modelName; }
 
-  size_t getMaxTemporarySize() const { return _max_temp_size; }
+  /**
+   * @return Size of the arena for temporary tensors, in elements
+   */
+  size_t getArenaSize() const { return _arena_size; }
 
-  size_t getTempTID() const { return _temp_tensor_id; }
+  /**
+   * @return Offsets in the arena of temporary tensors, in elements, by tensor id.
+   * Temporary tensors not in the arena (constants) refer to the model parameters instead.
+   */
+  const std::map<size_t, size_t> &getArenaOffsets() const { return _arena_offsets; }
 
 protected:
   void visit_fallback(mir::Operation &op) override;
@@ -140,12 +147,6 @@ private:
   void appendOperationToInference(mir::Operation *op, const std::string &function_name,
                                   std::vector<size_t> aux_args = {});
 
-  /**
-   * @brief Registers a temporary buffer of size *size* used by op *op_id*
-   * @param size Size of buffer
-   */
-  void updateMaxTemporarySize(size_t size);
-
   /**
    * @brief Declares input tensor in artifact
    * @param name Name of tensor
@@ -157,16 +158,24 @@ private:
   /**
    * @brief Declares persistent tensor in artifact
    * @param name Name of variable, if empty - assigned automaticly
+   * @param shape Shape of tensor
    * @return Id of created tensor
    */
-  size_t declarePersistentTensor(const std::string &name);
+  size_t declarePersistentTensor(const std::string &name, const mir::Shape &shape);
 
   /**
-   * @brief Declares temporary tensor in artifact
+   * @brief Declares temporary tensor in artifact, which refers to data of model parameters
    * @return Id of created tensor
    */
   size_t declareTemporaryTensor();
 
+  /**
+   * @brief Declares temporary tensor in artifact, which is placed in the arena
+   * @param shape Shape of tensor
+   * @return Id of created tensor
+   */
+  size_t declareTemporaryTensor(const mir::Shape &shape);
+
   /**
    * @brief Gathers info where tensors were defined and used in inference sequence
    * @param sequence Sequence of operations in inference
@@ -188,6 +197,14 @@ private:
    */
   void collectOutputs(const mir::Graph *g);
 
+  /**
+   * @brief Assigns offsets in the arena to temporary tensors
+   *
+   * Tensors which are alive at the same time in inference sequence get disjoint memory,
+   * larger tensors are placed first.
+   */
+  void planArena();
+
   std::string _modelName = "NN";
   std::vector<std::unique_ptr<sir::Action>> _inferenceSequence;
   size_t _allocatedTensors = 0;
@@ -196,8 +213,9 @@ private:
   std::vector<size_t> _persistent_tensors;
   /// @brief list of tensor ids corresponding to NN outputs
   std::vector<size_t> _outputs;
-  size_t _max_temp_size = 0;
-  size_t _temp_tensor_id = 0;
+  /// @brief offsets of temporary tensors in the arena, in elements
+  std::map<size_t, size_t> _arena_offsets;
+  size_t _arena_size = 0;
   std::vector<sir::TensorDescriptor> _tensors;
   std::map<const mir::Operation *, const sir::Action *> _opToDescr;
 };
@@ -44,7 +44,8 @@ struct TensorDescriptor
    * input      tensors of this type supposed to be set outside of artifact
    * persistent tensors store data after inference process is over, this include NN outputs
    * temporary  tensors are not accessible outside artifact in any way,
-   *            they are created and destructed on demand
+   *            they are created and destructed on demand, placed in the arena of artifact
+   *            or referring to model parameters
    */
   enum class Type
   {
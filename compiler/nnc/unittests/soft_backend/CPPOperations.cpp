@@ -529,6 +529,7 @@ TEST(cpp_operations_test, convTransposed2d)
   // to 1
   using iT = int32_t;
   Tensor temporary(Shape({1024 * 40}));
+  Tensor kernel_temporary(Shape({4 * 4 * 3 * 3}));
   for (iT kernel_h = 2; kernel_h <= 4; ++kernel_h)
     for (iT kernel_w = 2; kernel_w <= 4; ++kernel_w)
       for (iT input_c = 1; input_c <= 3; ++input_c)
@@ -552,7 +553,7 @@ TEST(cpp_operations_test, convTransposed2d)
               };
 
               createAndRunTestGraph(op_generator, convTransposed2d, input_ntensors, input_atensor0,
-                                    input_atensor1, temporary);
+                                    input_atensor1, temporary, kernel_temporary);
             }
 }
 
@@ -843,7 +844,8 @@ TEST(cpp_operations_test, reduceMeanTst)
         return op;
       };
 
-      createAndRunTestGraph(op_generator, reduceMean, input_ntensors, input_atensor);
+      Tensor temporary(Shape({2 * 3 * 4 * 5}));
+      createAndRunTestGraph(op_generator, reduceMean, input_ntensors, input_atensor, temporary);
     }
   }
 }
@@ -19,9 +19,12 @@
 #include "mir/ops/InputOp.h"
 #include "mir/ops/ReluOp.h"
 #include "mir/ops/ConcatOp.h"
+#include "mir/ops/ReduceMeanOp.h"
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 using namespace std;
 using namespace nnc;
 using namespace mir;
@@ -81,3 +84,64 @@ TEST(ModelAnalyzer, linearization)
   vector<Operation *> valid_seq2{input, head2, tail2, head1, tail1, join};
   ASSERT_TRUE(op_seq == valid_seq1 || op_seq == valid_seq2);
 }
+
+/*
+ * This test checks that temporary tensors alive at the same time do not share memory in the arena,
+ * while others reuse it
+ */
+TEST(ModelAnalyzer, arena)
+{
+  mir::Graph g;
+  // [input] -> [relu1] -> [relu2] -> [relu3] -> [relu4]
+  mir::TensorType input_type{mir::DataType::FLOAT32, Shape{1, 2, 3}};
+  Operation *input = g.create<ops::InputOp>(input_type);
+  Operation *relu1 = g.create<ops::ReluOp>(input->getOutput(0));
+  Operation *relu2 = g.create<ops::ReluOp>(relu1->getOutput(0));
+  Operation *relu3 = g.create<ops::ReluOp>(relu2->getOutput(0));
+  Operation *relu4 = g.create<ops::ReluOp>(relu3->getOutput(0));
+  input->getOutput(0)->setName("input");
+  relu4->getOutput(0)->setName("output");
+
+  ModelAnalyzer ma;
+  ma.analyze(&g);
+
+  // outputs of relu1, relu2 and relu3 are temporary
+  const auto &offsets = ma.getArenaOffsets();
+  ASSERT_EQ(offsets.size(), 3u);
+  vector<size_t> tensor_offsets;
+  for (const auto &item : offsets)
+    tensor_offsets.push_back(item.second);
+  ASSERT_NE(tensor_offsets[0], tensor_offsets[1]);
+  ASSERT_NE(tensor_offsets[1], tensor_offsets[2]);
+  ASSERT_EQ(tensor_offsets[0], tensor_offsets[2]);
+  // 6 elements of each tensor are aligned to 8
+  ASSERT_EQ(ma.getArenaSize(), 16u);
+}
+
+/*
+ * This test checks that scratch buffers of operations are placed in the arena as well
+ */
+TEST(ModelAnalyzer, arena_scratch)
+{
+  mir::Graph g;
+  // [input] -> [relu] -> [mean]
+  mir::TensorType input_type{mir::DataType::FLOAT32, Shape{2, 3, 4}};
+  Operation *input = g.create<ops::InputOp>(input_type);
+  Operation *relu = g.create<ops::ReluOp>(input->getOutput(0));
+  Operation *mean = g.create<ops::ReduceMeanOp>(relu->getOutput(0), vector<int>{2}, false);
+  input->getOutput(0)->setName("input");
+  mean->getOutput(0)->setName("output");
+
+  ModelAnalyzer ma;
+  ma.analyze(&g);
+
+  // output of relu and the sum buffer of mean are temporary, and used by mean at the same time
+  const auto &offsets = ma.getArenaOffsets();
+  ASSERT_EQ(offsets.size(), 2u);
+  vector<size_t> tensor_offsets;
+  for (const auto &item : offsets)
+    tensor_offsets.push_back(item.second);
+  ASSERT_NE(tensor_offsets[0], tensor_offsets[1]);
+  // 24 elements of relu and 6 elements of sums aligned to 8
+  ASSERT_EQ(ma.getArenaSize(), 32u);
+}
@@ -0,0 +1,122 @@
+#!/bin/bash
+
+# Measure wall time and peak RSS of tflite2circle converting a large model
+#
+# The model is made of fully connected layers, whose weights are about
+# LAYERS x DIM x DIM x 4 bytes in total (1GB by default).
+
+usage()
+{
+  echo "$0 <options>"
+  echo "Options"
+  echo "--tflite2circle : tflite2circle path"
+  echo "--tflchef-file  : tflchef-file path, to generate the model"
+  echo "--model  : tflite model to convert (generated if not given)"
+  echo "--layers : the number of layers of generated model (default: 1024)"
+  echo "--dim    : the size of layers of generated model (default: 512)"
+  echo "--repeat : the number of runs (default: 3)"
+  echo "--workdir : the dir for models (default: temporary dir)"
+  exit 1
+}
+
+tflite2circle="tflite2circle"
+tflchef_file="tflchef-file"
+model=""
+layers=1024
+dim=512
+repeat=3
+workdir=""
+
+for i in "$@"
+do
+case $i in
+  --tflite2circle=*)
+    tflite2circle="${i#*=}"
+    ;;
+  --tflchef-file=*)
+    tflchef_file="${i#*=}"
+    ;;
+  --model=*)
+    model="${i#*=}"
+    ;;
+  --layers=*)
+    layers="${i#*=}"
+    ;;
+  --dim=*)
+    dim="${i#*=}"
+    ;;
+  --repeat=*)
+    repeat="${i#*=}"
+    ;;
+  --workdir=*)
+    workdir="${i#*=}"
+    ;;
+  *)
+    usage
+    ;;
+esac
+shift
+done
+
+if ! [ -x /usr/bin/time ]; then
+  echo "/usr/bin/time is required to measure peak RSS."
+  exit 1
+fi
+
+if [ -z "${workdir}" ]; then
+  workdir="$(mktemp -d)"
+  trap "rm -rf ${workdir}" EXIT
+fi
+
+generate_recipe()
+{
+  echo "operand { name: \"act_0\" type: FLOAT32 shape { dim: 1 dim: ${dim} } }"
+  for ((n = 0; n < layers; n++)); do
+    echo "operand {"
+    echo "  name: \"weight_${n}\" type: FLOAT32 shape { dim: ${dim} dim: ${dim} }"
+    echo "  filler { tag: \"gaussian\" arg: \"0.0\" arg: \"1.0\" }"
+    echo "}"
+    echo "operand {"
+    echo "  name: \"bias_${n}\" type: FLOAT32 shape { dim: ${dim} }"
+    echo "  filler { tag: \"gaussian\" arg: \"0.0\" arg: \"1.0\" }"
+    echo "}"
+    echo "operand { name: \"act_$((n + 1))\" type: FLOAT32 shape { dim: 1 dim: ${dim} } }"
+    echo "operation {"
+    echo "  type: \"FullyConnected\""
+    echo "  fullyconnected_options { activation: RELU }"
+    echo "  input: \"act_${n}\" input: \"weight_${n}\" input: \"bias_${n}\""
+    echo "  output: \"act_$((n + 1))\""
+    echo "}"
+  done
+  echo "input: \"act_0\""
+  echo "output: \"act_${layers}\""
+}
+
+if [ -z "${model}" ]; then
+  model="${workdir}/large_${layers}x${dim}.tflite"
+  echo "Generating ${model} ..."
+  generate_recipe > "${workdir}/large.recipe"
+  if ! "${tflchef_file}" "${workdir}/large.recipe" "${model}"; then
+    echo "Failed to generate model."
+    exit 1
+  fi
+fi
+
+echo "Model: ${model} ($(stat -c %s "${model}") bytes)"
+
+for ((run = 0; run < repeat; run++)); do
+  # Drop the converted model of the previous run not to measure its writeback
+  rm -f "${workdir}/out.circle"
+  sync
+
+  /usr/bin/time -v "${tflite2circle}" "${model}" "${workdir}/out.circle" 2> "${workdir}/time.log"
+  if [ $? -ne 0 ]; then
+    cat "${workdir}/time.log"
+    echo "Failed to convert model."
+    exit 1
+  fi
+
+  wall_time="$(grep "Elapsed (wall clock) time" "${workdir}/time.log" | awk '{print $NF}')"
+  peak_rss="$(grep "Maximum resident set size" "${workdir}/time.log" | awk '{print $NF}')"
+  echo "Run ${run}: wall time ${wall_time}, peak RSS ${peak_rss} KB"
+done
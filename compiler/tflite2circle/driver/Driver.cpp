@@ -14,7 +14,10 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <fstream>
 #include <iostream>
+#include <limits>
 #include <vector>
 
 #include "CircleModel.h"
@@ -39,7 +42,12 @@ int entry(int argc, char **argv)
   }
 
   // create flatbuffer builder
-  auto flatbuffer_builder = stdex::make_unique<flatbuffers::FlatBufferBuilder>(1024);
+  // NOTE Reserve as large as the tflite model, which circle model is about as large as,
+  //      not to grow (and copy) the buffer again and again for large models
+  const size_t initial_size =
+      std::min<size_t>(std::max<size_t>(1024, tfl_model.size() + tfl_model.size() / 64),
+                       std::numeric_limits<flatbuffers::soffset_t>::max());
+  auto flatbuffer_builder = stdex::make_unique<flatbuffers::FlatBufferBuilder>(initial_size);
 
   // convert tflite to circle
   tflite2circle::CircleModel circle_model{flatbuffer_builder, tfl_model};
@@ -64,7 +64,8 @@ private:
 
 public:
   Offset(void) = delete;
-  Offset(FlatBufBuilder &fb, const TFLFlatBufVec *tflite_flatbuffer_vec);
+  // Large vectors of tables are built in 'num_chunks' threads (0 to decide by the size)
+  Offset(FlatBufBuilder &fb, const TFLFlatBufVec *tflite_flatbuffer_vec, uint32_t num_chunks = 0);
 
 public:
   CIRFlatBufVecOffset offset(void) const { return _circle_flatbuffer_vec_offset; }
@@ -80,7 +81,7 @@ private:
 
 public:
   CircleModel(void) = delete;
-  CircleModel(FlatBufBuilder &fb, TFLModel &tfl_model);
+  CircleModel(FlatBufBuilder &fb, TFLModel &tfl_model, uint32_t num_chunks = 0);
 
 public:
   void model_build(void) const;
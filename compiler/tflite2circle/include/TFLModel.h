@@ -18,9 +18,7 @@
 #define __TFL_MODEL_H__
 
 #include <iostream>
-#include <fstream>
 #include <string>
-#include <vector>
 
 #include <mio/tflite/schema_generated.h>
 
@@ -29,22 +27,26 @@ namespace tflite2circle
 
 class TFLModel
 {
-private:
-  using DataBuffer = std::vector<char>;
-
 public:
   TFLModel(void) = delete;
   TFLModel(const std::string &path);
+  ~TFLModel();
+
+public:
+  TFLModel(const TFLModel &) = delete;
+  TFLModel &operator=(const TFLModel &) = delete;
 
 public:
   bool is_valid(void) { return _valid; }
+  size_t size(void) const { return _size; }
 
 private:
   const tflite::Model *load_model(void);
 
 private:
-  std::ifstream _infile;
-  DataBuffer _data;
+  // The file is mapped in memory, so that buffers are copied from the page cache directly
+  void *_data;
+  size_t _size;
   bool _valid;
 
   friend class CircleModel;
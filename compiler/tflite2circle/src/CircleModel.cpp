@@ -18,12 +18,14 @@
 
 #include "CircleModel.h"
 #include "DataLookup.h"
+#include "ParallelBuild.h"
 
 namespace tflite2circle
 {
 
 template <>
-Offset<MetaDataBufferLink>::Offset(FlatBufBuilder &fb, const TFLFlatBufVec *tflite_flatbuffer_vec)
+Offset<MetaDataBufferLink>::Offset(FlatBufBuilder &fb, const TFLFlatBufVec *tflite_flatbuffer_vec,
+                                   uint32_t)
 {
   if (tflite_flatbuffer_vec == nullptr)
     return;
@@ -33,7 +35,8 @@ Offset<MetaDataBufferLink>::Offset(FlatBufBuilder &fb, const TFLFlatBufVec *tfli
 }
 
 template <>
-Offset<BufferLink>::Offset(FlatBufBuilder &fb, const TFLFlatBufVec *tflite_flatbuffer_vec)
+Offset<BufferLink>::Offset(FlatBufBuilder &fb, const TFLFlatBufVec *tflite_flatbuffer_vec,
+                           uint32_t)
 {
   std::vector<flatbuffers::Offset<circle::Buffer>> buffers_vec;
 
@@ -42,8 +45,10 @@ Offset<BufferLink>::Offset(FlatBufBuilder &fb, const TFLFlatBufVec *tflite_flatb
     flatbuffers::Offset<flatbuffers::Vector<uint8_t>> buffer_data;
     if (it->data())
     {
-      std::vector<uint8_t> data_vec{it->data()->begin(), it->data()->end()};
-      buffer_data = fb->CreateVector(data_vec);
+      // Copy data in bulk from the model file, aligned as 'force_align' in schema
+      const auto size = it->data()->size();
+      fb->ForceVectorAlignment(size, sizeof(uint8_t), 16);
+      buffer_data = fb->CreateVector(it->data()->data(), size);
     }
     circle::BufferBuilder circle_buffer_builder{*fb};
     circle_buffer_builder.add_data(buffer_data);
@@ -53,132 +58,131 @@ Offset<BufferLink>::Offset(FlatBufBuilder &fb, const TFLFlatBufVec *tflite_flatb
   _circle_flatbuffer_vec_offset = fb->CreateVector(buffers_vec);
 }
 
+namespace
+{
+
+flatbuffers::Offset<circle::Tensor> build_circle_tensor(flatbuffers::FlatBufferBuilder &fb,
+                                                        const tflite::Tensor *it)
+{
+  // shape
+  flatbuffers::Offset<flatbuffers::Vector<int32_t>> shape;
+  if (it->shape())
+  {
+    shape = fb.CreateVector(it->shape()->data(), it->shape()->size());
+  }
+  // name
+  flatbuffers::Offset<flatbuffers::String> name;
+  if (it->name())
+    name = fb.CreateString(it->name());
+  // quantization
+  flatbuffers::Offset<circle::QuantizationParameters> quantization;
+  if (it->quantization())
+  {
+    flatbuffers::Offset<flatbuffers::Vector<float>> min;
+    flatbuffers::Offset<flatbuffers::Vector<float>> max;
+    flatbuffers::Offset<flatbuffers::Vector<float>> scale;
+    flatbuffers::Offset<flatbuffers::Vector<int64_t>> zero_point;
+
+    if (it->quantization()->min() && it->quantization()->max())
+    {
+      auto rmin = it->quantization()->min();
+      auto rmax = it->quantization()->max();
+      min = fb.CreateVector(rmin->data(), rmin->size());
+      max = fb.CreateVector(rmax->data(), rmax->size());
+    }
+
+    if (it->quantization()->scale() && it->quantization()->zero_point())
+    {
+      auto rs = it->quantization()->scale();
+      auto rz = it->quantization()->zero_point();
+      scale = fb.CreateVector(rs->data(), rs->size());
+      zero_point = fb.CreateVector(rz->data(), rz->size());
+    }
+
+    quantization = circle::CreateQuantizationParameters(fb, min, max, scale, zero_point);
+  }
+  // is_variable
+  bool is_variable = it->is_variable();
+
+  circle::TensorBuilder tensor_builder{fb};
+  tensor_builder.add_shape(shape);
+  tensor_builder.add_type(get_circle_tensortype(it->type()));
+  tensor_builder.add_buffer(it->buffer());
+  tensor_builder.add_name(name);
+  tensor_builder.add_quantization(quantization);
+  tensor_builder.add_is_variable(is_variable);
+  return tensor_builder.Finish();
+}
+
+flatbuffers::Offset<circle::Operator> build_circle_operator(flatbuffers::FlatBufferBuilder &fb,
+                                                            const tflite::Operator *it)
+{
+  // inputs
+  auto circle_inputs = fb.CreateVector(it->inputs()->data(), it->inputs()->size());
+  // outputs
+  auto circle_outputs = fb.CreateVector(it->outputs()->data(), it->outputs()->size());
+  // builtin options
+  auto circle_builtin_options = get_circle_builtin_options(fb, it);
+  auto circle_builtin_options_type = get_circle_builtin_options_type(it);
+  // custom options
+  flatbuffers::Offset<flatbuffers::Vector<uint8_t>> circle_custom_options;
+  if (it->custom_options())
+  {
+    circle_custom_options =
+        fb.CreateVector(it->custom_options()->data(), it->custom_options()->size());
+  }
+  // custom options format
+  // TODO Make get_circle_custom_options_format
+  assert(it->custom_options_format() == tflite::CustomOptionsFormat_FLEXBUFFERS);
+  auto circle_custom_options_format = circle::CustomOptionsFormat_FLEXBUFFERS;
+
+  circle::OperatorBuilder operator_builder{fb};
+  operator_builder.add_opcode_index(it->opcode_index());
+  operator_builder.add_inputs(circle_inputs);
+  operator_builder.add_outputs(circle_outputs);
+  operator_builder.add_builtin_options(circle_builtin_options);
+  operator_builder.add_builtin_options_type(circle_builtin_options_type);
+  operator_builder.add_custom_options(circle_custom_options);
+  operator_builder.add_custom_options_format(circle_custom_options_format);
+  // TODO mutating_variable_inputs
+  return operator_builder.Finish();
+}
+
+} // namespace
+
 template <>
-Offset<SubGraphLink>::Offset(FlatBufBuilder &fb, const TFLFlatBufVec *tflite_flatbuffer_vec)
+Offset<SubGraphLink>::Offset(FlatBufBuilder &fb, const TFLFlatBufVec *tflite_flatbuffer_vec,
+                             uint32_t num_chunks)
 {
   std::vector<flatbuffers::Offset<circle::SubGraph>> subgprahs_vec;
 
   for (auto it_sg : *tflite_flatbuffer_vec)
   {
     // tensors of subgraph
-    std::vector<flatbuffers::Offset<circle::Tensor>> tensor_vec;
-
     auto tflite_tensors = it_sg->tensors();
-    for (auto it : *tflite_tensors)
-    {
-      // shape
-      flatbuffers::Offset<flatbuffers::Vector<int32_t>> shape;
-      if (it->shape())
-      {
-        auto shape_vec = std::vector<int32_t>({it->shape()->begin(), it->shape()->end()});
-        shape = fb->CreateVector(shape_vec);
-      }
-      // name
-      flatbuffers::Offset<flatbuffers::String> name;
-      if (it->name())
-        name = fb->CreateString(it->name()->str());
-      // quantization
-      flatbuffers::Offset<circle::QuantizationParameters> quantization;
-      if (it->quantization())
-      {
-        std::vector<float> tfmin;
-        std::vector<float> tfmax;
-        std::vector<float> tfscale;
-        std::vector<int64_t> tfzerop;
-        flatbuffers::Offset<flatbuffers::Vector<float>> min;
-        flatbuffers::Offset<flatbuffers::Vector<float>> max;
-        flatbuffers::Offset<flatbuffers::Vector<float>> scale;
-        flatbuffers::Offset<flatbuffers::Vector<int64_t>> zero_point;
-
-        if (it->quantization()->min() && it->quantization()->max())
-        {
-          auto rmin = it->quantization()->min();
-          auto rmax = it->quantization()->max();
-          tfmin = std::vector<float>{rmin->begin(), rmin->end()};
-          tfmax = std::vector<float>{rmax->begin(), rmax->end()};
-          min = fb->CreateVector(tfmin);
-          max = fb->CreateVector(tfmax);
-        }
-
-        if (it->quantization()->scale() && it->quantization()->zero_point())
-        {
-          auto rs = it->quantization()->scale();
-          auto rz = it->quantization()->zero_point();
-          tfscale = std::vector<float>{rs->begin(), rs->end()};
-          tfzerop = std::vector<int64_t>{rz->begin(), rz->end()};
-          scale = fb->CreateVector(tfscale);
-          zero_point = fb->CreateVector(tfzerop);
-        }
-
-        quantization = circle::CreateQuantizationParameters(*fb, min, max, scale, zero_point);
-      }
-      // is_variable
-      bool is_variable = it->is_variable();
-
-      circle::TensorBuilder tensor_builder{*fb};
-      tensor_builder.add_shape(shape);
-      tensor_builder.add_type(get_circle_tensortype(it->type()));
-      tensor_builder.add_buffer(it->buffer());
-      tensor_builder.add_name(name);
-      tensor_builder.add_quantization(quantization);
-      tensor_builder.add_is_variable(is_variable);
-      auto tensor = tensor_builder.Finish();
-      tensor_vec.emplace_back(tensor);
-    }
+    auto build_tensor = [tflite_tensors](flatbuffers::FlatBufferBuilder &builder, uint32_t i) {
+      return build_circle_tensor(builder, tflite_tensors->Get(i));
+    };
+    auto tensor_vec =
+        build_parallel<circle::Tensor>(*fb, tflite_tensors->size(), build_tensor, num_chunks);
     auto circle_tensors = fb->CreateVector(tensor_vec);
 
     // inputs of subgraph
     auto tflite_inputs = it_sg->inputs();
-    std::vector<int32_t> input_vec{tflite_inputs->begin(), tflite_inputs->end()};
-
-    auto circle_inputs = fb->CreateVector(input_vec);
+    auto circle_inputs = fb->CreateVector(tflite_inputs->data(), tflite_inputs->size());
 
     // outputs of subgraph
     auto tflite_outputs = it_sg->outputs();
-    std::vector<int32_t> output_vec{tflite_outputs->begin(), tflite_outputs->end()};
-
-    auto circle_outputs = fb->CreateVector(output_vec);
+    auto circle_outputs = fb->CreateVector(tflite_outputs->data(), tflite_outputs->size());
 
     // operators of subgraph
-    std::vector<flatbuffers::Offset<circle::Operator>> operator_vec;
-
     auto tflite_operators = it_sg->operators();
-    for (auto it : *tflite_operators)
-    {
-      // inputs
-      std::vector<int32_t> input_vec{it->inputs()->begin(), it->inputs()->end()};
-      auto circle_inputs = fb->CreateVector(input_vec);
-      // outputs
-      std::vector<int32_t> output_vec{it->outputs()->begin(), it->outputs()->end()};
-      auto circle_outputs = fb->CreateVector(output_vec);
-      // builtin options
-      auto circle_builtin_options = get_circle_builtin_options(*fb, it);
-      auto circle_builtin_options_type = get_circle_builtin_options_type(it);
-      // custom options
-      flatbuffers::Offset<flatbuffers::Vector<uint8_t>> circle_custom_options;
-      if (it->custom_options())
-      {
-        std::vector<uint8_t> custom_options_vec{it->custom_options()->begin(),
-                                                it->custom_options()->end()};
-        circle_custom_options = fb->CreateVector(custom_options_vec);
-      }
-      // custom options format
-      // TODO Make get_circle_custom_options_format
-      assert(it->custom_options_format() == tflite::CustomOptionsFormat_FLEXBUFFERS);
-      auto circle_custom_options_format = circle::CustomOptionsFormat_FLEXBUFFERS;
-
-      circle::OperatorBuilder operator_builder{*fb};
-      operator_builder.add_opcode_index(it->opcode_index());
-      operator_builder.add_inputs(circle_inputs);
-      operator_builder.add_outputs(circle_outputs);
-      operator_builder.add_builtin_options(circle_builtin_options);
-      operator_builder.add_builtin_options_type(circle_builtin_options_type);
-      operator_builder.add_custom_options(circle_custom_options);
-      operator_builder.add_custom_options_format(circle_custom_options_format);
-      // TODO mutating_variable_inputs
-      auto opeartor = operator_builder.Finish();
-      operator_vec.emplace_back(opeartor);
-    }
+    auto build_operator = [tflite_operators](flatbuffers::FlatBufferBuilder &builder,
+                                             uint32_t i) {
+      return build_circle_operator(builder, tflite_operators->Get(i));
+    };
+    auto operator_vec = build_parallel<circle::Operator>(*fb, tflite_operators->size(),
+                                                         build_operator, num_chunks);
     auto circle_operators = fb->CreateVector(operator_vec);
 
     // name of subgraph
@@ -201,7 +205,8 @@ Offset<SubGraphLink>::Offset(FlatBufBuilder &fb, const TFLFlatBufVec *tflite_fla
 }
 
 template <>
-Offset<OperatorCodeLink>::Offset(FlatBufBuilder &fb, const TFLFlatBufVec *tflite_flatbuffer_vec)
+Offset<OperatorCodeLink>::Offset(FlatBufBuilder &fb, const TFLFlatBufVec *tflite_flatbuffer_vec,
+                                 uint32_t)
 {
   std::vector<flatbuffers::Offset<circle::OperatorCode>> operator_code_vec;
 
@@ -218,13 +223,14 @@ Offset<OperatorCodeLink>::Offset(FlatBufBuilder &fb, const TFLFlatBufVec *tflite
   _circle_flatbuffer_vec_offset = fb->CreateVector(operator_code_vec);
 }
 
-CircleModel::CircleModel(FlatBufBuilder &fb, TFLModel &model)
+CircleModel::CircleModel(FlatBufBuilder &fb, TFLModel &model, uint32_t num_chunks)
     : _version{0}, _description{fb->CreateString("nnpackage")}, _fb{fb}
 {
   const tflite::Model *tfl_model = model.load_model();
   _operator_codes_offset =
       stdex::make_unique<Offset<OperatorCodeLink>>(fb, tfl_model->operator_codes());
-  _subGraphs_offset = stdex::make_unique<Offset<SubGraphLink>>(fb, tfl_model->subgraphs());
+  _subGraphs_offset =
+      stdex::make_unique<Offset<SubGraphLink>>(fb, tfl_model->subgraphs(), num_chunks);
   _buffers_offset = stdex::make_unique<Offset<BufferLink>>(fb, tfl_model->buffers());
   _metadata_buffer_offset =
       stdex::make_unique<Offset<MetaDataBufferLink>>(fb, tfl_model->metadata_buffer());
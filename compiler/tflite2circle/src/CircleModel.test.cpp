@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CircleModel.h"
+#include "TFLModel.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+
+// More than kMinChunkElements, so that tensors and operators are split into chunks
+const uint32_t kNumTensors = 600;
+
+// Model: t(i + 1) = Add(t(i), t(i)) or Custom(t(i), t(i)), alternately
+// Some tensors are quantized with int64 zero points, and custom options are of odd sizes, so that
+// tables of various alignments are built
+flatbuffers::DetachedBuffer buildTFLModel(void)
+{
+  flatbuffers::FlatBufferBuilder fbb;
+
+  std::vector<flatbuffers::Offset<tflite::Buffer>> buffers{tflite::CreateBuffer(fbb)};
+
+  std::vector<flatbuffers::Offset<tflite::Tensor>> tensors;
+  for (uint32_t i = 0; i < kNumTensors; ++i)
+  {
+    const std::vector<int32_t> shape{1, static_cast<int32_t>(i % 5 + 1)};
+    const std::string name = "tensor_" + std::to_string(i);
+    flatbuffers::Offset<tflite::QuantizationParameters> quantization;
+    if (i % 3 == 0)
+    {
+      const std::vector<float> scale{0.5f + i};
+      const std::vector<int64_t> zero_point{static_cast<int64_t>(i) - 300};
+      quantization =
+          tflite::CreateQuantizationParametersDirect(fbb, nullptr, nullptr, &scale, &zero_point);
+    }
+    tensors.push_back(tflite::CreateTensorDirect(fbb, &shape, tflite::TensorType_FLOAT32, 0,
+                                                 name.c_str(), quantization, i % 7 == 0));
+  }
+
+  std::vector<flatbuffers::Offset<tflite::Operator>> operators;
+  for (uint32_t i = 0; i + 1 < kNumTensors; ++i)
+  {
+    const std::vector<int32_t> inputs{static_cast<int32_t>(i), static_cast<int32_t>(i)};
+    const std::vector<int32_t> outputs{static_cast<int32_t>(i + 1)};
+    if (i % 2 == 0)
+    {
+      const auto activation = i % 4 == 0 ? tflite::ActivationFunctionType_RELU
+                                         : tflite::ActivationFunctionType_NONE;
+      operators.push_back(tflite::CreateOperatorDirect(
+          fbb, 0, &inputs, &outputs, tflite::BuiltinOptions_AddOptions,
+          tflite::CreateAddOptions(fbb, activation).Union()));
+    }
+    else
+    {
+      const std::vector<uint8_t> custom_options(i % 7, static_cast<uint8_t>(i));
+      operators.push_back(tflite::CreateOperatorDirect(fbb, 1, &inputs, &outputs,
+                                                       tflite::BuiltinOptions_NONE, 0,
+                                                       &custom_options));
+    }
+  }
+
+  const std::vector<int32_t> inputs{0};
+  const std::vector<int32_t> outputs{static_cast<int32_t>(kNumTensors - 1)};
+  std::vector<flatbuffers::Offset<tflite::SubGraph>> subgraphs{
+      tflite::CreateSubGraphDirect(fbb, &tensors, &inputs, &outputs, &operators, "main")};
+
+  std::vector<flatbuffers::Offset<tflite::OperatorCode>> operator_codes{
+      tflite::CreateOperatorCode(fbb, tflite::BuiltinOperator_ADD),
+      tflite::CreateOperatorCodeDirect(fbb, tflite::BuiltinOperator_CUSTOM, "Custom")};
+
+  auto model = tflite::CreateModelDirect(fbb, 3, &operator_codes, &subgraphs, "test", &buffers);
+  tflite::FinishModelBuffer(fbb, model);
+  return fbb.Release();
+}
+
+class TFLModelFile
+{
+public:
+  TFLModelFile() : _path{"tflite2circle_test_XXXXXX"}
+  {
+    const int fd = mkstemp(&_path[0]);
+    if (fd < 0)
+      throw std::runtime_error("Failed to create a temporary file");
+    close(fd);
+
+    const auto model = buildTFLModel();
+    std::ofstream file(_path, std::ios::binary);
+    file.write(reinterpret_cast<const char *>(model.data()), model.size());
+  }
+
+  ~TFLModelFile() { std::remove(_path.c_str()); }
+
+public:
+  const std::string &path(void) const { return _path; }
+
+private:
+  std::string _path;
+};
+
+// Convert the model and return the circle model
+std::vector<char> convert(const std::string &path, uint32_t num_chunks)
+{
+  tflite2circle::TFLModel tfl_model(path);
+  EXPECT_TRUE(tfl_model.is_valid());
+
+  auto fb = stdex::make_unique<flatbuffers::FlatBufferBuilder>(1024);
+  tflite2circle::CircleModel circle_model{fb, tfl_model, num_chunks};
+  return std::vector<char>(circle_model.base(), circle_model.base() + circle_model.size());
+}
+
+template <typename T> std::vector<T> values(const flatbuffers::Vector<T> *vec)
+{
+  return vec == nullptr ? std::vector<T>{} : std::vector<T>(vec->begin(), vec->end());
+}
+
+void expectSameTensor(const circle::Tensor *a, const circle::Tensor *b)
+{
+  EXPECT_EQ(values(a->shape()), values(b->shape()));
+  EXPECT_EQ(a->type(), b->type());
+  EXPECT_EQ(a->buffer(), b->buffer());
+  ASSERT_NE(a->name(), nullptr);
+  ASSERT_NE(b->name(), nullptr);
+  EXPECT_EQ(a->name()->str(), b->name()->str());
+  EXPECT_EQ(a->is_variable(), b->is_variable());
+  ASSERT_EQ(a->quantization() == nullptr, b->quantization() == nullptr);
+  if (a->quantization() != nullptr)
+  {
+    EXPECT_EQ(values(a->quantization()->scale()), values(b->quantization()->scale()));
+    EXPECT_EQ(values(a->quantization()->zero_point()), values(b->quantization()->zero_point()));
+  }
+}
+
+void expectSameOperator(const circle::Operator *a, const circle::Operator *b)
+{
+  EXPECT_EQ(a->opcode_index(), b->opcode_index());
+  EXPECT_EQ(values(a->inputs()), values(b->inputs()));
+  EXPECT_EQ(values(a->outputs()), values(b->outputs()));
+  ASSERT_EQ(a->builtin_options_type(), b->builtin_options_type());
+  if (a->builtin_options_type() == circle::BuiltinOptions_AddOptions)
+  {
+    EXPECT_EQ(a->builtin_options_as_AddOptions()->fused_activation_function(),
+              b->builtin_options_as_AddOptions()->fused_activation_function());
+  }
+  EXPECT_EQ(values(a->custom_options()), values(b->custom_options()));
+}
+
+void expectSameModel(const std::vector<char> &a_data, const std::vector<char> &b_data)
+{
+  const auto a = circle::GetModel(a_data.data());
+  const auto b = circle::GetModel(b_data.data());
+
+  ASSERT_EQ(a->subgraphs()->size(), 1);
+  ASSERT_EQ(b->subgraphs()->size(), 1);
+  const auto a_subgraph = a->subgraphs()->Get(0);
+  const auto b_subgraph = b->subgraphs()->Get(0);
+  EXPECT_EQ(values(a_subgraph->inputs()), values(b_subgraph->inputs()));
+  EXPECT_EQ(values(a_subgraph->outputs()), values(b_subgraph->outputs()));
+
+  ASSERT_EQ(a_subgraph->tensors()->size(), b_subgraph->tensors()->size());
+  for (uint32_t i = 0; i < a_subgraph->tensors()->size(); ++i)
+  {
+    SCOPED_TRACE("tensor " + std::to_string(i));
+    expectSameTensor(a_subgraph->tensors()->Get(i), b_subgraph->tensors()->Get(i));
+  }
+
+  ASSERT_EQ(a_subgraph->operators()->size(), b_subgraph->operators()->size());
+  for (uint32_t i = 0; i < a_subgraph->operators()->size(); ++i)
+  {
+    SCOPED_TRACE("operator " + std::to_string(i));
+    expectSameOperator(a_subgraph->operators()->Get(i), b_subgraph->operators()->Get(i));
+  }
+}
+
+bool verify(const std::vector<char> &data)
+{
+  flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t *>(data.data()), data.size());
+  return circle::VerifyModelBuffer(verifier);
+}
+
+} // namespace
+
+TEST(CircleModelTest, parallel_build_same_as_serial)
+{
+  TFLModelFile file;
+
+  const auto serial = convert(file.path(), 1);
+  ASSERT_TRUE(verify(serial));
+
+  const auto model = circle::GetModel(serial.data());
+  const auto subgraph = model->subgraphs()->Get(0);
+  ASSERT_EQ(subgraph->tensors()->size(), kNumTensors);
+  ASSERT_EQ(subgraph->operators()->size(), kNumTensors - 1);
+  EXPECT_EQ(subgraph->tensors()->Get(kNumTensors - 1)->name()->str(),
+            "tensor_" + std::to_string(kNumTensors - 1));
+
+  // Chunks of uneven sizes, and as many chunks as cores
+  for (uint32_t num_chunks : {2u, 3u, 7u, 0u})
+  {
+    SCOPED_TRACE("num_chunks " + std::to_string(num_chunks));
+    const auto parallel = convert(file.path(), num_chunks);
+    ASSERT_TRUE(verify(parallel));
+    expectSameModel(serial, parallel);
+  }
+}
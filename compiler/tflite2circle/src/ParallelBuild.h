@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PARALLEL_BUILD_H__
+#define __PARALLEL_BUILD_H__
+
+#include <flatbuffers/flatbuffers.h>
+#include <stdex/Memory.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace tflite2circle
+{
+
+// Elements of a chunk built by a thread, which is the smallest to be worth a thread
+constexpr uint32_t kMinChunkElements = 256;
+
+// Largest alignment of scalars in tensors and operators (e.g. int64 zero points)
+constexpr size_t kMaxChunkAlignment = 8;
+
+/**
+ * @brief Build 'count' tables with 'build' in parallel and return their offsets in 'fb'
+ *
+ * @note  Each thread builds a range of tables into its own builder, which is then copied into 'fb'
+ *        as is. This works as offsets in a flatbuffer are relative to where they are stored, so
+ *        only offsets of the tables themselves (relative to the end of builder) are translated.
+ *        'build' is called as build(flatbuffers::FlatBufferBuilder &, uint32_t index) and should
+ *        be safe to call from multiple threads.
+ *        Tables are built in 'num_chunks' threads, or as many as cores of at least
+ *        kMinChunkElements tables each if 'num_chunks' is 0.
+ */
+template <typename T, typename BuildFunc>
+std::vector<flatbuffers::Offset<T>> build_parallel(flatbuffers::FlatBufferBuilder &fb,
+                                                   uint32_t count, BuildFunc build,
+                                                   uint32_t num_chunks = 0)
+{
+  std::vector<flatbuffers::Offset<T>> offsets(count);
+
+  if (num_chunks == 0)
+  {
+    const uint32_t num_threads = std::max(1u, std::thread::hardware_concurrency());
+    num_chunks = std::min(num_threads, count / kMinChunkElements);
+  }
+  num_chunks = std::min(num_chunks, count);
+  if (num_chunks <= 1)
+  {
+    for (uint32_t i = 0; i < count; ++i)
+      offsets[i] = build(fb, i);
+    return offsets;
+  }
+
+  std::vector<std::unique_ptr<flatbuffers::FlatBufferBuilder>> chunks(num_chunks);
+  std::vector<std::exception_ptr> errors(num_chunks);
+  std::vector<std::thread> threads;
+
+  const uint32_t chunk_size = (count + num_chunks - 1) / num_chunks;
+  auto chunk_begin = [&](uint32_t c) { return std::min(count, c * chunk_size); };
+
+  for (uint32_t c = 0; c < num_chunks; ++c)
+  {
+    chunks[c] = stdex::make_unique<flatbuffers::FlatBufferBuilder>(1024);
+    threads.emplace_back([&, c]() {
+      try
+      {
+        for (uint32_t i = chunk_begin(c); i < chunk_begin(c + 1); ++i)
+          offsets[i] = build(*chunks[c], i);
+      }
+      catch (...)
+      {
+        errors[c] = std::current_exception();
+      }
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  for (const auto &error : errors)
+  {
+    if (error)
+      std::rethrow_exception(error);
+  }
+
+  // Copy chunks in order, keeping alignment of scalars relative to the end of buffer
+  for (uint32_t c = 0; c < num_chunks; ++c)
+  {
+    fb.Align(kMaxChunkAlignment);
+    const auto base = static_cast<flatbuffers::uoffset_t>(fb.GetSize());
+    // NOTE Chunks are not finished as root tables, which GetBufferPointer expects
+    fb.PushBytes(chunks[c]->GetCurrentBufferPointer(), chunks[c]->GetSize());
+    chunks[c].reset();
+
+    for (uint32_t i = chunk_begin(c); i < chunk_begin(c + 1); ++i)
+      offsets[i].o += base;
+  }
+
+  return offsets;
+}
+
+} // namespace tflite2circle
+
+#endif // __PARALLEL_BUILD_H__
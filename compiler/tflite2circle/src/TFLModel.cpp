@@ -14,30 +14,50 @@
  * limitations under the License.
  */
 
+#include <cassert>
 #include <iostream>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include "TFLModel.h"
 
 namespace tflite2circle
 {
 
-TFLModel::TFLModel(const std::string &path)
+TFLModel::TFLModel(const std::string &path) : _data{MAP_FAILED}, _size{0}, _valid{false}
+{
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    return;
+
+  struct stat st;
+  if (fstat(fd, &st) == 0 && st.st_size > 0)
+  {
+    _size = static_cast<size_t>(st.st_size);
+    _data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // Buffers are read once from the beginning to the end
+    if (_data != MAP_FAILED)
+      madvise(_data, _size, MADV_SEQUENTIAL);
+  }
+  // The mapping is kept after the file is closed
+  close(fd);
+
+  _valid = (_data != MAP_FAILED);
+}
+
+TFLModel::~TFLModel()
 {
-  _infile.open(path, std::ios::binary | std::ios::in);
-  _valid = _infile.good();
+  if (_data != MAP_FAILED)
+    munmap(_data, _size);
 }
 
 const tflite::Model *TFLModel::load_model(void)
 {
   assert(_valid == true);
-  _infile.seekg(0, std::ios::end);
-  auto fileSize = _infile.tellg();
-  _infile.seekg(0, std::ios::beg);
-  _data.resize(fileSize);
-  _infile.read(_data.data(), fileSize);
-  _infile.close();
-
-  return tflite::GetModel(_data.data());
+  return tflite::GetModel(_data);
 }
 
 } // namespace tflite2circle
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_THREAD_LIMIT_H__
+#define __NNFW_CKER_THREAD_LIMIT_H__
+
+namespace nnfw
+{
+namespace cker
+{
+
+namespace detail
+{
+
+inline int &threadLimit()
+{
+  static thread_local int limit = -1;
+  return limit;
+}
+
+} // namespace detail
+
+/**
+ * @brief Limit number of threads which kernels called from the calling thread use, including
+ *        the calling thread itself
+ *
+ * ruy, gemmlowp and Eigen based kernels follow the limit, except ruy with RUY_THREADS set by user.
+ * It is per thread, so that kernels run concurrently by several threads can share cores without
+ * oversubscription.
+ *
+ * @param[in] num_threads Number of threads, or -1 to use the default of each library
+ */
+inline void setThreadLimit(int num_threads) { detail::threadLimit() = num_threads; }
+
+/**
+ * @brief  Get the limit set by setThreadLimit() on the calling thread
+ * @return Number of threads, or -1 if there is no limit
+ */
+inline int getThreadLimit() { return detail::threadLimit(); }
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_THREAD_LIMIT_H__
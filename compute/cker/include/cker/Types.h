@@ -18,6 +18,8 @@
 #ifndef __NNFW_CKER_TYPES_H__
 #define __NNFW_CKER_TYPES_H__
 
+#include "cker/Shape.h"
+
 #include <cstdint>
 #include <type_traits>
 #include <limits>
@@ -239,6 +241,9 @@ struct FullyConnectedParams
   int32_t input_offset;
   int32_t weights_offset;
   float weights_scale;
+  // Scale of each output channel for per-channel quantized weights of hybrid kernel.
+  // If it is nullptr, weights_scale is used for all the channels.
+  const float *weights_scales{nullptr};
   int32_t output_offset;
   int32_t output_multiplier;
   int output_shift;
@@ -21,7 +21,9 @@
 //#if defined(CKER_OPTIMIZED_EIGEN)
 
 #include <Eigen/Core>
+#include <memory>
 #include <thread>
+#include "cker/ThreadLimit.h"
 #include "cker/eigen/eigen_spatial_convolutions.h"
 
 #ifdef EIGEN_USE_THREADS
@@ -110,7 +112,17 @@ struct EigenContext
 inline const Eigen::ThreadPoolDevice *GetThreadPoolDevice()
 {
   auto &ctx = EigenContext::GetEigenContext();
-  return ctx.device.get();
+  const int thread_limit = getThreadLimit();
+  if (thread_limit <= 0 || thread_limit >= ctx.device->numThreads())
+    return ctx.device.get();
+
+  // Device that splits work into fewer pieces on the shared thread pool
+  static thread_local std::unique_ptr<Eigen::ThreadPoolDevice> limited_device;
+  if (!limited_device || limited_device->numThreads() != thread_limit)
+  {
+    limited_device.reset(new Eigen::ThreadPoolDevice(ctx.thread_pool_wrapper.get(), thread_limit));
+  }
+  return limited_device.get();
 }
 
 } // namespace eigen_support
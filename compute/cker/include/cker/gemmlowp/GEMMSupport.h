@@ -20,6 +20,8 @@
 
 #include <public/gemmlowp.h>
 
+#include "cker/ThreadLimit.h"
+
 #include <memory>
 #include <thread>
 
@@ -33,6 +35,7 @@ namespace gemm_support
 struct GemmContext
 {
   std::unique_ptr<gemmlowp::GemmContext> gemm_context;
+  int default_num_threads;
   constexpr static int default_num_threadpool_threads = 4;
 
   GemmContext()
@@ -43,13 +46,15 @@ struct GemmContext
       num_threads = default_num_threadpool_threads;
     }
 
+    default_num_threads = num_threads;
     gemm_context.reset(new gemmlowp::GemmContext());
     gemm_context->set_max_num_threads(num_threads);
   }
 
+  // gemmlowp::GemmContext is not thread-safe, so each thread running kernels has its own one
   static inline GemmContext &GetGemmLowpContext()
   {
-    static GemmContext instance;
+    static thread_local GemmContext instance;
     return instance;
   }
 };
@@ -57,6 +62,8 @@ struct GemmContext
 inline gemmlowp::GemmContext *GetGemmLowpContext()
 {
   auto &ctx = GemmContext::GetGemmLowpContext();
+  const int thread_limit = getThreadLimit();
+  ctx.gemm_context->set_max_num_threads(thread_limit > 0 ? thread_limit : ctx.default_num_threads);
   return ctx.gemm_context.get();
 }
 
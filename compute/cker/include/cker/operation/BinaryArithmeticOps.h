@@ -19,6 +19,7 @@
 #define __NNFW_CKER_BINARY_ARITHMETIC_OPS_H__
 
 #include <functional>
+#include <stdexcept>
 #include "cker/operation/optimized/BinaryArithmeticOps.h"
 #include "cker/operation/reference/BinaryArithmeticOps.h"
 #include "cker/Shape.h"
@@ -267,6 +268,76 @@ inline void BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const S
   }
 }
 
+namespace
+{
+// Add of asymmetric quantized values, see TFLite's reference integer Add
+template <typename T>
+inline T QuantizedAddElement(const BinaryArithmeticOpParam &params, T input1, T input2)
+{
+  const int32_t shifted_input1_val = (params.input1_offset + input1) * (1 << params.left_shift);
+  const int32_t shifted_input2_val = (params.input2_offset + input2) * (1 << params.left_shift);
+  const int32_t scaled_input1_val = MultiplyByQuantizedMultiplier(
+      shifted_input1_val, params.input1_multiplier, params.input1_shift);
+  const int32_t scaled_input2_val = MultiplyByQuantizedMultiplier(
+      shifted_input2_val, params.input2_multiplier, params.input2_shift);
+  const int32_t raw_sum = scaled_input1_val + scaled_input2_val;
+  const int32_t raw_output =
+      MultiplyByQuantizedMultiplier(raw_sum, params.output_multiplier, params.output_shift) +
+      params.output_offset;
+  const int32_t clamped_output = std::min(params.quantized_activation_max,
+                                          std::max(params.quantized_activation_min, raw_output));
+  return static_cast<T>(clamped_output);
+}
+} // namespace
+
+/**
+ * @brief Add of uint8 or int8 tensors of the same shape
+ * @note  Offsets, multipliers and shifts of inputs and output in params must be set
+ */
+template <typename T>
+inline void QuantizedAdd(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                         const T *input1_data, const Shape &input2_shape, const T *input2_data,
+                         const Shape &output_shape, T *output_data)
+{
+  assert(params.quantized_activation_min <= params.quantized_activation_max);
+  const int flat_size = MatchingFlatSize(input1_shape, input2_shape, output_shape);
+  for (int i = 0; i < flat_size; ++i)
+  {
+    output_data[i] = QuantizedAddElement(params, input1_data[i], input2_data[i]);
+  }
+}
+
+/**
+ * @brief Add of uint8 or int8 tensors broadcasting to the output shape of rank 4 or less
+ */
+template <typename T>
+inline void BroadcastQuantizedAdd(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                                  const T *input1_data, const Shape &input2_shape,
+                                  const T *input2_data, const Shape &output_shape, T *output_data)
+{
+  assert(params.quantized_activation_min <= params.quantized_activation_max);
+  NdArrayDesc<4> desc1;
+  NdArrayDesc<4> desc2;
+  NdArrayDescsForElementwiseBroadcast(input1_shape, input2_shape, &desc1, &desc2);
+  const Shape extended_output_shape = Shape::ExtendedShape(4, output_shape);
+
+  for (int b = 0; b < extended_output_shape.Dims(0); ++b)
+  {
+    for (int y = 0; y < extended_output_shape.Dims(1); ++y)
+    {
+      for (int x = 0; x < extended_output_shape.Dims(2); ++x)
+      {
+        for (int c = 0; c < extended_output_shape.Dims(3); ++c)
+        {
+          output_data[Offset(extended_output_shape, b, y, x, c)] =
+              QuantizedAddElement(params, input1_data[SubscriptToIndex(desc1, b, y, x, c)],
+                                  input2_data[SubscriptToIndex(desc2, b, y, x, c)]);
+        }
+      }
+    }
+  }
+}
+
 } // namespace cker
 } // namespace nnfw
 
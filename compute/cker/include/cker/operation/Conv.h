@@ -97,6 +97,18 @@ public:
     _prepared = true;
   }
 
+  void prepareHybrid(const Shape &input_shape, const Shape &kernel_shape,
+                     const Shape &output_shape, uint32_t stride_width, uint32_t stride_height)
+  {
+    if (!_prepared)
+    {
+      prepareQuant(input_shape, kernel_shape, output_shape, stride_width, stride_height);
+      _hybrid_quantized_input.resize(input_shape.FlatSize());
+      _hybrid_scaling_factors.resize(input_shape.Dims(0));
+      _hybrid_accum_scratch.resize(output_shape.FlatSize());
+    }
+  }
+
   void operator()(const ConvParams &params, const Shape &input_shape, const float *input_data,
                   const Shape &filter_shape, const float *filter_data, const Shape &bias_shape,
                   const float *bias_data, const Shape &output_shape, float *output_data)
@@ -137,12 +149,50 @@ public:
     }
   }
 
+  void operator()(const ConvParams &params, const int32_t *output_multiplier,
+                  const int32_t *output_shift, const Shape &input_shape, const int8_t *input_data,
+                  const Shape &filter_shape, const int8_t *filter_data, const Shape &bias_shape,
+                  const int32_t *bias_data, const Shape &output_shape, int8_t *output_data)
+  {
+    if (_prepared)
+    {
+      int8_t *im2col_raw_data = reinterpret_cast<int8_t *>(_im2col_data.data());
+      optimized::ConvPerChannel(params, output_multiplier, output_shift, input_shape, input_data,
+                                filter_shape, filter_data, bias_shape, bias_data, output_shape,
+                                output_data, _im2col_shape, im2col_raw_data);
+    }
+    else
+    {
+      reference::ConvPerChannel(params, output_multiplier, output_shift, input_shape, input_data,
+                                filter_shape, filter_data, bias_shape, bias_data, output_shape,
+                                output_data);
+    }
+  }
+
+  void operator()(const ConvParams &params, const float *filter_scales, const Shape &input_shape,
+                  const float *input_data, const Shape &filter_shape, const int8_t *filter_data,
+                  const Shape &bias_shape, const float *bias_data, const Shape &output_shape,
+                  float *output_data)
+  {
+    assert(_prepared && !_hybrid_quantized_input.empty());
+    int8_t *im2col_raw_data =
+        _need_im2col ? reinterpret_cast<int8_t *>(_im2col_data.data()) : nullptr;
+    optimized::HybridConvPerChannel(
+        params, filter_scales, input_shape, input_data, filter_shape, filter_data, bias_shape,
+        bias_data, output_shape, output_data, _im2col_shape, im2col_raw_data,
+        _hybrid_quantized_input.data(), _hybrid_scaling_factors.data(),
+        _hybrid_accum_scratch.data());
+  }
+
 private:
   std::vector<float> _modified_filter_data;
   std::vector<uint8_t> _im2col_data;
   Shape _im2col_shape;
   bool _need_im2col;
   bool _prepared;
+  std::vector<int8_t> _hybrid_quantized_input;
+  std::vector<float> _hybrid_scaling_factors;
+  std::vector<int32_t> _hybrid_accum_scratch;
 };
 } // namespace cker
 } // namespace nnfw
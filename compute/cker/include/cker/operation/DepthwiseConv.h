@@ -24,6 +24,8 @@
 #include "cker/neon/neon_check.h"
 #include "cker/operation/optimized/DepthwiseConvUint8.h"
 
+#include <vector>
+
 namespace nnfw
 {
 namespace cker
@@ -161,6 +163,95 @@ inline void DepthwiseConv(const DepthwiseConvParams &params, const Shape &input_
   }
 }
 
+inline void DepthwiseConvPerChannel(const DepthwiseConvParams &params,
+                                    const int32_t *output_multiplier, const int32_t *output_shift,
+                                    const Shape &input_shape, const int8_t *input_data,
+                                    const Shape &filter_shape, const int8_t *filter_data,
+                                    const Shape &bias_shape, const int32_t *bias_data,
+                                    const Shape &output_shape, int8_t *output_data)
+{
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int dilation_width_factor = params.dilation_width_factor;
+  const int dilation_height_factor = params.dilation_height_factor;
+  const int pad_width = params.padding_values.width;
+  const int pad_height = params.padding_values.height;
+  const int depth_multiplier = params.depth_multiplier;
+  const int32_t input_offset = params.input_offset;
+  const int32_t output_offset = params.output_offset;
+  const int32_t output_activation_min = params.quantized_activation_min;
+  const int32_t output_activation_max = params.quantized_activation_max;
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  assert(output_activation_min <= output_activation_max);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int output_depth = MatchingDim(filter_shape, 3, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  assert(output_depth == input_depth * depth_multiplier);
+  UNUSED_RELEASE(bias_shape);
+
+  // Accumulate all the channels of an output pixel at once so that both input and filter are
+  // read contiguously along the depth
+  std::vector<int32_t> acc(output_depth);
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int out_y = 0; out_y < output_height; ++out_y)
+    {
+      for (int out_x = 0; out_x < output_width; ++out_x)
+      {
+        for (int oc = 0; oc < output_depth; ++oc)
+        {
+          acc[oc] = bias_data ? bias_data[oc] : 0;
+        }
+        const int in_x_origin = (out_x * stride_width) - pad_width;
+        const int in_y_origin = (out_y * stride_height) - pad_height;
+        for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+        {
+          const int in_y = in_y_origin + dilation_height_factor * filter_y;
+          if (in_y < 0 || in_y >= input_height)
+            continue;
+          for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+          {
+            const int in_x = in_x_origin + dilation_width_factor * filter_x;
+            // Zero padding by omitting the areas outside the image.
+            if (in_x < 0 || in_x >= input_width)
+              continue;
+            const int8_t *in_ptr = input_data + Offset(input_shape, b, in_y, in_x, 0);
+            const int8_t *filter_ptr = filter_data + Offset(filter_shape, 0, filter_y, filter_x, 0);
+            for (int ic = 0; ic < input_depth; ++ic)
+            {
+              const int32_t input_val = in_ptr[ic] + input_offset;
+              for (int m = 0; m < depth_multiplier; ++m)
+              {
+                const int oc = m + ic * depth_multiplier;
+                acc[oc] += filter_ptr[oc] * input_val;
+              }
+            }
+          }
+        }
+        int8_t *out_ptr = output_data + Offset(output_shape, b, out_y, out_x, 0);
+        for (int oc = 0; oc < output_depth; ++oc)
+        {
+          int32_t val =
+              MultiplyByQuantizedMultiplier(acc[oc], output_multiplier[oc], output_shift[oc]);
+          val += output_offset;
+          val = std::max(val, output_activation_min);
+          val = std::min(val, output_activation_max);
+          out_ptr[oc] = static_cast<int8_t>(val);
+        }
+      }
+    }
+  }
+}
+
 } // namespace cker
 } // namespace nnfw
 
@@ -22,6 +22,7 @@
 #include "cker/Types.h"
 #include "cker/Utils.h"
 #include "cker/TensorUtils.h"
+#include "cker/operation/optimized/Gemm.h"
 
 namespace nnfw
 {
@@ -54,6 +55,45 @@ public:
   std::vector<int32_t> accum_scratch;
 };
 
+namespace
+{
+
+// Float FullyConnected as GEMM, where weights [num_units, input_size] are lhs and input
+// [batch_size, input_size] is rhs.
+inline void GetFullyConnectedGemmParams(int num_units, int input_size, int batch_size,
+                                        MatrixParams<float> *lhs_params,
+                                        MatrixParams<float> *rhs_params,
+                                        MatrixParams<float> *dst_params)
+{
+  lhs_params->rows = num_units;
+  lhs_params->cols = input_size;
+  lhs_params->order = Order::kRowMajor;
+  lhs_params->cacheable = true;
+  rhs_params->rows = input_size;
+  rhs_params->cols = batch_size;
+  rhs_params->order = Order::kColMajor;
+  dst_params->rows = num_units;
+  dst_params->cols = batch_size;
+  dst_params->order = Order::kColMajor;
+}
+
+} // namespace
+
+/**
+ * @brief Whether float FullyConnected runs on ruy
+ *
+ * ruy has optimized float kernels only for ARM. Elsewhere its reference kernel is slower than the
+ * portable GEMV, so prepacking weights for ruy does not pay off.
+ */
+constexpr bool IsFullyConnectedRuyEnabled()
+{
+#ifdef USE_NEON
+  return true;
+#else
+  return false;
+#endif
+}
+
 inline void FullyConnected(const FullyConnectedParams &params, const Shape &input_shape,
                            const float *input_data, const Shape &weights_shape,
                            const float *weights_data, const Shape &, const float *bias_data,
@@ -64,6 +104,21 @@ inline void FullyConnected(const FullyConnectedParams &params, const Shape &inpu
   const int batch_size = total_input_size / input_size;
   const int num_units = weights_shape.Dims(0);
 
+  if (IsFullyConnectedRuyEnabled() && batch_size > 1)
+  {
+    // Compute output = weight * input + bias as a real GEMM
+    MatrixParams<float> lhs_params, rhs_params, dst_params;
+    GetFullyConnectedGemmParams(num_units, input_size, batch_size, &lhs_params, &rhs_params,
+                                &dst_params);
+    GemmParams<float, float> gemm_params;
+    gemm_params.bias = bias_data;
+    optimized::Gemm(lhs_params, weights_data, rhs_params, input_data, dst_params, output_data,
+                    gemm_params);
+
+    ApplyActivationToVector(output_data, batch_size * num_units, params.activation, output_data);
+    return;
+  }
+
   // Output = bias if bias tensor exists.
   if (bias_data)
   {
@@ -82,6 +137,46 @@ inline void FullyConnected(const FullyConnectedParams &params, const Shape &inpu
   ApplyActivationToVector(output_data, batch_size * num_units, params.activation, output_data);
 }
 
+/**
+ * @brief Pack float weights of FullyConnected for FullyConnectedPrepacked
+ * @param[in] batch_size Expected batch size, which is used only for ruy to choose a kernel
+ */
+inline void PrepackFullyConnectedWeights(const Shape &weights_shape, const float *weights_data,
+                                         int batch_size, optimized::PrepackedLhs<float> *prepacked)
+{
+  assert(weights_shape.DimensionsCount() == 2);
+  MatrixParams<float> lhs_params, rhs_params, dst_params;
+  GetFullyConnectedGemmParams(weights_shape.Dims(0), weights_shape.Dims(1), batch_size,
+                              &lhs_params, &rhs_params, &dst_params);
+  GemmParams<float, float> gemm_params;
+  prepacked->prepack(lhs_params, weights_data, rhs_params, dst_params, gemm_params);
+}
+
+/**
+ * @brief Float FullyConnected with weights packed by PrepackFullyConnectedWeights()
+ */
+inline void FullyConnectedPrepacked(const FullyConnectedParams &params, const Shape &input_shape,
+                                    const float *input_data, const Shape &weights_shape,
+                                    optimized::PrepackedLhs<float> &prepacked_weights,
+                                    const Shape &, const float *bias_data, const Shape &,
+                                    float *output_data)
+{
+  const int input_size = weights_shape.Dims(1);
+  const int batch_size = input_shape.FlatSize() / input_size;
+  const int num_units = weights_shape.Dims(0);
+  assert(prepacked_weights.params().rows == num_units);
+  assert(prepacked_weights.params().cols == input_size);
+
+  MatrixParams<float> lhs_params, rhs_params, dst_params;
+  GetFullyConnectedGemmParams(num_units, input_size, batch_size, &lhs_params, &rhs_params,
+                              &dst_params);
+  GemmParams<float, float> gemm_params;
+  gemm_params.bias = bias_data;
+  optimized::Gemm(prepacked_weights, rhs_params, input_data, dst_params, output_data, gemm_params);
+
+  ApplyActivationToVector(output_data, batch_size * num_units, params.activation, output_data);
+}
+
 inline void FullyConnected(const FullyConnectedParams &params, const Shape &input_shape,
                            const uint8_t *input_data, const Shape &filter_shape,
                            const uint8_t *filter_data, const Shape &bias_shape,
@@ -136,6 +231,54 @@ inline void FullyConnected(const FullyConnectedParams &params, const Shape &inpu
   }
 }
 
+inline void FullyConnectedPerChannel(const FullyConnectedParams &params,
+                                     const int32_t *output_multiplier, const int32_t *output_shift,
+                                     const Shape &input_shape, const int8_t *input_data,
+                                     const Shape &filter_shape, const int8_t *filter_data,
+                                     const Shape &bias_shape, const int32_t *bias_data,
+                                     const Shape &output_shape, int8_t *output_data)
+{
+  UNUSED_RELEASE(input_shape);
+  UNUSED_RELEASE(bias_shape);
+  const int32_t output_activation_min = params.quantized_activation_min;
+  const int32_t output_activation_max = params.quantized_activation_max;
+  assert(filter_shape.DimensionsCount() >= 2);
+  assert(output_shape.DimensionsCount() >= 1);
+  assert(output_activation_min <= output_activation_max);
+
+  const int output_dim_count = output_shape.DimensionsCount();
+  const int filter_dim_count = filter_shape.DimensionsCount();
+  const int batches = FlatSizeSkipDim(output_shape, output_dim_count - 1);
+  const int output_depth =
+      MatchingDim(filter_shape, filter_dim_count - 2, output_shape, output_dim_count - 1);
+  const int accum_depth = filter_shape.Dims(filter_dim_count - 1);
+
+  MatrixParams<int8_t> lhs_params;
+  lhs_params.rows = output_depth;
+  lhs_params.cols = accum_depth;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.zero_point = -params.weights_offset;
+  lhs_params.cacheable = true;
+  MatrixParams<int8_t> rhs_params;
+  rhs_params.rows = accum_depth;
+  rhs_params.cols = batches;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.zero_point = -params.input_offset;
+  MatrixParams<int8_t> dst_params;
+  dst_params.rows = output_depth;
+  dst_params.cols = batches;
+  dst_params.order = Order::kColMajor;
+  dst_params.zero_point = params.output_offset;
+  GemmParams<int32_t, int8_t, QuantizationFlavor::kIntegerWithPerRowMultiplier> gemm_params;
+  gemm_params.bias = bias_data;
+  gemm_params.clamp_min = output_activation_min;
+  gemm_params.clamp_max = output_activation_max;
+  gemm_params.multiplier_fixedpoint_perchannel = output_multiplier;
+  gemm_params.multiplier_exponent_perchannel = output_shift;
+  optimized::Gemm(lhs_params, filter_data, rhs_params, input_data, dst_params, output_data,
+                  gemm_params);
+}
+
 inline void FullyConnectedHybrid(const FullyConnectedParams &params, const Shape &input_shape,
                                  const float *input_data, const Shape &filter_shape,
                                  const int8_t *filter_data, const Shape &, const float *bias_data,
@@ -146,13 +289,26 @@ inline void FullyConnectedHybrid(const FullyConnectedParams &params, const Shape
   const int input_size = filter_shape.Dims(1);
   const int batch_size = total_input_size / input_size;
   const int num_units = filter_shape.Dims(0);
+  const bool is_per_channel = params.weights_scales != nullptr;
 
   // Output = bias if bias tensor exists.
-  VectorBatchVectorAssign(bias_data, num_units, batch_size, output_data);
+  // For per-channel weights, bias is added after scaling the accumulated values of each channel.
+  if (bias_data && !is_per_channel)
+  {
+    VectorBatchVectorAssign(bias_data, num_units, batch_size, output_data);
+  }
+  else
+  {
+    ZeroVector(output_data, batch_size * num_units);
+  }
 
   // Save matrix multiplication computation for all zero input.
   if (IsZeroVector(input_data, total_input_size))
   {
+    if (bias_data && is_per_channel)
+    {
+      VectorBatchVectorAssign(bias_data, num_units, batch_size, output_data);
+    }
     ApplyActivationToVector(output_data, batch_size * num_units, params.activation, output_data);
     return;
   }
@@ -169,7 +325,10 @@ inline void FullyConnectedHybrid(const FullyConnectedParams &params, const Shape
     SymmetricQuantizeFloats(input_data + offset, input_size, quant_data + offset, &unused_min,
                             &unused_max, &scaling_factors_ptr[b]);
     // Incorporate scaling of the filter.
-    scaling_factors_ptr[b] *= params.weights_scale;
+    if (!is_per_channel)
+    {
+      scaling_factors_ptr[b] *= params.weights_scale;
+    }
   }
 
 // Compute output += weight * quantized_input
@@ -187,6 +346,19 @@ inline void FullyConnectedHybrid(const FullyConnectedParams &params, const Shape
   UNUSED_RELEASE(output_shape);
 #endif
 
+  if (is_per_channel)
+  {
+    for (int b = 0; b < batch_size; ++b)
+    {
+      float *output_ptr = output_data + b * num_units;
+      for (int unit = 0; unit < num_units; ++unit)
+      {
+        const float bias = bias_data ? bias_data[unit] : 0.f;
+        output_ptr[unit] = output_ptr[unit] * params.weights_scales[unit] + bias;
+      }
+    }
+  }
+
   // Apply activation function to floats.
   ApplyActivationToVector(output_data, batch_size * num_units, params.activation, output_data);
   return;
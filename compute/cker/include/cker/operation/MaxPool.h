@@ -25,6 +25,8 @@
 #include "cker/eigen/Utils.h"
 
 #include <Eigen/Core>
+#include <algorithm>
+#include <limits>
 
 namespace nnfw
 {
@@ -196,6 +198,61 @@ inline void MaxPool(const PoolParams &params, const Shape &input_shape, const ui
   }
 }
 
+inline void MaxPool(const PoolParams &params, const Shape &input_shape, const int8_t *input_data,
+                    const Shape &output_shape, int8_t *output_data)
+{
+  assert(params.quantized_activation_min <= params.quantized_activation_max);
+  assert(input_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int depth = MatchingDim(input_shape, 3, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int stride_height = params.stride_height;
+  const int stride_width = params.stride_width;
+
+  for (int batch = 0; batch < batches; ++batch)
+  {
+    for (int out_y = 0; out_y < output_height; ++out_y)
+    {
+      for (int out_x = 0; out_x < output_width; ++out_x)
+      {
+        const int in_x_origin = (out_x * stride_width) - params.padding_values.width;
+        const int in_y_origin = (out_y * stride_height) - params.padding_values.height;
+        const int filter_x_start = std::max(0, -in_x_origin);
+        const int filter_x_end = std::min(params.filter_width, input_width - in_x_origin);
+        const int filter_y_start = std::max(0, -in_y_origin);
+        const int filter_y_end = std::min(params.filter_height, input_height - in_y_origin);
+
+        // Accumulate maximums of the window along depth in the output directly
+        int8_t *output_ptr = output_data + Offset(output_shape, batch, out_y, out_x, 0);
+        std::fill(output_ptr, output_ptr + depth, std::numeric_limits<int8_t>::lowest());
+        for (int fy = filter_y_start; fy < filter_y_end; ++fy)
+        {
+          for (int fx = filter_x_start; fx < filter_x_end; ++fx)
+          {
+            const int8_t *input_ptr =
+                input_data + Offset(input_shape, batch, in_y_origin + fy, in_x_origin + fx, 0);
+            for (int channel = 0; channel < depth; ++channel)
+            {
+              output_ptr[channel] = std::max(output_ptr[channel], input_ptr[channel]);
+            }
+          }
+        }
+        for (int channel = 0; channel < depth; ++channel)
+        {
+          int32_t a = output_ptr[channel];
+          a = std::max<int32_t>(a, params.quantized_activation_min);
+          a = std::min<int32_t>(a, params.quantized_activation_max);
+          output_ptr[channel] = static_cast<int8_t>(a);
+        }
+      }
+    }
+  }
+}
+
 } // namespace cker
 } // namespace nnfw
 
@@ -26,6 +26,7 @@
 #include <Eigen/Core>
 #include <fixedpoint/fixedpoint.h>
 #include <cmath>
+#include <limits>
 
 namespace nnfw
 {
@@ -50,8 +51,11 @@ inline void Softmax(const SoftmaxParams &params, const Shape &input_shape, const
   out_mat.array().rowwise() *= scale;
 }
 
-inline void Softmax(const SoftmaxParams &params, const Shape &input_shape,
-                    const uint8_t *input_data, const Shape &output_shape, uint8_t *output_data)
+// Softmax of uint8 or int8, whose output is quantized with scale of 1/256 and zero point of the
+// lowest value of the type
+template <typename T>
+inline void SoftmaxQuant8(const SoftmaxParams &params, const Shape &input_shape,
+                          const T *input_data, const Shape &output_shape, T *output_data)
 {
   const int32_t input_beta_multiplier = params.input_multiplier;
   const int32_t input_beta_left_shift = params.input_left_shift;
@@ -73,7 +77,7 @@ inline void Softmax(const SoftmaxParams &params, const Shape &input_shape,
 
   for (int i = 0; i < outer_size; ++i)
   {
-    uint8_t max_in_row = 0;
+    T max_in_row = std::numeric_limits<T>::lowest();
     for (int c = 0; c < depth; ++c)
     {
       max_in_row = std::max(max_in_row, input_data[i * depth + c]);
@@ -121,17 +125,32 @@ inline void Softmax(const SoftmaxParams &params, const Shape &input_shape,
         int32_t unsat_output = gemmlowp::RoundingDivideByPOT((shifted_scale * exp_in_0).raw(),
                                                              num_bits_over_unit + 31 - 8);
 
-        output_data[i * depth + c] = static_cast<uint8_t>(
-            std::max(std::min(unsat_output, static_cast<int32_t>(255)), static_cast<int32_t>(0)));
+        // unsat_output is within [0, 256]
+        const int32_t output = unsat_output + std::numeric_limits<T>::lowest();
+        output_data[i * depth + c] = static_cast<T>(
+            std::max(std::min(output, static_cast<int32_t>(std::numeric_limits<T>::max())),
+                     static_cast<int32_t>(std::numeric_limits<T>::lowest())));
       }
       else
       {
-        output_data[i * depth + c] = 0;
+        output_data[i * depth + c] = std::numeric_limits<T>::lowest();
       }
     }
   }
 }
 
+inline void Softmax(const SoftmaxParams &params, const Shape &input_shape,
+                    const uint8_t *input_data, const Shape &output_shape, uint8_t *output_data)
+{
+  SoftmaxQuant8(params, input_shape, input_data, output_shape, output_data);
+}
+
+inline void Softmax(const SoftmaxParams &params, const Shape &input_shape, const int8_t *input_data,
+                    const Shape &output_shape, int8_t *output_data)
+{
+  SoftmaxQuant8(params, input_shape, input_data, output_shape, output_data);
+}
+
 } // namespace cker
 } // namespace nnfw
 
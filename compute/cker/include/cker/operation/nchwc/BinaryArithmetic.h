@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_NCHWC_BINARY_ARITHMETIC_H__
+#define __NNFW_CKER_NCHWC_BINARY_ARITHMETIC_H__
+
+#include "cker/operation/nchwc/Common.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace nchwc
+{
+
+template <typename Op>
+void ElementwiseBlocks(const BinaryArithmeticOpParam &params, int size, const float *input1_data,
+                       const float *input2_data, float *output_data, Op op)
+{
+  const float activation_min = params.float_activation_min;
+  const float activation_max = params.float_activation_max;
+  for (int i = 0; i < size; ++i)
+    output_data[i] = std::min(std::max(op(input1_data[i], input2_data[i]), activation_min),
+                              activation_max);
+}
+
+/**
+ * @brief ADD, SUB or MUL of NCHWc inputs of the same shape, without broadcasting
+ *        Padding channels stay zero with these, so whole blocks are computed at once.
+ */
+inline void BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                               const float *input1_data, const Shape &input2_shape,
+                               const float *input2_data, const Shape &output_shape,
+                               float *output_data)
+{
+  assert(input1_shape == output_shape && input2_shape == output_shape);
+  UNUSED_RELEASE(input1_shape);
+  UNUSED_RELEASE(input2_shape);
+
+  const int size = FlatSize(output_shape);
+  switch (params.type)
+  {
+    case BinaryArithmeticOpType::ADD:
+      ElementwiseBlocks(params, size, input1_data, input2_data, output_data,
+                        [](float a, float b) { return a + b; });
+      break;
+    case BinaryArithmeticOpType::SUB:
+      ElementwiseBlocks(params, size, input1_data, input2_data, output_data,
+                        [](float a, float b) { return a - b; });
+      break;
+    case BinaryArithmeticOpType::MUL:
+      ElementwiseBlocks(params, size, input1_data, input2_data, output_data,
+                        [](float a, float b) { return a * b; });
+      break;
+    default:
+      throw std::runtime_error{"nchwc::BinaryArithmeticOp: Unsupported operation type"};
+  }
+}
+
+} // namespace nchwc
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_NCHWC_BINARY_ARITHMETIC_H__
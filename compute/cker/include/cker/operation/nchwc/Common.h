@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Kernels of NCHWc layout, where channels of NHWC are split into blocks of kBlockSize and stored
+ * as [N, C / kBlockSize, H, W, kBlockSize]. Shapes given to kernels are of NHWC.
+ *
+ * Channels beyond C in the last block must be zero in inputs, and kernels write zeros there, so
+ * that whole blocks are computed without checking depth.
+ */
+
+#ifndef __NNFW_CKER_NCHWC_COMMON_H__
+#define __NNFW_CKER_NCHWC_COMMON_H__
+
+#include "cker/Shape.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace nchwc
+{
+
+constexpr int kBlockSize = 8;
+
+inline int NumBlocks(int depth) { return (depth + kBlockSize - 1) / kBlockSize; }
+
+// Number of elements including channels that pad the last block
+inline int FlatSize(const Shape &shape)
+{
+  assert(shape.DimensionsCount() == 4);
+  return shape.Dims(0) * NumBlocks(shape.Dims(3)) * shape.Dims(1) * shape.Dims(2) * kBlockSize;
+}
+
+inline int BlockedOffset(const Shape &shape, int b, int h, int w, int c)
+{
+  assert(shape.DimensionsCount() == 4);
+  const int block = (b * NumBlocks(shape.Dims(3)) + c / kBlockSize) * shape.Dims(1) + h;
+  return (block * shape.Dims(2) + w) * kBlockSize + c % kBlockSize;
+}
+
+inline void FromNHWC(const Shape &shape, const float *input_data, float *output_data)
+{
+  const int batches = shape.Dims(0);
+  const int depth = shape.Dims(3);
+  const int pixels = shape.Dims(1) * shape.Dims(2);
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int cb = 0; cb < NumBlocks(depth); ++cb)
+    {
+      const int count = std::min(kBlockSize, depth - cb * kBlockSize);
+      const float *in = input_data + b * pixels * depth + cb * kBlockSize;
+      float *out = output_data + (b * NumBlocks(depth) + cb) * pixels * kBlockSize;
+      for (int p = 0; p < pixels; ++p, in += depth, out += kBlockSize)
+      {
+        for (int i = 0; i < count; ++i)
+          out[i] = in[i];
+        for (int i = count; i < kBlockSize; ++i)
+          out[i] = 0.0f;
+      }
+    }
+  }
+}
+
+inline void ToNHWC(const Shape &shape, const float *input_data, float *output_data)
+{
+  const int batches = shape.Dims(0);
+  const int depth = shape.Dims(3);
+  const int pixels = shape.Dims(1) * shape.Dims(2);
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int cb = 0; cb < NumBlocks(depth); ++cb)
+    {
+      const int count = std::min(kBlockSize, depth - cb * kBlockSize);
+      const float *in = input_data + (b * NumBlocks(depth) + cb) * pixels * kBlockSize;
+      float *out = output_data + b * pixels * depth + cb * kBlockSize;
+      for (int p = 0; p < pixels; ++p, in += kBlockSize, out += depth)
+      {
+        for (int i = 0; i < count; ++i)
+          out[i] = in[i];
+      }
+    }
+  }
+}
+
+// Pad bias of 'depth' to blocks, which is zero if there is no bias
+inline void PackBias(int depth, const float *bias_data, float *packed_data)
+{
+  std::fill(packed_data, packed_data + NumBlocks(depth) * kBlockSize, 0.0f);
+  if (bias_data != nullptr)
+    std::copy(bias_data, bias_data + depth, packed_data);
+}
+
+} // namespace nchwc
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_NCHWC_COMMON_H__
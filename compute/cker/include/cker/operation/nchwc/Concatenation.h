@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_NCHWC_CONCATENATION_H__
+#define __NNFW_CKER_NCHWC_CONCATENATION_H__
+
+#include "cker/operation/nchwc/Common.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace nchwc
+{
+
+/**
+ * @brief Concatenation of NCHWc inputs along 'params.axis' of NHWC
+ *        Blocks are copied as they are, unless channels of inputs are concatenated and some input
+ *        has padding channels, which are dropped by copying each channel.
+ */
+inline void Concatenation(const ConcatenationParams &params, const Shape *const *input_shapes,
+                          const float *const *input_data, const Shape &output_shape,
+                          float *output_data)
+{
+  const int axis = params.axis;
+  const int inputs_count = params.inputs_count;
+  assert(output_shape.DimensionsCount() == 4 && axis >= 0 && axis < 4);
+
+  const int batches = output_shape.Dims(0);
+  const int height = output_shape.Dims(1);
+  const int width = output_shape.Dims(2);
+  const int depth = output_shape.Dims(3);
+
+  if (axis == 3)
+  {
+    const bool whole_blocks =
+        std::all_of(input_shapes, input_shapes + inputs_count,
+                    [](const Shape *shape) { return shape->Dims(3) % kBlockSize == 0; });
+    if (!whole_blocks)
+    {
+      // Padding channels of output are not written below
+      std::fill(output_data, output_data + FlatSize(output_shape), 0.0f);
+    }
+
+    int depth_offset = 0;
+    for (int i = 0; i < inputs_count; ++i)
+    {
+      const Shape &input_shape = *input_shapes[i];
+      const int input_depth = input_shape.Dims(3);
+      if (whole_blocks)
+      {
+        // Blocks of an input are contiguous within each batch
+        const int size = FlatSize(input_shape) / batches;
+        for (int b = 0; b < batches; ++b)
+        {
+          std::memcpy(output_data + BlockedOffset(output_shape, b, 0, 0, depth_offset),
+                      input_data[i] + b * size, size * sizeof(float));
+        }
+      }
+      else
+      {
+        for (int b = 0; b < batches; ++b)
+          for (int y = 0; y < height; ++y)
+            for (int x = 0; x < width; ++x)
+              for (int c = 0; c < input_depth; ++c)
+                output_data[BlockedOffset(output_shape, b, y, x, depth_offset + c)] =
+                    input_data[i][BlockedOffset(input_shape, b, y, x, c)];
+      }
+      depth_offset += input_depth;
+    }
+    assert(depth_offset == depth);
+    UNUSED_RELEASE(depth);
+    return;
+  }
+
+  // Memory is [N, C / kBlockSize, H, W, kBlockSize], where dimensions outside of the axis are
+  // iterated and the rest is copied from each input
+  const int blocks = NumBlocks(depth);
+  const int outer_size = axis == 0 ? 1 : batches * blocks * (axis == 2 ? height : 1);
+  float *output_ptr = output_data;
+  for (int k = 0; k < outer_size; ++k)
+  {
+    for (int i = 0; i < inputs_count; ++i)
+    {
+      const int copy_size = FlatSize(*input_shapes[i]) / outer_size;
+      std::memcpy(output_ptr, input_data[i] + k * copy_size, copy_size * sizeof(float));
+      output_ptr += copy_size;
+    }
+  }
+}
+
+} // namespace nchwc
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_NCHWC_CONCATENATION_H__
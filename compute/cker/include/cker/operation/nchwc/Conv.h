@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_NCHWC_CONV_H__
+#define __NNFW_CKER_NCHWC_CONV_H__
+
+#include "cker/operation/nchwc/Common.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace nchwc
+{
+
+// Pack filter of [OC, KH, KW, IC] into [OC / kBlockSize, IC / kBlockSize, KH, KW, kBlockSize(IC),
+// kBlockSize(OC)], where channels padding blocks are zero
+inline void PackConvFilter(const Shape &filter_shape, const float *filter_data,
+                           std::vector<float> &packed)
+{
+  const int output_depth = filter_shape.Dims(0);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int input_depth = filter_shape.Dims(3);
+  const int input_blocks = NumBlocks(input_depth);
+
+  packed.assign(NumBlocks(output_depth) * input_blocks * filter_height * filter_width *
+                    kBlockSize * kBlockSize,
+                0.0f);
+  for (int oc = 0; oc < output_depth; ++oc)
+  {
+    for (int ky = 0; ky < filter_height; ++ky)
+    {
+      for (int kx = 0; kx < filter_width; ++kx)
+      {
+        for (int ic = 0; ic < input_depth; ++ic)
+        {
+          const int tap =
+              ((oc / kBlockSize * input_blocks + ic / kBlockSize) * filter_height + ky) *
+                  filter_width +
+              kx;
+          packed[(tap * kBlockSize + ic % kBlockSize) * kBlockSize + oc % kBlockSize] =
+              filter_data[cker::Offset(filter_shape, oc, ky, kx, ic)];
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Convolution of NCHWc input with a filter packed by PackConvFilter
+ *        Dilation is not supported.
+ * @param packed_bias Bias padded to blocks by PackBias
+ */
+inline void Conv(const ConvParams &params, const Shape &input_shape, const float *input_data,
+                 const Shape &filter_shape, const float *packed_filter, const float *packed_bias,
+                 const Shape &output_shape, float *output_data)
+{
+  assert(params.dilation_width_factor == 1 && params.dilation_height_factor == 1);
+  // Output pixels computed together along width, to reuse filter loaded in registers
+  constexpr int kTile = 4;
+  const float zeros[kBlockSize] = {0.0f};
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_blocks = NumBlocks(MatchingDim(input_shape, 3, filter_shape, 3));
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int output_blocks = NumBlocks(MatchingDim(filter_shape, 0, output_shape, 3));
+  const int stride_height = params.stride_height;
+  const int stride_width = params.stride_width;
+  const int pad_height = params.padding_values.height;
+  const int pad_width = params.padding_values.width;
+  const float activation_min = params.float_activation_min;
+  const float activation_max = params.float_activation_max;
+  const int filter_block_size = filter_height * filter_width * kBlockSize * kBlockSize;
+
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int ob = 0; ob < output_blocks; ++ob)
+    {
+      float *output_block =
+          output_data + (b * output_blocks + ob) * output_height * output_width * kBlockSize;
+      for (int out_y = 0; out_y < output_height; ++out_y)
+      {
+        for (int out_x0 = 0; out_x0 < output_width; out_x0 += kTile)
+        {
+          const int tile = std::min(kTile, output_width - out_x0);
+          float acc[kTile][kBlockSize];
+          for (int t = 0; t < kTile; ++t)
+            for (int o = 0; o < kBlockSize; ++o)
+              acc[t][o] = packed_bias[ob * kBlockSize + o];
+
+          for (int ib = 0; ib < input_blocks; ++ib)
+          {
+            const float *input_block =
+                input_data + (b * input_blocks + ib) * input_height * input_width * kBlockSize;
+            const float *filter_block =
+                packed_filter + (ob * input_blocks + ib) * filter_block_size;
+            for (int ky = 0; ky < filter_height; ++ky)
+            {
+              const int in_y = out_y * stride_height - pad_height + ky;
+              if (in_y < 0 || in_y >= input_height)
+                continue;
+              for (int kx = 0; kx < filter_width; ++kx)
+              {
+                const float *in[kTile];
+                for (int t = 0; t < kTile; ++t)
+                {
+                  const int in_x = (out_x0 + t) * stride_width - pad_width + kx;
+                  in[t] = (t < tile && in_x >= 0 && in_x < input_width)
+                              ? input_block + (in_y * input_width + in_x) * kBlockSize
+                              : zeros;
+                }
+
+                const float *w = filter_block + (ky * filter_width + kx) * kBlockSize * kBlockSize;
+                for (int i = 0; i < kBlockSize; ++i, w += kBlockSize)
+                {
+                  for (int t = 0; t < kTile; ++t)
+                  {
+                    const float x = in[t][i];
+                    for (int o = 0; o < kBlockSize; ++o)
+                      acc[t][o] += x * w[o];
+                  }
+                }
+              }
+            }
+          }
+
+          for (int t = 0; t < tile; ++t)
+          {
+            float *out = output_block + (out_y * output_width + out_x0 + t) * kBlockSize;
+            for (int o = 0; o < kBlockSize; ++o)
+              out[o] = std::min(std::max(acc[t][o], activation_min), activation_max);
+          }
+        }
+      }
+    }
+  }
+}
+
+} // namespace nchwc
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_NCHWC_CONV_H__
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_NCHWC_DEPTHWISE_CONV_H__
+#define __NNFW_CKER_NCHWC_DEPTHWISE_CONV_H__
+
+#include "cker/operation/nchwc/Common.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace nchwc
+{
+
+// Pack filter of [1, KH, KW, C] into [C / kBlockSize, KH, KW, kBlockSize]
+inline void PackDepthwiseConvFilter(const Shape &filter_shape, const float *filter_data,
+                                    std::vector<float> &packed)
+{
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int depth = filter_shape.Dims(3);
+
+  packed.assign(NumBlocks(depth) * filter_height * filter_width * kBlockSize, 0.0f);
+  for (int ky = 0; ky < filter_height; ++ky)
+  {
+    for (int kx = 0; kx < filter_width; ++kx)
+    {
+      for (int c = 0; c < depth; ++c)
+      {
+        const int tap = (c / kBlockSize * filter_height + ky) * filter_width + kx;
+        packed[tap * kBlockSize + c % kBlockSize] =
+            filter_data[cker::Offset(filter_shape, 0, ky, kx, c)];
+      }
+    }
+  }
+}
+
+/**
+ * @brief Depthwise convolution of NCHWc input with a filter packed by PackDepthwiseConvFilter
+ *        Only depth multiplier of 1 is supported, without dilation.
+ * @param packed_bias Bias padded to blocks by PackBias
+ */
+inline void DepthwiseConv(const DepthwiseConvParams &params, const Shape &input_shape,
+                          const float *input_data, const Shape &filter_shape,
+                          const float *packed_filter, const float *packed_bias,
+                          const Shape &output_shape, float *output_data)
+{
+  assert(params.depth_multiplier == 1);
+  assert(params.dilation_width_factor == 1 && params.dilation_height_factor == 1);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int blocks = NumBlocks(MatchingDim(input_shape, 3, filter_shape, 3, output_shape, 3));
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int stride_height = params.stride_height;
+  const int stride_width = params.stride_width;
+  const int pad_height = params.padding_values.height;
+  const int pad_width = params.padding_values.width;
+  const float activation_min = params.float_activation_min;
+  const float activation_max = params.float_activation_max;
+
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int cb = 0; cb < blocks; ++cb)
+    {
+      const float *input_block =
+          input_data + (b * blocks + cb) * input_height * input_width * kBlockSize;
+      const float *filter_block = packed_filter + cb * filter_height * filter_width * kBlockSize;
+      float *out = output_data + (b * blocks + cb) * output_height * output_width * kBlockSize;
+      for (int out_y = 0; out_y < output_height; ++out_y)
+      {
+        for (int out_x = 0; out_x < output_width; ++out_x, out += kBlockSize)
+        {
+          float acc[kBlockSize];
+          for (int c = 0; c < kBlockSize; ++c)
+            acc[c] = packed_bias[cb * kBlockSize + c];
+
+          for (int ky = 0; ky < filter_height; ++ky)
+          {
+            const int in_y = out_y * stride_height - pad_height + ky;
+            if (in_y < 0 || in_y >= input_height)
+              continue;
+            for (int kx = 0; kx < filter_width; ++kx)
+            {
+              const int in_x = out_x * stride_width - pad_width + kx;
+              if (in_x < 0 || in_x >= input_width)
+                continue;
+              const float *in = input_block + (in_y * input_width + in_x) * kBlockSize;
+              const float *w = filter_block + (ky * filter_width + kx) * kBlockSize;
+              for (int c = 0; c < kBlockSize; ++c)
+                acc[c] += in[c] * w[c];
+            }
+          }
+
+          for (int c = 0; c < kBlockSize; ++c)
+            out[c] = std::min(std::max(acc[c], activation_min), activation_max);
+        }
+      }
+    }
+  }
+}
+
+} // namespace nchwc
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_NCHWC_DEPTHWISE_CONV_H__
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_NCHWC_POOL_H__
+#define __NNFW_CKER_NCHWC_POOL_H__
+
+#include "cker/operation/nchwc/Common.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace nchwc
+{
+
+// Pool each block of channels over windows, where 'reduce' accumulates a pixel of the window into
+// a block and 'finish' is given the number of pixels in the window
+template <typename Init, typename Reduce, typename Finish>
+void PoolBlocks(const PoolParams &params, const Shape &input_shape, const float *input_data,
+                const Shape &output_shape, float *output_data, Init init, Reduce reduce,
+                Finish finish)
+{
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int blocks = NumBlocks(MatchingDim(input_shape, 3, output_shape, 3));
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int cb = 0; cb < blocks; ++cb)
+    {
+      const float *input_block =
+          input_data + (b * blocks + cb) * input_height * input_width * kBlockSize;
+      float *out = output_data + (b * blocks + cb) * output_height * output_width * kBlockSize;
+      for (int out_y = 0; out_y < output_height; ++out_y)
+      {
+        const int in_y_origin = out_y * params.stride_height - params.padding_values.height;
+        const int y_start = std::max(0, in_y_origin);
+        const int y_end = std::min(input_height, in_y_origin + params.filter_height);
+        for (int out_x = 0; out_x < output_width; ++out_x, out += kBlockSize)
+        {
+          const int in_x_origin = out_x * params.stride_width - params.padding_values.width;
+          const int x_start = std::max(0, in_x_origin);
+          const int x_end = std::min(input_width, in_x_origin + params.filter_width);
+
+          float acc[kBlockSize];
+          init(acc);
+          for (int in_y = y_start; in_y < y_end; ++in_y)
+            for (int in_x = x_start; in_x < x_end; ++in_x)
+              reduce(acc, input_block + (in_y * input_width + in_x) * kBlockSize);
+          finish(acc, (y_end - y_start) * (x_end - x_start));
+
+          for (int c = 0; c < kBlockSize; ++c)
+            out[c] = std::min(std::max(acc[c], params.float_activation_min),
+                              params.float_activation_max);
+        }
+      }
+    }
+  }
+}
+
+inline void MaxPool(const PoolParams &params, const Shape &input_shape, const float *input_data,
+                    const Shape &output_shape, float *output_data)
+{
+  const auto init = [](float *acc) {
+    std::fill(acc, acc + kBlockSize, std::numeric_limits<float>::lowest());
+  };
+  const auto reduce = [](float *acc, const float *in) {
+    for (int c = 0; c < kBlockSize; ++c)
+      acc[c] = std::max(acc[c], in[c]);
+  };
+  const auto finish = [](float *, int) {};
+  PoolBlocks(params, input_shape, input_data, output_shape, output_data, init, reduce, finish);
+}
+
+// Average over pixels in the window except padding, as cker::AveragePool does
+inline void AveragePool(const PoolParams &params, const Shape &input_shape,
+                        const float *input_data, const Shape &output_shape, float *output_data)
+{
+  const auto init = [](float *acc) { std::fill(acc, acc + kBlockSize, 0.0f); };
+  const auto reduce = [](float *acc, const float *in) {
+    for (int c = 0; c < kBlockSize; ++c)
+      acc[c] += in[c];
+  };
+  const auto finish = [](float *acc, int count) {
+    for (int c = 0; c < kBlockSize; ++c)
+      acc[c] /= count;
+  };
+  PoolBlocks(params, input_shape, input_data, output_shape, output_data, init, reduce, finish);
+}
+
+} // namespace nchwc
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_NCHWC_POOL_H__
@@ -19,6 +19,7 @@
 #define __NNFW_CKER_OPTIMIZED_CONV_H__
 
 #include "OptimizedUtils.h"
+#include "Gemm.h"
 
 #include "cker/eigen/EigenSupport.h"
 #include "cker/eigen/Utils.h"
@@ -27,6 +28,7 @@
 #include "cker/operation/Common.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
+#include "cker/TensorUtils.h"
 
 #include <public/gemmlowp.h>
 #include <public/map.h>
@@ -169,6 +171,195 @@ inline void Conv(const ConvParams &params, const Shape &input_shape, const uint8
       output_pipeline);
 }
 
+inline void ConvPerChannel(const ConvParams &params, const int32_t *output_multiplier,
+                           const int32_t *output_shift, const Shape &input_shape,
+                           const int8_t *input_data, const Shape &filter_shape,
+                           const int8_t *filter_data, const Shape &bias_shape,
+                           const int32_t *bias_data, const Shape &output_shape,
+                           int8_t *output_data, const Shape &im2col_shape, int8_t *im2col_data)
+{
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int32_t input_offset = params.input_offset;
+  const int32_t output_offset = params.output_offset;
+  const int32_t output_activation_min = params.quantized_activation_min;
+  const int32_t output_activation_max = params.quantized_activation_max;
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  assert(params.dilation_width_factor == 1 && params.dilation_height_factor == 1);
+
+  const int8_t *gemm_input_data = nullptr;
+  const Shape *gemm_input_shape = nullptr;
+  const int filter_width = filter_shape.Dims(2);
+  const int filter_height = filter_shape.Dims(1);
+  const bool need_im2col =
+      stride_width != 1 || stride_height != 1 || filter_width != 1 || filter_height != 1;
+  if (need_im2col)
+  {
+    assert(im2col_data);
+    // Padded area of im2col buffer has the value which is dequantized to zero
+    const int input_zero_point = -input_offset;
+    assert(input_zero_point >= std::numeric_limits<int8_t>::min());
+    assert(input_zero_point <= std::numeric_limits<int8_t>::max());
+    Im2col(params, filter_height, filter_width,
+           static_cast<uint8_t>(static_cast<int8_t>(input_zero_point)), input_shape, input_data,
+           im2col_shape, im2col_data);
+    gemm_input_data = im2col_data;
+    gemm_input_shape = &im2col_shape;
+  }
+  else
+  {
+    gemm_input_data = input_data;
+    gemm_input_shape = &input_shape;
+  }
+
+  const int gemm_input_rows = gemm_input_shape->Dims(3);
+  const int gemm_input_cols =
+      gemm_input_shape->Dims(0) * gemm_input_shape->Dims(1) * gemm_input_shape->Dims(2);
+  const int filter_rows = filter_shape.Dims(0);
+  const int filter_cols = filter_shape.Dims(1) * filter_shape.Dims(2) * filter_shape.Dims(3);
+  const int output_rows = output_shape.Dims(3);
+  const int output_cols = output_shape.Dims(0) * output_shape.Dims(1) * output_shape.Dims(2);
+  assert(output_rows == filter_rows);
+  assert(output_cols == gemm_input_cols);
+  assert(filter_cols == gemm_input_rows);
+  assert(bias_shape.FlatSize() == output_rows);
+  UNUSED_RELEASE(output_cols);
+  UNUSED_RELEASE(bias_shape);
+
+  MatrixParams<int8_t> lhs_params;
+  lhs_params.rows = filter_rows;
+  lhs_params.cols = filter_cols;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.zero_point = 0; // filter is symmetric-quantized
+  lhs_params.cacheable = true;
+  MatrixParams<int8_t> rhs_params;
+  rhs_params.rows = gemm_input_rows;
+  rhs_params.cols = gemm_input_cols;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.zero_point = -input_offset;
+  MatrixParams<int8_t> dst_params;
+  dst_params.rows = output_rows;
+  dst_params.cols = gemm_input_cols;
+  dst_params.order = Order::kColMajor;
+  dst_params.zero_point = output_offset;
+  GemmParams<int32_t, int8_t, QuantizationFlavor::kIntegerWithPerRowMultiplier> gemm_params;
+  gemm_params.bias = bias_data;
+  gemm_params.clamp_min = output_activation_min;
+  gemm_params.clamp_max = output_activation_max;
+  gemm_params.multiplier_fixedpoint_perchannel = output_multiplier;
+  gemm_params.multiplier_exponent_perchannel = output_shift;
+  Gemm(lhs_params, filter_data, rhs_params, gemm_input_data, dst_params, output_data,
+       gemm_params);
+}
+
+/**
+ * @brief Convolution with float input/output and symmetric int8 filter
+ *
+ * Input is quantized per batch on the fly, so that most of computation is done with int8 GEMM.
+ * Accumulators are dequantized with the scale of each batch and output channel.
+ */
+inline void HybridConvPerChannel(const ConvParams &params, const float *filter_scales,
+                                 const Shape &input_shape, const float *input_data,
+                                 const Shape &filter_shape, const int8_t *filter_data,
+                                 const Shape &bias_shape, const float *bias_data,
+                                 const Shape &output_shape, float *output_data,
+                                 const Shape &im2col_shape, int8_t *im2col_data,
+                                 int8_t *quantized_input_data, float *scaling_factors,
+                                 int32_t *accum_scratch)
+{
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const float output_activation_min = params.float_activation_min;
+  const float output_activation_max = params.float_activation_max;
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  assert(params.dilation_width_factor == 1 && params.dilation_height_factor == 1);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_size = input_shape.FlatSize() / batches;
+  for (int b = 0; b < batches; ++b)
+  {
+    float unused_min, unused_max;
+    const int offset = b * input_size;
+    SymmetricQuantizeFloats(input_data + offset, input_size, quantized_input_data + offset,
+                            &unused_min, &unused_max, &scaling_factors[b]);
+  }
+
+  const int8_t *gemm_input_data = nullptr;
+  const Shape *gemm_input_shape = nullptr;
+  const int filter_width = filter_shape.Dims(2);
+  const int filter_height = filter_shape.Dims(1);
+  const bool need_im2col =
+      stride_width != 1 || stride_height != 1 || filter_width != 1 || filter_height != 1;
+  if (need_im2col)
+  {
+    assert(im2col_data);
+    // Quantized input is symmetric, so zero is padded
+    Im2col(params, filter_height, filter_width, 0, input_shape, quantized_input_data,
+           im2col_shape, im2col_data);
+    gemm_input_data = im2col_data;
+    gemm_input_shape = &im2col_shape;
+  }
+  else
+  {
+    gemm_input_data = quantized_input_data;
+    gemm_input_shape = &input_shape;
+  }
+
+  const int gemm_input_rows = gemm_input_shape->Dims(3);
+  const int gemm_input_cols =
+      gemm_input_shape->Dims(0) * gemm_input_shape->Dims(1) * gemm_input_shape->Dims(2);
+  const int filter_rows = filter_shape.Dims(0);
+  const int filter_cols = filter_shape.Dims(1) * filter_shape.Dims(2) * filter_shape.Dims(3);
+  const int output_rows = output_shape.Dims(3);
+  const int output_cols = output_shape.Dims(0) * output_shape.Dims(1) * output_shape.Dims(2);
+  assert(output_rows == filter_rows);
+  assert(output_cols == gemm_input_cols);
+  assert(filter_cols == gemm_input_rows);
+  assert(bias_data == nullptr || bias_shape.FlatSize() == output_rows);
+  UNUSED_RELEASE(filter_cols);
+  UNUSED_RELEASE(bias_shape);
+
+  MatrixParams<int8_t> lhs_params;
+  lhs_params.rows = filter_rows;
+  lhs_params.cols = filter_cols;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.cacheable = true;
+  MatrixParams<int8_t> rhs_params;
+  rhs_params.rows = gemm_input_rows;
+  rhs_params.cols = gemm_input_cols;
+  rhs_params.order = Order::kColMajor;
+  MatrixParams<int32_t> dst_params;
+  dst_params.rows = output_rows;
+  dst_params.cols = gemm_input_cols;
+  dst_params.order = Order::kColMajor;
+  GemmParams<int32_t, int32_t> gemm_params;
+  Gemm(lhs_params, filter_data, rhs_params, gemm_input_data, dst_params, accum_scratch,
+       gemm_params);
+
+  // Dequantize the accumulators, add bias and apply activation
+  const int cols_per_batch = output_cols / batches;
+  for (int col = 0; col < output_cols; ++col)
+  {
+    const float batch_scale = scaling_factors[col / cols_per_batch];
+    const int32_t *accum = accum_scratch + col * output_rows;
+    float *output = output_data + col * output_rows;
+    for (int row = 0; row < output_rows; ++row)
+    {
+      float value = accum[row] * batch_scale * filter_scales[row];
+      if (bias_data)
+      {
+        value += bias_data[row];
+      }
+      output[row] = ActivationFunctionWithMinMax(value, output_activation_min,
+                                                 output_activation_max);
+    }
+  }
+}
+
 } // namespace optimized
 
 namespace multithreaded
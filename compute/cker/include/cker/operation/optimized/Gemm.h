@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ * Copyright 2018 The TensorFlow Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_GEMM_H__
+#define __NNFW_CKER_OPTIMIZED_GEMM_H__
+
+#include "cker/Types.h"
+#include "cker/ruy/RuySupport.h"
+
+#include <ruy/path.h>
+#include <ruy/ruy.h>
+#include <ruy/ruy_advanced.h>
+
+#include <cassert>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+/**
+ * @brief Compute dst = lhs * rhs with ruy, quantizing down the accumulators as @c params says
+ *
+ * This is a counterpart of tflite::cpu_backend_gemm::Gemm which always uses ruy as the back-end.
+ * Weights are usually passed as lhs (row-major) and activations as rhs (column-major).
+ */
+template <typename LhsScalar, typename RhsScalar, typename AccumScalar, typename DstScalar,
+          QuantizationFlavor quantization_flavor>
+void Gemm(const MatrixParams<LhsScalar> &lhs_params, const LhsScalar *lhs_data,
+          const MatrixParams<RhsScalar> &rhs_params, const RhsScalar *rhs_data,
+          const MatrixParams<DstScalar> &dst_params, DstScalar *dst_data,
+          const GemmParams<AccumScalar, DstScalar, quantization_flavor> &params)
+{
+  ruy::Context *ruy_context = ruy_support::GetRuyContext();
+
+  ruy::Matrix<LhsScalar> ruy_lhs;
+  ruy::Matrix<RhsScalar> ruy_rhs;
+  ruy::Matrix<DstScalar> ruy_dst;
+  ruy_support::MakeRuyMatrix(lhs_params, lhs_data, &ruy_lhs);
+  ruy_support::MakeRuyMatrix(rhs_params, rhs_data, &ruy_rhs);
+  ruy_support::MakeRuyMatrix(dst_params, dst_data, &ruy_dst);
+
+  ruy::BasicSpec<AccumScalar, DstScalar> ruy_spec;
+  ruy_support::MakeRuySpec(params, &ruy_spec);
+
+  constexpr ruy::Path kRuyPath = ruy::kAllPaths;
+  ruy::Mul<kRuyPath>(ruy_lhs, ruy_rhs, ruy_spec, ruy_context, &ruy_dst);
+}
+
+/**
+ * @brief Lhs matrix of Gemm packed ahead of time into the layout which ruy kernels consume
+ *
+ * Packing constant weights once saves packing them again on every Gemm call. The packed matrix
+ * does not refer to the original data, so the original data can be released after prepack().
+ */
+template <typename LhsScalar> class PrepackedLhs
+{
+public:
+  PrepackedLhs() : _params(), _matrix(), _buffers(), _prepacked(false)
+  {
+    // DO NOTHING
+  }
+
+  PrepackedLhs(const PrepackedLhs &) = delete;
+  PrepackedLhs &operator=(const PrepackedLhs &) = delete;
+
+public:
+  /**
+   * @brief Pack @c lhs_data for Gemm with rhs and dst of given params
+   *
+   * Only shapes of @c rhs_params and @c dst_params are used to select the ruy path, so the packed
+   * matrix can be used for any number of rhs columns later.
+   */
+  template <typename RhsScalar, typename AccumScalar, typename DstScalar,
+            QuantizationFlavor quantization_flavor>
+  void prepack(const MatrixParams<LhsScalar> &lhs_params, const LhsScalar *lhs_data,
+               const MatrixParams<RhsScalar> &rhs_params, const MatrixParams<DstScalar> &dst_params,
+               const GemmParams<AccumScalar, DstScalar, quantization_flavor> &params)
+  {
+    ruy::Context *ruy_context = ruy_support::GetRuyContext();
+
+    ruy::Matrix<LhsScalar> ruy_lhs;
+    ruy::Matrix<RhsScalar> ruy_rhs;
+    ruy::Matrix<DstScalar> ruy_dst;
+    ruy_support::MakeRuyMatrix(lhs_params, lhs_data, &ruy_lhs);
+    ruy_support::MakeRuyMatrix(rhs_params, static_cast<const RhsScalar *>(nullptr), &ruy_rhs);
+    ruy_support::MakeRuyMatrix(dst_params, static_cast<DstScalar *>(nullptr), &ruy_dst);
+
+    ruy::BasicSpec<AccumScalar, DstScalar> ruy_spec;
+    ruy_support::MakeRuySpec(params, &ruy_spec);
+
+    _buffers.clear();
+    auto alloc_fn = [this](std::size_t num_bytes) -> void * {
+      void *ptr = nullptr;
+      // ruy kernels load packed data with aligned SIMD loads
+      if (posix_memalign(&ptr, kAlignment, num_bytes == 0 ? kAlignment : num_bytes) != 0)
+        throw std::bad_alloc();
+      _buffers.emplace_back(ptr);
+      return ptr;
+    };
+
+    constexpr ruy::Path kRuyPath = ruy::kAllPaths;
+    ruy::PrePackForMul<kRuyPath>(ruy_lhs, ruy_rhs, ruy_spec, ruy_context, &ruy_dst, &_matrix,
+                                 nullptr, alloc_fn);
+    _params = lhs_params;
+    _prepacked = true;
+  }
+
+  bool prepacked() const { return _prepacked; }
+  const MatrixParams<LhsScalar> &params() const { return _params; }
+  ruy::PrepackedMatrix *matrix() { return &_matrix; }
+
+private:
+  struct FreeDeleter
+  {
+    void operator()(void *ptr) const { std::free(ptr); }
+  };
+
+  static constexpr std::size_t kAlignment = 64;
+
+private:
+  MatrixParams<LhsScalar> _params;
+  ruy::PrepackedMatrix _matrix;
+  std::vector<std::unique_ptr<void, FreeDeleter>> _buffers;
+  bool _prepacked;
+};
+
+/**
+ * @brief Compute dst = lhs * rhs with ruy, where lhs has been packed by PrepackedLhs::prepack()
+ */
+template <typename LhsScalar, typename RhsScalar, typename AccumScalar, typename DstScalar,
+          QuantizationFlavor quantization_flavor>
+void Gemm(PrepackedLhs<LhsScalar> &lhs, const MatrixParams<RhsScalar> &rhs_params,
+          const RhsScalar *rhs_data, const MatrixParams<DstScalar> &dst_params, DstScalar *dst_data,
+          const GemmParams<AccumScalar, DstScalar, quantization_flavor> &params)
+{
+  assert(lhs.prepacked());
+  ruy::Context *ruy_context = ruy_support::GetRuyContext();
+
+  ruy::Matrix<LhsScalar> ruy_lhs;
+  ruy::Matrix<RhsScalar> ruy_rhs;
+  ruy::Matrix<DstScalar> ruy_dst;
+  // Data of lhs is never read as the packed one is used instead
+  ruy_support::MakeRuyMatrix(lhs.params(), static_cast<const LhsScalar *>(nullptr), &ruy_lhs);
+  ruy_support::MakeRuyMatrix(rhs_params, rhs_data, &ruy_rhs);
+  ruy_support::MakeRuyMatrix(dst_params, dst_data, &ruy_dst);
+
+  ruy::BasicSpec<AccumScalar, DstScalar> ruy_spec;
+  ruy_support::MakeRuySpec(params, &ruy_spec);
+
+  constexpr ruy::Path kRuyPath = ruy::kAllPaths;
+  ruy::MulWithPrepacked<kRuyPath>(ruy_lhs, ruy_rhs, ruy_spec, ruy_context, &ruy_dst, lhs.matrix(),
+                                  nullptr);
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_GEMM_H__
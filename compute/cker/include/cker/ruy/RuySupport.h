@@ -21,6 +21,7 @@
 #include <util/ConfigSource.h>
 #include <ruy/context.h>
 #include "cker/Types.h"
+#include "cker/ThreadLimit.h"
 
 namespace
 {
@@ -47,9 +48,11 @@ public:
 
   ruy::Context *ruy_context() const { return ruy_context_.get(); }
 
+  // ruy::Context must not be used by multiple threads at the same time, and kernels can be run
+  // concurrently by executor's worker threads
   static inline RuyContext &GetRuyContext()
   {
-    static RuyContext instance;
+    static thread_local RuyContext instance;
     return instance;
   }
 
@@ -57,16 +60,30 @@ public:
   {
     const int target_num_threads =
         max_num_threads > -1 ? max_num_threads : kDefaultNumThreadpoolThreads;
+    default_num_threads_ = target_num_threads;
+    explicit_num_threads_ = max_num_threads > -1;
     ruy_context_->max_num_threads = target_num_threads;
   }
 
+  // Follow the limit of the calling thread if any, the default otherwise
+  // The number of threads set explicitly, e.g. by RUY_THREADS, is kept regardless of the limit
+  void ApplyThreadLimit(int thread_limit)
+  {
+    if (explicit_num_threads_)
+      return;
+    ruy_context_->max_num_threads = thread_limit > 0 ? thread_limit : default_num_threads_;
+  }
+
 private:
   const std::unique_ptr<ruy::Context> ruy_context_;
+  int default_num_threads_ = kDefaultNumThreadpoolThreads;
+  bool explicit_num_threads_ = false;
 };
 
 inline ruy::Context *GetRuyContext()
 {
   auto &ctx = RuyContext::GetRuyContext();
+  ctx.ApplyThreadLimit(getThreadLimit());
   return ctx.ruy_context();
 }
 
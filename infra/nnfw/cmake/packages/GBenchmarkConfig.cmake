@@ -0,0 +1,22 @@
+### Find and use pre-installed Google Benchmark
+function(_GBenchmark_import)
+  find_path(GBENCHMARK_INCLUDE_DIR benchmark/benchmark.h)
+  find_library(GBENCHMARK_LIBRARY benchmark)
+  find_package(Threads QUIET)
+
+  if(NOT GBENCHMARK_INCLUDE_DIR OR NOT GBENCHMARK_LIBRARY OR NOT TARGET Threads::Threads)
+    set(GBenchmark_FOUND FALSE PARENT_SCOPE)
+    return()
+  endif(NOT GBENCHMARK_INCLUDE_DIR OR NOT GBENCHMARK_LIBRARY OR NOT TARGET Threads::Threads)
+
+  if(NOT TARGET gbenchmark)
+    message(STATUS "Found Google Benchmark: ${GBENCHMARK_LIBRARY}")
+    add_library(gbenchmark INTERFACE)
+    target_include_directories(gbenchmark INTERFACE ${GBENCHMARK_INCLUDE_DIR})
+    target_link_libraries(gbenchmark INTERFACE ${GBENCHMARK_LIBRARY} Threads::Threads)
+  endif(NOT TARGET gbenchmark)
+
+  set(GBenchmark_FOUND TRUE PARENT_SCOPE)
+endfunction(_GBenchmark_import)
+
+_GBenchmark_import()
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "heap_trace_api.h"
+#include "trace.h"
+
+#include <memory>
+
+extern std::unique_ptr<Trace> GlobalTrace;
+
+extern "C" {
+
+void heap_trace_get_cpu_usage(size_t *in_use, size_t *peak)
+{
+  if (!GlobalTrace)
+  {
+    *in_use = 0;
+    *peak = 0;
+    return;
+  }
+  GlobalTrace->getHeapUsageOnCpu(in_use, peak);
+}
+
+void heap_trace_reset_cpu_peak(void)
+{
+  if (GlobalTrace)
+  {
+    GlobalTrace->resetPeakOfWindowOnCpu();
+  }
+}
+}
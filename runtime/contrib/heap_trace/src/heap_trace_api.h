@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HEAP_TRACE_API_H
+#define HEAP_TRACE_API_H
+
+#include <cstddef>
+
+// Functions for a process running with heap_trace preloaded to query its own heap usage.
+// They are looked up with dlsym(RTLD_DEFAULT, ...), so that the process does not need to link
+// heap_trace, which is how onert MemoryProfiler uses them.
+extern "C" {
+
+// Get heap usage on CPU in bytes. Peak is the highest usage since the last reset.
+void heap_trace_get_cpu_usage(size_t *in_use, size_t *peak);
+// Reset the peak to usage at the moment
+void heap_trace_reset_cpu_peak(void);
+}
+
+#endif // ! HEAP_TRACE_API_H
@@ -47,6 +47,10 @@ void Trace::logAllocationEvent(void *memory_ptr, size_t size_of_allocated_space_
   {
     _peak_heap_usage_on_cpu = _total_allocated_bytes_on_cpu - _total_deallocated_bytes_on_cpu;
   }
+  if (_peak_of_window_on_cpu < _total_allocated_bytes_on_cpu - _total_deallocated_bytes_on_cpu)
+  {
+    _peak_of_window_on_cpu = _total_allocated_bytes_on_cpu - _total_deallocated_bytes_on_cpu;
+  }
   _memory_in_use_on_cpu[memory_ptr] = size_of_allocated_space_in_bytes;
   Guard{}.signalizeThatDangerOfRecursionHasPassed();
 }
@@ -64,6 +68,23 @@ void Trace::logDeallocationEvent(void *memory_ptr)
   Guard{}.signalizeThatDangerOfRecursionHasPassed();
 }
 
+void Trace::getHeapUsageOnCpu(size_t *in_use, size_t *peak_of_window)
+{
+  Guard{}.signalizeAboutPossibleRecursion();
+  std::lock_guard<std::mutex> guard(_lock);
+  *in_use = _total_allocated_bytes_on_cpu - _total_deallocated_bytes_on_cpu;
+  *peak_of_window = _peak_of_window_on_cpu;
+  Guard{}.signalizeThatDangerOfRecursionHasPassed();
+}
+
+void Trace::resetPeakOfWindowOnCpu()
+{
+  Guard{}.signalizeAboutPossibleRecursion();
+  std::lock_guard<std::mutex> guard(_lock);
+  _peak_of_window_on_cpu = _total_allocated_bytes_on_cpu - _total_deallocated_bytes_on_cpu;
+  Guard{}.signalizeThatDangerOfRecursionHasPassed();
+}
+
 void Trace::logAllocationEvent(cl_mem memory_ptr, size_t size_of_allocated_space_in_bytes)
 {
   Guard{}.signalizeAboutPossibleRecursion();
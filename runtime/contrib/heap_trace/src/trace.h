@@ -65,6 +65,10 @@ public:
   void logDeallocationEvent(void *memory_ptr);
   void logDeallocationEvent(cl_mem memory_ptr);
 
+  // Peak of window is the highest heap usage since the last call of resetPeakOfWindowOnCpu()
+  void getHeapUsageOnCpu(size_t *in_use, size_t *peak_of_window);
+  void resetPeakOfWindowOnCpu();
+
   ~Trace();
 
 private:
@@ -76,6 +80,7 @@ private:
   size_t _total_allocated_bytes_on_cpu = 0;
   size_t _total_deallocated_bytes_on_cpu = 0;
   size_t _peak_heap_usage_on_cpu = 0;
+  size_t _peak_of_window_on_cpu = 0;
   size_t _total_allocated_bytes_on_gpu = 0;
   size_t _total_deallocated_bytes_on_gpu = 0;
   size_t _peak_heap_usage_on_gpu = 0;
@@ -18,6 +18,7 @@
 #include "file_content_manipulations.h"
 
 #include "trace.h"
+#include "heap_trace_api.h"
 
 #include <CL/cl.h>
 
@@ -172,4 +173,34 @@ TEST_F(Trace, must_log_allocation_and_deallocation_events)
   ASSERT_STREQ(getContentOfFile("./trace_test.log").c_str(), shouldBeInLogFile.c_str());
 }
 
+TEST_F(Trace, must_report_peak_of_heap_usage_since_last_reset)
+{
+  void *memOnCPU1 = (void *)1, *memOnCPU2 = (void *)3;
+  size_t inUse = 0, peak = 0;
+
+  heap_trace_reset_cpu_peak();
+  GlobalTrace->logAllocationEvent(memOnCPU1, 1000);
+  GlobalTrace->logAllocationEvent(memOnCPU2, 500);
+  GlobalTrace->logDeallocationEvent(memOnCPU2);
+  heap_trace_get_cpu_usage(&inUse, &peak);
+  ASSERT_EQ(peak - inUse, 500u);
+
+  heap_trace_reset_cpu_peak();
+  GlobalTrace->logDeallocationEvent(memOnCPU1);
+  heap_trace_get_cpu_usage(&inUse, &peak);
+  ASSERT_EQ(peak - inUse, 1000u);
+}
+
+TEST_F(Trace, should_report_zero_heap_usage_until_it_is_not_created)
+{
+  size_t inUse = 1, peak = 1;
+
+  GlobalTrace.reset();
+  heap_trace_reset_cpu_peak();
+  heap_trace_get_cpu_usage(&inUse, &peak);
+
+  ASSERT_EQ(inUse, 0u);
+  ASSERT_EQ(peak, 0u);
+}
+
 } // namespace backstage
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Config.h"
+
+#include <ir/Operations.Include.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace hi_perf_cpu
+{
+
+namespace
+{
+
+bool isStaticFloat(const ir::Operand &operand)
+{
+  return operand.typeInfo().type() == ir::DataType::FLOAT32 && !operand.info().isDynamic();
+}
+
+bool isSupportedActivation(ir::Activation activation)
+{
+  return activation == ir::Activation::NONE || activation == ir::Activation::RELU ||
+         activation == ir::Activation::RELU1 || activation == ir::Activation::RELU6;
+}
+
+} // namespace
+
+bool Config::initialize() { return true; }
+
+ir::Layout Config::supportLayout(const ir::Operation &, ir::Layout) { return ir::Layout::NHWC; }
+
+bool Config::supportOperation(const ir::Operation &node, const ir::Operands &operands)
+{
+  for (const auto &ind : node.getInputs() + node.getOutputs())
+  {
+    if (!isStaticFloat(operands.at(ind)))
+      return false;
+  }
+
+  switch (node.opcode())
+  {
+    case ir::OpCode::Conv2D:
+    {
+      const auto &conv = static_cast<const ir::operation::Conv2D &>(node);
+      return operands.at(conv.getInputs().at(ir::operation::Conv2D::KERNEL)).isConstant() &&
+             operands.at(conv.getInputs().at(ir::operation::Conv2D::BIAS)).isConstant() &&
+             isSupportedActivation(conv.param().activation);
+    }
+    case ir::OpCode::DepthwiseConv2D:
+    {
+      const auto &conv = static_cast<const ir::operation::DepthwiseConv2D &>(node);
+      return operands.at(conv.getInputs().at(ir::operation::DepthwiseConv2D::KERNEL))
+                 .isConstant() &&
+             isSupportedActivation(conv.param().activation);
+    }
+    case ir::OpCode::FullyConnected:
+    {
+      const auto &fc = static_cast<const ir::operation::FullyConnected &>(node);
+      return operands.at(fc.getInputs().at(ir::operation::FullyConnected::WEIGHT)).isConstant() &&
+             operands.at(fc.getInputs().at(ir::operation::FullyConnected::BIAS)).isConstant() &&
+             isSupportedActivation(fc.param().activation);
+    }
+    default:
+      return false;
+  }
+}
+
+} // namespace hi_perf_cpu
+} // namespace backend
+} // namespace onert
@@ -17,11 +17,11 @@
 #ifndef __ONERT_BACKEND_HI_PERF_CPU_KERNEL_GENERATOR_H__
 #define __ONERT_BACKEND_HI_PERF_CPU_KERNEL_GENERATOR_H__
 
-#include <backend/IKernelGenerator.h>
-
-#include "ir/Operands.h"
 #include "TensorBuilder.h"
 
+#include <backend/IKernelGenerator.h>
+#include <ir/Operands.h>
+
 namespace onert
 {
 namespace backend
@@ -29,15 +29,25 @@ namespace backend
 namespace hi_perf_cpu
 {
 
+/**
+ * @brief Generate kernels specialized for shapes of operands, which are known at compile time
+ */
 class KernelGenerator : public IKernelGenerator
 {
 public:
   KernelGenerator(const ir::Operands &ctx, const std::shared_ptr<TensorBuilder> &tensor_builder);
-  // TODO add more ops
+
+  using IKernelGenerator::visit;
+
+  void visit(const ir::OpSequence &) override;
+  void visit(const ir::operation::Conv2D &) override;
+  void visit(const ir::operation::DepthwiseConv2D &) override;
+  void visit(const ir::operation::FullyConnected &) override;
 
 private:
   const ir::Operands &_ctx;
   std::shared_ptr<TensorBuilder> _tensor_builder;
+  ir::Layout _current_op_seq_layout;
 };
 
 } // namespace hi_perf_cpu
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "StaticTensorManager.h"
+
+#include <util/logging.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace hi_perf_cpu
+{
+
+StaticTensorManager::StaticTensorManager(const std::shared_ptr<TensorRegistry> &reg)
+    : _const_mgr{new cpu_common::DynamicMemoryManager()},
+      _nonconst_mgr{new cpu_common::MemoryManager()}, _tensors{reg}
+{
+  // DO NOTHING
+}
+
+void StaticTensorManager::allocateConsts(void)
+{
+  for (auto &pair : (*_tensors))
+  {
+    const auto &ind = pair.first;
+    auto tensor = pair.second;
+    if (_as_constants[ind])
+    {
+      auto mem_alloc = _const_mgr->allocate(ind, tensor->total_size());
+      tensor->setBuffer(mem_alloc);
+      auto buffer = mem_alloc->base();
+      VERBOSE(HI_PERF_CPU_StaticTensorManager) << "CONSTANT TENSOR(#" << ind.value()
+                                       << "): " << static_cast<void *>(buffer)
+                                       << "size : " << tensor->total_size() << std::endl;
+    }
+  }
+}
+
+void StaticTensorManager::allocateNonconsts(void)
+{
+  _nonconst_mgr->allocate();
+
+  for (auto &pair : (*_tensors))
+  {
+    const auto &ind = pair.first;
+    auto tensor = pair.second;
+    if (!_as_constants[ind])
+    {
+      auto *buffer = _nonconst_mgr->getBuffer(ind);
+      tensor->setBuffer(buffer);
+
+      VERBOSE(HI_PERF_CPU_StaticTensorManager) << "TENSOR(#" << ind.value()
+                                       << "): " << static_cast<void *>(buffer) << std::endl;
+    }
+  }
+}
+
+void StaticTensorManager::deallocateConsts(void) { _const_mgr->deallocate(); }
+
+void StaticTensorManager::deallocateNonconsts(void) { _nonconst_mgr->deallocate(); }
+
+void StaticTensorManager::buildTensor(const ir::OperandIndex &ind,
+                                      const ir::OperandInfo &tensor_info, bool as_const)
+{
+  assert(_tensors->find(ind) == _tensors->end());
+  (*_tensors)[ind] = std::make_shared<operand::Tensor>(tensor_info);
+  _as_constants[ind] = as_const;
+}
+
+void StaticTensorManager::claimPlan(const ir::OperandIndex &ind, uint32_t size)
+{
+  assert(_tensors->find(ind) != _tensors->end());
+
+  if (!_as_constants[ind])
+    _nonconst_mgr->claimPlan(ind, size);
+}
+
+void StaticTensorManager::releasePlan(const ir::OperandIndex &ind)
+{
+  assert(_tensors->find(ind) != _tensors->end());
+
+  if (!_as_constants[ind])
+    _nonconst_mgr->releasePlan(ind);
+}
+
+void StaticTensorManager::iterate(const std::function<void(const ir::OperandIndex &)> &fn)
+{
+  for (const auto &it : (*_tensors))
+    fn(it.first);
+}
+
+ITensorManager::MemoryStats StaticTensorManager::memoryStats() const
+{
+  MemoryStats stats;
+  stats.arena_bytes = _nonconst_mgr->allocatedBytes();
+  return stats;
+}
+
+} // namespace hi_perf_cpu
+} // namespace backend
+} // namespace onert
@@ -15,4 +15,83 @@
  */
 
 #include "TensorBuilder.h"
-// to force compilation
+
+#include <cassert>
+#include <stdexcept>
+
+namespace onert
+{
+namespace backend
+{
+namespace hi_perf_cpu
+{
+
+TensorBuilder::TensorBuilder()
+    : _tensor_reg{new TensorRegistry()}, _static_tensor_mgr{new StaticTensorManager(_tensor_reg)}
+{
+  /* empty */
+}
+
+void TensorBuilder::registerTensorInfo(const ir::OperandIndex &ind, const ir::OperandInfo &info,
+                                       ir::Layout, bool as_const)
+{
+  if (info.isDynamic())
+    throw std::runtime_error{"HI_PERF_CPU backend: Dynamic tensor is not supported"};
+
+  _tensor_info_map.emplace(ind, info);
+  _static_tensor_mgr->buildTensor(ind, info, as_const);
+}
+
+void TensorBuilder::notifyFirstUse(const ir::OperandIndex &ind)
+{
+  assert(_tensor_info_map.find(ind) != _tensor_info_map.end());
+  _static_tensor_mgr->claimPlan(ind, _tensor_info_map.at(ind).total_size());
+}
+
+void TensorBuilder::notifyLastUse(const ir::OperandIndex &ind)
+{
+  _static_tensor_mgr->releasePlan(ind);
+}
+
+bool TensorBuilder::isRegistered(const ir::OperandIndex &ind) const
+{
+  return _tensor_info_map.find(ind) != _tensor_info_map.end();
+}
+
+void TensorBuilder::prepare(void)
+{
+  _static_tensor_mgr->allocateConsts();
+  _static_tensor_mgr->allocateNonconsts();
+}
+
+void TensorBuilder::allocate()
+{
+  // NOTE Allocation is done in prepare stage, as kernels read buffers of tensors when generated
+}
+
+std::shared_ptr<ITensor> TensorBuilder::tensorAt(const ir::OperandIndex &ind)
+{
+  auto found = _tensor_reg->find(ind);
+  if (found == _tensor_reg->end())
+    return nullptr;
+
+  return found->second;
+}
+
+void TensorBuilder::iterate(const IterateFunction &fn) { _static_tensor_mgr->iterate(fn); }
+
+std::shared_ptr<operand::Tensor> TensorBuilder::at(const ir::OperandIndex &ind)
+{
+  auto found = _tensor_reg->find(ind);
+  assert(found != _tensor_reg->end());
+  return found->second;
+}
+
+std::unique_ptr<ITensorManager> TensorBuilder::releaseStaticTensorManager(void)
+{
+  return std::move(_static_tensor_mgr);
+}
+
+} // namespace hi_perf_cpu
+} // namespace backend
+} // namespace onert
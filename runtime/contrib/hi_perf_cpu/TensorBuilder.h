@@ -14,13 +14,15 @@
  * limitations under the License.
  */
 
-#ifndef NNFW_TENSORBUILDER_H
-#define NNFW_TENSORBUILDER_H
+#ifndef __ONERT_BACKEND_HI_PERF_CPU_TENSOR_BUILDER_H__
+#define __ONERT_BACKEND_HI_PERF_CPU_TENSOR_BUILDER_H__
 
-#include <unordered_map>
+#include "StaticTensorManager.h"
+#include "TensorRegistry.h"
+#include "operand/Tensor.h"
 
 #include <backend/ITensorBuilder.h>
-#include "ir/OperandIndexMap.h"
+#include <ir/OperandIndexMap.h>
 
 namespace onert
 {
@@ -34,11 +36,50 @@ class TensorBuilder : public ITensorBuilder
 public:
   TensorBuilder();
 
+  bool supportDynamicTensor() override { return false; }
+
+  /**
+   * @brief     Register tensor information to allocate on HI_PERF_CPU backend
+   * @param[in] ind    Operand index
+   * @param[in] info   Operand information
+   * @param[in] layout Operand data layout
+   */
+  void registerTensorInfo(const ir::OperandIndex &ind, const ir::OperandInfo &info,
+                          ir::Layout backend_layout, bool as_const) override;
+
+  void notifyFirstUse(const ir::OperandIndex &) override;
+  void notifyLastUse(const ir::OperandIndex &) override;
+
+  bool isRegistered(const ir::OperandIndex &) const override;
+
+  void prepare(void) override;
+  void allocate() override;
+  void postFunctionPrepare() override { /* DO NOTHING */}
+  void postAllFunctionsPrepare() override { /* DO NOTHING */}
+
+  std::shared_ptr<ITensor> tensorAt(const ir::OperandIndex &ind) override;
+
+  void iterate(const IterateFunction &fn) override;
+
+  std::unique_ptr<ITensorManager> releaseStaticTensorManager(void) override;
+
+  /**
+   * @brief Get tensor with a specific OperandIndex.
+   * @param ind OperandIndex for the tensor. There must exist a tensor with this ind.
+   * @return shared_ptr<operand::Tensor>
+   */
+  std::shared_ptr<operand::Tensor> at(const ir::OperandIndex &ind);
+
+  std::shared_ptr<ITensorRegistry> tensorRegistry() override { return _tensor_reg; }
+
 private:
+  const std::shared_ptr<TensorRegistry> _tensor_reg;
+  std::unique_ptr<StaticTensorManager> _static_tensor_mgr;
+  ir::OperandIndexMap<ir::OperandInfo> _tensor_info_map;
 };
 
 } // namespace hi_perf_cpu
 } // namespace backend
 } // namespace onert
 
-#endif // NNFW_TENSORBUILDER_H
+#endif // __ONERT_BACKEND_HI_PERF_CPU_TENSOR_BUILDER_H__
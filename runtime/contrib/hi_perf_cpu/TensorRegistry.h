@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_HI_PERF_CPU_TENSOR_REGISTRY__
+#define __ONERT_BACKEND_HI_PERF_CPU_TENSOR_REGISTRY__
+
+#include "ir/OperandIndexMap.h"
+#include "backend/ITensorRegistry.h"
+#include "operand/Tensor.h"
+
+#include <memory>
+
+namespace onert
+{
+namespace backend
+{
+namespace hi_perf_cpu
+{
+
+class TensorRegistry : public ITensorRegistry,
+                       public ir::OperandIndexMap<std::shared_ptr<operand::Tensor>>
+{
+public:
+  /**
+   * @brief Returns pointer of ITensor
+   */
+  ITensor *getITensor(const ir::OperandIndex &ind) override { return at(ind).get(); }
+};
+
+} // namespace hi_perf_cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_HI_PERF_CPU_TENSOR_REGISTRY__
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  Conv.h
+ * @brief Convolution kernels specialized for filter size and stride at compile time
+ *
+ * Output channels are computed in blocks of kBlock with filters packed as
+ * [ceil(OC / kBlock), KH, KW, IC, kBlock], so that the innermost loop is over a block of fixed
+ * size, held in 128-bit vectors. Each pass computes kTile pixels along width to reuse weights
+ * loaded into registers.
+ */
+
+#ifndef __ONERT_BACKEND_HI_PERF_CPU_KERNEL_CONV_H__
+#define __ONERT_BACKEND_HI_PERF_CPU_KERNEL_CONV_H__
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace onert
+{
+namespace backend
+{
+namespace hi_perf_cpu
+{
+namespace kernel
+{
+
+// Output channels computed together, which are two 128-bit registers
+constexpr int kBlock = 8;
+// Output pixels computed together along width
+constexpr int kTile = 4;
+
+// 128-bit vector of GCC and Clang, which is SSE on x86 and NEON on ARM
+using Vec4 = float __attribute__((vector_size(16)));
+
+inline Vec4 loadVec4(const float *p)
+{
+  Vec4 v;
+  __builtin_memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+struct ConvGeometry
+{
+  int batch;
+  int in_h;
+  int in_w;
+  int in_c;
+  int out_h;
+  int out_w;
+  int out_c;
+  int ker_h;
+  int ker_w;
+  int stride_h;
+  int stride_w;
+  int pad_top;
+  int pad_left;
+  float act_min;
+  float act_max;
+};
+
+inline int numBlocks(int channels) { return (channels + kBlock - 1) / kBlock; }
+
+/**
+ * @brief Pack filter of [OC, KH, KW, IC] into blocks of output channels
+ *        Output channels beyond OC in the last block are zero.
+ */
+inline std::vector<float> packConvFilter(const ConvGeometry &g, const float *filter)
+{
+  const int spatial = g.ker_h * g.ker_w * g.in_c;
+  std::vector<float> packed(numBlocks(g.out_c) * spatial * kBlock, 0.0f);
+  for (int oc = 0; oc < g.out_c; ++oc)
+  {
+    float *dst = packed.data() + (oc / kBlock) * spatial * kBlock + oc % kBlock;
+    const float *src = filter + oc * spatial;
+    for (int i = 0; i < spatial; ++i)
+      dst[i * kBlock] = src[i];
+  }
+  return packed;
+}
+
+/**
+ * @brief Pad bias to blocks of output channels, which is zero if there is no bias
+ */
+inline std::vector<float> packBias(int channels, const float *bias)
+{
+  std::vector<float> packed(numBlocks(channels) * kBlock, 0.0f);
+  if (bias != nullptr)
+    std::copy(bias, bias + channels, packed.begin());
+  return packed;
+}
+
+/**
+ * @brief Convolution of NHWC input with a packed filter
+ *
+ * @tparam KH Height of filter, or 0 to read it from geometry at runtime (so for KW, SH and SW)
+ * @param zeros At least g.in_c zeros, which are read instead of padding and pixels beyond width
+ */
+template <int KH, int KW, int SH, int SW>
+void conv(const ConvGeometry &g, const float *input, const float *packed_filter,
+          const float *packed_bias, const float *zeros, float *output)
+{
+  const int ker_h = KH > 0 ? KH : g.ker_h;
+  const int ker_w = KW > 0 ? KW : g.ker_w;
+  const int stride_h = SH > 0 ? SH : g.stride_h;
+  const int stride_w = SW > 0 ? SW : g.stride_w;
+  const int in_c = g.in_c;
+  const int block_size = ker_h * ker_w * in_c * kBlock;
+
+  for (int b = 0; b < g.batch; ++b)
+  {
+    const float *input_b = input + b * g.in_h * g.in_w * in_c;
+    for (int oh = 0; oh < g.out_h; ++oh)
+    {
+      for (int ow0 = 0; ow0 < g.out_w; ow0 += kTile)
+      {
+        const int tile = std::min(kTile, g.out_w - ow0);
+        for (int ob = 0; ob < numBlocks(g.out_c); ++ob)
+        {
+          // Accumulators of kTile x kBlock, which stay in registers
+          const Vec4 bias_lo = loadVec4(packed_bias + ob * kBlock);
+          const Vec4 bias_hi = loadVec4(packed_bias + ob * kBlock + 4);
+          Vec4 acc[kTile][2];
+          for (int t = 0; t < kTile; ++t)
+          {
+            acc[t][0] = bias_lo;
+            acc[t][1] = bias_hi;
+          }
+
+          const float *filter_block = packed_filter + ob * block_size;
+          for (int kh = 0; kh < ker_h; ++kh)
+          {
+            const int ih = oh * stride_h - g.pad_top + kh;
+            if (ih < 0 || ih >= g.in_h)
+              continue;
+            for (int kw = 0; kw < ker_w; ++kw)
+            {
+              const float *in[kTile];
+              for (int t = 0; t < kTile; ++t)
+              {
+                const int iw = (ow0 + t) * stride_w - g.pad_left + kw;
+                in[t] = (t < tile && iw >= 0 && iw < g.in_w) ? input_b + (ih * g.in_w + iw) * in_c
+                                                             : zeros;
+              }
+
+              const float *w = filter_block + (kh * ker_w + kw) * in_c * kBlock;
+              for (int ic = 0; ic < in_c; ++ic, w += kBlock)
+              {
+                const Vec4 w_lo = loadVec4(w);
+                const Vec4 w_hi = loadVec4(w + 4);
+                for (int t = 0; t < kTile; ++t)
+                {
+                  const float x = in[t][ic];
+                  acc[t][0] += x * w_lo;
+                  acc[t][1] += x * w_hi;
+                }
+              }
+            }
+          }
+
+          const int count = std::min(kBlock, g.out_c - ob * kBlock);
+          for (int t = 0; t < tile; ++t)
+          {
+            float res[kBlock];
+            __builtin_memcpy(res, acc[t], sizeof(res));
+            float *out = output + ((b * g.out_h + oh) * g.out_w + ow0 + t) * g.out_c + ob * kBlock;
+            for (int j = 0; j < count; ++j)
+              out[j] = std::min(std::max(res[j], g.act_min), g.act_max);
+          }
+        }
+      }
+    }
+  }
+}
+
+using ConvKernel = void (*)(const ConvGeometry &, const float *, const float *, const float *,
+                            const float *, float *);
+
+/**
+ * @brief Get the kernel instantiated for the filter size and stride of 'g'
+ *        Those not instantiated run the generic kernel, which reads them at runtime.
+ */
+inline ConvKernel getConvKernel(const ConvGeometry &g)
+{
+#define HI_PERF_CONV(KH, KW, SH, SW)                                                     \
+  if (g.ker_h == KH && g.ker_w == KW && g.stride_h == SH && g.stride_w == SW)          \
+    return conv<KH, KW, SH, SW>;
+  HI_PERF_CONV(1, 1, 1, 1)
+  HI_PERF_CONV(1, 1, 2, 2)
+  HI_PERF_CONV(3, 3, 1, 1)
+  HI_PERF_CONV(3, 3, 2, 2)
+  HI_PERF_CONV(5, 5, 1, 1)
+  HI_PERF_CONV(5, 5, 2, 2)
+  HI_PERF_CONV(7, 7, 2, 2)
+#undef HI_PERF_CONV
+  return conv<0, 0, 0, 0>;
+}
+
+} // namespace kernel
+} // namespace hi_perf_cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_HI_PERF_CPU_KERNEL_CONV_H__
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "kernel/Conv.h"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <random>
+
+using namespace onert::backend::hi_perf_cpu::kernel;
+
+namespace
+{
+
+const ConvKernel kGenericKernel = conv<0, 0, 0, 0>;
+
+std::vector<float> randomData(size_t size)
+{
+  std::mt19937 gen{1234};
+  std::uniform_real_distribution<float> dist{-1.0f, 1.0f};
+  std::vector<float> data(size);
+  for (auto &v : data)
+    v = dist(gen);
+  return data;
+}
+
+ConvGeometry makeGeometry(int in_hw, int in_c, int out_c, int ker, int stride, int pad)
+{
+  ConvGeometry g;
+  g.batch = 2;
+  g.in_h = in_hw;
+  g.in_w = in_hw + 1;
+  g.in_c = in_c;
+  g.out_h = (g.in_h + 2 * pad - ker) / stride + 1;
+  g.out_w = (g.in_w + 2 * pad - ker) / stride + 1;
+  g.out_c = out_c;
+  g.ker_h = ker;
+  g.ker_w = ker;
+  g.stride_h = stride;
+  g.stride_w = stride;
+  g.pad_top = pad;
+  g.pad_left = pad;
+  g.act_min = std::numeric_limits<float>::lowest();
+  g.act_max = std::numeric_limits<float>::max();
+  return g;
+}
+
+// Direct convolution of [N, H, W, IC] and [OC, KH, KW, IC]
+std::vector<float> referenceConv(const ConvGeometry &g, const std::vector<float> &input,
+                                 const std::vector<float> &filter, const std::vector<float> &bias)
+{
+  std::vector<float> output(g.batch * g.out_h * g.out_w * g.out_c);
+  for (int b = 0; b < g.batch; ++b)
+    for (int oh = 0; oh < g.out_h; ++oh)
+      for (int ow = 0; ow < g.out_w; ++ow)
+        for (int oc = 0; oc < g.out_c; ++oc)
+        {
+          float sum = bias[oc];
+          for (int kh = 0; kh < g.ker_h; ++kh)
+            for (int kw = 0; kw < g.ker_w; ++kw)
+            {
+              const int ih = oh * g.stride_h - g.pad_top + kh;
+              const int iw = ow * g.stride_w - g.pad_left + kw;
+              if (ih < 0 || ih >= g.in_h || iw < 0 || iw >= g.in_w)
+                continue;
+              for (int ic = 0; ic < g.in_c; ++ic)
+                sum += input[((b * g.in_h + ih) * g.in_w + iw) * g.in_c + ic] *
+                       filter[((oc * g.ker_h + kh) * g.ker_w + kw) * g.in_c + ic];
+            }
+          output[((b * g.out_h + oh) * g.out_w + ow) * g.out_c + oc] =
+              std::min(std::max(sum, g.act_min), g.act_max);
+        }
+  return output;
+}
+
+void verifyConv(const ConvGeometry &g, ConvKernel kernel)
+{
+  const auto input = randomData(g.batch * g.in_h * g.in_w * g.in_c);
+  const auto filter = randomData(g.out_c * g.ker_h * g.ker_w * g.in_c);
+  const auto bias = randomData(g.out_c);
+  const auto packed_filter = packConvFilter(g, filter.data());
+  const auto packed_bias = packBias(g.out_c, bias.data());
+  const std::vector<float> zeros(g.in_c, 0.0f);
+
+  std::vector<float> output(g.batch * g.out_h * g.out_w * g.out_c);
+  kernel(g, input.data(), packed_filter.data(), packed_bias.data(), zeros.data(), output.data());
+
+  const auto expected = referenceConv(g, input, filter, bias);
+  for (size_t i = 0; i < output.size(); ++i)
+    ASSERT_NEAR(output[i], expected[i], 1e-4f) << "at " << i;
+}
+
+} // namespace
+
+TEST(HiPerfCpuConv, specialized)
+{
+  // Output channels not a multiple of block and width not a multiple of tile
+  for (int ker : {1, 3, 5})
+    for (int stride : {1, 2})
+    {
+      const auto g = makeGeometry(9, 5, 13, ker, stride, ker / 2);
+      ASSERT_NE(getConvKernel(g), kGenericKernel);
+      verifyConv(g, getConvKernel(g));
+    }
+}
+
+TEST(HiPerfCpuConv, generic)
+{
+  const auto g = makeGeometry(8, 3, 8, 2, 1, 0);
+  ASSERT_EQ(getConvKernel(g), kGenericKernel);
+  verifyConv(g, getConvKernel(g));
+}
+
+TEST(HiPerfCpuConv, activation)
+{
+  auto g = makeGeometry(6, 4, 10, 3, 1, 1);
+  g.act_min = 0.0f;
+  g.act_max = 0.5f;
+  verifyConv(g, getConvKernel(g));
+}
+
+TEST(HiPerfCpuConv, fully_connected)
+{
+  // Fully connected of batch 3 as 1x1 convolution over a row of 3 pixels
+  auto g = makeGeometry(1, 17, 11, 1, 1, 0);
+  g.batch = 1;
+  g.in_w = g.out_w = 3;
+  verifyConv(g, getConvKernel(g));
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ConvolutionLayer.h"
+
+#include "OperationUtils.h"
+
+namespace onert
+{
+namespace backend
+{
+namespace hi_perf_cpu
+{
+namespace kernel
+{
+
+ConvolutionLayer::ConvolutionLayer()
+    : _input(nullptr), _kernel(nullptr), _bias(nullptr), _output(nullptr), _geometry(),
+      _conv(nullptr)
+{
+  // DO NOTHING
+}
+
+void ConvolutionLayer::configure(const operand::Tensor *input, const operand::Tensor *kernel,
+                                 const operand::Tensor *bias, const uint32_t paddingLeft,
+                                 const uint32_t paddingTop, const uint32_t strideWidth,
+                                 const uint32_t strideHeight, const ir::Activation activation,
+                                 operand::Tensor *output)
+{
+  _input = input;
+  _kernel = kernel;
+  _bias = bias;
+  _output = output;
+
+  // Input and output are [N, H, W, C], and kernel is [OC, KH, KW, IC]
+  _geometry.batch = input->dimension(0);
+  _geometry.in_h = input->dimension(1);
+  _geometry.in_w = input->dimension(2);
+  _geometry.in_c = input->dimension(3);
+  _geometry.out_h = output->dimension(1);
+  _geometry.out_w = output->dimension(2);
+  _geometry.out_c = output->dimension(3);
+  _geometry.ker_h = kernel->dimension(1);
+  _geometry.ker_w = kernel->dimension(2);
+  _geometry.stride_h = strideHeight;
+  _geometry.stride_w = strideWidth;
+  _geometry.pad_top = paddingTop;
+  _geometry.pad_left = paddingLeft;
+  CalculateActivationRangeFloat(activation, &_geometry.act_min, &_geometry.act_max);
+
+  _conv = getConvKernel(_geometry);
+}
+
+void ConvolutionLayer::prepare()
+{
+  _packed_filter = packConvFilter(_geometry, reinterpret_cast<const float *>(_kernel->buffer()));
+  _packed_bias = packBias(_geometry.out_c, reinterpret_cast<const float *>(_bias->buffer()));
+  _zeros.assign(_geometry.in_c, 0.0f);
+}
+
+void ConvolutionLayer::run()
+{
+  _conv(_geometry, reinterpret_cast<const float *>(_input->buffer()), _packed_filter.data(),
+        _packed_bias.data(), _zeros.data(), reinterpret_cast<float *>(_output->buffer()));
+}
+
+} // namespace kernel
+} // namespace hi_perf_cpu
+} // namespace backend
+} // namespace onert
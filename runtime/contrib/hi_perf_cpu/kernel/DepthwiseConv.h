@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  DepthwiseConv.h
+ * @brief Depthwise convolution kernels specialized for filter size and stride at compile time
+ *
+ * Channels are innermost in NHWC, so each filter tap is accumulated over all channels of an
+ * output pixel at once, which compilers turn into SIMD instructions.
+ */
+
+#ifndef __ONERT_BACKEND_HI_PERF_CPU_KERNEL_DEPTHWISE_CONV_H__
+#define __ONERT_BACKEND_HI_PERF_CPU_KERNEL_DEPTHWISE_CONV_H__
+
+#include "Conv.h"
+
+#include <algorithm>
+
+namespace onert
+{
+namespace backend
+{
+namespace hi_perf_cpu
+{
+namespace kernel
+{
+
+/**
+ * @brief Depthwise convolution of NHWC input with filter of [1, KH, KW, OC]
+ *
+ * @tparam KH Height of filter, or 0 to read it from geometry at runtime (so for KW, SH and SW)
+ * @param multiplier Output channels of each input channel, where OC is IC * multiplier
+ */
+template <int KH, int KW, int SH, int SW>
+void depthwiseConv(const ConvGeometry &g, int multiplier, const float *input, const float *filter,
+                   const float *bias, float *output)
+{
+  const int ker_h = KH > 0 ? KH : g.ker_h;
+  const int ker_w = KW > 0 ? KW : g.ker_w;
+  const int stride_h = SH > 0 ? SH : g.stride_h;
+  const int stride_w = SW > 0 ? SW : g.stride_w;
+  const int out_c = g.out_c;
+
+  for (int b = 0; b < g.batch; ++b)
+  {
+    for (int oh = 0; oh < g.out_h; ++oh)
+    {
+      for (int ow = 0; ow < g.out_w; ++ow)
+      {
+        float *out = output + ((b * g.out_h + oh) * g.out_w + ow) * out_c;
+        for (int c = 0; c < out_c; ++c)
+          out[c] = bias[c];
+
+        for (int kh = 0; kh < ker_h; ++kh)
+        {
+          const int ih = oh * stride_h - g.pad_top + kh;
+          if (ih < 0 || ih >= g.in_h)
+            continue;
+          for (int kw = 0; kw < ker_w; ++kw)
+          {
+            const int iw = ow * stride_w - g.pad_left + kw;
+            if (iw < 0 || iw >= g.in_w)
+              continue;
+
+            const float *in = input + ((b * g.in_h + ih) * g.in_w + iw) * g.in_c;
+            const float *w = filter + (kh * ker_w + kw) * out_c;
+            if (multiplier == 1)
+            {
+              for (int c = 0; c < out_c; ++c)
+                out[c] += in[c] * w[c];
+            }
+            else
+            {
+              for (int ic = 0; ic < g.in_c; ++ic)
+                for (int m = 0; m < multiplier; ++m)
+                  out[ic * multiplier + m] += in[ic] * w[ic * multiplier + m];
+            }
+          }
+        }
+
+        for (int c = 0; c < out_c; ++c)
+          out[c] = std::min(std::max(out[c], g.act_min), g.act_max);
+      }
+    }
+  }
+}
+
+using DepthwiseConvKernel = void (*)(const ConvGeometry &, int, const float *, const float *,
+                                     const float *, float *);
+
+/**
+ * @brief Get the kernel instantiated for the filter size and stride of 'g'
+ *        Those not instantiated run the generic kernel, which reads them at runtime.
+ */
+inline DepthwiseConvKernel getDepthwiseConvKernel(const ConvGeometry &g)
+{
+#define HI_PERF_DEPTHWISE_CONV(KH, KW, SH, SW)                                           \
+  if (g.ker_h == KH && g.ker_w == KW && g.stride_h == SH && g.stride_w == SW)          \
+    return depthwiseConv<KH, KW, SH, SW>;
+  HI_PERF_DEPTHWISE_CONV(3, 3, 1, 1)
+  HI_PERF_DEPTHWISE_CONV(3, 3, 2, 2)
+  HI_PERF_DEPTHWISE_CONV(5, 5, 1, 1)
+  HI_PERF_DEPTHWISE_CONV(5, 5, 2, 2)
+#undef HI_PERF_DEPTHWISE_CONV
+  return depthwiseConv<0, 0, 0, 0>;
+}
+
+} // namespace kernel
+} // namespace hi_perf_cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_HI_PERF_CPU_KERNEL_DEPTHWISE_CONV_H__
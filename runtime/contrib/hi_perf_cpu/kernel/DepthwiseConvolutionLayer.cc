@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DepthwiseConvolutionLayer.h"
+
+#include "OperationUtils.h"
+
+namespace onert
+{
+namespace backend
+{
+namespace hi_perf_cpu
+{
+namespace kernel
+{
+
+DepthwiseConvolutionLayer::DepthwiseConvolutionLayer()
+    : _input(nullptr), _kernel(nullptr), _bias(nullptr), _output(nullptr), _geometry(),
+      _multiplier(0), _conv(nullptr)
+{
+  // DO NOTHING
+}
+
+void DepthwiseConvolutionLayer::configure(const operand::Tensor *input,
+                                          const operand::Tensor *kernel,
+                                          const operand::Tensor *bias, const uint32_t paddingLeft,
+                                          const uint32_t paddingTop, const uint32_t strideWidth,
+                                          const uint32_t strideHeight, const uint32_t multiplier,
+                                          const ir::Activation activation, operand::Tensor *output)
+{
+  _input = input;
+  _kernel = kernel;
+  _bias = bias;
+  _output = output;
+  _multiplier = multiplier;
+
+  // Input and output are [N, H, W, C], and kernel is [1, KH, KW, OC]
+  _geometry.batch = input->dimension(0);
+  _geometry.in_h = input->dimension(1);
+  _geometry.in_w = input->dimension(2);
+  _geometry.in_c = input->dimension(3);
+  _geometry.out_h = output->dimension(1);
+  _geometry.out_w = output->dimension(2);
+  _geometry.out_c = output->dimension(3);
+  _geometry.ker_h = kernel->dimension(1);
+  _geometry.ker_w = kernel->dimension(2);
+  _geometry.stride_h = strideHeight;
+  _geometry.stride_w = strideWidth;
+  _geometry.pad_top = paddingTop;
+  _geometry.pad_left = paddingLeft;
+  CalculateActivationRangeFloat(activation, &_geometry.act_min, &_geometry.act_max);
+
+  _conv = getDepthwiseConvKernel(_geometry);
+}
+
+void DepthwiseConvolutionLayer::run()
+{
+  _conv(_geometry, _multiplier, reinterpret_cast<const float *>(_input->buffer()),
+        reinterpret_cast<const float *>(_kernel->buffer()),
+        reinterpret_cast<const float *>(_bias->buffer()),
+        reinterpret_cast<float *>(_output->buffer()));
+}
+
+} // namespace kernel
+} // namespace hi_perf_cpu
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_HI_PERF_CPU_KERNEL_DEPTHWISE_CONVOLUTION_LAYER_H__
+#define __ONERT_BACKEND_HI_PERF_CPU_KERNEL_DEPTHWISE_CONVOLUTION_LAYER_H__
+
+#include "../operand/Tensor.h"
+#include "DepthwiseConv.h"
+
+#include <exec/IFunction.h>
+#include <ir/InternalType.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace hi_perf_cpu
+{
+namespace kernel
+{
+
+class DepthwiseConvolutionLayer : public ::onert::exec::IFunction
+{
+public:
+  DepthwiseConvolutionLayer();
+
+public:
+  /**
+   * @brief Select the kernel for shapes of tensors, which must not change after this
+   */
+  void configure(const operand::Tensor *input, const operand::Tensor *kernel,
+                 const operand::Tensor *bias, const uint32_t paddingLeft,
+                 const uint32_t paddingTop, const uint32_t strideWidth,
+                 const uint32_t strideHeight, const uint32_t multiplier,
+                 const ir::Activation activation, operand::Tensor *output);
+
+  void run() override;
+  void runSync() override { run(); }
+
+private:
+  const operand::Tensor *_input;
+  const operand::Tensor *_kernel;
+  const operand::Tensor *_bias;
+  operand::Tensor *_output;
+
+  ConvGeometry _geometry;
+  int _multiplier;
+  DepthwiseConvKernel _conv;
+};
+
+} // namespace kernel
+} // namespace hi_perf_cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_HI_PERF_CPU_KERNEL_DEPTHWISE_CONVOLUTION_LAYER_H__
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FullyConnectedLayer.h"
+
+#include "OperationUtils.h"
+
+namespace onert
+{
+namespace backend
+{
+namespace hi_perf_cpu
+{
+namespace kernel
+{
+
+FullyConnectedLayer::FullyConnectedLayer()
+    : _input(nullptr), _weights(nullptr), _bias(nullptr), _output(nullptr), _geometry(),
+      _conv(nullptr)
+{
+  // DO NOTHING
+}
+
+void FullyConnectedLayer::configure(const operand::Tensor *input, const operand::Tensor *weights,
+                                    const operand::Tensor *bias, const ir::Activation activation,
+                                    operand::Tensor *output)
+{
+  _input = input;
+  _weights = weights;
+  _bias = bias;
+  _output = output;
+
+  // Weights of [OC, IC] are a 1x1 filter, and input of any rank is flattened to [batch, IC]
+  const int in_c = weights->dimension(1);
+  const int out_c = weights->dimension(0);
+  const int batch = input->total_size() / sizeof(float) / in_c;
+
+  _geometry.batch = 1;
+  _geometry.in_h = 1;
+  _geometry.in_w = batch;
+  _geometry.in_c = in_c;
+  _geometry.out_h = 1;
+  _geometry.out_w = batch;
+  _geometry.out_c = out_c;
+  _geometry.ker_h = 1;
+  _geometry.ker_w = 1;
+  _geometry.stride_h = 1;
+  _geometry.stride_w = 1;
+  _geometry.pad_top = 0;
+  _geometry.pad_left = 0;
+  CalculateActivationRangeFloat(activation, &_geometry.act_min, &_geometry.act_max);
+
+  _conv = getConvKernel(_geometry);
+}
+
+void FullyConnectedLayer::prepare()
+{
+  _packed_weights = packConvFilter(_geometry, reinterpret_cast<const float *>(_weights->buffer()));
+  _packed_bias = packBias(_geometry.out_c, reinterpret_cast<const float *>(_bias->buffer()));
+  _zeros.assign(_geometry.in_c, 0.0f);
+}
+
+void FullyConnectedLayer::run()
+{
+  _conv(_geometry, reinterpret_cast<const float *>(_input->buffer()), _packed_weights.data(),
+        _packed_bias.data(), _zeros.data(), reinterpret_cast<float *>(_output->buffer()));
+}
+
+} // namespace kernel
+} // namespace hi_perf_cpu
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_HI_PERF_CPU_KERNEL_FULLY_CONNECTED_LAYER_H__
+#define __ONERT_BACKEND_HI_PERF_CPU_KERNEL_FULLY_CONNECTED_LAYER_H__
+
+#include "../operand/Tensor.h"
+#include "Conv.h"
+
+#include <exec/IFunction.h>
+#include <ir/InternalType.h>
+
+#include <vector>
+
+namespace onert
+{
+namespace backend
+{
+namespace hi_perf_cpu
+{
+namespace kernel
+{
+
+/**
+ * @brief Fully connected layer run as 1x1 convolution over a row of 'batch' pixels
+ */
+class FullyConnectedLayer : public ::onert::exec::IFunction
+{
+public:
+  FullyConnectedLayer();
+
+public:
+  void configure(const operand::Tensor *input, const operand::Tensor *weights,
+                 const operand::Tensor *bias, const ir::Activation activation,
+                 operand::Tensor *output);
+
+  /**
+   * @brief Pack the weights and bias, which are initialized by now
+   */
+  void prepare() override;
+
+  void run() override;
+  void runSync() override { run(); }
+
+private:
+  const operand::Tensor *_input;
+  const operand::Tensor *_weights;
+  const operand::Tensor *_bias;
+  operand::Tensor *_output;
+
+  ConvGeometry _geometry;
+  ConvKernel _conv;
+
+  std::vector<float> _packed_weights;
+  std::vector<float> _packed_bias;
+  // Read for pixels of the last tile beyond the batch
+  std::vector<float> _zeros;
+};
+
+} // namespace kernel
+} // namespace hi_perf_cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_HI_PERF_CPU_KERNEL_FULLY_CONNECTED_LAYER_H__
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OperationUtils.h"
+
+#include <limits>
+#include <stdexcept>
+
+namespace onert
+{
+namespace backend
+{
+namespace hi_perf_cpu
+{
+namespace kernel
+{
+
+void CalculateActivationRangeFloat(ir::Activation activation, float *activation_min,
+                                   float *activation_max)
+{
+  switch (activation)
+  {
+    case ir::Activation::NONE:
+      *activation_min = std::numeric_limits<float>::lowest();
+      *activation_max = std::numeric_limits<float>::max();
+      break;
+    case ir::Activation::RELU:
+      *activation_min = 0.f;
+      *activation_max = std::numeric_limits<float>::max();
+      break;
+    case ir::Activation::RELU1:
+      *activation_min = -1.f;
+      *activation_max = 1.f;
+      break;
+    case ir::Activation::RELU6:
+      *activation_min = 0.f;
+      *activation_max = 6.f;
+      break;
+    default:
+      throw std::runtime_error{"HI_PERF_CPU backend: Unsupported fused activation function"};
+  }
+}
+
+} // namespace kernel
+} // namespace hi_perf_cpu
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file BinaryArithmeticOp benchmarks with and without broadcast
+ */
+
+#include "Common.h"
+
+#include <cker/operation/BinaryArithmeticOps.h>
+
+namespace
+{
+
+struct BinaryCase
+{
+  const char *name;
+  nnfw::cker::BinaryArithmeticOpType type;
+  nnfw::cker::Shape lhs_shape;
+  nnfw::cker::Shape rhs_shape;
+  nnfw::cker::Shape output_shape;
+};
+
+using OpType = nnfw::cker::BinaryArithmeticOpType;
+
+const BinaryCase kCases[] = {
+    // Shortcut of residual blocks
+    {"ResNet50/res2_add", OpType::ADD, {1, 56, 56, 256}, {1, 56, 56, 256}, {1, 56, 56, 256}},
+    {"ResNet50/res4_add", OpType::ADD, {1, 14, 14, 1024}, {1, 14, 14, 1024}, {1, 14, 14, 1024}},
+    // Bias and residual of BERT-Base with sequence length of 128
+    {"BERT/bias_add_broadcast", OpType::ADD, {128, 768}, {768}, {128, 768}},
+    {"BERT/residual_add", OpType::ADD, {128, 768}, {128, 768}, {128, 768}},
+    {"BERT/attention_mask_add_broadcast", OpType::ADD, {12, 128, 128}, {1, 1, 128}, {12, 128, 128}},
+    {"BERT/layernorm_mul_broadcast", OpType::MUL, {128, 768}, {768}, {128, 768}},
+    // Per-channel scale of squeeze-and-excitation
+    {"MobileNetV3/se_mul_broadcast",
+     OpType::MUL,
+     {1, 28, 28, 120},
+     {1, 1, 1, 120},
+     {1, 28, 28, 120}},
+    {"MobileNetV3/hswish_mul", OpType::MUL, {1, 14, 14, 480}, {1, 14, 14, 480}, {1, 14, 14, 480}},
+    {"Generic/sub_broadcast", OpType::SUB, {128, 768}, {128, 1}, {128, 768}},
+    {"Generic/div_broadcast", OpType::DIV, {128, 768}, {128, 1}, {128, 768}},
+};
+
+void benchBinaryArithmeticOp(benchmark::State &state, const BinaryCase &c)
+{
+  nnfw::cker::BinaryArithmeticOpParam params{};
+  params.type = c.type;
+  params.float_activation_min = uben::kActivationMin;
+  params.float_activation_max = uben::kActivationMax;
+
+  auto lhs = uben::randomData(c.lhs_shape.FlatSize());
+  // Keep away from zero for DIV
+  auto rhs = uben::randomData(c.rhs_shape.FlatSize());
+  for (auto &value : rhs)
+    value += value < 0 ? -1.0f : 1.0f;
+  std::vector<float> output(c.output_shape.FlatSize());
+
+  // Broadcast is resolved at prepare time in the runtime
+  const bool need_broadcast = nnfw::cker::ProcessBroadcastShapes(c.lhs_shape, c.rhs_shape, &params);
+
+  for (auto _ : state)
+  {
+    if (need_broadcast)
+      nnfw::cker::BroadcastBinaryArithmeticOp(params, c.lhs_shape, lhs.data(), c.rhs_shape,
+                                              rhs.data(), c.output_shape, output.data());
+    else
+      nnfw::cker::BinaryArithmeticOp(params, c.lhs_shape, lhs.data(), c.rhs_shape, rhs.data(),
+                                     c.output_shape, output.data());
+    benchmark::ClobberMemory();
+  }
+
+  const double elements = lhs.size() + rhs.size() + output.size();
+  uben::setThroughput(state, output.size(), elements * sizeof(float));
+}
+
+const int kRegistered = uben::registerCases("BinaryArithmeticOp", kCases, benchBinaryArithmeticOp);
+
+} // namespace
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Common helpers of cker benchmarks
+ */
+
+#ifndef __UBEN_CKER_COMMON_H__
+#define __UBEN_CKER_COMMON_H__
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace uben
+{
+
+/**
+ * @brief Return 'size' values in [-1, 1), which are the same on every run
+ */
+template <typename T = float> std::vector<T> randomData(size_t size)
+{
+  std::mt19937 gen{1234};
+  std::uniform_real_distribution<float> dist{-1.0f, 1.0f};
+
+  std::vector<T> data(size);
+  for (auto &value : data)
+    value = static_cast<T>(dist(gen));
+  return data;
+}
+
+/**
+ * @brief Output size and padding before the input along an axis for SAME padding
+ */
+struct SamePadding
+{
+  SamePadding(int in_size, int filter_size, int stride)
+  {
+    out = (in_size + stride - 1) / stride;
+    const int total = (out - 1) * stride + filter_size - in_size;
+    pad = total > 0 ? total / 2 : 0;
+  }
+
+  int out;
+  int pad;
+};
+
+/**
+ * @brief Report throughput of a kernel, where 'flops' and 'bytes' are done in an iteration
+ *
+ * @note 'flops' counts a multiply-add as two operations. Pass 0 for kernels which only move
+ *       data, and 'bytes' as the sum of inputs and outputs (i.e. the least memory traffic)
+ */
+inline void setThroughput(benchmark::State &state, double flops, double bytes)
+{
+  if (flops > 0)
+    state.counters["FLOP/s"] =
+        benchmark::Counter(flops, benchmark::Counter::kIsIterationInvariantRate);
+  state.counters["B/s"] = benchmark::Counter(bytes, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+/**
+ * @brief Register 'func' as "<op>/<case name>" for each of 'cases', which has 'name'
+ *
+ * @note Wall time is measured as some kernels run on a thread pool of their own
+ */
+template <typename Case, size_t N, typename Func>
+int registerCases(const std::string &op, const Case (&cases)[N], Func func)
+{
+  for (const auto &c : cases)
+    benchmark::RegisterBenchmark((op + "/" + c.name).c_str(), func, c)->UseRealTime();
+  return static_cast<int>(N);
+}
+
+constexpr float kActivationMin = std::numeric_limits<float>::lowest();
+constexpr float kActivationMax = std::numeric_limits<float>::max();
+
+} // namespace uben
+
+#endif // __UBEN_CKER_COMMON_H__
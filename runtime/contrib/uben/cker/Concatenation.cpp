@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Concatenation benchmark
+ */
+
+#include "Common.h"
+
+#include <cker/operation/Concatenation.h>
+
+namespace
+{
+
+struct ConcatenationCase
+{
+  const char *name;
+  std::vector<nnfw::cker::Shape> input_shapes;
+  int axis;
+};
+
+const ConcatenationCase kCases[] = {
+    // Branches of an Inception block along channels
+    {"InceptionV3/mixed_5b",
+     {{1, 35, 35, 64}, {1, 35, 35, 64}, {1, 35, 35, 96}, {1, 35, 35, 32}},
+     3},
+    {"DenseNet121/dense_block1", {{1, 56, 56, 224}, {1, 56, 56, 32}}, 3},
+    // Heads of BERT-Base with sequence length of 128, and outer concatenation
+    {"BERT/merge_heads", {{128, 384}, {128, 384}}, 1},
+    {"Generic/outer_axis", {{64, 768}, {64, 768}, {128, 768}}, 0},
+};
+
+void benchConcatenation(benchmark::State &state, const ConcatenationCase &c)
+{
+  nnfw::cker::ConcatenationParams params{};
+  params.axis = c.axis;
+  params.inputs_count = c.input_shapes.size();
+
+  nnfw::cker::Shape output_shape(c.input_shapes[0]);
+  output_shape.SetDim(c.axis, 0);
+
+  std::vector<std::vector<float>> inputs;
+  std::vector<const nnfw::cker::Shape *> input_shape_ptrs;
+  std::vector<const float *> input_ptrs;
+  size_t elements = 0;
+  for (const auto &shape : c.input_shapes)
+  {
+    inputs.emplace_back(uben::randomData(shape.FlatSize()));
+    input_shape_ptrs.emplace_back(&shape);
+    input_ptrs.emplace_back(inputs.back().data());
+    output_shape.SetDim(c.axis, output_shape.Dims(c.axis) + shape.Dims(c.axis));
+    elements += shape.FlatSize();
+  }
+  std::vector<float> output(output_shape.FlatSize());
+
+  for (auto _ : state)
+  {
+    nnfw::cker::Concatenation<float>(params, input_shape_ptrs.data(), input_ptrs.data(),
+                                     output_shape, output.data());
+    benchmark::ClobberMemory();
+  }
+
+  uben::setThroughput(state, 0, (elements + output.size()) * sizeof(float));
+}
+
+const int kRegistered = uben::registerCases("Concatenation", kCases, benchConcatenation);
+
+} // namespace
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Conv and DepthwiseConv benchmarks
+ */
+
+#include "Common.h"
+
+#include <cker/operation/Conv.h>
+#include <cker/operation/DepthwiseConv.h>
+
+namespace
+{
+
+struct ConvCase
+{
+  const char *name;
+  int height;
+  int width;
+  int in_depth;
+  // Output depth of Conv, or depth multiplier of DepthwiseConv
+  int out_depth;
+  int filter;
+  int stride;
+};
+
+// Input of 224x224
+const ConvCase kConvCases[] = {
+    {"MobileNetV1/conv0_3x3s2", 224, 224, 3, 32, 3, 2},
+    {"MobileNetV1/pw1_112x112", 112, 112, 32, 64, 1, 1},
+    {"MobileNetV1/pw3_56x56", 56, 56, 128, 128, 1, 1},
+    {"MobileNetV1/pw5_28x28", 28, 28, 256, 256, 1, 1},
+    {"MobileNetV1/pw7_14x14", 14, 14, 512, 512, 1, 1},
+    {"MobileNetV1/pw13_7x7", 7, 7, 1024, 1024, 1, 1},
+    {"ResNet50/conv1_7x7s2", 224, 224, 3, 64, 7, 2},
+    {"ResNet50/res2_1x1", 56, 56, 64, 64, 1, 1},
+    {"ResNet50/res2_3x3", 56, 56, 64, 64, 3, 1},
+    {"ResNet50/res3_3x3", 28, 28, 128, 128, 3, 1},
+    {"ResNet50/res4_3x3", 14, 14, 256, 256, 3, 1},
+    {"ResNet50/res5_3x3", 7, 7, 512, 512, 3, 1},
+    {"ResNet50/res5_1x1_expand", 7, 7, 512, 2048, 1, 1},
+};
+
+const ConvCase kDepthwiseConvCases[] = {
+    {"MobileNetV1/dw1_112x112", 112, 112, 32, 1, 3, 1},
+    {"MobileNetV1/dw2_112x112s2", 112, 112, 64, 1, 3, 2},
+    {"MobileNetV1/dw3_56x56", 56, 56, 128, 1, 3, 1},
+    {"MobileNetV1/dw5_28x28", 28, 28, 256, 1, 3, 1},
+    {"MobileNetV1/dw7_14x14", 14, 14, 512, 1, 3, 1},
+    {"MobileNetV1/dw13_7x7", 7, 7, 1024, 1, 3, 1},
+};
+
+void benchConv(benchmark::State &state, const ConvCase &c)
+{
+  const uben::SamePadding pad_h{c.height, c.filter, c.stride};
+  const uben::SamePadding pad_w{c.width, c.filter, c.stride};
+
+  nnfw::cker::ConvParams params{};
+  params.padding_type = nnfw::cker::PaddingType::kSame;
+  params.padding_values.height = pad_h.pad;
+  params.padding_values.width = pad_w.pad;
+  params.stride_height = c.stride;
+  params.stride_width = c.stride;
+  params.dilation_height_factor = 1;
+  params.dilation_width_factor = 1;
+  params.float_activation_min = uben::kActivationMin;
+  params.float_activation_max = uben::kActivationMax;
+
+  const nnfw::cker::Shape input_shape{1, c.height, c.width, c.in_depth};
+  const nnfw::cker::Shape filter_shape{c.out_depth, c.filter, c.filter, c.in_depth};
+  const nnfw::cker::Shape bias_shape{c.out_depth};
+  const nnfw::cker::Shape output_shape{1, pad_h.out, pad_w.out, c.out_depth};
+
+  auto input = uben::randomData(input_shape.FlatSize());
+  auto filter = uben::randomData(filter_shape.FlatSize());
+  auto bias = uben::randomData(bias_shape.FlatSize());
+  std::vector<float> output(output_shape.FlatSize());
+
+  // The first run prepares weights, which is done once at compile time in the runtime
+  nnfw::cker::Conv conv;
+  conv(params, input_shape, input.data(), filter_shape, filter.data(), bias_shape, bias.data(),
+       output_shape, output.data());
+
+  for (auto _ : state)
+  {
+    conv(params, input_shape, input.data(), filter_shape, filter.data(), bias_shape, bias.data(),
+         output_shape, output.data());
+    benchmark::ClobberMemory();
+  }
+
+  const double macs = 1.0 * output_shape.FlatSize() * c.filter * c.filter * c.in_depth;
+  const double elements = input.size() + filter.size() + bias.size() + output.size();
+  uben::setThroughput(state, 2 * macs, elements * sizeof(float));
+}
+
+void benchDepthwiseConv(benchmark::State &state, const ConvCase &c)
+{
+  const uben::SamePadding pad_h{c.height, c.filter, c.stride};
+  const uben::SamePadding pad_w{c.width, c.filter, c.stride};
+  const int out_depth = c.in_depth * c.out_depth;
+
+  nnfw::cker::DepthwiseConvParams params{};
+  params.padding_type = nnfw::cker::PaddingType::kSame;
+  params.padding_values.height = pad_h.pad;
+  params.padding_values.width = pad_w.pad;
+  params.stride_height = c.stride;
+  params.stride_width = c.stride;
+  params.dilation_height_factor = 1;
+  params.dilation_width_factor = 1;
+  params.depth_multiplier = c.out_depth;
+  params.float_activation_min = uben::kActivationMin;
+  params.float_activation_max = uben::kActivationMax;
+
+  const nnfw::cker::Shape input_shape{1, c.height, c.width, c.in_depth};
+  const nnfw::cker::Shape filter_shape{1, c.filter, c.filter, out_depth};
+  const nnfw::cker::Shape bias_shape{out_depth};
+  const nnfw::cker::Shape output_shape{1, pad_h.out, pad_w.out, out_depth};
+
+  auto input = uben::randomData(input_shape.FlatSize());
+  auto filter = uben::randomData(filter_shape.FlatSize());
+  auto bias = uben::randomData(bias_shape.FlatSize());
+  std::vector<float> output(output_shape.FlatSize());
+
+  for (auto _ : state)
+  {
+    nnfw::cker::DepthwiseConv(params, input_shape, input.data(), filter_shape, filter.data(),
+                              bias_shape, bias.data(), output_shape, output.data());
+    benchmark::ClobberMemory();
+  }
+
+  const double macs = 1.0 * output_shape.FlatSize() * c.filter * c.filter;
+  const double elements = input.size() + filter.size() + bias.size() + output.size();
+  uben::setThroughput(state, 2 * macs, elements * sizeof(float));
+}
+
+const int kConvRegistered = uben::registerCases("Conv", kConvCases, benchConv);
+const int kDepthwiseConvRegistered =
+    uben::registerCases("DepthwiseConv", kDepthwiseConvCases, benchDepthwiseConv);
+
+} // namespace
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file FullyConnected benchmark
+ */
+
+#include "Common.h"
+
+#include <cker/operation/FullyConnected.h>
+
+namespace
+{
+
+struct FullyConnectedCase
+{
+  const char *name;
+  int batch;
+  int input_size;
+  int num_units;
+};
+
+const FullyConnectedCase kCases[] = {
+    {"MobileNetV1/logits", 1, 1024, 1001},
+    {"ResNet50/fc1000", 1, 2048, 1000},
+    // BERT-Base with sequence length of 128
+    {"BERT/attention_qkv", 128, 768, 768},
+    {"BERT/intermediate", 128, 768, 3072},
+    {"BERT/output", 128, 3072, 768},
+    {"BERT/pooler", 1, 768, 768},
+};
+
+void benchFullyConnected(benchmark::State &state, const FullyConnectedCase &c)
+{
+  nnfw::cker::FullyConnectedParams params{};
+  params.activation = nnfw::cker::FusedActivationFunctionType::kNone;
+  params.float_activation_min = uben::kActivationMin;
+  params.float_activation_max = uben::kActivationMax;
+
+  const nnfw::cker::Shape input_shape{c.batch, c.input_size};
+  const nnfw::cker::Shape weights_shape{c.num_units, c.input_size};
+  const nnfw::cker::Shape bias_shape{c.num_units};
+  const nnfw::cker::Shape output_shape{c.batch, c.num_units};
+
+  auto input = uben::randomData(input_shape.FlatSize());
+  auto weights = uben::randomData(weights_shape.FlatSize());
+  auto bias = uben::randomData(bias_shape.FlatSize());
+  std::vector<float> output(output_shape.FlatSize());
+
+  for (auto _ : state)
+  {
+    nnfw::cker::FullyConnected(params, input_shape, input.data(), weights_shape, weights.data(),
+                               bias_shape, bias.data(), output_shape, output.data());
+    benchmark::ClobberMemory();
+  }
+
+  const double macs = 1.0 * c.batch * c.input_size * c.num_units;
+  const double elements = input.size() + weights.size() + bias.size() + output.size();
+  uben::setThroughput(state, 2 * macs, elements * sizeof(float));
+}
+
+const int kRegistered = uben::registerCases("FullyConnected", kCases, benchFullyConnected);
+
+} // namespace
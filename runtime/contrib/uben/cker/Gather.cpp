@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Gather benchmark
+ */
+
+#include "Common.h"
+
+#include <cker/operation/Gather.h>
+
+namespace
+{
+
+struct GatherCase
+{
+  const char *name;
+  int vocab_size;
+  int embedding_size;
+  int num_indices;
+};
+
+// Embedding lookups along axis 0
+const GatherCase kCases[] = {
+    {"BERT/word_embeddings", 30522, 768, 128},
+    {"BERT/position_embeddings", 512, 768, 128},
+    {"Generic/small_table", 1000, 64, 1024},
+};
+
+void benchGather(benchmark::State &state, const GatherCase &c)
+{
+  nnfw::cker::GatherParams params{};
+  params.axis = 0;
+
+  const nnfw::cker::Shape input_shape{c.vocab_size, c.embedding_size};
+  const nnfw::cker::Shape coords_shape{c.num_indices};
+  const nnfw::cker::Shape output_shape{c.num_indices, c.embedding_size};
+
+  auto input = uben::randomData(input_shape.FlatSize());
+  std::vector<float> output(output_shape.FlatSize());
+
+  // Indices spread over the table, the same on every run
+  std::vector<int32_t> coords(c.num_indices);
+  std::mt19937 gen{1234};
+  std::uniform_int_distribution<int32_t> dist{0, c.vocab_size - 1};
+  for (auto &coord : coords)
+    coord = dist(gen);
+
+  for (auto _ : state)
+  {
+    nnfw::cker::Gather<float>(params, input_shape, input.data(), coords_shape, coords.data(),
+                              output_shape, output.data());
+    benchmark::ClobberMemory();
+  }
+
+  // Rows read and written, which excludes the rest of the table
+  const double bytes = 2.0 * output.size() * sizeof(float) + coords.size() * sizeof(int32_t);
+  uben::setThroughput(state, 0, bytes);
+}
+
+const int kRegistered = uben::registerCases("Gather", kCases, benchGather);
+
+} // namespace
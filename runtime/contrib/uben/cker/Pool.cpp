@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file AveragePool and MaxPool benchmarks
+ */
+
+#include "Common.h"
+
+#include <cker/operation/AveragePool.h>
+#include <cker/operation/MaxPool.h>
+
+namespace
+{
+
+struct PoolCase
+{
+  const char *name;
+  int height;
+  int width;
+  int depth;
+  int filter;
+  int stride;
+};
+
+const PoolCase kMaxPoolCases[] = {
+    {"ResNet50/pool1_3x3s2", 112, 112, 64, 3, 2},
+    {"InceptionV3/pool_3x3s2", 35, 35, 288, 3, 2},
+};
+
+const PoolCase kAveragePoolCases[] = {
+    {"MobileNetV1/global_7x7", 7, 7, 1024, 7, 1},
+    {"ResNet50/global_7x7", 7, 7, 2048, 7, 1},
+    {"InceptionV3/pool_3x3s1", 35, 35, 192, 3, 1},
+};
+
+using PoolFunc = void (*)(const nnfw::cker::PoolParams &, const nnfw::cker::Shape &, const float *,
+                          const nnfw::cker::Shape &, float *);
+
+void benchPool(benchmark::State &state, const PoolCase &c, PoolFunc pool)
+{
+  const uben::SamePadding pad_h{c.height, c.filter, c.stride};
+  const uben::SamePadding pad_w{c.width, c.filter, c.stride};
+
+  nnfw::cker::PoolParams params{};
+  params.padding_type = nnfw::cker::PaddingType::kSame;
+  params.padding_values.height = pad_h.pad;
+  params.padding_values.width = pad_w.pad;
+  params.stride_height = c.stride;
+  params.stride_width = c.stride;
+  params.filter_height = c.filter;
+  params.filter_width = c.filter;
+  params.float_activation_min = uben::kActivationMin;
+  params.float_activation_max = uben::kActivationMax;
+
+  const nnfw::cker::Shape input_shape{1, c.height, c.width, c.depth};
+  const nnfw::cker::Shape output_shape{1, pad_h.out, pad_w.out, c.depth};
+
+  auto input = uben::randomData(input_shape.FlatSize());
+  std::vector<float> output(output_shape.FlatSize());
+
+  for (auto _ : state)
+  {
+    pool(params, input_shape, input.data(), output_shape, output.data());
+    benchmark::ClobberMemory();
+  }
+
+  // An operation for each element of a window, ignoring that windows are clipped by padding
+  const double ops = 1.0 * output_shape.FlatSize() * c.filter * c.filter;
+  uben::setThroughput(state, ops, (input.size() + output.size()) * sizeof(float));
+}
+
+void benchMaxPool(benchmark::State &state, const PoolCase &c)
+{
+  benchPool(state, c, nnfw::cker::MaxPool);
+}
+
+void benchAveragePool(benchmark::State &state, const PoolCase &c)
+{
+  benchPool(state, c, nnfw::cker::AveragePool);
+}
+
+const int kMaxPoolRegistered = uben::registerCases("MaxPool", kMaxPoolCases, benchMaxPool);
+const int kAveragePoolRegistered =
+    uben::registerCases("AveragePool", kAveragePoolCases, benchAveragePool);
+
+} // namespace
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Reduce benchmark
+ */
+
+#include "Common.h"
+
+#include <cker/operation/Reduce.h>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace
+{
+
+struct ReduceCase
+{
+  const char *name;
+  bool max;
+  nnfw::cker::Shape input_shape;
+  std::vector<int> axes;
+  nnfw::cker::Shape output_shape;
+};
+
+const ReduceCase kCases[] = {
+    // Global pooling written as reduction
+    {"ResNet50/global_sum", false, {1, 7, 7, 2048}, {1, 2}, {1, 1, 1, 2048}},
+    {"MobileNetV3/se_sum", false, {1, 28, 28, 120}, {1, 2}, {1, 1, 1, 120}},
+    // Statistics of LayerNorm of BERT-Base with sequence length of 128
+    {"BERT/layernorm_sum", false, {128, 768}, {1}, {128, 1}},
+    {"BERT/softmax_max", true, {12, 128, 128}, {2}, {12, 128, 1}},
+    {"Generic/outer_sum", false, {1024, 256}, {0}, {1, 256}},
+};
+
+void benchReduce(benchmark::State &state, const ReduceCase &c)
+{
+  auto input = uben::randomData(c.input_shape.FlatSize());
+  std::vector<float> output(c.output_shape.FlatSize());
+
+  nnfw::cker::Reduce reduce;
+  reduce.prepare(c.input_shape.DimensionsCount(), c.axes.size());
+
+  const float init_value = c.max ? std::numeric_limits<float>::lowest() : 0.0f;
+  using Reducer = float (*)(const float current, const float in);
+  const Reducer reducer =
+      c.max ? Reducer{[](const float current, const float in) { return std::max(in, current); }}
+            : Reducer{[](const float current, const float in) { return in + current; }};
+
+  for (auto _ : state)
+  {
+    if (!reduce.ReduceGeneric<float>(c.input_shape, input.data(), c.output_shape, output.data(),
+                                     c.axes, true, init_value, reducer))
+      throw std::runtime_error{"Reduce: Fail to run"};
+    benchmark::ClobberMemory();
+  }
+
+  uben::setThroughput(state, input.size(), (input.size() + output.size()) * sizeof(float));
+}
+
+const int kRegistered = uben::registerCases("Reduce", kCases, benchReduce);
+
+} // namespace
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Softmax benchmark
+ */
+
+#include "Common.h"
+
+#include <cker/operation/SoftMax.h>
+
+namespace
+{
+
+struct SoftmaxCase
+{
+  const char *name;
+  int rows;
+  int depth;
+};
+
+const SoftmaxCase kCases[] = {
+    {"MobileNetV1/logits", 1, 1001},
+    // Attention scores of 12 heads of BERT-Base with sequence length of 128
+    {"BERT/attention", 12 * 128, 128},
+    {"BERT/attention_seq384", 12 * 384, 384},
+};
+
+void benchSoftmax(benchmark::State &state, const SoftmaxCase &c)
+{
+  nnfw::cker::SoftmaxParams params{};
+  params.beta = 1.0;
+
+  const nnfw::cker::Shape shape{c.rows, c.depth};
+  auto input = uben::randomData(shape.FlatSize());
+  std::vector<float> output(shape.FlatSize());
+
+  for (auto _ : state)
+  {
+    nnfw::cker::Softmax(params, shape, input.data(), shape, output.data());
+    benchmark::ClobberMemory();
+  }
+
+  // exp is far from a single operation, so only memory throughput is reported
+  uben::setThroughput(state, 0, (input.size() + output.size()) * sizeof(float));
+}
+
+const int kRegistered = uben::registerCases("Softmax", kCases, benchSoftmax);
+
+} // namespace
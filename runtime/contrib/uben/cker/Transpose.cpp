@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Transpose benchmark
+ */
+
+#include "Common.h"
+
+#include <cker/operation/Transpose.h>
+
+namespace
+{
+
+struct TransposeCase
+{
+  const char *name;
+  nnfw::cker::Shape input_shape;
+  std::vector<int> perm;
+};
+
+const TransposeCase kCases[] = {
+    // Split and merge of attention heads of BERT-Base with sequence length of 128
+    {"BERT/split_heads", {1, 128, 12, 64}, {0, 2, 1, 3}},
+    {"BERT/key_transpose", {12, 128, 64}, {0, 2, 1}},
+    {"BERT/weights_2d", {768, 3072}, {1, 0}},
+    // Layout conversion of feature maps
+    {"ResNet50/nhwc_to_nchw", {1, 56, 56, 256}, {0, 3, 1, 2}},
+    {"ResNet50/nchw_to_nhwc", {1, 256, 56, 56}, {0, 2, 3, 1}},
+};
+
+void benchTranspose(benchmark::State &state, const TransposeCase &c)
+{
+  nnfw::cker::TransposeParams params{};
+  params.perm_count = static_cast<int8_t>(c.perm.size());
+  nnfw::cker::Shape output_shape(params.perm_count);
+  for (int i = 0; i < params.perm_count; ++i)
+  {
+    params.perm[i] = c.perm[i];
+    output_shape.SetDim(i, c.input_shape.Dims(c.perm[i]));
+  }
+
+  auto input = uben::randomData(c.input_shape.FlatSize());
+  std::vector<float> output(output_shape.FlatSize());
+
+  for (auto _ : state)
+  {
+    nnfw::cker::Transpose(params, c.input_shape, input.data(), output_shape, output.data());
+    benchmark::ClobberMemory();
+  }
+
+  uben::setThroughput(state, 0, (input.size() + output.size()) * sizeof(float));
+}
+
+const int kRegistered = uben::registerCases("Transpose", kCases, benchTranspose);
+
+} // namespace
@@ -59,6 +59,17 @@ extern "C" {
  */
 typedef struct nnfw_session nnfw_session;
 
+/**
+ * @brief Runtime context that sessions share
+ *
+ * <p>Sessions of a context share memory for activations, and constants of the same content,
+ * e.g. weights of a common backbone, are kept once. They are prepared and run one at a time,
+ * and a session waits for another to finish.</p>
+ *
+ * <p>Backends which do not support it run sessions on their own resources.</p>
+ */
+typedef struct nnfw_context nnfw_context;
+
 /**
  * @brief Tensor types
  *
@@ -79,6 +90,12 @@ typedef enum {
   NNFW_TYPE_TENSOR_BOOL = 3,
   /** A tensor of 8 bit unsigned integer */
   NNFW_TYPE_TENSOR_UINT8 = 4,
+  /**
+   * A tensor of 8 bit signed integers that represent real numbers.
+   *
+   * real_value = (integer_value - zeroPoint) * scale.
+   */
+  NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED = 5,
 } NNFW_TYPE;
 
 /**
@@ -119,6 +136,44 @@ typedef enum {
   NNFW_INFO_ID_VERSION = 0,
 } NNFW_INFO_ID;
 
+/**
+ * @brief Number of buckets of latency histogram in {@link nnfw_metrics}
+ */
+#define NNFW_METRICS_LATENCY_BUCKETS (24)
+
+/**
+ * @brief Runtime metrics of a session
+ *
+ * <p>All the counters are maintained always with low overhead, so application can scrape them
+ * periodically by calling {@link nnfw_query_metrics} even while inference is running.
+ *
+ * <p>Counters about run are cumulative since {@link nnfw_prepare}, so application can compute
+ * rates by diffing two snapshots.
+ */
+typedef struct nnfw_metrics
+{
+  /** The number of finished inferences */
+  uint64_t run_count;
+  /** Sum of latency of finished inferences in microseconds */
+  uint64_t run_time_total_us;
+  /** Maximum latency of finished inferences in microseconds */
+  uint64_t run_time_max_us;
+  /**
+   * Latency histogram in power-of-two microseconds.
+   * latency_histogram[0] counts inferences shorter than 1us, latency_histogram[i] counts
+   * inferences in [2^(i-1), 2^i) us, and the last bucket counts all the longer inferences.
+   */
+  uint64_t latency_histogram[NNFW_METRICS_LATENCY_BUCKETS];
+  /** Time spent in {@link nnfw_prepare} in microseconds */
+  uint64_t compile_time_us;
+  /** Bytes of memory planned for static intermediate tensors */
+  uint64_t arena_bytes;
+  /** Bytes allocated for dynamic tensors so far (cumulative) */
+  uint64_t dynamic_alloc_bytes;
+  /** Bytes copied by permutation between backends or layouts so far (cumulative) */
+  uint64_t permute_bytes;
+} nnfw_metrics;
+
 /**
  * @brief Maximum rank expressible with nnfw
  */
@@ -174,6 +229,37 @@ NNFW_STATUS nnfw_create_session(nnfw_session **session);
  */
 NNFW_STATUS nnfw_close_session(nnfw_session *session);
 
+/**
+ * @brief Create a new runtime context instance
+ *
+ * <p>{@link nnfw_close_context} should be called once if the context is no longer needed</p>
+ *
+ * @param[out] context The context to be created
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_create_context(nnfw_context **context);
+
+/**
+ * @brief Close a runtime context instance
+ *
+ * Sessions in the context keep the resources of it until they are closed.
+ *
+ * @param[in] context The context to be closed
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_close_context(nnfw_context *context);
+
+/**
+ * @brief Put a session into a runtime context
+ *
+ * This function should be called before {@link nnfw_load_model_from_file} is invoked.
+ *
+ * @param[in] session Session to be put into the context
+ * @param[in] context Context to share with other sessions
+ * @return    @c NNFW_STATUS_NO_ERROR if successful, otherwise return @c NNFW_STATUS_ERROR
+ */
+NNFW_STATUS nnfw_set_context(nnfw_session *session, nnfw_context *context);
+
 /**
  * @brief     Load model from nnpackage file or directory
  *
@@ -402,6 +488,19 @@ NNFW_STATUS nnfw_set_op_backend(nnfw_session *session, const char *op, const cha
  */
 NNFW_STATUS nnfw_query_info_u32(nnfw_session *session, NNFW_INFO_ID id, uint32_t *val);
 
+/**
+ * @brief     Get a snapshot of runtime metrics of the session
+ *
+ * <p>This can be called after {@link nnfw_prepare}, and it is safe to call from other thread while
+ * {@link nnfw_run} is in progress.</p>
+ *
+ * @param[in]  session session to be queried on
+ * @param[out] metrics metrics to be filled
+ *
+ * @return @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_query_metrics(nnfw_session *session, nnfw_metrics *metrics);
+
 #ifdef __cplusplus
 }
 #endif
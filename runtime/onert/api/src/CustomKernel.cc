@@ -57,6 +57,9 @@ public:
       case ir::DataType::BOOL8:
         api_type.dtype = NNFW_TYPE_TENSOR_BOOL;
         break;
+      case ir::DataType::QUANT8_ASYMM_SIGNED:
+        api_type.dtype = NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED;
+        break;
       default:
         throw std::runtime_error("Unsupported tensor datatype");
     }
@@ -17,6 +17,8 @@
 #include "nnfw_api_internal.h"
 #include "nnfw_version.h"
 
+#include <backend/SharedContext.h>
+
 #define NNFW_RETURN_ERROR_IF_NULL(p) \
   do                                 \
   {                                  \
@@ -51,6 +53,47 @@ NNFW_STATUS nnfw_close_session(nnfw_session *session)
   return NNFW_STATUS_NO_ERROR;
 }
 
+/*
+ * Create a new runtime context instance
+ *
+ * @param context the context to be created
+ * @return NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_create_context(nnfw_context **context)
+{
+  NNFW_RETURN_ERROR_IF_NULL(context);
+
+  *context = new nnfw_context{std::make_shared<onert::backend::SharedContext>()};
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+/*
+ * Close a runtime context instance
+ *
+ * @param context the context to be closed
+ * @return NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_close_context(nnfw_context *context)
+{
+  delete context;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+/*
+ * Put a session into a runtime context
+ *
+ * @param session the session to be put into the context
+ * @param context the context to share with other sessions
+ * @return NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_set_context(nnfw_session *session, nnfw_context *context)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  NNFW_RETURN_ERROR_IF_NULL(context);
+  return session->set_context(context);
+}
+
 /*
  * Load model from nnpackage file or directory
  *
@@ -296,3 +339,17 @@ NNFW_STATUS nnfw_query_info_u32(nnfw_session *session, NNFW_INFO_ID id, uint32_t
   // It should not be reached.
   return NNFW_STATUS_ERROR;
 }
+
+/*
+ * Get a snapshot of runtime metrics of the session
+ *
+ * @param[in]  session session to be queried on
+ * @param[out] metrics metrics to be filled
+ *
+ * @return @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_query_metrics(nnfw_session *session, nnfw_metrics *metrics)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->query_metrics(metrics);
+}
@@ -19,9 +19,12 @@
 #include "compiler/Compiler.h"
 #include "util/ConfigSource.h"
 #include "exec/Execution.h"
+#include "util/MemoryProfiler.h"
+#include "backend/SharedContext.h"
 #include "circle_loader.h"
 #include "tflite_loader.h"
 #include "json/json.h"
+#include <chrono>
 #include <fstream>
 #include <iostream>
 #include <string>
@@ -65,13 +68,26 @@ static onert::ir::Layout convertLayout(NNFW_LAYOUT layout)
 nnfw_session::nnfw_session()
     : _subgraphs{nullptr}, _execution{nullptr},
       _kernel_registry{std::make_shared<onert::frontend::custom::KernelRegistry>()},
-      _source{std::make_unique<onert::util::GeneralConfigSource>()}
+      _compile_time_us{0}, _source{std::make_unique<onert::util::GeneralConfigSource>()}
 {
   // DO NOTHING
 }
 
 nnfw_session::~nnfw_session() = default;
 
+NNFW_STATUS nnfw_session::set_context(nnfw_context *context)
+{
+  if (_subgraphs || _execution)
+  {
+    std::cerr << "Error during nnfw_session::set_context : "
+              << "set_context should be run before load_model" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  _shared_context = context->shared;
+  return NNFW_STATUS_NO_ERROR;
+}
+
 NNFW_STATUS nnfw_session::load_model_from_file(const char *package_dir)
 {
   // TODO : add support for zipped package file load
@@ -83,8 +99,18 @@ NNFW_STATUS nnfw_session::load_model_from_file(const char *package_dir)
   }
   closedir(dir);
 
+  // Configurations of the session are not applied until prepare, so global one is used here
+  const auto memory_profile_filepath =
+      onert::util::getConfigString(onert::util::config::MEMORY_PROFILE_FILEPATH);
+  if (!memory_profile_filepath.empty())
+  {
+    _memory_profiler = std::make_shared<onert::util::MemoryProfiler>(memory_profile_filepath);
+  }
+
   try
   {
+    onert::util::MemoryProfilePhase phase{_memory_profiler.get(), "load"};
+
     std::string manifest_file_name(package_dir);
     manifest_file_name += "/metadata/MANIFEST";
     std::ifstream mfs(manifest_file_name);
@@ -112,6 +138,9 @@ NNFW_STATUS nnfw_session::load_model_from_file(const char *package_dir)
       return NNFW_STATUS_ERROR;
     }
     _subgraphs->primary()->bindKernelBuilder(_kernel_registry->getBuilder());
+    // Child subgraphs run while the primary one is running, so they do not share resources
+    if (_shared_context)
+      _subgraphs->primary()->bindSharedContext(_shared_context);
   }
   catch (const std::exception &e)
   {
@@ -120,6 +149,7 @@ NNFW_STATUS nnfw_session::load_model_from_file(const char *package_dir)
   }
 
   _compiler = std::make_unique<onert::compiler::Compiler>(_subgraphs);
+  _compiler->options().memory_profiler = _memory_profiler;
 
   return NNFW_STATUS_NO_ERROR;
 }
@@ -147,11 +177,22 @@ NNFW_STATUS nnfw_session::prepare()
     using onert::util::config_source;
     config_source(std::move(_source));
 
+    std::unique_lock<std::mutex> lock;
+    if (_shared_context)
+      lock = std::unique_lock<std::mutex>{_shared_context->mutex()};
+
+    const auto begin = std::chrono::steady_clock::now();
+    onert::util::MemoryProfilePhase phase{_memory_profiler.get(), "prepare"};
+
     _subgraphs.reset();
     _compiler->compile();
     std::shared_ptr<onert::exec::ExecutorMap> executors;
     _compiler->release(executors);
     _execution = std::make_shared<onert::exec::Execution>(executors);
+
+    phase.end();
+    const auto end = std::chrono::steady_clock::now();
+    _compile_time_us = std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
   }
   catch (const std::exception &e)
   {
@@ -173,6 +214,10 @@ NNFW_STATUS nnfw_session::run()
 
   try
   {
+    std::unique_lock<std::mutex> lock;
+    if (_shared_context)
+      lock = std::unique_lock<std::mutex>{_shared_context->mutex()};
+
     _execution->execute();
   }
   catch (const std::exception &e)
@@ -307,6 +352,8 @@ static NNFW_TYPE datatype_to_nnfw_dtype(onert::ir::DataType dt)
       return NNFW_TYPE_TENSOR_BOOL;
     case DataType::UINT8:
       return NNFW_TYPE_TENSOR_UINT8;
+    case DataType::QUANT8_ASYMM_SIGNED:
+      return NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED;
     case DataType::UINT32:
     case DataType::QUANT8_SYMM:
     default:
@@ -523,6 +570,12 @@ NNFW_STATUS nnfw_session::set_config(const char *key, const char *value)
   {
     options.trace_filepath = value;
   }
+  else if (key == config::MEMORY_PROFILE_FILEPATH)
+  {
+    // Heap usage during load is not recorded when set here
+    _memory_profiler = std::make_shared<MemoryProfiler>(value);
+    options.memory_profiler = _memory_profiler;
+  }
   else if (key == config::GRAPH_DOT_DUMP)
   {
     options.graph_dump_level = toInt(value);
@@ -617,3 +670,40 @@ NNFW_STATUS nnfw_session::get_config(const char *key, char *value, size_t value_
 
   return NNFW_STATUS_NO_ERROR;
 }
+
+NNFW_STATUS nnfw_session::query_metrics(nnfw_metrics *metrics)
+{
+  if (metrics == nullptr)
+  {
+    std::cerr << "Error during nnfw_session::query_metrics, metrics is null pointer." << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  if (!_execution)
+  {
+    std::cerr << "Error during nnfw_session::query_metrics : "
+              << "query_metrics should be run after prepare" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  static_assert(NNFW_METRICS_LATENCY_BUCKETS ==
+                    onert::exec::RuntimeMetricsSnapshot::NUM_LATENCY_BUCKETS,
+                "Latency histogram size mismatch");
+
+  onert::exec::RuntimeMetricsSnapshot snapshot;
+  _execution->collectMetrics(snapshot);
+
+  metrics->run_count = snapshot.run_count;
+  metrics->run_time_total_us = snapshot.run_time_total_us;
+  metrics->run_time_max_us = snapshot.run_time_max_us;
+  for (uint32_t i = 0; i < NNFW_METRICS_LATENCY_BUCKETS; ++i)
+  {
+    metrics->latency_histogram[i] = snapshot.latency_histogram[i];
+  }
+  metrics->compile_time_us = _compile_time_us;
+  metrics->arena_bytes = snapshot.arena_bytes;
+  metrics->dynamic_alloc_bytes = snapshot.dynamic_alloc_bytes;
+  metrics->permute_bytes = snapshot.permute_bytes;
+
+  return NNFW_STATUS_NO_ERROR;
+}
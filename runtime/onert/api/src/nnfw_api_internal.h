@@ -38,6 +38,10 @@ namespace exec
 {
 class Execution;
 } // namespace exec
+namespace backend
+{
+class SharedContext;
+} // namespace backend
 namespace ir
 {
 class Graph;
@@ -47,14 +51,24 @@ namespace compiler
 {
 class Compiler;
 } // namespace compiler
+namespace util
+{
+class MemoryProfiler;
+} // namespace util
 } // namespace onert
 
+struct nnfw_context
+{
+  std::shared_ptr<onert::backend::SharedContext> shared;
+};
+
 struct nnfw_session
 {
 public:
   nnfw_session();
   ~nnfw_session();
 
+  NNFW_STATUS set_context(nnfw_context *context);
   NNFW_STATUS load_model_from_file(const char *package_file_path);
   NNFW_STATUS prepare();
   NNFW_STATUS run();
@@ -81,6 +95,8 @@ public:
   NNFW_STATUS set_config(const char *key, const char *value);
   NNFW_STATUS get_config(const char *key, char *value, size_t value_size);
 
+  NNFW_STATUS query_metrics(nnfw_metrics *metrics);
+
 private:
   onert::ir::Graph *primary_subgraph();
 
@@ -89,6 +105,9 @@ private:
   std::unique_ptr<onert::compiler::Compiler> _compiler;
   std::shared_ptr<onert::exec::Execution> _execution;
   std::shared_ptr<onert::frontend::custom::KernelRegistry> _kernel_registry;
+  uint64_t _compile_time_us;
+  std::shared_ptr<onert::util::MemoryProfiler> _memory_profiler;
+  std::shared_ptr<onert::backend::SharedContext> _shared_context;
 
 protected:
   std::unique_ptr<onert::util::GeneralConfigSource> _source;
@@ -67,6 +67,7 @@ public:
   void prepare(void) override;
   void allocate() override;
   void postFunctionPrepare() override;
+  void postAllFunctionsPrepare() override { /* DO NOTHING */}
 
   std::shared_ptr<ITensor> tensorAt(const ir::OperandIndex &ind) override;
   void iterate(const IterateFunction &fn) override;
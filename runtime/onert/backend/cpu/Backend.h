@@ -23,6 +23,7 @@
 #include "ShapeFixer.h"
 
 #include <backend/Backend.h>
+#include <backend/SharedContext.h>
 
 #include <memory>
 
@@ -46,7 +47,10 @@ public:
   {
     const auto &operands = graph.operands();
     auto context = std::make_unique<BackendContext>(this, &graph);
-    auto tb = std::make_shared<TensorBuilder>();
+    auto shared_context = graph.getSharedContext();
+    auto shared_memory =
+        shared_context ? shared_context->get<cpu_common::SharedMemory>(this) : nullptr;
+    auto tb = std::make_shared<TensorBuilder>(shared_memory);
     context->tensor_builder = tb;
     context->constant_initializer = std::make_shared<ConstantInitializer>(operands, tb);
     context->kernel_gen = std::make_shared<KernelGenerator>(operands, tb, kb);
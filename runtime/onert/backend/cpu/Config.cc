@@ -16,6 +16,11 @@
 
 #include "Config.h"
 
+#include <cker/operation/nchwc/Common.h>
+#include <cker/ThreadLimit.h>
+#include <ir/Operations.Include.h>
+#include <util/ConfigSource.h>
+
 namespace onert
 {
 namespace backend
@@ -23,10 +28,95 @@ namespace backend
 namespace cpu
 {
 
+namespace
+{
+
+static_assert(nnfw::cker::nchwc::kBlockSize == ir::NCHWC_BLOCK, "Block size of NCHWc mismatch");
+
+// Feature maps that kernels of NCHWc read and write in blocks
+bool isBlockedFeature(const ir::Operand &operand)
+{
+  return operand.shape().rank() == 4 && operand.typeInfo().type() == ir::DataType::FLOAT32 &&
+         !operand.info().isDynamic() && !operand.isConstant();
+}
+
+// Whether cpu has a kernel of NCHWc for 'node', which runs only with feature maps in blocks
+bool supportBlockedLayout(const ir::Operation &node, const ir::Operands &operands)
+{
+  for (const auto &ind : node.getOutputs())
+  {
+    if (!isBlockedFeature(operands.at(ind)))
+      return false;
+  }
+
+  switch (node.opcode())
+  {
+    case ir::OpCode::Conv2D:
+    {
+      const auto &inputs = node.getInputs();
+      return isBlockedFeature(operands.at(inputs.at(ir::operation::Conv2D::INPUT))) &&
+             operands.at(inputs.at(ir::operation::Conv2D::KERNEL)).isConstant() &&
+             operands.at(inputs.at(ir::operation::Conv2D::BIAS)).isConstant();
+    }
+    case ir::OpCode::DepthwiseConv2D:
+    {
+      const auto &conv = static_cast<const ir::operation::DepthwiseConv2D &>(node);
+      const auto &inputs = node.getInputs();
+      return isBlockedFeature(operands.at(inputs.at(ir::operation::DepthwiseConv2D::INPUT))) &&
+             operands.at(inputs.at(ir::operation::DepthwiseConv2D::KERNEL)).isConstant() &&
+             operands.at(inputs.at(ir::operation::DepthwiseConv2D::BIAS)).isConstant() &&
+             conv.param().multiplier == 1;
+    }
+    case ir::OpCode::MaxPool2D:
+    case ir::OpCode::AvgPool2D:
+      return isBlockedFeature(operands.at(node.getInputs().at(0)));
+    case ir::OpCode::Add:
+    case ir::OpCode::Sub:
+    case ir::OpCode::Mul:
+    {
+      // No broadcasting
+      const auto &lhs = operands.at(node.getInputs().at(0));
+      const auto &rhs = operands.at(node.getInputs().at(1));
+      const auto &output = operands.at(node.getOutputs().at(0));
+      return isBlockedFeature(lhs) && isBlockedFeature(rhs) && lhs.shape() == output.shape() &&
+             rhs.shape() == output.shape();
+    }
+    case ir::OpCode::Concat:
+    {
+      for (const auto &ind : node.getInputs())
+      {
+        if (!isBlockedFeature(operands.at(ind)))
+          return false;
+      }
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+} // namespace
+
 bool Config::initialize() { return true; }
 
 ir::Layout Config::supportLayout(const ir::Operation &, ir::Layout) { return ir::Layout::NHWC; }
 
+ir::Layout Config::supportLayout(const ir::Operation &node, const ir::Operands &operands,
+                                 ir::Layout frontend_layout)
+{
+  // NCHWc is used only where the whole operation runs in blocks, and feature maps are converted
+  // from and to NHWC by Permute before and after those operations
+  const std::string cpu_layout_str = util::getConfigString(util::config::CPU_LAYOUT);
+  if (cpu_layout_str == "NCHWc" && supportBlockedLayout(node, operands))
+  {
+    return ir::Layout::NCHWc;
+  }
+
+  return supportLayout(node, frontend_layout);
+}
+
+void Config::setIntraOpThreads(int num_threads) { nnfw::cker::setThreadLimit(num_threads); }
+
 } // namespace cpu
 } // namespace backend
 } // namespace onert
@@ -34,11 +34,15 @@ public:
   std::string id() override { return "cpu"; }
   bool initialize() override;
   ir::Layout supportLayout(const ir::Operation &node, ir::Layout frontend_layout) override;
+  ir::Layout supportLayout(const ir::Operation &node, const ir::Operands &operands,
+                           ir::Layout frontend_layout) override;
   bool supportPermutation() override { return true; }
   bool supportDynamicTensor() override { return true; }
   bool supportFP16() override { return false; }
 
   std::unique_ptr<util::ITimer> timer() override { return std::make_unique<util::CPUTimer>(); }
+
+  void setIntraOpThreads(int num_threads) override;
 };
 
 } // namespace cpu
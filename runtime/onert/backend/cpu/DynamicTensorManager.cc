@@ -75,6 +75,13 @@ void DynamicTensorManager::changeShape(const ir::OperandIndex &ind, const ir::Sh
   tensor->set_dynamic();
 }
 
+ITensorManager::MemoryStats DynamicTensorManager::memoryStats() const
+{
+  MemoryStats stats;
+  stats.dynamic_alloc_bytes = _dynamic_mem_mgr->allocatedBytes();
+  return stats;
+}
+
 } // namespace cpu
 } // namespace backend
 } // namespace onert
@@ -52,6 +52,8 @@ public:
   void buildTensor(const ir::OperandIndex &ind, const ir::OperandInfo &tensor_info);
   void changeShape(const ir::OperandIndex &, const ir::Shape &) override;
 
+  MemoryStats memoryStats() const override;
+
 private:
   /**
    * @brief Memory manager for dynamic tensor.
@@ -44,6 +44,7 @@
 #include "kernel/OperationUtils.h"
 #include "kernel/PackLayer.h"
 #include "kernel/PadLayer.h"
+#include "kernel/PermuteLayer.h"
 #include "kernel/PowLayer.h"
 #include "kernel/ReduceLayer.h"
 #include "kernel/ReLULayer.h"
@@ -1139,6 +1140,23 @@ void KernelGenerator::visit(const ir::operation::LogicalOr &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::Permute &node)
+{
+  // Permute of cpu converts feature maps between NHWC and NCHWc
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(0)};
+
+  const auto rank = _ctx.at(output_index).shape().rank();
+  auto output_alloc = _tensor_builder->at(output_index);
+  auto input_alloc = _tensor_builder->at(input_index);
+
+  auto fn = std::make_unique<::onert::backend::cpu::kernel::PermuteLayer>();
+
+  fn->configure(input_alloc, output_alloc, rank);
+
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::Mean &node)
 {
   const auto output_index{node.getOutputs().at(0)};
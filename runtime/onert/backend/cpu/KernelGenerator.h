@@ -96,6 +96,7 @@ public:
   void visit(const ir::operation::SquaredDifference &) override;
   void visit(const ir::operation::Tile &) override;
   void visit(const ir::operation::LogicalOr &) override;
+  void visit(const ir::operation::Permute &) override;
 
 private:
   const ir::Operands &_ctx;
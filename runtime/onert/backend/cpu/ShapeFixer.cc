@@ -77,16 +77,7 @@ void ShapeFixer::visit(const ir::operation::Softmax &) { /* DO NOTHING */}
 
 void ShapeFixer::visit(const ir::operation::Gather &) { /* DO NOTHING */}
 
-void ShapeFixer::visit(const ir::operation::Add &node)
-{
-  const auto lhs_index{node.getInputs().at(ir::operation::Add::Input::LHS)};
-
-  // Quantization : not supported
-  if (_ctx.at(lhs_index).typeInfo().type() == ir::DataType::QUANT8_ASYMM)
-  {
-    throw std::runtime_error{"ShapeFixer: NYI for quantized Add"};
-  }
-}
+void ShapeFixer::visit(const ir::operation::Add &) { /* DO NOTHING */}
 
 void ShapeFixer::visit(const ir::operation::Sub &node)
 {
@@ -96,7 +87,7 @@ void ShapeFixer::visit(const ir::operation::Sub &node)
   // Quantization : not supported
   if (_ctx.at(lhs_index).typeInfo().type() == ir::DataType::QUANT8_ASYMM)
   {
-    throw std::runtime_error{"ShapeFixer: NYI for quantized Sub"};
+    throw NotSupportedError{"ShapeFixer: NYI for quantized Sub"};
   }
 }
 
@@ -108,7 +99,7 @@ void ShapeFixer::visit(const ir::operation::Mul &node)
   // Quantization : not supported
   if (_ctx.at(lhs_index).typeInfo().type() == ir::DataType::QUANT8_ASYMM)
   {
-    throw std::runtime_error{"ShapeFixer: NYI for quantized Mul"};
+    throw NotSupportedError{"ShapeFixer: NYI for quantized Mul"};
   }
 }
 
@@ -120,7 +111,7 @@ void ShapeFixer::visit(const ir::operation::Div &node)
   // Quantization : not supported
   if (_ctx.at(lhs_index).typeInfo().type() == ir::DataType::QUANT8_ASYMM)
   {
-    throw std::runtime_error{"ShapeFixer: NYI for quantized Div"};
+    throw NotSupportedError{"ShapeFixer: NYI for quantized Div"};
   }
 }
 
@@ -136,7 +127,7 @@ void ShapeFixer::visit(const ir::operation::Pad &node)
   // Quantization : not supported
   if (_ctx.at(lhs_index).typeInfo().type() == ir::DataType::QUANT8_ASYMM)
   {
-    throw std::runtime_error{"ShapeFixer: NYI for quantized Pad"};
+    throw NotSupportedError{"ShapeFixer: NYI for quantized Pad"};
   }
 }
 
@@ -210,6 +201,8 @@ void ShapeFixer::visit(const ir::operation::Tile &) { /* DO NOTHING */}
 
 void ShapeFixer::visit(const ir::operation::LogicalOr &) { /* DO NOTHING */}
 
+void ShapeFixer::visit(const ir::operation::Permute &) { /* DO NOTHING */}
+
 } // namespace cpu
 } // namespace backend
 } // namespace onert
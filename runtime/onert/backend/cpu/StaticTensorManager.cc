@@ -25,9 +25,13 @@ namespace backend
 namespace cpu
 {
 
-StaticTensorManager::StaticTensorManager(const std::shared_ptr<TensorRegistry> &reg)
+StaticTensorManager::StaticTensorManager(
+    const std::shared_ptr<TensorRegistry> &reg,
+    const std::shared_ptr<cpu_common::SharedMemory> &shared_memory)
     : _const_mgr{new cpu_common::DynamicMemoryManager()},
-      _nonconst_mgr{new cpu_common::MemoryManager()}, _tensors{reg}
+      _nonconst_mgr{shared_memory ? new cpu_common::MemoryManager(shared_memory)
+                                  : new cpu_common::MemoryManager()},
+      _tensors{reg}, _shared_memory{shared_memory}
 {
   // DO NOTHING
 }
@@ -60,6 +64,14 @@ void StaticTensorManager::allocateNonconsts(void)
     auto tensor = pair.second;
     if (!_as_constants[ind] && !tensor->is_dynamic())
     {
+      if (_nonconst_mgr->isShared())
+      {
+        tensor->setBuffer(_nonconst_mgr->allocator(), _nonconst_mgr->getOffset(ind));
+        VERBOSE(CPU_StaticTensorManager) << "TENSOR(#" << ind.value() << "): shared arena + "
+                                         << _nonconst_mgr->getOffset(ind) << std::endl;
+        continue;
+      }
+
       auto *buffer = _nonconst_mgr->getBuffer(ind);
       tensor->setBuffer(buffer);
 
@@ -73,11 +85,32 @@ void StaticTensorManager::deallocateConsts(void) { _const_mgr->deallocate(); }
 
 void StaticTensorManager::deallocateNonconsts(void) { _nonconst_mgr->deallocate(); }
 
+void StaticTensorManager::shareConsts(void)
+{
+  if (!_shared_memory)
+    return;
+
+  for (auto &pair : (*_tensors))
+  {
+    const auto &ind = pair.first;
+    if (!_as_constants[ind])
+      continue;
+
+    // Constants released by kernels, e.g. after packing, have no memory
+    auto mem_alloc = _const_mgr->allocator(ind);
+    if (mem_alloc)
+      _shared_memory->shareConstant(*mem_alloc, pair.second->total_size());
+  }
+}
+
 void StaticTensorManager::buildTensor(const ir::OperandIndex &ind,
-                                      const ir::OperandInfo &tensor_info, bool as_const)
+                                      const ir::OperandInfo &tensor_info, ir::Layout layout,
+                                      bool as_const)
 {
   assert(_tensors->find(ind) == _tensors->end());
-  auto tensor = std::make_shared<operand::Tensor>(tensor_info);
+  auto tensor = std::make_shared<operand::Tensor>(tensor_info, layout);
+  if (as_const)
+    tensor->set_constant();
   (*_tensors)[ind] = tensor;
   _as_constants[ind] = as_const;
 }
@@ -110,6 +143,13 @@ void StaticTensorManager::iterate(const std::function<void(const ir::OperandInde
     fn(it.first);
 }
 
+ITensorManager::MemoryStats StaticTensorManager::memoryStats() const
+{
+  MemoryStats stats;
+  stats.arena_bytes = _nonconst_mgr->allocatedBytes();
+  return stats;
+}
+
 } // namespace cpu
 } // namespace backend
 } // namespace onert
@@ -35,26 +35,40 @@ namespace cpu
 class StaticTensorManager : public backend::ITensorManager
 {
 public:
-  StaticTensorManager(const std::shared_ptr<TensorRegistry> &reg);
+  /**
+   * @brief Construct a new StaticTensorManager object
+   * @param[in] shared_memory Memory shared with other sessions, or nullptr if there is none
+   */
+  StaticTensorManager(const std::shared_ptr<TensorRegistry> &reg,
+                      const std::shared_ptr<cpu_common::SharedMemory> &shared_memory = nullptr);
   virtual ~StaticTensorManager() = default;
 
   void allocateConsts(void);
   void allocateNonconsts(void);
   void deallocateConsts(void);
   void deallocateNonconsts(void);
+  /**
+   * @brief Let constants share memory with the ones of the same content in other sessions
+   * @note  This must be called after constants are initialized
+   */
+  void shareConsts(void);
 
-  void buildTensor(const ir::OperandIndex &ind, const ir::OperandInfo &tensor_info, bool as_const);
+  void buildTensor(const ir::OperandIndex &ind, const ir::OperandInfo &tensor_info,
+                   ir::Layout layout, bool as_const);
 
   void claimPlan(const ir::OperandIndex &ind, uint32_t size);
   void releasePlan(const ir::OperandIndex &ind);
 
   void iterate(const std::function<void(const ir::OperandIndex &)> &fn);
 
+  MemoryStats memoryStats() const override;
+
 private:
   std::unique_ptr<cpu_common::DynamicMemoryManager> _const_mgr;
   std::unique_ptr<cpu_common::MemoryManager> _nonconst_mgr;
   const std::shared_ptr<TensorRegistry> _tensors;
   ir::OperandIndexMap<bool> _as_constants;
+  std::shared_ptr<cpu_common::SharedMemory> _shared_memory;
 };
 
 } // namespace cpu
@@ -27,15 +27,16 @@ namespace backend
 namespace cpu
 {
 
-TensorBuilder::TensorBuilder()
-    : _tensor_reg{new TensorRegistry()}, _static_tensor_mgr{new StaticTensorManager(_tensor_reg)},
+TensorBuilder::TensorBuilder(const std::shared_ptr<cpu_common::SharedMemory> &shared_memory)
+    : _tensor_reg{new TensorRegistry()},
+      _static_tensor_mgr{new StaticTensorManager(_tensor_reg, shared_memory)},
       _dynamic_tensor_mgr{new DynamicTensorManager(_tensor_reg)}
 {
   /* empty */
 }
 
 void TensorBuilder::registerTensorInfo(const ir::OperandIndex &ind, const ir::OperandInfo &info,
-                                       ir::Layout, bool as_const)
+                                       ir::Layout backend_layout, bool as_const)
 {
   _tensor_info_map.emplace(ind, info);
 
@@ -48,18 +49,24 @@ void TensorBuilder::registerTensorInfo(const ir::OperandIndex &ind, const ir::Op
   }
   else
   {
-    _static_tensor_mgr->buildTensor(ind, info, _constants.contains(ind));
+    // Only feature maps are stored in blocks, and constants like filters stay in NHWC for kernels
+    // to pack them on their own
+    const bool as_blocks = backend_layout == ir::Layout::NCHWc && !_constants.contains(ind) &&
+                           info.shape().rank() == 4;
+    const auto layout = as_blocks ? ir::Layout::NCHWc : ir::Layout::NHWC;
+    _static_tensor_mgr->buildTensor(ind, info, layout, _constants.contains(ind));
   }
 }
 
 void TensorBuilder::notifyFirstUse(const ir::OperandIndex &ind)
 {
   assert(_tensor_info_map.find(ind) != _tensor_info_map.end());
-  const auto tensor_info = _tensor_info_map.at(ind);
+  const auto tensor = at(ind);
 
-  if (!at(ind)->is_dynamic())
+  if (!tensor->is_dynamic())
   {
-    const auto size = tensor_info.total_size();
+    // Size of the tensor includes padding of its layout
+    const auto size = tensor->total_size();
     _static_tensor_mgr->claimPlan(ind, size);
   }
 }
@@ -89,6 +96,12 @@ void TensorBuilder::allocate()
   //      This is because CPU kernels require `ITensor`s to be allocated before Kernel Generation.
 }
 
+void TensorBuilder::postAllFunctionsPrepare()
+{
+  // Constants are shared as kernels have left them, e.g. released after packing
+  _static_tensor_mgr->shareConsts();
+}
+
 std::shared_ptr<ITensor> TensorBuilder::tensorAt(const ir::OperandIndex &ind)
 {
   auto found = _tensor_reg->find(ind);
@@ -37,7 +37,11 @@ namespace cpu
 class TensorBuilder : public ITensorBuilder
 {
 public:
-  TensorBuilder();
+  /**
+   * @brief Construct a new TensorBuilder object
+   * @param[in] shared_memory Memory shared with other sessions, or nullptr if there is none
+   */
+  TensorBuilder(const std::shared_ptr<cpu_common::SharedMemory> &shared_memory = nullptr);
 
   bool supportDynamicTensor() override { return true; }
 
@@ -58,6 +62,7 @@ public:
   void prepare(void) override;
   void allocate() override;
   void postFunctionPrepare() override { /* DO NOTHING */}
+  void postAllFunctionsPrepare() override;
 
   /**
    * @brief Get tensor with a specific OperandIndex
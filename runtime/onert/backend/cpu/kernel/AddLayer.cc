@@ -17,6 +17,9 @@
 #include "AddLayer.h"
 
 #include <cker/operation/BinaryArithmeticOps.h>
+#include <cker/operation/nchwc/BinaryArithmetic.h>
+
+#include <algorithm>
 
 namespace onert
 {
@@ -29,41 +32,93 @@ namespace kernel
 
 void AddLayer::addFloat32()
 {
-  float output_activation_min, output_activation_max;
-  CalculateActivationRangeFloat(_activation, &output_activation_min, &output_activation_max);
-  nnfw::cker::BinaryArithmeticOpParam op_params;
-  op_params.type = nnfw::cker::BinaryArithmeticOpType::ADD;
-  op_params.float_activation_max = output_activation_max;
-  op_params.float_activation_min = output_activation_min;
-
-  const bool need_broadcast = nnfw::cker::ProcessBroadcastShapes(
-      convertTensorToCkerShape(_lhs), convertTensorToCkerShape(_rhs), &op_params);
-  if (need_broadcast)
+  // Shapes of static tensors and broadcast parameters over them are computed just once
+  const bool lhs_changed = _lhs_shape.update(_lhs);
+  const bool rhs_changed = _rhs_shape.update(_rhs);
+  _output_shape.update(_output);
+  if (lhs_changed || rhs_changed)
+  {
+    _need_broadcast = nnfw::cker::ProcessBroadcastShapes(_lhs_shape.shape(), _rhs_shape.shape(),
+                                                         &_op_params);
+  }
+
+  if (_output->layout() == ir::Layout::NCHWc)
+  {
+    // Shapes of inputs are the same, which cpu::Config checks before choosing NCHWc
+    nnfw::cker::nchwc::BinaryArithmeticOp(
+        _op_params, _lhs_shape.shape(), reinterpret_cast<const float *>(_lhs->buffer()),
+        _rhs_shape.shape(), reinterpret_cast<const float *>(_rhs->buffer()), _output_shape.shape(),
+        reinterpret_cast<float *>(_output->buffer()));
+    return;
+  }
+
+  if (_need_broadcast)
   {
     nnfw::cker::BroadcastBinaryArithmeticOp(
-        op_params, convertTensorToCkerShape(_lhs), reinterpret_cast<const float *>(_lhs->buffer()),
-        convertTensorToCkerShape(_rhs), reinterpret_cast<const float *>(_rhs->buffer()),
-        convertTensorToCkerShape(_output), reinterpret_cast<float *>(_output->buffer()));
+        _op_params, _lhs_shape.shape(), reinterpret_cast<const float *>(_lhs->buffer()),
+        _rhs_shape.shape(), reinterpret_cast<const float *>(_rhs->buffer()), _output_shape.shape(),
+        reinterpret_cast<float *>(_output->buffer()));
     return;
   }
 
   nnfw::cker::BinaryArithmeticOp(
-      op_params, convertTensorToCkerShape(_lhs), reinterpret_cast<const float *>(_lhs->buffer()),
-      convertTensorToCkerShape(_rhs), reinterpret_cast<const float *>(_rhs->buffer()),
-      convertTensorToCkerShape(_output), reinterpret_cast<float *>(_output->buffer()));
+      _op_params, _lhs_shape.shape(), reinterpret_cast<const float *>(_lhs->buffer()),
+      _rhs_shape.shape(), reinterpret_cast<const float *>(_rhs->buffer()), _output_shape.shape(),
+      reinterpret_cast<float *>(_output->buffer()));
 }
 
-void AddLayer::addQuant8()
+template <typename T> void AddLayer::addQuant8()
 {
-  int32_t output_activation_min, output_activation_max;
-  CalculateActivationRangeUint8(_activation, _output, &output_activation_min,
-                                &output_activation_max);
-  // nnfw::cker::BinaryArithmeticOpParam op_params;
-  // op_params.quantized_activation_max = output_activation_max;
-  // op_params.quantized_activation_min = output_activation_min;
-
-  // cker quant8 add is not implemented yet
-  throw std::runtime_error{"NYI"};
+  // Shapes of static tensors and quantization parameters are computed just once
+  const bool lhs_changed = _lhs_shape.update(_lhs);
+  const bool rhs_changed = _rhs_shape.update(_rhs);
+  const bool output_changed = _output_shape.update(_output);
+  if (lhs_changed || rhs_changed)
+  {
+    _need_broadcast = !HaveSameShapes(_lhs, _rhs);
+  }
+  if (output_changed)
+  {
+    int32_t output_activation_min, output_activation_max;
+    CalculateActivationRangeQuant8<T>(_activation, _output, &output_activation_min,
+                                      &output_activation_max);
+    _op_params.quantized_activation_min = output_activation_min;
+    _op_params.quantized_activation_max = output_activation_max;
+
+    // Inputs are rescaled to twice of the larger scale of them, with 20 bits of headroom
+    _op_params.left_shift = 20;
+    const double twice_max_input_scale = 2 * std::max(_lhs->data_scale(), _rhs->data_scale());
+    const double real_input1_multiplier = _lhs->data_scale() / twice_max_input_scale;
+    const double real_input2_multiplier = _rhs->data_scale() / twice_max_input_scale;
+    const double real_output_multiplier =
+        twice_max_input_scale / ((1 << _op_params.left_shift) * _output->data_scale());
+
+    int shift = 0;
+    QuantizeMultiplier(real_input1_multiplier, &_op_params.input1_multiplier, &shift);
+    _op_params.input1_shift = shift;
+    QuantizeMultiplier(real_input2_multiplier, &_op_params.input2_multiplier, &shift);
+    _op_params.input2_shift = shift;
+    QuantizeMultiplier(real_output_multiplier, &_op_params.output_multiplier, &shift);
+    _op_params.output_shift = shift;
+
+    _op_params.input1_offset = -_lhs->data_offset();
+    _op_params.input2_offset = -_rhs->data_offset();
+    _op_params.output_offset = _output->data_offset();
+  }
+
+  if (_need_broadcast)
+  {
+    nnfw::cker::BroadcastQuantizedAdd(
+        _op_params, _lhs_shape.shape(), reinterpret_cast<const T *>(_lhs->buffer()),
+        _rhs_shape.shape(), reinterpret_cast<const T *>(_rhs->buffer()), _output_shape.shape(),
+        reinterpret_cast<T *>(_output->buffer()));
+    return;
+  }
+
+  nnfw::cker::QuantizedAdd(_op_params, _lhs_shape.shape(),
+                           reinterpret_cast<const T *>(_lhs->buffer()), _rhs_shape.shape(),
+                           reinterpret_cast<const T *>(_rhs->buffer()), _output_shape.shape(),
+                           reinterpret_cast<T *>(_output->buffer()));
 }
 
 void AddLayer::configure(const operand::Tensor *lhs, const operand::Tensor *rhs,
@@ -77,6 +132,12 @@ void AddLayer::configure(const operand::Tensor *lhs, const operand::Tensor *rhs,
   _rhs = rhs;
   _activation = activation;
   _output = output;
+
+  float output_activation_min, output_activation_max;
+  CalculateActivationRangeFloat(_activation, &output_activation_min, &output_activation_max);
+  _op_params.type = nnfw::cker::BinaryArithmeticOpType::ADD;
+  _op_params.float_activation_max = output_activation_max;
+  _op_params.float_activation_min = output_activation_min;
 }
 
 void AddLayer::run()
@@ -87,7 +148,15 @@ void AddLayer::run()
   }
   else if (_lhs->data_type() == OperandType::QUANT8_ASYMM)
   {
-    addQuant8();
+    addQuant8<uint8_t>();
+  }
+  else if (_lhs->data_type() == OperandType::QUANT8_ASYMM_SIGNED)
+  {
+    addQuant8<int8_t>();
+  }
+  else
+  {
+    throw std::runtime_error{"Add: unsupported data type"};
   }
 }
 
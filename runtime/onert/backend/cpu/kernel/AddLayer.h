@@ -42,7 +42,7 @@ public:
 public:
   void addFloat32();
 
-  void addQuant8();
+  template <typename T> void addQuant8();
 
   void configure(const operand::Tensor *lhs, const operand::Tensor *rhs,
                  const ir::Activation activation, operand::Tensor *output);
@@ -61,6 +61,12 @@ private:
   operand::Tensor *_output;
 
   ir::Activation _activation{ir::Activation::NONE};
+
+  CachedCkerShape _lhs_shape;
+  CachedCkerShape _rhs_shape;
+  CachedCkerShape _output_shape;
+  nnfw::cker::BinaryArithmeticOpParam _op_params{};
+  bool _need_broadcast{false};
 };
 
 } // namespace kernel
@@ -17,6 +17,7 @@
 #include "AvgPoolLayer.h"
 
 #include <cker/operation/AveragePool.h>
+#include <cker/operation/nchwc/Pool.h>
 
 namespace onert
 {
@@ -52,25 +53,34 @@ void AvgPoolLayer::averagePoolFloat32()
   op_params.float_activation_min = output_activation_min;
   op_params.float_activation_max = output_activation_max;
 
+  if (_output->layout() == ir::Layout::NCHWc)
+  {
+    nnfw::cker::nchwc::AveragePool(op_params, convertTensorToCkerShape(_input),
+                                   reinterpret_cast<const float *>(_input->buffer()),
+                                   convertTensorToCkerShape(_output),
+                                   reinterpret_cast<float *>(_output->buffer()));
+    return;
+  }
+
   nnfw::cker::AveragePool(op_params, convertTensorToCkerShape(_input),
                           reinterpret_cast<const float *>(_input->buffer()),
                           convertTensorToCkerShape(_output),
                           reinterpret_cast<float *>(_output->buffer()));
 }
-void AvgPoolLayer::averagePoolQuant8()
+template <typename T> void AvgPoolLayer::averagePoolQuant8()
 {
   AVGPOOLING_PARAMETERS
   int32_t output_activation_min = 0;
   int32_t output_activation_max = 0;
-  CalculateActivationRangeUint8(_activation, _output, &output_activation_min,
-                                &output_activation_max);
+  CalculateActivationRangeQuant8<T>(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
   op_params.quantized_activation_min = output_activation_min;
   op_params.quantized_activation_max = output_activation_max;
 
   nnfw::cker::AveragePool(op_params, convertTensorToCkerShape(_input),
-                          reinterpret_cast<const uint8_t *>(_input->buffer()),
+                          reinterpret_cast<const T *>(_input->buffer()),
                           convertTensorToCkerShape(_output),
-                          reinterpret_cast<uint8_t *>(_output->buffer()));
+                          reinterpret_cast<T *>(_output->buffer()));
 }
 
 void AvgPoolLayer::configure(const operand::Tensor *input, const uint32_t paddingLeft,
@@ -104,7 +114,15 @@ void AvgPoolLayer::run()
   }
   else if (_input->data_type() == OperandType::QUANT8_ASYMM)
   {
-    averagePoolQuant8();
+    averagePoolQuant8<uint8_t>();
+  }
+  else if (_input->data_type() == OperandType::QUANT8_ASYMM_SIGNED)
+  {
+    averagePoolQuant8<int8_t>();
+  }
+  else
+  {
+    throw std::runtime_error{"AvgPool: unsupported data type"};
   }
 }
 
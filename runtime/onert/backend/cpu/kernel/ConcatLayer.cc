@@ -19,6 +19,7 @@
 #include "OperationUtils.h"
 
 #include <cker/operation/Concatenation.h>
+#include <cker/operation/nchwc/Concatenation.h>
 
 namespace onert
 {
@@ -60,6 +61,14 @@ void ConcatLayer::concatenationFloat32()
     inputFloatPtrs.emplace_back(reinterpret_cast<const float *>(input->buffer()));
   }
 
+  if (_output->layout() == ir::Layout::NCHWc)
+  {
+    nnfw::cker::nchwc::Concatenation(op_params, inputDimsPtr.data(), inputFloatPtrs.data(),
+                                     convertTensorToCkerShape(_output),
+                                     reinterpret_cast<float *>(_output->buffer()));
+    return;
+  }
+
   nnfw::cker::Concatenation<float>(op_params, inputDimsPtr.data(), inputFloatPtrs.data(),
                                    convertTensorToCkerShape(_output),
                                    reinterpret_cast<float *>(_output->buffer()));
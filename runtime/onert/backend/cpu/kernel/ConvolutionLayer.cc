@@ -17,6 +17,7 @@
 #include "ConvolutionLayer.h"
 
 #include <cker/operation/Conv.h>
+#include <cker/operation/nchwc/Conv.h>
 
 namespace onert
 {
@@ -75,6 +76,42 @@ void ConvolutionLayer::convFloat32()
          reinterpret_cast<float *>(_output->buffer()));
 }
 
+void ConvolutionLayer::convFloat32NCHWc()
+{
+  float output_activation_min, output_activation_max;
+  CalculateActivationRangeFloat(_activation, &output_activation_min, &output_activation_max);
+
+  nnfw::cker::ConvParams op_params;
+  op_params.padding_type = getPaddingType(_paddingType);
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = 1;
+  op_params.dilation_height_factor = 1;
+  op_params.float_activation_min = output_activation_min;
+  op_params.float_activation_max = output_activation_max;
+
+  if (!_prepare)
+  {
+    // Filter and bias are constant, which cpu::Config checks before choosing NCHWc
+    nnfw::cker::nchwc::PackConvFilter(convertTensorToCkerShape(_kernel),
+                                      reinterpret_cast<const float *>(_kernel->buffer()),
+                                      _nchwc_filter);
+    _nchwc_bias.resize(nnfw::cker::nchwc::NumBlocks(_kernel->dimension(0)) *
+                       nnfw::cker::nchwc::kBlockSize);
+    nnfw::cker::nchwc::PackBias(_kernel->dimension(0),
+                                reinterpret_cast<const float *>(_bias->buffer()),
+                                _nchwc_bias.data());
+    _prepare = true;
+  }
+  nnfw::cker::nchwc::Conv(op_params, convertTensorToCkerShape(_input),
+                          reinterpret_cast<const float *>(_input->buffer()),
+                          convertTensorToCkerShape(_kernel), _nchwc_filter.data(),
+                          _nchwc_bias.data(), convertTensorToCkerShape(_output),
+                          reinterpret_cast<float *>(_output->buffer()));
+}
+
 void ConvolutionLayer::convQuant8()
 {
   int32_t output_activation_min = 0;
@@ -118,6 +155,89 @@ void ConvolutionLayer::convQuant8()
          reinterpret_cast<uint8_t *>(_output->buffer()));
 }
 
+void ConvolutionLayer::convQuant8PerChannel()
+{
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeInt8(_activation, _output, &output_activation_min,
+                               &output_activation_max);
+
+  nnfw::cker::ConvParams op_params;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = 1;
+  op_params.dilation_height_factor = 1;
+  op_params.padding_type = getPaddingType(_paddingType);
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.input_offset = -_input->data_offset();
+  op_params.output_offset = _output->data_offset();
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  nnfw::cker::Conv &kernel = *_conv_kernel;
+  if (!_prepare)
+  {
+    // Filter is [O, H, W, I] and quantized along O
+    GetQuantizedConvolutionMultipliersAndShifts(_input, _kernel, _output, _kernel->dimension(0),
+                                                _per_channel_output_multiplier,
+                                                _per_channel_output_shift);
+    kernel.prepareQuant(convertTensorToCkerShape(_input), convertTensorToCkerShape(_kernel),
+                        convertTensorToCkerShape(_output), _strideWidth, _strideHeight);
+    _prepare = true;
+  }
+  kernel(op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+         convertTensorToCkerShape(_input), reinterpret_cast<const int8_t *>(_input->buffer()),
+         convertTensorToCkerShape(_kernel), reinterpret_cast<const int8_t *>(_kernel->buffer()),
+         convertTensorToCkerShape(_bias), reinterpret_cast<const int32_t *>(_bias->buffer()),
+         convertTensorToCkerShape(_output), reinterpret_cast<int8_t *>(_output->buffer()));
+}
+
+void ConvolutionLayer::convHybrid()
+{
+  float output_activation_min, output_activation_max;
+  CalculateActivationRangeFloat(_activation, &output_activation_min, &output_activation_max);
+
+  nnfw::cker::ConvParams op_params;
+  op_params.padding_type = getPaddingType(_paddingType);
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = 1;
+  op_params.dilation_height_factor = 1;
+  op_params.float_activation_min = output_activation_min;
+  op_params.float_activation_max = output_activation_max;
+
+  nnfw::cker::Conv &kernel = *_conv_kernel;
+  if (!_prepare)
+  {
+    // Filter is [O, H, W, I] and quantized along O, or per-tensor
+    const auto output_depth = _kernel->dimension(0);
+    if (_kernel->data_scales().empty())
+    {
+      _hybrid_filter_scales.assign(output_depth, _kernel->data_scale());
+    }
+    else if (_kernel->data_scales().size() == output_depth)
+    {
+      _hybrid_filter_scales = _kernel->data_scales();
+    }
+    else
+    {
+      throw std::runtime_error{"Conv2D: The number of filter scales must be output channels"};
+    }
+    kernel.prepareHybrid(convertTensorToCkerShape(_input), convertTensorToCkerShape(_kernel),
+                         convertTensorToCkerShape(_output), _strideWidth, _strideHeight);
+    _prepare = true;
+  }
+  kernel(op_params, _hybrid_filter_scales.data(), convertTensorToCkerShape(_input),
+         reinterpret_cast<const float *>(_input->buffer()), convertTensorToCkerShape(_kernel),
+         reinterpret_cast<const int8_t *>(_kernel->buffer()),
+         _bias ? convertTensorToCkerShape(_bias) : nnfw::cker::Shape{},
+         _bias ? reinterpret_cast<const float *>(_bias->buffer()) : nullptr,
+         convertTensorToCkerShape(_output), reinterpret_cast<float *>(_output->buffer()));
+}
+
 void ConvolutionLayer::configure(const operand::Tensor *input, const operand::Tensor *kernel,
                                  const operand::Tensor *bias, const ir::PaddingType paddingType,
                                  const uint32_t paddingLeft, const uint32_t paddingRight,
@@ -141,14 +261,29 @@ void ConvolutionLayer::configure(const operand::Tensor *input, const operand::Te
 
 void ConvolutionLayer::run()
 {
-  if (_input->data_type() == OperandType::FLOAT32)
+  if (_output->layout() == ir::Layout::NCHWc)
   {
-    convFloat32();
+    convFloat32NCHWc();
+  }
+  else if (_input->data_type() == OperandType::FLOAT32)
+  {
+    if (_kernel->data_type() == OperandType::QUANT8_SYMM)
+    {
+      convHybrid();
+    }
+    else
+    {
+      convFloat32();
+    }
   }
   else if (_input->data_type() == OperandType::QUANT8_ASYMM)
   {
     convQuant8();
   }
+  else if (_input->data_type() == OperandType::QUANT8_ASYMM_SIGNED)
+  {
+    convQuant8PerChannel();
+  }
 }
 
 #undef ANDROID_NN_CONV_PARAMETERS
@@ -50,8 +50,14 @@ public:
 public:
   void convFloat32();
 
+  void convFloat32NCHWc();
+
   void convQuant8();
 
+  void convQuant8PerChannel();
+
+  void convHybrid();
+
   void configure(const operand::Tensor *input, const operand::Tensor *kernel,
                  const operand::Tensor *bias, const ir::PaddingType paddingType,
                  const uint32_t paddingLeft, const uint32_t paddingRight, const uint32_t paddingTop,
@@ -85,6 +91,14 @@ private:
 
   std::unique_ptr<nnfw::cker::Conv> _conv_kernel;
 
+  std::vector<int32_t> _per_channel_output_multiplier;
+  std::vector<int32_t> _per_channel_output_shift;
+
+  std::vector<float> _hybrid_filter_scales;
+  // Filter and bias packed into blocks for NCHWc
+  std::vector<float> _nchwc_filter;
+  std::vector<float> _nchwc_bias;
+
   bool _prepare;
 };
 
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ConvolutionLayer.h"
+#include "TestUtils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace onert;
+using namespace onert::backend::cpu;
+using namespace onert::backend::cpu::kernel::test;
+
+namespace
+{
+
+// Input is [1, H, W, I], filter is [O, KH, KW, I] and output is [1, H - KH + 1, W - KW + 1, O]
+std::vector<float> convReference(const std::vector<float> &input, int height, int width,
+                                 int in_depth, const std::vector<float> &filter, int kernel_h,
+                                 int kernel_w, int out_depth, const std::vector<float> &bias)
+{
+  const int out_h = height - kernel_h + 1;
+  const int out_w = width - kernel_w + 1;
+  std::vector<float> output(out_h * out_w * out_depth);
+  for (int y = 0; y < out_h; ++y)
+    for (int x = 0; x < out_w; ++x)
+      for (int o = 0; o < out_depth; ++o)
+      {
+        float acc = bias.empty() ? 0.f : bias[o];
+        for (int ky = 0; ky < kernel_h; ++ky)
+          for (int kx = 0; kx < kernel_w; ++kx)
+            for (int i = 0; i < in_depth; ++i)
+              acc += input[((y + ky) * width + (x + kx)) * in_depth + i] *
+                     filter[((o * kernel_h + ky) * kernel_w + kx) * in_depth + i];
+        output[(y * out_w + x) * out_depth + o] = acc;
+      }
+  return output;
+}
+
+void runHybridPerChannel(bool with_bias)
+{
+  const int H = 5, W = 4, I = 3, O = 4, KH = 3, KW = 2;
+  const int OH = H - KH + 1, OW = W - KW + 1;
+
+  std::vector<float> input(H * W * I);
+  for (size_t n = 0; n < input.size(); ++n)
+    input[n] = static_cast<float>(static_cast<int>(n * 7 % 19) - 9) / 9.f;
+
+  // Channels are quantized with quite different scales
+  const std::vector<float> scales{0.01f, 0.002f, 0.05f, 0.0004f};
+  std::vector<int8_t> filter(O * KH * KW * I);
+  std::vector<float> dequantized(filter.size());
+  for (size_t n = 0; n < filter.size(); ++n)
+  {
+    filter[n] = static_cast<int8_t>(static_cast<int>(n * 37 % 255) - 127);
+    dequantized[n] = filter[n] * scales[n / (KH * KW * I)];
+  }
+  std::vector<float> bias;
+  if (with_bias)
+    bias = {0.5f, -0.25f, 1.f, 0.125f};
+
+  ir::TypeInfo filter_type{ir::DataType::QUANT8_SYMM};
+  filter_type.perChannel(scales, 0);
+  std::vector<float> output(OH * OW * O);
+
+  auto input_tensor =
+      createTensor(ir::Shape{1, H, W, I}, ir::TypeInfo{ir::DataType::FLOAT32}, input.data());
+  auto filter_tensor = createTensor(ir::Shape{O, KH, KW, I}, filter_type, filter.data());
+  auto bias_tensor =
+      createTensor(ir::Shape{O}, ir::TypeInfo{ir::DataType::FLOAT32}, bias.data());
+  auto output_tensor =
+      createTensor(ir::Shape{1, OH, OW, O}, ir::TypeInfo{ir::DataType::FLOAT32}, output.data());
+
+  kernel::ConvolutionLayer layer;
+  layer.configure(input_tensor.get(), filter_tensor.get(), with_bias ? bias_tensor.get() : nullptr,
+                  ir::PaddingType::EXPLICIT, 0, 0, 0, 0, 1, 1, ir::Activation::NONE,
+                  output_tensor.get());
+  layer.run();
+
+  const auto expected = convReference(input, H, W, I, dequantized, KH, KW, O, bias);
+  for (size_t n = 0; n < output.size(); ++n)
+  {
+    // Input within [-1, 1] is quantized to int8 as well, whose error is a half step of 1/127
+    const float max_filter = 127 * scales[n % O];
+    const float tolerance = 1e-4f + KH * KW * I * max_filter * (0.5f / 127);
+    EXPECT_NEAR(output[n], expected[n], tolerance) << "at " << n;
+  }
+}
+
+void runQuant8PerChannel(int kernel_h, int kernel_w)
+{
+  const int H = 5, W = 4, I = 3, O = 4;
+  const int OH = H - kernel_h + 1, OW = W - kernel_w + 1;
+
+  const float input_scale = 0.05f;
+  const int32_t input_zero_point = -3;
+  std::vector<int8_t> input(H * W * I);
+  std::vector<float> dequantized_input(input.size());
+  for (size_t n = 0; n < input.size(); ++n)
+  {
+    input[n] = static_cast<int8_t>(static_cast<int>(n * 53 % 251) - 125);
+    dequantized_input[n] = (input[n] - input_zero_point) * input_scale;
+  }
+
+  const int filter_size = kernel_h * kernel_w * I;
+  const std::vector<float> scales{0.01f, 0.002f, 0.05f, 0.0004f};
+  std::vector<int8_t> filter(O * filter_size);
+  std::vector<float> dequantized_filter(filter.size());
+  for (size_t n = 0; n < filter.size(); ++n)
+  {
+    filter[n] = static_cast<int8_t>(static_cast<int>(n * 37 % 255) - 127);
+    dequantized_filter[n] = filter[n] * scales[n / filter_size];
+  }
+
+  // Bias is quantized with input_scale * filter_scale of each channel
+  const std::vector<int32_t> bias{1000, -2000, 30, 400000};
+  std::vector<float> dequantized_bias(O);
+  for (int o = 0; o < O; ++o)
+    dequantized_bias[o] = bias[o] * input_scale * scales[o];
+
+  const auto expected = convReference(dequantized_input, H, W, I, dequantized_filter, kernel_h,
+                                      kernel_w, O, dequantized_bias);
+  float max_expected = 0.f;
+  for (const auto value : expected)
+    max_expected = std::max(max_expected, std::abs(value));
+  const float output_scale = max_expected / 100;
+  const int32_t output_zero_point = 5;
+
+  ir::TypeInfo input_type{ir::DataType::QUANT8_ASYMM_SIGNED, input_scale, input_zero_point};
+  ir::TypeInfo filter_type{ir::DataType::QUANT8_ASYMM_SIGNED};
+  filter_type.perChannel(scales, 0);
+  ir::TypeInfo output_type{ir::DataType::QUANT8_ASYMM_SIGNED, output_scale, output_zero_point};
+  std::vector<int8_t> output(OH * OW * O);
+
+  auto input_tensor = createTensor(ir::Shape{1, H, W, I}, input_type, input.data());
+  auto filter_tensor =
+      createTensor(ir::Shape{O, kernel_h, kernel_w, I}, filter_type, filter.data());
+  auto bias_tensor = createTensor(ir::Shape{O}, ir::TypeInfo{ir::DataType::INT32},
+                                  const_cast<int32_t *>(bias.data()));
+  auto output_tensor = createTensor(ir::Shape{1, OH, OW, O}, output_type, output.data());
+
+  kernel::ConvolutionLayer layer;
+  layer.configure(input_tensor.get(), filter_tensor.get(), bias_tensor.get(),
+                  ir::PaddingType::EXPLICIT, 0, 0, 0, 0, 1, 1, ir::Activation::NONE,
+                  output_tensor.get());
+  layer.run();
+
+  for (size_t n = 0; n < output.size(); ++n)
+  {
+    const float quantized = std::round(expected[n] / output_scale) + output_zero_point;
+    EXPECT_NEAR(output[n], std::min(std::max(quantized, -128.f), 127.f), 1.f) << "at " << n;
+  }
+}
+
+} // namespace
+
+TEST(ConvolutionLayer, quant8_per_channel)
+{
+  // With im2col
+  runQuant8PerChannel(3, 2);
+  // Without im2col, whose input goes to GEMM as it is
+  runQuant8PerChannel(1, 1);
+}
+
+TEST(ConvolutionLayer, hybrid_per_channel)
+{
+  runHybridPerChannel(true);
+  runHybridPerChannel(false);
+}
+
+TEST(ConvolutionLayer, hybrid_mismatched_scales)
+{
+  std::vector<float> input(1 * 2 * 2 * 1);
+  std::vector<int8_t> filter(4 * 1 * 1 * 1);
+  std::vector<float> bias(4);
+  std::vector<float> output(1 * 2 * 2 * 4);
+
+  // 3 scales for 4 output channels
+  ir::TypeInfo filter_type{ir::DataType::QUANT8_SYMM};
+  filter_type.perChannel({0.1f, 0.2f, 0.3f}, 0);
+
+  auto input_tensor =
+      createTensor(ir::Shape{1, 2, 2, 1}, ir::TypeInfo{ir::DataType::FLOAT32}, input.data());
+  auto filter_tensor = createTensor(ir::Shape{4, 1, 1, 1}, filter_type, filter.data());
+  auto bias_tensor = createTensor(ir::Shape{4}, ir::TypeInfo{ir::DataType::FLOAT32}, bias.data());
+  auto output_tensor =
+      createTensor(ir::Shape{1, 2, 2, 4}, ir::TypeInfo{ir::DataType::FLOAT32}, output.data());
+
+  kernel::ConvolutionLayer layer;
+  layer.configure(input_tensor.get(), filter_tensor.get(), bias_tensor.get(),
+                  ir::PaddingType::EXPLICIT, 0, 0, 0, 0, 1, 1, ir::Activation::NONE,
+                  output_tensor.get());
+  EXPECT_THROW(layer.run(), std::runtime_error);
+}
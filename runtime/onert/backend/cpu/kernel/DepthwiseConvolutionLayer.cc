@@ -17,6 +17,7 @@
 #include "DepthwiseConvolutionLayer.h"
 
 #include <cker/operation/DepthwiseConv.h>
+#include <cker/operation/nchwc/DepthwiseConv.h>
 
 namespace onert
 {
@@ -59,6 +60,41 @@ void DepthwiseConvolutionLayer::convFloat32()
       reinterpret_cast<float *>(_output->buffer()));
 }
 
+void DepthwiseConvolutionLayer::convFloat32NCHWc()
+{
+  float output_activation_min, output_activation_max;
+  CalculateActivationRangeFloat(_activation, &output_activation_min, &output_activation_max);
+
+  nnfw::cker::DepthwiseConvParams op_params;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = 1;
+  op_params.dilation_height_factor = 1;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.depth_multiplier = _multiplier;
+  op_params.float_activation_min = output_activation_min;
+  op_params.float_activation_max = output_activation_max;
+
+  if (_nchwc_filter.empty())
+  {
+    // Filter and bias are constant, which cpu::Config checks before choosing NCHWc
+    nnfw::cker::nchwc::PackDepthwiseConvFilter(convertTensorToCkerShape(_kernel),
+                                               reinterpret_cast<const float *>(_kernel->buffer()),
+                                               _nchwc_filter);
+    _nchwc_bias.resize(nnfw::cker::nchwc::NumBlocks(_kernel->dimension(3)) *
+                       nnfw::cker::nchwc::kBlockSize);
+    nnfw::cker::nchwc::PackBias(_kernel->dimension(3),
+                                reinterpret_cast<const float *>(_bias->buffer()),
+                                _nchwc_bias.data());
+  }
+  nnfw::cker::nchwc::DepthwiseConv(op_params, convertTensorToCkerShape(_input),
+                                   reinterpret_cast<const float *>(_input->buffer()),
+                                   convertTensorToCkerShape(_kernel), _nchwc_filter.data(),
+                                   _nchwc_bias.data(), convertTensorToCkerShape(_output),
+                                   reinterpret_cast<float *>(_output->buffer()));
+}
+
 void DepthwiseConvolutionLayer::convQuant8()
 {
   int32_t output_activation_min = 0;
@@ -96,6 +132,42 @@ void DepthwiseConvolutionLayer::convQuant8()
       reinterpret_cast<uint8_t *>(_output->buffer()));
 }
 
+void DepthwiseConvolutionLayer::convQuant8PerChannel()
+{
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeInt8(_activation, _output, &output_activation_min,
+                               &output_activation_max);
+
+  if (_per_channel_output_multiplier.empty())
+  {
+    // Filter is [1, H, W, O] and quantized along O
+    GetQuantizedConvolutionMultipliersAndShifts(_input, _kernel, _output, _kernel->dimension(3),
+                                                _per_channel_output_multiplier,
+                                                _per_channel_output_shift);
+  }
+
+  nnfw::cker::DepthwiseConvParams op_params;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = 1;
+  op_params.dilation_height_factor = 1;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.depth_multiplier = _multiplier;
+  op_params.input_offset = -_input->data_offset();
+  op_params.output_offset = _output->data_offset();
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  nnfw::cker::DepthwiseConvPerChannel(
+      op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+      convertTensorToCkerShape(_input), reinterpret_cast<const int8_t *>(_input->buffer()),
+      convertTensorToCkerShape(_kernel), reinterpret_cast<const int8_t *>(_kernel->buffer()),
+      convertTensorToCkerShape(_bias), reinterpret_cast<const int32_t *>(_bias->buffer()),
+      convertTensorToCkerShape(_output), reinterpret_cast<int8_t *>(_output->buffer()));
+}
+
 void DepthwiseConvolutionLayer::configure(const operand::Tensor *input,
                                           const operand::Tensor *kernel,
                                           const operand::Tensor *bias, const uint32_t paddingLeft,
@@ -120,7 +192,11 @@ void DepthwiseConvolutionLayer::configure(const operand::Tensor *input,
 
 void DepthwiseConvolutionLayer::run()
 {
-  if (_input->data_type() == OperandType::FLOAT32)
+  if (_output->layout() == ir::Layout::NCHWc)
+  {
+    convFloat32NCHWc();
+  }
+  else if (_input->data_type() == OperandType::FLOAT32)
   {
     convFloat32();
   }
@@ -128,6 +204,10 @@ void DepthwiseConvolutionLayer::run()
   {
     convQuant8();
   }
+  else if (_input->data_type() == OperandType::QUANT8_ASYMM_SIGNED)
+  {
+    convQuant8PerChannel();
+  }
 }
 
 } // namespace kernel
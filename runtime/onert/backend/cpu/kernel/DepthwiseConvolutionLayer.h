@@ -39,8 +39,12 @@ public:
 public:
   void convFloat32();
 
+  void convFloat32NCHWc();
+
   void convQuant8();
 
+  void convQuant8PerChannel();
+
   void configure(const operand::Tensor *input, const operand::Tensor *kernel,
                  const operand::Tensor *bias, const uint32_t paddingLeft,
                  const uint32_t paddingRight, const uint32_t paddingTop,
@@ -73,6 +77,13 @@ private:
   uint32_t _multiplier;
 
   ir::Activation _activation;
+
+  std::vector<int32_t> _per_channel_output_multiplier;
+  std::vector<int32_t> _per_channel_output_shift;
+
+  // Filter and bias packed into blocks for NCHWc
+  std::vector<float> _nchwc_filter;
+  std::vector<float> _nchwc_bias;
 };
 
 } // namespace kernel
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "DepthwiseConvolutionLayer.h"
+#include "TestUtils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace onert;
+using namespace onert::backend::cpu;
+using namespace onert::backend::cpu::kernel::test;
+
+TEST(DepthwiseConvolutionLayer, quant8_per_channel)
+{
+  const int H = 5, W = 4, I = 3, M = 2, O = I * M, KH = 3, KW = 2;
+  const int OH = H - KH + 1, OW = W - KW + 1;
+
+  const float input_scale = 0.05f;
+  const int32_t input_zero_point = -3;
+  std::vector<int8_t> input(H * W * I);
+  for (size_t n = 0; n < input.size(); ++n)
+    input[n] = static_cast<int8_t>(static_cast<int>(n * 53 % 251) - 125);
+
+  // Filter is [1, KH, KW, O] and quantized along O
+  const std::vector<float> scales{0.01f, 0.002f, 0.05f, 0.0004f, 0.02f, 0.1f};
+  std::vector<int8_t> filter(KH * KW * O);
+  for (size_t n = 0; n < filter.size(); ++n)
+    filter[n] = static_cast<int8_t>(static_cast<int>(n * 37 % 255) - 127);
+  const std::vector<int32_t> bias{1000, -2000, 30, 400000, -50, 0};
+
+  std::vector<float> expected(OH * OW * O);
+  float max_expected = 0.f;
+  for (int y = 0; y < OH; ++y)
+    for (int x = 0; x < OW; ++x)
+      for (int o = 0; o < O; ++o)
+      {
+        float acc = bias[o] * input_scale * scales[o];
+        for (int ky = 0; ky < KH; ++ky)
+          for (int kx = 0; kx < KW; ++kx)
+          {
+            const int8_t in = input[((y + ky) * W + (x + kx)) * I + o / M];
+            acc += (in - input_zero_point) * input_scale * filter[(ky * KW + kx) * O + o] *
+                   scales[o];
+          }
+        expected[(y * OW + x) * O + o] = acc;
+        max_expected = std::max(max_expected, std::abs(acc));
+      }
+  const float output_scale = max_expected / 100;
+  const int32_t output_zero_point = 5;
+
+  ir::TypeInfo input_type{ir::DataType::QUANT8_ASYMM_SIGNED, input_scale, input_zero_point};
+  ir::TypeInfo filter_type{ir::DataType::QUANT8_ASYMM_SIGNED};
+  filter_type.perChannel(scales, 3);
+  ir::TypeInfo output_type{ir::DataType::QUANT8_ASYMM_SIGNED, output_scale, output_zero_point};
+  std::vector<int8_t> output(OH * OW * O);
+
+  auto input_tensor = createTensor(ir::Shape{1, H, W, I}, input_type, input.data());
+  auto filter_tensor = createTensor(ir::Shape{1, KH, KW, O}, filter_type, filter.data());
+  auto bias_tensor = createTensor(ir::Shape{O}, ir::TypeInfo{ir::DataType::INT32},
+                                  const_cast<int32_t *>(bias.data()));
+  auto output_tensor = createTensor(ir::Shape{1, OH, OW, O}, output_type, output.data());
+
+  kernel::DepthwiseConvolutionLayer layer;
+  layer.configure(input_tensor.get(), filter_tensor.get(), bias_tensor.get(), 0, 0, 0, 0, 1, 1,
+                  M, ir::Activation::NONE, output_tensor.get());
+  layer.run();
+
+  for (size_t n = 0; n < output.size(); ++n)
+  {
+    const float quantized = std::round(expected[n] / output_scale) + output_zero_point;
+    EXPECT_NEAR(output[n], std::min(std::max(quantized, -128.f), 127.f), 1.f) << "at " << n;
+  }
+}
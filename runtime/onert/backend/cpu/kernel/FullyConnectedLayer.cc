@@ -29,7 +29,9 @@ namespace kernel
 
 FullyConnectedLayer::FullyConnectedLayer()
     : _input(nullptr), _weights(nullptr), _bias(nullptr), _output(nullptr),
-      _activation(ir::Activation::NONE), _temp_arena(new nnfw::cker::FCTempArena())
+      _activation(ir::Activation::NONE), _temp_arena(new nnfw::cker::FCTempArena()),
+      _prepacked_weights(new nnfw::cker::optimized::PrepackedLhs<float>()),
+      _prepack_weights(nnfw::cker::IsFullyConnectedRuyEnabled())
 {
   // DO NOTHING
 }
@@ -46,11 +48,26 @@ void FullyConnectedLayer::fullyConnectedFloat32()
   op_params.float_activation_max = output_activation_max;
   op_params.activation = convertActivationType(_activation);
 
+  // Shapes of static tensors are converted just once
+  _input_shape.update(_input);
+  _weights_shape.update(_weights);
+  _bias_shape.update(_bias);
+  _output_shape.update(_output);
+
+  if (_prepacked_weights->prepacked())
+  {
+    nnfw::cker::FullyConnectedPrepacked(
+        op_params, _input_shape.shape(), reinterpret_cast<const float *>(_input->buffer()),
+        _weights_shape.shape(), *_prepacked_weights, _bias_shape.shape(),
+        reinterpret_cast<const float *>(_bias->buffer()), _output_shape.shape(),
+        reinterpret_cast<float *>(_output->buffer()));
+    return;
+  }
+
   nnfw::cker::FullyConnected(
-      op_params, convertTensorToCkerShape(_input),
-      reinterpret_cast<const float *>(_input->buffer()), convertTensorToCkerShape(_weights),
-      reinterpret_cast<const float *>(_weights->buffer()), convertTensorToCkerShape(_bias),
-      reinterpret_cast<const float *>(_bias->buffer()), convertTensorToCkerShape(_output),
+      op_params, _input_shape.shape(), reinterpret_cast<const float *>(_input->buffer()),
+      _weights_shape.shape(), reinterpret_cast<const float *>(_weights->buffer()),
+      _bias_shape.shape(), reinterpret_cast<const float *>(_bias->buffer()), _output_shape.shape(),
       reinterpret_cast<float *>(_output->buffer()));
 }
 
@@ -96,13 +113,53 @@ void FullyConnectedLayer::fullyConnectedHybrid()
   nnfw::cker::FullyConnectedParams op_params;
   op_params.activation = convertActivationType(_activation);
   op_params.weights_scale = _weights->data_scale();
+  // Weights are [O, I] and may be quantized along O
+  if (!_weights->data_scales().empty())
+  {
+    if (_weights->data_scales().size() != _weights->dimension(0))
+    {
+      throw std::runtime_error{"FullyConnected: The number of weights scales must be output units"};
+    }
+    op_params.weights_scales = _weights->data_scales().data();
+  }
 
   nnfw::cker::FullyConnectedHybrid(
       op_params, convertTensorToCkerShape(_input),
       reinterpret_cast<const float *>(_input->buffer()), convertTensorToCkerShape(_weights),
-      reinterpret_cast<const int8_t *>(_weights->buffer()), convertTensorToCkerShape(_bias),
-      reinterpret_cast<const float *>(_bias->buffer()), convertTensorToCkerShape(_output),
-      reinterpret_cast<float *>(_output->buffer()), temp_arena);
+      reinterpret_cast<const int8_t *>(_weights->buffer()),
+      _bias ? convertTensorToCkerShape(_bias) : nnfw::cker::Shape{},
+      _bias ? reinterpret_cast<const float *>(_bias->buffer()) : nullptr,
+      convertTensorToCkerShape(_output), reinterpret_cast<float *>(_output->buffer()), temp_arena);
+}
+
+void FullyConnectedLayer::fullyConnectedQuant8PerChannel()
+{
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeInt8(_activation, _output, &output_activation_min,
+                               &output_activation_max);
+
+  if (_per_channel_output_multiplier.empty())
+  {
+    // Weights are [O, I] and quantized along O, or per-tensor
+    GetQuantizedConvolutionMultipliersAndShifts(_input, _weights, _output, _weights->dimension(0),
+                                                _per_channel_output_multiplier,
+                                                _per_channel_output_shift);
+  }
+
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.input_offset = -_input->data_offset();
+  op_params.weights_offset = -_weights->data_offset();
+  op_params.output_offset = _output->data_offset();
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  nnfw::cker::FullyConnectedPerChannel(
+      op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+      convertTensorToCkerShape(_input), reinterpret_cast<const int8_t *>(_input->buffer()),
+      convertTensorToCkerShape(_weights), reinterpret_cast<const int8_t *>(_weights->buffer()),
+      convertTensorToCkerShape(_bias), reinterpret_cast<const int32_t *>(_bias->buffer()),
+      convertTensorToCkerShape(_output), reinterpret_cast<int8_t *>(_output->buffer()));
 }
 
 void FullyConnectedLayer::configure(const operand::Tensor *input, const operand::Tensor *weights,
@@ -116,6 +173,28 @@ void FullyConnectedLayer::configure(const operand::Tensor *input, const operand:
   _output = output;
 }
 
+void FullyConnectedLayer::prepare()
+{
+  if (!_prepack_weights)
+    return;
+
+  if (_input->data_type() != OperandType::FLOAT32 ||
+      _weights->data_type() != OperandType::FLOAT32 || !_weights->is_constant() ||
+      _input->is_dynamic())
+    return;
+
+  // Pack weights once, then every run skips packing
+  const auto weights_shape = convertTensorToCkerShape(_weights);
+  const int batch_size = convertTensorToCkerShape(_input).FlatSize() / weights_shape.Dims(1);
+  nnfw::cker::PrepackFullyConnectedWeights(weights_shape,
+                                           reinterpret_cast<const float *>(_weights->buffer()),
+                                           batch_size, _prepacked_weights.get());
+
+  // Original weights are not used anymore
+  // TODO Remove const_cast
+  const_cast<operand::Tensor *>(_weights)->decrease_ref();
+}
+
 void FullyConnectedLayer::run()
 {
   if (_input->data_type() == OperandType::FLOAT32)
@@ -133,6 +212,10 @@ void FullyConnectedLayer::run()
   {
     fullyConnectedQuant8();
   }
+  else if (_input->data_type() == OperandType::QUANT8_ASYMM_SIGNED)
+  {
+    fullyConnectedQuant8PerChannel();
+  }
 }
 
 } // namespace kernel
@@ -27,7 +27,11 @@ namespace nnfw
 namespace cker
 {
 class FCTempArena;
+namespace optimized
+{
+template <typename LhsScalar> class PrepackedLhs;
 }
+} // namespace cker
 } // namespace nnfw
 
 namespace onert
@@ -52,9 +56,20 @@ public:
 
   void fullyConnectedHybrid();
 
+  void fullyConnectedQuant8PerChannel();
+
   void configure(const operand::Tensor *input, const operand::Tensor *weights,
                  const operand::Tensor *bias, ir::Activation activation, operand::Tensor *output);
 
+  void prepare() override;
+
+  /**
+   * @brief Set whether prepare() packs constant float weights for ruy
+   * @note  It is set only where ruy has optimized float kernels, see
+   *        nnfw::cker::IsFullyConnectedRuyEnabled(). Elsewhere it is set just to test the path.
+   */
+  void prepackWeights(bool prepack_weights) { _prepack_weights = prepack_weights; }
+
   void run();
   void runSync()
   {
@@ -71,6 +86,16 @@ private:
 
   ir::Activation _activation;
   std::unique_ptr<nnfw::cker::FCTempArena> _temp_arena;
+  std::unique_ptr<nnfw::cker::optimized::PrepackedLhs<float>> _prepacked_weights;
+  bool _prepack_weights;
+
+  std::vector<int32_t> _per_channel_output_multiplier;
+  std::vector<int32_t> _per_channel_output_shift;
+
+  CachedCkerShape _input_shape;
+  CachedCkerShape _weights_shape;
+  CachedCkerShape _bias_shape;
+  CachedCkerShape _output_shape;
 };
 
 } // namespace kernel
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "FullyConnectedLayer.h"
+#include "TestUtils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace onert;
+using namespace onert::backend::cpu;
+using namespace onert::backend::cpu::kernel::test;
+
+namespace
+{
+
+void runHybridPerChannel(bool with_bias)
+{
+  const int B = 2, I = 19, O = 5;
+
+  std::vector<float> input(B * I);
+  for (size_t n = 0; n < input.size(); ++n)
+    input[n] = static_cast<float>(static_cast<int>(n * 5 % 17) - 8) / 8.f;
+
+  // Units are quantized with quite different scales
+  const std::vector<float> scales{0.01f, 0.002f, 0.05f, 0.0004f, 0.02f};
+  std::vector<int8_t> weights(O * I);
+  for (size_t n = 0; n < weights.size(); ++n)
+    weights[n] = static_cast<int8_t>(static_cast<int>(n * 41 % 255) - 127);
+  std::vector<float> bias;
+  if (with_bias)
+    bias = {0.5f, -0.25f, 1.f, 0.125f, -2.f};
+
+  ir::TypeInfo weights_type{ir::DataType::QUANT8_SYMM};
+  weights_type.perChannel(scales, 0);
+  std::vector<float> output(B * O);
+
+  auto input_tensor =
+      createTensor(ir::Shape{B, I}, ir::TypeInfo{ir::DataType::FLOAT32}, input.data());
+  auto weights_tensor = createTensor(ir::Shape{O, I}, weights_type, weights.data());
+  auto bias_tensor = createTensor(ir::Shape{O}, ir::TypeInfo{ir::DataType::FLOAT32}, bias.data());
+  auto output_tensor =
+      createTensor(ir::Shape{B, O}, ir::TypeInfo{ir::DataType::FLOAT32}, output.data());
+
+  kernel::FullyConnectedLayer layer;
+  layer.configure(input_tensor.get(), weights_tensor.get(),
+                  with_bias ? bias_tensor.get() : nullptr, ir::Activation::NONE,
+                  output_tensor.get());
+  layer.prepare();
+  layer.run();
+
+  for (int b = 0; b < B; ++b)
+  {
+    for (int o = 0; o < O; ++o)
+    {
+      float expected = with_bias ? bias[o] : 0.f;
+      for (int i = 0; i < I; ++i)
+        expected += input[b * I + i] * weights[o * I + i] * scales[o];
+
+      // Input within [-1, 1] is quantized to int8 as well, whose error is a half step of 1/127
+      const float tolerance = 1e-4f + I * 127 * scales[o] * (0.5f / 127);
+      EXPECT_NEAR(output[b * O + o], expected, tolerance) << "at " << b << ", " << o;
+    }
+  }
+}
+
+// Run float FullyConnected of RELU, packing constant weights for ruy or not
+std::vector<float> runFloat32(int batch, bool prepack_weights)
+{
+  const int I = 19, O = 5;
+
+  std::vector<float> input(batch * I);
+  for (size_t n = 0; n < input.size(); ++n)
+    input[n] = static_cast<float>(static_cast<int>(n * 5 % 17) - 8) / 8.f;
+  std::vector<float> weights(O * I);
+  for (size_t n = 0; n < weights.size(); ++n)
+    weights[n] = static_cast<float>(static_cast<int>(n * 41 % 23) - 11) / 4.f;
+  std::vector<float> bias{0.5f, -0.25f, 1.f, 0.125f, -2.f};
+  std::vector<float> output(batch * O);
+
+  auto input_tensor =
+      createTensor(ir::Shape{batch, I}, ir::TypeInfo{ir::DataType::FLOAT32}, input.data());
+  auto weights_tensor =
+      createTensor(ir::Shape{O, I}, ir::TypeInfo{ir::DataType::FLOAT32}, weights.data());
+  weights_tensor->set_constant();
+  weights_tensor->increase_ref();
+  auto bias_tensor = createTensor(ir::Shape{O}, ir::TypeInfo{ir::DataType::FLOAT32}, bias.data());
+  auto output_tensor =
+      createTensor(ir::Shape{batch, O}, ir::TypeInfo{ir::DataType::FLOAT32}, output.data());
+
+  kernel::FullyConnectedLayer layer;
+  layer.configure(input_tensor.get(), weights_tensor.get(), bias_tensor.get(),
+                  ir::Activation::RELU, output_tensor.get());
+  layer.prepackWeights(prepack_weights);
+  layer.prepare();
+  // Packed weights are used instead of the original ones, which are released
+  EXPECT_EQ(weights_tensor->buffer() == nullptr, prepack_weights);
+  layer.run();
+
+  for (int b = 0; b < batch; ++b)
+  {
+    for (int o = 0; o < O; ++o)
+    {
+      float expected = bias[o];
+      for (int i = 0; i < I; ++i)
+        expected += input[b * I + i] * weights[o * I + i];
+      EXPECT_NEAR(output[b * O + o], std::max(expected, 0.f), 1e-4f)
+          << "batch " << b << ", unit " << o;
+    }
+  }
+  return output;
+}
+
+} // namespace
+
+TEST(FullyConnectedLayer, float32_prepacked_weights)
+{
+  for (int batch : {1, 3})
+  {
+    // ruy path is taken even where it is not by default
+    const auto prepacked = runFloat32(batch, true);
+    const auto unpacked = runFloat32(batch, false);
+    ASSERT_EQ(prepacked.size(), unpacked.size());
+    for (size_t n = 0; n < prepacked.size(); ++n)
+      EXPECT_NEAR(prepacked[n], unpacked[n], 1e-4f);
+  }
+}
+
+TEST(FullyConnectedLayer, quant8_per_channel)
+{
+  const int B = 2, I = 19, O = 5;
+
+  const float input_scale = 0.05f;
+  const int32_t input_zero_point = -3;
+  std::vector<int8_t> input(B * I);
+  for (size_t n = 0; n < input.size(); ++n)
+    input[n] = static_cast<int8_t>(static_cast<int>(n * 53 % 251) - 125);
+
+  const std::vector<float> scales{0.01f, 0.002f, 0.05f, 0.0004f, 0.02f};
+  std::vector<int8_t> weights(O * I);
+  for (size_t n = 0; n < weights.size(); ++n)
+    weights[n] = static_cast<int8_t>(static_cast<int>(n * 41 % 255) - 127);
+  const std::vector<int32_t> bias{1000, -2000, 30, 400000, -50};
+
+  std::vector<float> expected(B * O);
+  float max_expected = 0.f;
+  for (int b = 0; b < B; ++b)
+    for (int o = 0; o < O; ++o)
+    {
+      float acc = bias[o] * input_scale * scales[o];
+      for (int i = 0; i < I; ++i)
+        acc += (input[b * I + i] - input_zero_point) * input_scale * weights[o * I + i] * scales[o];
+      expected[b * O + o] = acc;
+      max_expected = std::max(max_expected, std::abs(acc));
+    }
+  const float output_scale = max_expected / 100;
+  const int32_t output_zero_point = 5;
+
+  ir::TypeInfo input_type{ir::DataType::QUANT8_ASYMM_SIGNED, input_scale, input_zero_point};
+  ir::TypeInfo weights_type{ir::DataType::QUANT8_ASYMM_SIGNED};
+  weights_type.perChannel(scales, 0);
+  ir::TypeInfo output_type{ir::DataType::QUANT8_ASYMM_SIGNED, output_scale, output_zero_point};
+  std::vector<int8_t> output(B * O);
+
+  auto input_tensor = createTensor(ir::Shape{B, I}, input_type, input.data());
+  auto weights_tensor = createTensor(ir::Shape{O, I}, weights_type, weights.data());
+  auto bias_tensor = createTensor(ir::Shape{O}, ir::TypeInfo{ir::DataType::INT32},
+                                  const_cast<int32_t *>(bias.data()));
+  auto output_tensor = createTensor(ir::Shape{B, O}, output_type, output.data());
+
+  kernel::FullyConnectedLayer layer;
+  layer.configure(input_tensor.get(), weights_tensor.get(), bias_tensor.get(),
+                  ir::Activation::NONE, output_tensor.get());
+  layer.prepare();
+  layer.run();
+
+  for (size_t n = 0; n < output.size(); ++n)
+  {
+    const float quantized = std::round(expected[n] / output_scale) + output_zero_point;
+    EXPECT_NEAR(output[n], std::min(std::max(quantized, -128.f), 127.f), 1.f) << "at " << n;
+  }
+}
+
+TEST(FullyConnectedLayer, hybrid_per_channel)
+{
+  runHybridPerChannel(true);
+  runHybridPerChannel(false);
+}
+
+TEST(FullyConnectedLayer, hybrid_mismatched_scales)
+{
+  std::vector<float> input(4);
+  std::vector<int8_t> weights(3 * 4);
+  std::vector<float> bias(3);
+  std::vector<float> output(3);
+
+  // 2 scales for 3 output units
+  ir::TypeInfo weights_type{ir::DataType::QUANT8_SYMM};
+  weights_type.perChannel({0.1f, 0.2f}, 0);
+
+  auto input_tensor =
+      createTensor(ir::Shape{1, 4}, ir::TypeInfo{ir::DataType::FLOAT32}, input.data());
+  auto weights_tensor = createTensor(ir::Shape{3, 4}, weights_type, weights.data());
+  auto bias_tensor = createTensor(ir::Shape{3}, ir::TypeInfo{ir::DataType::FLOAT32}, bias.data());
+  auto output_tensor =
+      createTensor(ir::Shape{1, 3}, ir::TypeInfo{ir::DataType::FLOAT32}, output.data());
+
+  kernel::FullyConnectedLayer layer;
+  layer.configure(input_tensor.get(), weights_tensor.get(), bias_tensor.get(),
+                  ir::Activation::NONE, output_tensor.get());
+  layer.prepare();
+  EXPECT_THROW(layer.run(), std::runtime_error);
+}
@@ -39,7 +39,7 @@ public:
 public:
   void maxPoolFloat32();
 
-  void maxPoolQuant8();
+  template <typename T> void maxPoolQuant8();
 
   void configure(const operand::Tensor *input, const uint32_t paddingLeft,
                  const uint32_t paddingRight, const uint32_t paddingTop,
@@ -94,6 +94,29 @@ void GetQuantizedConvolutionMultiplier(const operand::Tensor *input, const opera
   *multiplier = input_product_scale / output_scale;
 }
 
+void GetQuantizedConvolutionMultipliersAndShifts(const operand::Tensor *input,
+                                                 const operand::Tensor *filter,
+                                                 const operand::Tensor *output, int num_channels,
+                                                 std::vector<int32_t> &per_channel_multiplier,
+                                                 std::vector<int32_t> &per_channel_shift)
+{
+  const auto &filter_scales = filter->data_scales();
+  // Per-tensor quantized filter is handled as if all the channels have the same scale
+  assert(filter_scales.empty() || filter_scales.size() == static_cast<size_t>(num_channels));
+
+  per_channel_multiplier.resize(num_channels);
+  per_channel_shift.resize(num_channels);
+  for (int i = 0; i < num_channels; ++i)
+  {
+    const float filter_scale = filter_scales.empty() ? filter->data_scale() : filter_scales[i];
+    const double effective_scale =
+        static_cast<double>(input->data_scale()) * filter_scale / output->data_scale();
+    int shift = 0;
+    QuantizeMultiplier(effective_scale, &per_channel_multiplier[i], &shift);
+    per_channel_shift[i] = shift;
+  }
+}
+
 void QuantizeMultiplierGreaterThanOne(double double_multiplier, int32_t *quantized_multiplier,
                                       int *left_shift)
 {
@@ -145,11 +168,13 @@ void CalculateActivationRangeFloat(ir::Activation activation, float *activation_
   }
 }
 
-void CalculateActivationRangeUint8(ir::Activation activation, const operand::Tensor *output,
-                                   int32_t *act_min, int32_t *act_max)
+namespace
+{
+
+void calculateActivationRangeQuantized(ir::Activation activation, const operand::Tensor *output,
+                                       int32_t qmin, int32_t qmax, int32_t *act_min,
+                                       int32_t *act_max)
 {
-  const int32_t qmin = std::numeric_limits<uint8_t>::min();
-  const int32_t qmax = std::numeric_limits<uint8_t>::max();
   const auto scale = output->data_scale();
   const auto zero_point = output->data_offset();
   auto quantize = [scale, zero_point](float f) {
@@ -186,6 +211,22 @@ void CalculateActivationRangeUint8(ir::Activation activation, const operand::Ten
   }
 }
 
+} // namespace
+
+void CalculateActivationRangeUint8(ir::Activation activation, const operand::Tensor *output,
+                                   int32_t *act_min, int32_t *act_max)
+{
+  calculateActivationRangeQuantized(activation, output, std::numeric_limits<uint8_t>::min(),
+                                    std::numeric_limits<uint8_t>::max(), act_min, act_max);
+}
+
+void CalculateActivationRangeInt8(ir::Activation activation, const operand::Tensor *output,
+                                  int32_t *act_min, int32_t *act_max)
+{
+  calculateActivationRangeQuantized(activation, output, std::numeric_limits<int8_t>::min(),
+                                    std::numeric_limits<int8_t>::max(), act_min, act_max);
+}
+
 bool HaveSameShapes(const operand::Tensor *input1, const operand::Tensor *input2)
 {
   if (input1 == input2)
@@ -232,6 +273,7 @@ uint32_t sizeOfData(OperandType type, const std::vector<uint32_t> &dimensions)
     case OperandType::BOOL8:
     case OperandType::QUANT8_ASYMM:
     case OperandType::QUANT8_SYMM:
+    case OperandType::QUANT8_ASYMM_SIGNED:
       size = 1;
       break;
     default:
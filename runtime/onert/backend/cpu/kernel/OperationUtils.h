@@ -28,6 +28,7 @@
 #include <ir/Padding.h>
 
 #include <limits>
+#include <type_traits>
 #include <vector>
 
 using OperandType = onert::ir::DataType;
@@ -60,39 +61,76 @@ uint32_t getSizeOfDimension(const operand::Tensor *tensor, uint32_t dimensionIdx
 inline nnfw::cker::Shape convertToExtendedCkerShape(const operand::Tensor *tensor)
 {
   assert(tensor);
-  std::vector<int32_t> raw_shape;
-  raw_shape.resize(4);
+  // cker::Shape keeps up to 4 dimensions inline, so this does not allocate
+  nnfw::cker::Shape shape(4);
 
   uint32_t src = 4 - tensor->num_dimensions();
   for (uint32_t i = 0; i < 4; ++i)
   {
     if (i < src)
     {
-      raw_shape[i] = 1;
+      shape.SetDim(i, 1);
     }
     else
     {
-      raw_shape[i] = tensor->dimension(i - src);
+      shape.SetDim(i, tensor->dimension(i - src));
     }
   }
 
-  return nnfw::cker::GetShape(raw_shape);
+  return shape;
 }
 
 inline nnfw::cker::Shape convertTensorToCkerShape(const operand::Tensor *tensor)
 {
   assert(tensor);
-  assert(tensor->layout() == ir::Layout::NHWC);
-  std::vector<int32_t> raw_shape;
-  raw_shape.resize(tensor->num_dimensions());
-  for (uint32_t i = 0; i < tensor->num_dimensions(); ++i)
+  assert(tensor->layout() == ir::Layout::NHWC || tensor->layout() == ir::Layout::NCHWc);
+  const auto rank = tensor->num_dimensions();
+  nnfw::cker::Shape shape(rank);
+  for (uint32_t i = 0; i < rank; ++i)
   {
-    raw_shape[i] = tensor->dimension(i);
+    shape.SetDim(i, tensor->dimension(i));
   }
 
-  return nnfw::cker::GetShape(raw_shape);
+  return shape;
 }
 
+/**
+ * @brief cker::Shape of a tensor, which is converted once and then again only while the tensor
+ *        is dynamic
+ *
+ * Kernels of small models spend a large part of a run in converting shapes, so those run
+ * frequently keep them with this.
+ */
+class CachedCkerShape
+{
+public:
+  /**
+   * @brief  Convert shape of the tensor if it may have been changed since the last call
+   * @return @c true if it is converted
+   */
+  bool update(const operand::Tensor *tensor)
+  {
+    assert(tensor);
+    if (_converted && !tensor->is_dynamic())
+      return false;
+
+    const auto rank = tensor->num_dimensions();
+    _shape.Resize(rank);
+    for (uint32_t i = 0; i < rank; ++i)
+    {
+      _shape.SetDim(i, tensor->dimension(i));
+    }
+    _converted = true;
+    return true;
+  }
+
+  const nnfw::cker::Shape &shape() const { return _shape; }
+
+private:
+  nnfw::cker::Shape _shape;
+  bool _converted{false};
+};
+
 inline nnfw::cker::FusedActivationFunctionType
 convertActivationType(const ir::Activation activation)
 {
@@ -137,6 +175,16 @@ void GetQuantizedConvolutionMultiplier(const operand::Tensor *inputDescr,
                                        const operand::Tensor *biasDescr,
                                        const operand::Tensor *outputDescr, double *multiplier);
 
+/**
+ * @brief Compute multipliers and shifts of each output channel for per-channel quantized
+ *        convolution whose filter has one scale per output channel
+ */
+void GetQuantizedConvolutionMultipliersAndShifts(const operand::Tensor *input,
+                                                 const operand::Tensor *filter,
+                                                 const operand::Tensor *output, int num_channels,
+                                                 std::vector<int32_t> &per_channel_multiplier,
+                                                 std::vector<int32_t> &per_channel_shift);
+
 void QuantizeMultiplierGreaterThanOne(double double_multiplier, int32_t *quantized_multiplier,
                                       int *left_shift);
 
@@ -146,6 +194,22 @@ void CalculateActivationRangeFloat(ir::Activation activation, float *activation_
 void CalculateActivationRangeUint8(ir::Activation activation, const operand::Tensor *output,
                                    int32_t *act_min, int32_t *act_max);
 
+void CalculateActivationRangeInt8(ir::Activation activation, const operand::Tensor *output,
+                                  int32_t *act_min, int32_t *act_max);
+
+// Activation range of output of uint8_t or int8_t
+template <typename T>
+void CalculateActivationRangeQuant8(ir::Activation activation, const operand::Tensor *output,
+                                    int32_t *act_min, int32_t *act_max)
+{
+  static_assert(std::is_same<T, uint8_t>::value || std::is_same<T, int8_t>::value,
+                "Only uint8_t and int8_t are supported");
+  if (std::is_same<T, int8_t>::value)
+    CalculateActivationRangeInt8(activation, output, act_min, act_max);
+  else
+    CalculateActivationRangeUint8(activation, output, act_min, act_max);
+}
+
 bool HaveSameShapes(const operand::Tensor *input1, const operand::Tensor *input2);
 
 int32_t CalculateInputRadius(int input_integer_bits, int input_left_shift);
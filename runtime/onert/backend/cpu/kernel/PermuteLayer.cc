@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "PermuteLayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/nchwc/Common.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace kernel
+{
+
+PermuteLayer::PermuteLayer() : _input(nullptr), _output(nullptr)
+{
+  // DO NOTHING
+}
+
+void PermuteLayer::configure(std::shared_ptr<operand::Tensor> input,
+                             std::shared_ptr<operand::Tensor> output, size_t rank)
+{
+  _input = input.get();
+  _output = output.get();
+  _src_tensors.emplace_back(input);
+  _dst_tensors.emplace_back(output);
+  _ranks.emplace_back(rank);
+}
+
+void PermuteLayer::run()
+{
+  if (_input->data_type() == OperandType::FLOAT32)
+  {
+    if (_input->layout() == ir::Layout::NHWC && _output->layout() == ir::Layout::NCHWc)
+    {
+      nnfw::cker::nchwc::FromNHWC(convertTensorToCkerShape(_input),
+                                  reinterpret_cast<const float *>(_input->buffer()),
+                                  reinterpret_cast<float *>(_output->buffer()));
+      return;
+    }
+    if (_input->layout() == ir::Layout::NCHWc && _output->layout() == ir::Layout::NHWC)
+    {
+      nnfw::cker::nchwc::ToNHWC(convertTensorToCkerShape(_input),
+                                reinterpret_cast<const float *>(_input->buffer()),
+                                reinterpret_cast<float *>(_output->buffer()));
+      return;
+    }
+  }
+
+  IPermuteFunction::run();
+}
+
+} // namespace kernel
+} // namespace cpu
+} // namespace backend
+} // namespace onert
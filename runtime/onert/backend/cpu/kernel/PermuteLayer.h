@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __ONERT_BACKEND_CPU_KERNEL_PERMUTELAYER_H__
+#define __ONERT_BACKEND_CPU_KERNEL_PERMUTELAYER_H__
+
+#include "../operand/Tensor.h"
+
+#include <exec/IPermuteFunction.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace kernel
+{
+
+/**
+ * @brief Permute between tensors of cpu, which are in NHWC or NCHWc
+ *        Float feature maps are converted by cker, and the rest by IPermuteFunction.
+ */
+class PermuteLayer : public ::onert::exec::IPermuteFunction
+{
+public:
+  PermuteLayer();
+
+public:
+  void configure(std::shared_ptr<operand::Tensor> input, std::shared_ptr<operand::Tensor> output,
+                 size_t rank);
+
+  void run() override;
+
+  void optimize() override
+  {
+    // DO NOTHING
+  }
+
+private:
+  operand::Tensor *_input;
+  operand::Tensor *_output;
+};
+
+} // namespace kernel
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_KERNEL_PERMUTELAYER_H__
@@ -99,7 +99,7 @@ void SoftMaxLayer::softmaxFloat32()
   }
 }
 
-void SoftMaxLayer::softmaxQuant8()
+template <typename T> void SoftMaxLayer::softmaxQuant8()
 {
   nnfw::cker::Shape descrIn4D(4);
 
@@ -126,7 +126,9 @@ void SoftMaxLayer::softmaxQuant8()
   {
     throw std::runtime_error{"only 2D and 4D tensors supported"};
   }
-  if (_output->data_offset() != 0 || _output->data_scale() != 1.f / 256)
+  // Output is of scale 1/256 and zero point of the lowest value of T
+  if (_output->data_offset() != std::numeric_limits<T>::lowest() ||
+      _output->data_scale() != 1.f / 256)
   {
     throw std::runtime_error{"incorrect scale / offset for output"};
   }
@@ -143,8 +145,8 @@ void SoftMaxLayer::softmaxQuant8()
   op_params.input_multiplier = input_multiplier;
   op_params.input_left_shift = input_left_shift;
   op_params.diff_min = diff_min;
-  nnfw::cker::Softmax(op_params, descrIn4D, reinterpret_cast<const uint8_t *>(_input->buffer()),
-                      descrIn4D, reinterpret_cast<uint8_t *>(_output->buffer()));
+  nnfw::cker::Softmax(op_params, descrIn4D, reinterpret_cast<const T *>(_input->buffer()),
+                      descrIn4D, reinterpret_cast<T *>(_output->buffer()));
 }
 
 void SoftMaxLayer::configure(const operand::Tensor *input, const float beta,
@@ -163,7 +165,15 @@ void SoftMaxLayer::run()
   }
   else if (_input->data_type() == OperandType::QUANT8_ASYMM)
   {
-    softmaxQuant8();
+    softmaxQuant8<uint8_t>();
+  }
+  else if (_input->data_type() == OperandType::QUANT8_ASYMM_SIGNED)
+  {
+    softmaxQuant8<int8_t>();
+  }
+  else
+  {
+    throw std::runtime_error{"SoftMax: unsupported data type"};
   }
 }
 
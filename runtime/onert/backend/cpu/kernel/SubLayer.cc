@@ -17,6 +17,7 @@
 #include "SubLayer.h"
 
 #include <cker/operation/BinaryArithmeticOps.h>
+#include <cker/operation/nchwc/BinaryArithmetic.h>
 
 namespace onert
 {
@@ -29,28 +30,39 @@ namespace kernel
 
 void SubLayer::subFloat32()
 {
-  float output_activation_min, output_activation_max;
-  CalculateActivationRangeFloat(_activation, &output_activation_min, &output_activation_max);
-  nnfw::cker::BinaryArithmeticOpParam op_params;
-  op_params.type = nnfw::cker::BinaryArithmeticOpType::SUB;
-  op_params.float_activation_max = output_activation_max;
-  op_params.float_activation_min = output_activation_min;
+  // Shapes of static tensors and broadcast parameters over them are computed just once
+  const bool lhs_changed = _lhs_shape.update(_lhs);
+  const bool rhs_changed = _rhs_shape.update(_rhs);
+  _output_shape.update(_output);
+  if (lhs_changed || rhs_changed)
+  {
+    _need_broadcast = nnfw::cker::ProcessBroadcastShapes(_lhs_shape.shape(), _rhs_shape.shape(),
+                                                         &_op_params);
+  }
 
-  const bool need_broadcast = nnfw::cker::ProcessBroadcastShapes(
-      convertTensorToCkerShape(_lhs), convertTensorToCkerShape(_rhs), &op_params);
-  if (need_broadcast)
+  if (_output->layout() == ir::Layout::NCHWc)
+  {
+    // Shapes of inputs are the same, which cpu::Config checks before choosing NCHWc
+    nnfw::cker::nchwc::BinaryArithmeticOp(
+        _op_params, _lhs_shape.shape(), reinterpret_cast<const float *>(_lhs->buffer()),
+        _rhs_shape.shape(), reinterpret_cast<const float *>(_rhs->buffer()), _output_shape.shape(),
+        reinterpret_cast<float *>(_output->buffer()));
+    return;
+  }
+
+  if (_need_broadcast)
   {
     nnfw::cker::BroadcastBinaryArithmeticOp(
-        op_params, convertTensorToCkerShape(_lhs), reinterpret_cast<const float *>(_lhs->buffer()),
-        convertTensorToCkerShape(_rhs), reinterpret_cast<const float *>(_rhs->buffer()),
-        convertTensorToCkerShape(_output), reinterpret_cast<float *>(_output->buffer()));
+        _op_params, _lhs_shape.shape(), reinterpret_cast<const float *>(_lhs->buffer()),
+        _rhs_shape.shape(), reinterpret_cast<const float *>(_rhs->buffer()), _output_shape.shape(),
+        reinterpret_cast<float *>(_output->buffer()));
     return;
   }
 
   nnfw::cker::BinaryArithmeticOp(
-      op_params, convertTensorToCkerShape(_lhs), reinterpret_cast<const float *>(_lhs->buffer()),
-      convertTensorToCkerShape(_rhs), reinterpret_cast<const float *>(_rhs->buffer()),
-      convertTensorToCkerShape(_output), reinterpret_cast<float *>(_output->buffer()));
+      _op_params, _lhs_shape.shape(), reinterpret_cast<const float *>(_lhs->buffer()),
+      _rhs_shape.shape(), reinterpret_cast<const float *>(_rhs->buffer()), _output_shape.shape(),
+      reinterpret_cast<float *>(_output->buffer()));
 }
 
 void SubLayer::subQuant8()
@@ -73,6 +85,12 @@ void SubLayer::configure(const operand::Tensor *lhs, const operand::Tensor *rhs,
   _rhs = rhs;
   _activation = activation;
   _output = output;
+
+  float output_activation_min, output_activation_max;
+  CalculateActivationRangeFloat(_activation, &output_activation_min, &output_activation_max);
+  _op_params.type = nnfw::cker::BinaryArithmeticOpType::SUB;
+  _op_params.float_activation_max = output_activation_max;
+  _op_params.float_activation_min = output_activation_min;
 }
 
 void SubLayer::run()
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_KERNEL_TEST_UTILS_H__
+#define __ONERT_BACKEND_CPU_KERNEL_TEST_UTILS_H__
+
+#include "../operand/Tensor.h"
+
+#include <memory>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace kernel
+{
+namespace test
+{
+
+/**
+ * @brief Create a static tensor on the given buffer, which the caller keeps alive
+ */
+inline std::unique_ptr<operand::Tensor> createTensor(const ir::Shape &shape,
+                                                     const ir::TypeInfo &type, void *data)
+{
+  auto tensor = std::make_unique<operand::Tensor>(ir::OperandInfo::createStaticInfo(shape, type));
+  tensor->setBuffer(reinterpret_cast<uint8_t *>(data));
+  return tensor;
+}
+
+} // namespace test
+} // namespace kernel
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_KERNEL_TEST_UTILS_H__
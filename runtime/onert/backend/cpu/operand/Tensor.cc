@@ -25,8 +25,29 @@ namespace cpu
 namespace operand
 {
 
+size_t Tensor::total_size() const
+{
+  if (_layout == ir::Layout::NCHWc)
+  {
+    const auto blocks = (dimension(3) + ir::NCHWC_BLOCK - 1) / ir::NCHWC_BLOCK;
+    return dimension(0) * blocks * dimension(1) * dimension(2) * ir::NCHWC_BLOCK *
+           sizeOfDataType(data_type());
+  }
+  return _info.total_size();
+}
+
 size_t Tensor::calcOffset(const ir::Coordinates &coords) const
 {
+  if (_layout == ir::Layout::NCHWc)
+  {
+    // [N, C/block, H, W, block]
+    const auto blocks = (dimension(3) + ir::NCHWC_BLOCK - 1) / ir::NCHWC_BLOCK;
+    size_t offset = coords[0] * blocks + coords[3] / ir::NCHWC_BLOCK;
+    offset = (offset * dimension(1) + coords[1]) * dimension(2) + coords[2];
+    offset = offset * ir::NCHWC_BLOCK + coords[3] % ir::NCHWC_BLOCK;
+    return offset * sizeOfDataType(data_type());
+  }
+
   size_t rank = num_dimensions();
   rank = rank == 0 ? 1 : rank;
   size_t offset = 0;
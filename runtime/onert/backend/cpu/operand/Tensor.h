@@ -37,10 +37,16 @@ public:
   Tensor() = delete;
 
 public:
-  Tensor(const ir::OperandInfo &info)
-      : _info(info), _buffer(nullptr), _num_references(0), _allocator(nullptr)
+  /**
+   * @brief Construct a tensor of 'info' stored in 'layout'
+   * @note  Tensors of ir::Layout::NCHWc must be of rank 4, whose channels are padded to blocks
+   */
+  Tensor(const ir::OperandInfo &info, ir::Layout layout = ir::Layout::NHWC)
+      : _info(info), _layout(layout), _buffer(nullptr), _num_references(0), _allocator(nullptr),
+        _offset(0), _is_constant(false)
   {
-    // DO NOTHING
+    assert(_layout == ir::Layout::NHWC ||
+           (_layout == ir::Layout::NCHWc && _info.shape().rank() == 4));
   }
 
 public:
@@ -50,17 +56,22 @@ public:
     assert(_buffer == nullptr && _allocator == nullptr);
     _buffer = buffer;
   }
-  void setBuffer(const std::shared_ptr<cpu_common::Allocator> &alloc)
+  /**
+   * @brief Set buffer at 'offset' of memory of 'alloc', which is read on every access as the
+   *        memory may be replaced, e.g. of an arena shared by sessions
+   */
+  void setBuffer(const std::shared_ptr<cpu_common::Allocator> &alloc, size_t offset = 0)
   {
     assert(_buffer == nullptr && _allocator == nullptr);
     _allocator = alloc;
+    _offset = offset;
   }
 
 public:
   uint8_t *buffer() const override
   {
     if (_allocator != nullptr)
-      return _allocator->base();
+      return _allocator->base() + _offset;
     else
       return _buffer;
   }
@@ -76,16 +87,22 @@ public:
    */
   size_t dimension(size_t index) const override { return _info.shape().dim(index); }
   size_t num_dimensions() const override { return _info.shape().rank(); }
-  size_t total_size() const override { return _info.total_size(); }
+  size_t total_size() const override;
   size_t calcOffset(const ir::Coordinates &coords) const override;
-  ir::Layout layout() const override { return ir::Layout::NHWC; }
+  ir::Layout layout() const override { return _layout; }
   ir::DataType data_type() const override { return _info.typeInfo().type(); }
   float data_scale() const { return _info.typeInfo().scale(); }
   int32_t data_offset() const { return _info.typeInfo().offset(); }
+  const std::vector<float> &data_scales() const { return _info.typeInfo().scales(); }
   bool has_padding() const override { return false; }
   void access(const std::function<void(ITensor &tensor)> &fn) final;
   bool is_dynamic() const override { return _info.isDynamic(); }
   void set_dynamic() override { _info.setDynamic(); }
+  /**
+   * @brief Whether the tensor holds constant data, which is initialized before the first run
+   */
+  bool is_constant() const { return _is_constant; }
+  void set_constant() { _is_constant = true; }
 
   void increase_ref()
   {
@@ -100,14 +117,15 @@ public:
     assert(_buffer != nullptr || _allocator != nullptr);
     assert(_num_references > 0);
     --_num_references;
-    // Only constant tensor has allocator pointer
     if (_num_references == 0)
     {
       if (_buffer != nullptr)
         _buffer = nullptr;
       else
       {
-        _allocator->release();
+        // Non-constant tensor with allocator pointer is in an arena, which others use as well
+        if (_is_constant)
+          _allocator->release();
         _allocator = nullptr;
       }
     }
@@ -133,9 +151,12 @@ public:
 
 private:
   ir::OperandInfo _info;
+  ir::Layout _layout;
   uint8_t *_buffer;
   int32_t _num_references;
   std::shared_ptr<cpu_common::Allocator> _allocator;
+  size_t _offset;
+  bool _is_constant;
 };
 
 } // namespace operand
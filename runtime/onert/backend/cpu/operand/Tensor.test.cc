@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "Tensor.h"
+
+using namespace onert;
+using namespace onert::backend::cpu::operand;
+
+namespace
+{
+
+ir::OperandInfo floatInfo(const ir::Shape &shape)
+{
+  return ir::OperandInfo::createStaticInfo(shape, ir::TypeInfo{ir::DataType::FLOAT32});
+}
+
+} // namespace
+
+TEST(Tensor, nhwc_offset)
+{
+  Tensor tensor{floatInfo(ir::Shape{2, 3, 4, 11})};
+
+  EXPECT_EQ(tensor.total_size(), 2 * 3 * 4 * 11 * sizeof(float));
+  EXPECT_EQ(tensor.calcOffset({0, 0, 0, 0}), 0u);
+  EXPECT_EQ(tensor.calcOffset({1, 2, 3, 10}), (((1 * 3 + 2) * 4 + 3) * 11 + 10) * sizeof(float));
+}
+
+TEST(Tensor, nchwc_offset)
+{
+  // 11 channels are stored in 2 blocks, whose last one has 5 channels of padding
+  Tensor tensor{floatInfo(ir::Shape{2, 3, 4, 11}), ir::Layout::NCHWc};
+  ASSERT_EQ(ir::NCHWC_BLOCK, 8);
+
+  EXPECT_EQ(tensor.total_size(), 2 * 2 * 3 * 4 * 8 * sizeof(float));
+  EXPECT_EQ(tensor.calcOffset({0, 0, 0, 0}), 0u);
+  // Channels of a block are contiguous
+  EXPECT_EQ(tensor.calcOffset({0, 0, 0, 7}), 7 * sizeof(float));
+  // Next block starts after all the pixels of the previous one
+  EXPECT_EQ(tensor.calcOffset({0, 0, 0, 8}), 3 * 4 * 8 * sizeof(float));
+  EXPECT_EQ(tensor.calcOffset({0, 0, 1, 0}), 8 * sizeof(float));
+  EXPECT_EQ(tensor.calcOffset({0, 1, 0, 0}), 4 * 8 * sizeof(float));
+  // [N, C/8, H, W, 8] of the last element
+  EXPECT_EQ(tensor.calcOffset({1, 2, 3, 10}),
+            ((((1 * 2 + 1) * 3 + 2) * 4 + 3) * 8 + 2) * sizeof(float));
+}
+
+TEST(Tensor, nchwc_offset_channels)
+{
+  // Fewer channels than a block still take a whole block
+  Tensor small{floatInfo(ir::Shape{1, 2, 2, 3}), ir::Layout::NCHWc};
+  EXPECT_EQ(small.total_size(), 1 * 1 * 2 * 2 * 8 * sizeof(float));
+  EXPECT_EQ(small.calcOffset({0, 1, 1, 2}), ((1 * 2 + 1) * 8 + 2) * sizeof(float));
+
+  // Multiple of block has no padding
+  Tensor exact{floatInfo(ir::Shape{1, 2, 2, 16}), ir::Layout::NCHWc};
+  EXPECT_EQ(exact.total_size(), 1 * 2 * 2 * 16 * sizeof(float));
+  EXPECT_EQ(exact.calcOffset({0, 1, 1, 15}), (((1 * 2 + 1) * 2 + 1) * 8 + 7) * sizeof(float));
+
+  // Size of element is applied to offsets
+  Tensor quant{ir::OperandInfo::createStaticInfo(ir::Shape{1, 2, 2, 9},
+                                                 ir::TypeInfo{ir::DataType::QUANT8_ASYMM}),
+               ir::Layout::NCHWc};
+  EXPECT_EQ(quant.total_size(), 1 * 2 * 2 * 2 * 8u);
+  EXPECT_EQ(quant.calcOffset({0, 0, 1, 8}), (2 * 2 + 1) * 8u);
+}
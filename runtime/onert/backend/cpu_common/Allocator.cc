@@ -25,9 +25,11 @@ namespace backend
 namespace cpu_common
 {
 
-Allocator::Allocator(uint32_t capacity)
+Allocator::Allocator(uint32_t capacity) { reallocate(capacity); }
+
+void Allocator::reallocate(uint32_t capacity)
 {
-  _base = std::make_unique<uint8_t[]>(capacity);
+  _base.reset(new uint8_t[capacity](), std::default_delete<uint8_t[]>());
 
   VERBOSE(ALLOC) << "allocation capacity: " << capacity << std::endl;
   VERBOSE(ALLOC) << "base pointer: " << static_cast<void *>(_base.get()) << std::endl;
@@ -45,8 +45,21 @@ public:
   uint8_t *base() const { return _base.get(); }
   void release() { _base.reset(); }
 
+  /**
+   * @brief Get the memory to share it with other allocators
+   */
+  const std::shared_ptr<uint8_t> &memory() const { return _base; }
+  /**
+   * @brief Replace the memory with 'memory', which is released when no allocator refers to it
+   */
+  void replace(const std::shared_ptr<uint8_t> &memory) { _base = memory; }
+  /**
+   * @brief Replace the memory with new one of 'capacity' bytes, which does not keep contents
+   */
+  void reallocate(uint32_t capacity);
+
 private:
-  std::unique_ptr<uint8_t[]> _base;
+  std::shared_ptr<uint8_t> _base;
 };
 
 } // namespace cpu_common
@@ -39,6 +39,12 @@ MemoryManager::MemoryManager(const std::string planner_id)
   // DO NOTHING
 }
 
+MemoryManager::MemoryManager(const std::shared_ptr<SharedMemory> &shared_memory)
+    : _mem_planner{createMemoryPlanner()}, _shared_memory{shared_memory}
+{
+  // DO NOTHING
+}
+
 cpu_common::IMemoryPlanner *MemoryManager::createMemoryPlanner()
 {
   auto planner_id = util::getConfigString(util::config::CPU_MEMORY_PLANNER);
@@ -59,8 +65,12 @@ void MemoryManager::releasePlan(const ir::OperandIndex &ind) { _mem_planner->rel
 
 void MemoryManager::allocate(void)
 {
-  _mem_alloc = std::make_shared<cpu_common::Allocator>(_mem_planner->capacity());
+  if (_shared_memory)
+    _mem_alloc = _shared_memory->arena(_mem_planner->capacity());
+  else
+    _mem_alloc = std::make_shared<cpu_common::Allocator>(_mem_planner->capacity());
   assert(_mem_alloc->base());
+  _allocated_bytes.store(_mem_planner->capacity(), std::memory_order_relaxed);
 }
 
 uint8_t *MemoryManager::getBuffer(const ir::OperandIndex &ind) const
@@ -70,11 +80,18 @@ uint8_t *MemoryManager::getBuffer(const ir::OperandIndex &ind) const
   return _mem_alloc->base() + mem_blk.offset;
 }
 
+uint32_t MemoryManager::getOffset(const ir::OperandIndex &ind) const
+{
+  assert(_mem_planner->memory_plans().find(ind) != _mem_planner->memory_plans().end());
+  return _mem_planner->memory_plans().at(ind).offset;
+}
+
 std::shared_ptr<cpu_common::Allocator> DynamicMemoryManager::allocate(const ir::OperandIndex &ind,
                                                                       uint32_t capacity)
 {
   auto mem_alloc = std::make_shared<cpu_common::Allocator>(capacity);
   _mem_alloc_map[ind] = mem_alloc;
+  _allocated_bytes.fetch_add(capacity, std::memory_order_relaxed);
   return mem_alloc;
 }
 
@@ -96,6 +113,15 @@ void DynamicMemoryManager::deallocate(void)
   }
 }
 
+std::shared_ptr<cpu_common::Allocator>
+DynamicMemoryManager::allocator(const ir::OperandIndex &ind) const
+{
+  auto find = _mem_alloc_map.find(ind);
+  if (find == _mem_alloc_map.end())
+    return nullptr;
+  return find->second;
+}
+
 } // namespace cpu_common
 } // namespace backend
 } // namespace onert
@@ -19,8 +19,11 @@
 
 #include "backend/IMemoryManager.h"
 #include "MemoryPlanner.h"
+#include "SharedMemory.h"
 #include "ir/OperandIndexMap.h"
 
+#include <atomic>
+
 namespace onert
 {
 namespace backend
@@ -33,15 +36,41 @@ class MemoryManager : public backend::IMemoryManager
 public:
   MemoryManager();
   MemoryManager(const std::string);
+  /**
+   * @brief Construct a MemoryManager which places tensors in the arena of 'shared_memory'
+   */
+  MemoryManager(const std::shared_ptr<SharedMemory> &shared_memory);
   virtual ~MemoryManager() = default;
 
   void allocate(void) override;
   uint8_t *getBuffer(const ir::OperandIndex &ind) const;
-  void deallocate(void) override { _mem_alloc->release(); }
+  void deallocate(void) override
+  {
+    // Memory of the shared arena is released when no session uses it
+    if (_shared_memory)
+      _mem_alloc.reset();
+    else
+      _mem_alloc->release();
+    _allocated_bytes.store(0, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Whether tensors are placed in an arena shared with other sessions
+   *        Memory of such arena can be replaced, so tensors must be bound to allocator() with
+   *        getOffset() rather than getBuffer().
+   */
+  bool isShared() const { return _shared_memory != nullptr; }
+  const std::shared_ptr<cpu_common::Allocator> &allocator() const { return _mem_alloc; }
+  uint32_t getOffset(const ir::OperandIndex &ind) const;
 
   void claimPlan(const ir::OperandIndex &ind, uint32_t size);
   void releasePlan(const ir::OperandIndex &ind);
 
+  /**
+   * @brief Get bytes of the currently allocated memory block
+   */
+  uint64_t allocatedBytes() const { return _allocated_bytes.load(std::memory_order_relaxed); }
+
 private:
   cpu_common::IMemoryPlanner *createMemoryPlanner();
   cpu_common::IMemoryPlanner *createMemoryPlanner(const std::string);
@@ -50,6 +79,8 @@ private:
   ir::OperandIndexMap<cpu_common::Block> _tensor_mem_map;
   std::shared_ptr<cpu_common::IMemoryPlanner> _mem_planner;
   std::shared_ptr<cpu_common::Allocator> _mem_alloc;
+  std::shared_ptr<SharedMemory> _shared_memory;
+  std::atomic<uint64_t> _allocated_bytes{0};
 };
 
 class DynamicMemoryManager
@@ -61,9 +92,19 @@ public:
   std::shared_ptr<cpu_common::Allocator> allocate(const ir::OperandIndex &ind, uint32_t capacity);
   void deallocate(const ir::OperandIndex &ind);
   void deallocate(void);
+  /**
+   * @brief Get the allocator for 'ind', or nullptr if there is none
+   */
+  std::shared_ptr<cpu_common::Allocator> allocator(const ir::OperandIndex &ind) const;
+
+  /**
+   * @brief Get bytes allocated so far, including deallocated ones
+   */
+  uint64_t allocatedBytes() const { return _allocated_bytes.load(std::memory_order_relaxed); }
 
 private:
   ir::OperandIndexMap<std::shared_ptr<cpu_common::Allocator>> _mem_alloc_map;
+  std::atomic<uint64_t> _allocated_bytes{0};
 };
 
 } // namespace cpu_common
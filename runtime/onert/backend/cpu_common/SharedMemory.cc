@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SharedMemory.h"
+
+#include "util/logging.h"
+
+#include <cstring>
+
+namespace
+{
+
+// Hash of bytes, which reads 8 bytes at a time as constants can be large
+uint64_t hashBytes(const uint8_t *data, uint32_t size)
+{
+  constexpr uint64_t kPrime = 0x100000001b3ULL;
+  uint64_t hash = 0xcbf29ce484222325ULL ^ size;
+
+  uint32_t i = 0;
+  for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+  {
+    uint64_t word;
+    std::memcpy(&word, data + i, sizeof(word));
+    hash = (hash ^ word) * kPrime;
+    hash ^= hash >> 29;
+  }
+  for (; i < size; ++i)
+  {
+    hash = (hash ^ data[i]) * kPrime;
+  }
+  return hash;
+}
+
+} // namespace
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu_common
+{
+
+std::shared_ptr<Allocator> SharedMemory::arena(uint32_t capacity)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  if (!_arena)
+  {
+    _arena = std::make_shared<Allocator>(capacity);
+    _arena_capacity = capacity;
+  }
+  else if (capacity > _arena_capacity)
+  {
+    _arena->reallocate(capacity);
+    _arena_capacity = capacity;
+  }
+  return _arena;
+}
+
+bool SharedMemory::shareConstant(Allocator &alloc, uint32_t size)
+{
+  if (alloc.base() == nullptr || size == 0)
+    return false;
+
+  const auto hash = hashBytes(alloc.base(), size);
+
+  std::lock_guard<std::mutex> lock{_mutex};
+  auto range = _constants.equal_range(hash);
+  for (auto it = range.first; it != range.second;)
+  {
+    auto memory = it->second.memory.lock();
+    if (!memory)
+    {
+      // Sessions having it are closed
+      it = _constants.erase(it);
+      continue;
+    }
+    if (it->second.size == size && std::memcmp(memory.get(), alloc.base(), size) == 0)
+    {
+      if (memory == alloc.memory())
+        return false;
+
+      alloc.replace(memory);
+      _saved_bytes += size;
+      VERBOSE(SharedMemory) << "Share constant of " << size << " bytes" << std::endl;
+      return true;
+    }
+    ++it;
+  }
+
+  _constants.emplace(hash, Constant{alloc.memory(), size});
+  return false;
+}
+
+uint64_t SharedMemory::savedBytes() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _saved_bytes;
+}
+
+} // namespace cpu_common
+} // namespace backend
+} // namespace onert
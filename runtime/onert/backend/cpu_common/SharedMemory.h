@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  SharedMemory.h
+ * @brief This file contains SharedMemory class for memory of tensors shared by sessions
+ */
+
+#ifndef __ONERT_BACKEND_CPU_COMMON_SHARED_MEMORY_H__
+#define __ONERT_BACKEND_CPU_COMMON_SHARED_MEMORY_H__
+
+#include "Allocator.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu_common
+{
+
+/**
+ * @brief Memory of tensors shared by sessions of a backend::SharedContext, which run one at a
+ *        time
+ *
+ * - Non-constant tensors of all the sessions are placed in one arena, which is as large as the
+ *   largest plan among them. Its data is valid only during a run.
+ * - Constants of the same content, e.g. weights of a backbone that models share, are kept once.
+ */
+class SharedMemory
+{
+public:
+  /**
+   * @brief Get the arena, after growing it to hold at least 'capacity' bytes
+   * @note  Memory of the arena is replaced when it grows, so users must get base() of the
+   *        allocator whenever they access the memory
+   */
+  std::shared_ptr<Allocator> arena(uint32_t capacity);
+
+  /**
+   * @brief Let 'alloc' share memory with a constant of the same content, if there is
+   *        Otherwise its memory is registered to be shared with others.
+   * @param[in] size Bytes of the constant in 'alloc'
+   * @return @c true if memory of 'alloc' is replaced with the shared one
+   */
+  bool shareConstant(Allocator &alloc, uint32_t size);
+
+  /**
+   * @brief Get bytes of constants that are not allocated by sharing, so far
+   */
+  uint64_t savedBytes() const;
+
+private:
+  struct Constant
+  {
+    std::weak_ptr<uint8_t> memory;
+    uint32_t size;
+  };
+
+private:
+  mutable std::mutex _mutex;
+  std::shared_ptr<Allocator> _arena;
+  uint32_t _arena_capacity = 0;
+  std::unordered_multimap<uint64_t, Constant> _constants;
+  uint64_t _saved_bytes = 0;
+};
+
+} // namespace cpu_common
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_COMMON_SHARED_MEMORY_H__
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "SharedMemory.h"
+
+#include <cstring>
+
+using namespace onert::backend::cpu_common;
+
+TEST(SharedMemory, arena_grow)
+{
+  SharedMemory shared;
+
+  auto arena = shared.arena(64);
+  ASSERT_NE(arena->base(), nullptr);
+
+  // Smaller requests reuse the arena as it is
+  const auto *base = arena->base();
+  ASSERT_EQ(shared.arena(32), arena);
+  ASSERT_EQ(arena->base(), base);
+
+  // Growth keeps the allocator, so that users of it see the new memory
+  ASSERT_EQ(shared.arena(1024), arena);
+  ASSERT_NE(arena->base(), nullptr);
+}
+
+TEST(SharedMemory, share_constant)
+{
+  SharedMemory shared;
+
+  const float data[] = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f};
+  const float other[] = {1.0f, 2.0f, 3.0f, 4.0f, 6.0f};
+  Allocator first(sizeof(data));
+  Allocator second(sizeof(data));
+  Allocator third(sizeof(other));
+  std::memcpy(first.base(), data, sizeof(data));
+  std::memcpy(second.base(), data, sizeof(data));
+  std::memcpy(third.base(), other, sizeof(other));
+
+  ASSERT_FALSE(shared.shareConstant(first, sizeof(data)));
+  ASSERT_TRUE(shared.shareConstant(second, sizeof(data)));
+  ASSERT_FALSE(shared.shareConstant(third, sizeof(other)));
+  ASSERT_EQ(second.base(), first.base());
+  ASSERT_NE(third.base(), first.base());
+  ASSERT_EQ(shared.savedBytes(), sizeof(data));
+
+  // Sharing again the same memory saves nothing
+  ASSERT_FALSE(shared.shareConstant(second, sizeof(data)));
+  ASSERT_EQ(shared.savedBytes(), sizeof(data));
+
+  // Memory outlives the allocator which registered it
+  first.release();
+  ASSERT_EQ(std::memcmp(second.base(), data, sizeof(data)), 0);
+}
@@ -19,6 +19,7 @@
 
 #include "ir/Layout.h"
 #include "ir/Operation.h"
+#include "ir/Operands.h"
 #include "util/ITimer.h"
 
 #include <memory>
@@ -38,12 +39,25 @@ struct IConfig
   // Support permute kernel
   virtual bool supportPermutation() = 0;
   virtual ir::Layout supportLayout(const ir::Operation &node, ir::Layout frontend_layout) = 0;
+  // Layout for 'node' that may depend on its operands, e.g. their data types or shapes
+  virtual ir::Layout supportLayout(const ir::Operation &node, const ir::Operands &,
+                                   ir::Layout frontend_layout)
+  {
+    return supportLayout(node, frontend_layout);
+  }
 
   virtual bool supportDynamicTensor() = 0;
   virtual bool supportFP16() = 0;
+  // Whether the backend has a kernel for the operation. Unless OP_BACKEND_ALLOPS is given, each
+  // operation is assigned to the first backend in BACKENDS that supports it.
+  virtual bool supportOperation(const ir::Operation &, const ir::Operands &) { return true; }
 
   // Timer is used for backend profiling. In case of default (nullptr) timer profiler won't work.
   virtual std::unique_ptr<util::ITimer> timer() { return nullptr; }
+
+  // Limit number of threads that kernels run by the calling thread use, -1 for the default.
+  // Executors call this right before running kernels so as not to oversubscribe cores.
+  virtual void setIntraOpThreads(int) {}
 };
 
 } // namespace backend
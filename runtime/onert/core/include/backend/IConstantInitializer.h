@@ -222,6 +222,7 @@ public:
         _init_map[index] = copyInit<uint8_t>;
         break;
       case DataType::QUANT8_SYMM:
+      case DataType::QUANT8_ASYMM_SIGNED:
         _init_map[index] = copyInit<int8_t>;
         break;
       case DataType::FLOAT16:
@@ -262,6 +263,7 @@ public:
         _init_map[index] = std::bind(permuteInit<uint8_t>, _1, _2, _current_op_seq_layout);
         break;
       case DataType::QUANT8_SYMM:
+      case DataType::QUANT8_ASYMM_SIGNED:
         _init_map[index] = std::bind(permuteInit<int8_t>, _1, _2, _current_op_seq_layout);
         break;
       case DataType::FLOAT16:
@@ -19,6 +19,7 @@
 
 #include <memory>
 #include <functional>
+#include <stdexcept>
 
 #include "ir/LowerInfoMap.h"
 #include "ITensorBuilder.h"
@@ -31,16 +32,25 @@ namespace onert
 namespace backend
 {
 
+/**
+ * @brief Exception thrown by ShapeFixer for operations that the backend does not support
+ */
+class NotSupportedError : public std::runtime_error
+{
+public:
+  using std::runtime_error::runtime_error;
+};
+
 class IShapeFixer : public ir::OperationVisitor
 {
 public:
   virtual ~IShapeFixer() = default;
 
 protected:
-#define OP(InternalName)                                                           \
-  void visit(const ir::operation::InternalName &) override                         \
-  {                                                                                \
-    throw std::runtime_error("ShapeFixer: NYI for operation '" #InternalName "'"); \
+#define OP(InternalName)                                                          \
+  void visit(const ir::operation::InternalName &) override                        \
+  {                                                                               \
+    throw NotSupportedError("ShapeFixer: NYI for operation '" #InternalName "'"); \
   }
 #include "ir/Operations.lst"
 #undef OP
@@ -90,6 +90,11 @@ struct ITensorBuilder
    *        called.
    */
   virtual void postFunctionPrepare() = 0;
+  /**
+   * @brief Some actions after all the functions' @c IFunction::prepare methods.
+   *        This is called once after the last function's @c postFunctionPrepare.
+   */
+  virtual void postAllFunctionsPrepare() = 0;
 
   /**
    * @brief Get the tensor object
@@ -17,6 +17,8 @@
 #ifndef __ONERT_BACKEND_ITENSOR_MANAGER_H__
 #define __ONERT_BACKEND_ITENSOR_MANAGER_H__
 
+#include <cstdint>
+
 namespace onert
 {
 namespace backend
@@ -30,7 +32,25 @@ namespace backend
  */
 struct ITensorManager
 {
+  /**
+   * @brief Memory usage of a tensor manager
+   */
+  struct MemoryStats
+  {
+    /// @brief Bytes of the planned memory block for static tensors
+    uint64_t arena_bytes = 0;
+    /// @brief Bytes allocated for dynamic tensors so far (cumulative)
+    uint64_t dynamic_alloc_bytes = 0;
+  };
+
   virtual ~ITensorManager() = default;
+
+  /**
+   * @brief  Get memory usage of this tensor manager
+   * @note   This may be called from other threads while executing, so implementations should read
+   *         only lock-free counters
+   */
+  virtual MemoryStats memoryStats() const { return MemoryStats{}; }
 };
 
 } // namespace backend
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_SHARED_CONTEXT_H__
+#define __ONERT_BACKEND_SHARED_CONTEXT_H__
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace onert
+{
+namespace backend
+{
+
+class Backend;
+
+/**
+ * @brief Context shared by sessions which run one at a time, e.g. models of a pipeline
+ *
+ * Backends keep resources that such sessions can share in it, like memory for tensors. Each
+ * backend defines its own object, which is created on the first request and lives as long as
+ * the context.
+ */
+class SharedContext
+{
+public:
+  /**
+   * @brief Get the object of type T for 'backend', or create it if there is none
+   * @note  The same type must be used for a backend
+   */
+  template <typename T> std::shared_ptr<T> get(const Backend *backend)
+  {
+    std::lock_guard<std::mutex> lock{_objects_mutex};
+    auto &object = _objects[backend];
+    if (!object)
+    {
+      object = std::make_shared<T>();
+    }
+    return std::static_pointer_cast<T>(object);
+  }
+
+  /**
+   * @brief Mutex that sessions hold while they are prepared or run, as they share resources
+   */
+  std::mutex &mutex() { return _mutex; }
+
+private:
+  std::mutex _mutex;
+  std::mutex _objects_mutex;
+  std::unordered_map<const Backend *, std::shared_ptr<void>> _objects;
+};
+
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_SHARED_CONTEXT_H__
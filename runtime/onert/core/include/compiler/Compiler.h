@@ -28,6 +28,16 @@
 namespace onert
 {
 
+namespace exec
+{
+class ExecTime;
+} // namespace exec
+
+namespace util
+{
+class MemoryProfiler;
+} // namespace util
+
 namespace compiler
 {
 
@@ -50,15 +60,28 @@ struct CompilerOptions
   std::vector<std::string> backend_list;
 
   // OPTIONS ONLY FOR DEBUGGING/PROFILING
-  std::string trace_filepath; //< File path to save trace records
-  int graph_dump_level;       //< Graph dump level, values between 0 and 2 are valid
-  int op_seq_max_node;        //< Number of nodes that can be
-  std::string executor;       //< Executor name to use
+  std::string trace_filepath;          //< File path to save trace records
+  std::string kernel_profile_filepath; //< File path to save per-kernel profile records
+  int graph_dump_level;                //< Graph dump level, values between 0 and 2 are valid
+  int op_seq_max_node;                 //< Number of nodes that can be
+  std::string executor;                //< Executor name to use
+  int parallel_workers;                //< Worker threads per backend for Parallel executor
+  int parallel_cores;                  //< Number of cores shared by jobs of Parallel executor
   ManualSchedulerOptions manual_scheduler_options; //< Options for ManualScheduler
   bool he_scheduler;      //< HEScheduler if true, ManualScheduler otherwise
   bool he_profiling_mode; //< Whether HEScheduler profiling mode ON/OFF
   bool disable_compile;   //< Run with Interpreter if true, try compilation otherwise
   bool fp16_enable;       //< Whether fp16 mode ON/OFF
+
+  // OPTIONS FOR ADAPTIVE HESCHEDULER
+  bool he_adaptive;         //< Whether HEScheduler reschedules with timings sampled at runtime
+  int he_adaptive_period;   //< Number of runs between reschedulings
+  int he_adaptive_sampling; //< Measure one of this number of runs
+  // Measurements shared by HEScheduler and executors, nullptr to load them from file
+  std::shared_ptr<exec::ExecTime> he_exec_time;
+
+  // Heap usage profiler owned by the session, nullptr if disabled
+  std::shared_ptr<util::MemoryProfiler> memory_profiler;
 };
 
 CompilerOptions fetchCompilerOptionsFromGlobalConfig(const ir::Subgraphs &subgs);
@@ -106,6 +129,7 @@ public:
 
 private:
   void checkProfilerConditions();
+  void checkAdaptiveConditions();
   std::shared_ptr<ir::Graph> &primary_subgraph() { return _subgraphs->at(ir::SubgraphIndex{0}); }
 
 private:
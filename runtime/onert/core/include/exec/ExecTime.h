@@ -23,6 +23,7 @@
 #include <memory>
 #include <limits>
 #include <map>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -55,6 +56,7 @@ public:
   /**
    * @brief Update exec time of the operation on a backend with given input size or
    *        add new entity if there is no one.
+   *        Existing record is blended with the new measurement by exponential decay.
    *
    * @param[in] backend id of a backend
    * @param[in] operation name of an operation
@@ -86,6 +88,11 @@ public:
    */
   void updatePermuteTime(const backend::Backend *from_backend, const backend::Backend *to_backend,
                          bool quant, uint32_t op_size, int64_t time);
+  /**
+   * @brief     Set weight of the existing record when it is updated with a new measurement
+   * @param[in] decay Weight in [0, 1), 0.5 by default. Lower value adapts faster to changes.
+   */
+  void setDecay(double decay) { _decay = decay; }
   /**
    * @brief Get the max value of int32_t in int64_t
    * @return max value
@@ -94,12 +101,19 @@ public:
   /**
    * @brief Update metrics file with new data.
    */
-  void uploadOperationsExecTime() const { _json.uploadOperationsExecTime(); }
+  void uploadOperationsExecTime() const
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _json.uploadOperationsExecTime();
+  }
   static const int64_t NOT_FOUND = -1;
 
 private:
   /// @brief Measurement data, which is shared with serializer
   MeasurementData _measurements;
+  // Measurements can be updated by executors while a scheduler reads them
+  mutable std::mutex _mutex;
+  double _decay = 0.5;
   // int64_t::max may cause integer overflow
   static const int64_t _MAX = std::numeric_limits<int32_t>::max();
   /// @brief Serializer
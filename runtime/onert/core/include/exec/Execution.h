@@ -139,6 +139,14 @@ public:
    */
   bool isFinished(void) const;
 
+  /**
+   * @brief     Get runtime metrics of this execution
+   * @param[out] snapshot Metrics to be filled
+   * @note      Run statistics come from the primary subgraph only, while memory and permutation
+   *            statistics are summed up over all subgraphs
+   */
+  void collectMetrics(RuntimeMetricsSnapshot &snapshot) const;
+
 private:
   const std::unique_ptr<IExecutor> &primary_executor() const
   {
@@ -20,11 +20,17 @@
 #include "exec/IFunction.h"
 #include "ir/OpSequence.h"
 #include "ExecTime.h"
+#include "KernelProfiler.h"
 #include "util/ITimer.h"
+#include "util/MemoryProfiler.h"
 #include "IExecutor.h"
 #include "misc/EventCollector.h"
 #include "misc/EventRecorder.h"
 
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+
 namespace onert
 {
 namespace exec
@@ -58,6 +64,35 @@ private:
   std::shared_ptr<ExecTime> _et;
 };
 
+/**
+ * @brief Observer that feeds execution time of every operation into ExecTime
+ *        on one of @c sampling_period runs
+ *
+ * Unlike ProfileObserver it can be attached to any executor, even the one running operations
+ * in parallel, because it measures wall time of each OpSequence by itself.
+ *
+ * @note  This assumes there is just one operation in an OpSequence
+ */
+class SampledProfileObserver : public IExecutionObserver
+{
+public:
+  SampledProfileObserver(std::shared_ptr<ExecTime> et, uint32_t sampling_period)
+      : _et{std::move(et)}, _sampling_period{sampling_period}
+  {
+  }
+  void handleBegin(IExecutor *) override;
+  void handleBegin(IExecutor *, const ir::OpSequence *, const backend::Backend *) override;
+  void handleEnd(IExecutor *, const ir::OpSequence *, const backend::Backend *) override;
+
+private:
+  std::shared_ptr<ExecTime> _et;
+  uint32_t _sampling_period;
+  uint32_t _run_count{0};
+  bool _sampling{false};
+  std::mutex _mutex;
+  std::unordered_map<const ir::OpSequence *, std::chrono::steady_clock::time_point> _begin;
+};
+
 class ChromeTracingObserver : public IExecutionObserver
 {
 public:
@@ -77,6 +112,49 @@ private:
   EventCollector _collector;
 };
 
+/**
+ * @brief Observer that marks model execution boundaries of KernelProfiler and writes its records
+ *        as Chrome trace and as summary table when destroyed
+ *
+ * @note  Per-kernel time is recorded by ProfiledFunction, not by this observer
+ */
+class KernelProfileObserver : public IExecutionObserver
+{
+public:
+  KernelProfileObserver(const std::string &filepath, std::shared_ptr<KernelProfiler> profiler);
+  ~KernelProfileObserver();
+  void handleBegin(IExecutor *) override { _profiler->beginRun(); }
+  void handleBegin(IExecutor *, const ir::OpSequence *, const backend::Backend *) override {}
+  void handleEnd(IExecutor *, const ir::OpSequence *, const backend::Backend *) override {}
+  void handleEnd(IExecutor *) override { _profiler->endRun(); }
+
+private:
+  std::string _filepath;
+  std::shared_ptr<KernelProfiler> _profiler;
+};
+
+/**
+ * @brief Observer that marks model executions as scopes of MemoryProfiler
+ *
+ * @note  Heap usage of each kernel is recorded by MemoryProfiledFunction, not by this observer
+ */
+class MemoryProfileObserver : public IExecutionObserver
+{
+public:
+  MemoryProfileObserver(std::shared_ptr<util::MemoryProfiler> profiler)
+      : _profiler{std::move(profiler)}, _id{_profiler->registerPhase("run")}
+  {
+  }
+  void handleBegin(IExecutor *) override { _profiler->begin(_id); }
+  void handleBegin(IExecutor *, const ir::OpSequence *, const backend::Backend *) override {}
+  void handleEnd(IExecutor *, const ir::OpSequence *, const backend::Backend *) override {}
+  void handleEnd(IExecutor *) override { _profiler->end(_id); }
+
+private:
+  std::shared_ptr<util::MemoryProfiler> _profiler;
+  util::MemoryProfiler::ScopeId _id;
+};
+
 } // namespace exec
 } // namespace onert
 
@@ -64,6 +64,15 @@ public:
 
   void iterate(const std::function<void(IFunction &)> &fn);
 
+  /**
+   * @brief Replace each IFunction object with the one returned by @c fn, e.g. its decorator
+   *
+   * @param fn Function that takes the ownership of an IFunction object and returns new one
+   */
+  void wrap(const std::function<std::unique_ptr<IFunction>(std::unique_ptr<IFunction> &&)> &fn);
+
+  size_t size() const { return _functions.size(); }
+
 protected:
   std::vector<std::unique_ptr<IFunction>> _functions;
 };
@@ -24,6 +24,7 @@
 #include "ir/Graph.h"
 #include "IFunction.h"
 #include "IODescription.h"
+#include "RuntimeMetrics.h"
 #include "ir/OperationIndexMap.h"
 
 namespace onert
@@ -72,6 +73,13 @@ struct IExecutor
    * @note      This method should be thread-safe
    */
   virtual void execute(const IODescription &desc) = 0;
+
+  /**
+   * @brief     Accumulate runtime metrics of this executor
+   * @param[in,out] snapshot Snapshot to which metrics are added
+   * @note      This method should be thread-safe
+   */
+  virtual void collectMetrics(RuntimeMetricsSnapshot &) const {}
 };
 
 using ExecutorMap = std::unordered_map<ir::SubgraphIndex, std::unique_ptr<IExecutor>>;
@@ -26,6 +26,8 @@
 #include <typeinfo>
 #include "util/feature/nchw/Reader.h"
 #include "util/feature/nchw/View.h"
+#include "util/feature/nchwc/Reader.h"
+#include "util/feature/nchwc/View.h"
 #include "util/feature/nhwc/Reader.h"
 #include "util/feature/nhwc/View.h"
 #include "util/Utils.h"
@@ -43,6 +45,10 @@ private:
   {
     NHWC_TO_NCHW,
     NCHW_TO_NHWC,
+    NHWC_TO_NCHWC,
+    NCHWC_TO_NHWC,
+    NCHW_TO_NCHWC,
+    NCHWC_TO_NCHW,
     COPY
   };
 
@@ -81,6 +87,7 @@ public:
             permute<uint8_t>(src_tensor, dst_tensor, *rank_it);
             break;
           case ir::DataType::QUANT8_SYMM:
+          case ir::DataType::QUANT8_ASYMM_SIGNED:
             permute<int8_t>(src_tensor, dst_tensor, *rank_it);
             break;
           default:
@@ -119,6 +126,16 @@ private:
       {
         return PermuteType::NCHW_TO_NHWC;
       }
+      else if (src->layout() != ir::Layout::NCHWc && dst->layout() == ir::Layout::NCHWc)
+      {
+        return src->layout() == ir::Layout::NCHW ? PermuteType::NCHW_TO_NCHWC
+                                                 : PermuteType::NHWC_TO_NCHWC;
+      }
+      else if (src->layout() == ir::Layout::NCHWc && dst->layout() != ir::Layout::NCHWc)
+      {
+        return dst->layout() == ir::Layout::NCHW ? PermuteType::NCHWC_TO_NCHW
+                                                 : PermuteType::NCHWC_TO_NHWC;
+      }
       else
       {
         return PermuteType::COPY;
@@ -215,6 +232,50 @@ private:
                        };
                 break;
               }
+              case PermuteType::NHWC_TO_NCHWC:
+              {
+                const auto shape = featureShape(src_tensor, ir::Layout::NHWC);
+                const util::feature::nhwc::Reader<T> from(&src_tensor);
+                util::feature::nchwc::View<T> into(&dst_tensor);
+                ::nnfw::misc::feature::iterate(shape)
+                    << [&](uint32_t batch, uint32_t ch, uint32_t row, uint32_t col) {
+                         into.at(batch, row, col, ch) = from.at(batch, row, col, ch);
+                       };
+                break;
+              }
+              case PermuteType::NCHWC_TO_NHWC:
+              {
+                const auto shape = featureShape(src_tensor, ir::Layout::NHWC);
+                const util::feature::nchwc::Reader<T> from(&src_tensor);
+                util::feature::nhwc::View<T> into(&dst_tensor);
+                ::nnfw::misc::feature::iterate(shape)
+                    << [&](uint32_t batch, uint32_t ch, uint32_t row, uint32_t col) {
+                         into.at(batch, row, col, ch) = from.at(batch, row, col, ch);
+                       };
+                break;
+              }
+              case PermuteType::NCHW_TO_NCHWC:
+              {
+                const auto shape = featureShape(src_tensor, ir::Layout::NCHW);
+                const util::feature::nchw::Reader<T> from(&src_tensor);
+                util::feature::nchwc::View<T> into(&dst_tensor);
+                ::nnfw::misc::feature::iterate(shape)
+                    << [&](uint32_t batch, uint32_t ch, uint32_t row, uint32_t col) {
+                         into.at(batch, row, col, ch) = from.at(batch, ch, row, col);
+                       };
+                break;
+              }
+              case PermuteType::NCHWC_TO_NCHW:
+              {
+                const auto shape = featureShape(src_tensor, ir::Layout::NHWC);
+                const util::feature::nchwc::Reader<T> from(&src_tensor);
+                util::feature::nchw::View<T> into(&dst_tensor);
+                ::nnfw::misc::feature::iterate(shape)
+                    << [&](uint32_t batch, uint32_t ch, uint32_t row, uint32_t col) {
+                         into.at(batch, ch, row, col) = from.at(batch, row, col, ch);
+                       };
+                break;
+              }
               case PermuteType::COPY:
               {
                 const int32_t dim_0 = dst_tensor.dimension(0);
@@ -253,6 +314,26 @@ private:
     src->access(fn);
   }
 
+  // Shape of feature map of a rank-4 tensor, where NCHWc is read as NHWC
+  static ir::FeatureShape featureShape(const backend::ITensor &tensor, ir::Layout layout)
+  {
+    ir::FeatureShape shape;
+    shape.N = tensor.dimension(0);
+    if (layout == ir::Layout::NCHW)
+    {
+      shape.C = tensor.dimension(1);
+      shape.H = tensor.dimension(2);
+      shape.W = tensor.dimension(3);
+    }
+    else
+    {
+      shape.H = tensor.dimension(1);
+      shape.W = tensor.dimension(2);
+      shape.C = tensor.dimension(3);
+    }
+    return shape;
+  }
+
   // NOTE The typeid expression is lvalue expression which refers to an object with static storage
   //      duration, of the polymorphic type const std::type_info or of some type derived from it.
   //      So std::type_info is non-copyable
@@ -271,6 +352,7 @@ private:
       case ir::DataType::UINT8:
         return typeid(uint8_t);
       case ir::DataType::QUANT8_SYMM:
+      case ir::DataType::QUANT8_ASYMM_SIGNED:
         return typeid(int8_t);
       default:
         throw std::runtime_error("IPermuteFunction: Not supported data type");
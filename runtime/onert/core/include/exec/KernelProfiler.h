@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  KernelProfiler.h
+ * @brief This file contains KernelProfiler class to collect per-kernel execution time
+ */
+
+#ifndef __ONERT_EXEC_KERNEL_PROFILER_H__
+#define __ONERT_EXEC_KERNEL_PROFILER_H__
+
+#include "ir/Index.h"
+
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Class to collect wall time of each kernel(IFunction) over multiple runs
+ *
+ * Unlike ProfileObserver and ChromeTracingObserver which work on OpSequence granularity, this
+ * records every single operation. Records can be written as Chrome trace JSON and as a summary
+ * table sorted by total time, with percentiles and achieved GFLOP/s and GB/s.
+ */
+class KernelProfiler
+{
+public:
+  using KernelId = uint32_t;
+
+  struct KernelInfo
+  {
+    ir::OperationIndex index;
+    std::string name;
+    std::string backend;
+    uint64_t flops;
+    uint64_t bytes;
+  };
+
+public:
+  /**
+   * @brief  Register a kernel to be profiled
+   * @return Id of the kernel, which is used to record its execution time
+   */
+  KernelId registerKernel(const KernelInfo &info);
+
+  /**
+   * @brief Mark the beginning of a model execution
+   */
+  void beginRun();
+  /**
+   * @brief Mark the end of a model execution
+   */
+  void endRun();
+
+  /**
+   * @brief Record an execution of a kernel
+   * @param[in] id    Kernel id returned by registerKernel
+   * @param[in] begin Begin timestamp in nanoseconds, from now()
+   * @param[in] end   End timestamp in nanoseconds, from now()
+   */
+  void record(KernelId id, uint64_t begin, uint64_t end);
+
+  uint32_t numRuns() const;
+
+  void writeChromeTrace(std::ostream &os);
+  void writeSummary(std::ostream &os);
+
+public:
+  /**
+   * @brief Current timestamp in nanoseconds
+   */
+  static uint64_t now();
+
+private:
+  struct Record
+  {
+    KernelId id;
+    uint32_t tid;
+    uint64_t begin;
+    uint64_t end;
+  };
+
+  struct Run
+  {
+    uint64_t begin;
+    uint64_t end;
+  };
+
+private:
+  mutable std::mutex _mutex;
+  std::vector<KernelInfo> _kernels;
+  std::vector<std::vector<uint64_t>> _durations;
+  std::vector<Record> _records;
+  std::vector<Run> _runs;
+  std::unordered_map<std::thread::id, uint32_t> _thread_ids;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_KERNEL_PROFILER_H__
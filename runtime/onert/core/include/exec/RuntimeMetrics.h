@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  RuntimeMetrics.h
+ * @brief This file contains RuntimeMetrics class for always-on execution statistics
+ */
+
+#ifndef __ONERT_EXEC_RUNTIME_METRICS_H__
+#define __ONERT_EXEC_RUNTIME_METRICS_H__
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Plain copy of runtime metrics at a moment
+ */
+struct RuntimeMetricsSnapshot
+{
+  /**
+   * @brief Number of latency histogram buckets
+   *        Bucket 0 counts runs shorter than 1us, bucket i counts runs in [2^(i-1), 2^i) us and
+   *        the last bucket counts all the longer runs.
+   */
+  static constexpr uint32_t NUM_LATENCY_BUCKETS = 24;
+
+  uint64_t run_count = 0;
+  uint64_t run_time_total_us = 0;
+  uint64_t run_time_max_us = 0;
+  std::array<uint64_t, NUM_LATENCY_BUCKETS> latency_histogram{};
+  uint64_t arena_bytes = 0;
+  uint64_t dynamic_alloc_bytes = 0;
+  uint64_t permute_bytes = 0;
+};
+
+/**
+ * @brief Class to maintain execution statistics with lock-free counters
+ *
+ * Updating is cheap enough to be always on, and snapshot() can be called from any thread even
+ * while an execution is in progress.
+ */
+class RuntimeMetrics
+{
+public:
+  RuntimeMetrics() { reset(); }
+
+public:
+  void addRun(uint64_t latency_us)
+  {
+    _run_count.fetch_add(1, std::memory_order_relaxed);
+    _run_time_total_us.fetch_add(latency_us, std::memory_order_relaxed);
+    _latency_histogram[latencyBucket(latency_us)].fetch_add(1, std::memory_order_relaxed);
+
+    auto max = _run_time_max_us.load(std::memory_order_relaxed);
+    while (max < latency_us &&
+           !_run_time_max_us.compare_exchange_weak(max, latency_us, std::memory_order_relaxed))
+    {
+      // Retry with updated max
+    }
+  }
+
+  void addPermuteBytes(uint64_t bytes)
+  {
+    _permute_bytes.fetch_add(bytes, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Accumulate counters into @c snapshot
+   */
+  void snapshot(RuntimeMetricsSnapshot &snapshot) const
+  {
+    snapshot.run_count += _run_count.load(std::memory_order_relaxed);
+    snapshot.run_time_total_us += _run_time_total_us.load(std::memory_order_relaxed);
+    const auto max = _run_time_max_us.load(std::memory_order_relaxed);
+    if (snapshot.run_time_max_us < max)
+      snapshot.run_time_max_us = max;
+    for (uint32_t i = 0; i < RuntimeMetricsSnapshot::NUM_LATENCY_BUCKETS; ++i)
+    {
+      snapshot.latency_histogram[i] += _latency_histogram[i].load(std::memory_order_relaxed);
+    }
+    snapshot.permute_bytes += _permute_bytes.load(std::memory_order_relaxed);
+  }
+
+  void reset()
+  {
+    _run_count.store(0);
+    _run_time_total_us.store(0);
+    _run_time_max_us.store(0);
+    for (auto &bucket : _latency_histogram)
+    {
+      bucket.store(0);
+    }
+    _permute_bytes.store(0);
+  }
+
+public:
+  static uint32_t latencyBucket(uint64_t latency_us)
+  {
+    uint32_t bucket = 0;
+    while (latency_us != 0 && bucket < RuntimeMetricsSnapshot::NUM_LATENCY_BUCKETS - 1)
+    {
+      latency_us >>= 1;
+      ++bucket;
+    }
+    return bucket;
+  }
+
+private:
+  std::atomic<uint64_t> _run_count;
+  std::atomic<uint64_t> _run_time_total_us;
+  std::atomic<uint64_t> _run_time_max_us;
+  std::array<std::atomic<uint64_t>, RuntimeMetricsSnapshot::NUM_LATENCY_BUCKETS>
+      _latency_histogram;
+  std::atomic<uint64_t> _permute_bytes;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_RUNTIME_METRICS_H__
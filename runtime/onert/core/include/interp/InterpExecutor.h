@@ -26,12 +26,15 @@
 #include "ir/Graph.h"
 #include "exec/IExecutor.h"
 
+#include <mutex>
+
 namespace onert
 {
 namespace interp
 {
 
 class ITensor;
+class Schedule;
 
 /**
  * @brief Class to execute model using interpreter
@@ -39,10 +42,8 @@ class ITensor;
 class InterpExecutor final : public exec::IExecutor
 {
 public:
-  explicit InterpExecutor(const ir::Graph &graph) : _graph(graph)
-  {
-    // DO NOTHING
-  }
+  explicit InterpExecutor(const ir::Graph &graph);
+  ~InterpExecutor();
 
 public:
   /**
@@ -61,7 +62,11 @@ public:
 
 private:
   const ir::Graph &_graph;
+  // Constant tensors shared by all runs
   ir::OperandIndexMap<std::shared_ptr<ITensor>> _tensor_map;
+  std::unique_ptr<Schedule> _schedule;
+  std::unique_ptr<uint8_t[]> _arena;
+  std::mutex _mutex;
 };
 
 } // namespace interp
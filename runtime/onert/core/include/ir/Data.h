@@ -18,6 +18,10 @@
 #define __ONERT_IR_DATA_H__
 
 #include <algorithm>
+#include <stdexcept>
+
+#include <sys/mman.h>
+#include <unistd.h>
 
 namespace onert
 {
@@ -69,6 +73,38 @@ private:
   const size_t _size;
 };
 
+/**
+ * @brief Data mapped from a file in memory, so that it is read on demand without copying
+ */
+class MMapedData final : public Data
+{
+public:
+  MMapedData(int fd, uint64_t offset, size_t size) : _size{size}
+  {
+    // Offset of mapping should be a multiple of the page size
+    const uint64_t page_size = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    const uint64_t mmap_offset = offset / page_size * page_size;
+    _mmap_size = static_cast<size_t>(offset - mmap_offset) + size;
+    _mmap_base = mmap(nullptr, _mmap_size, PROT_READ, MAP_PRIVATE, fd, mmap_offset);
+    if (_mmap_base == MAP_FAILED)
+      throw std::runtime_error{"Failed to map data in memory"};
+    _base = static_cast<const uint8_t *>(_mmap_base) + (offset - mmap_offset);
+  }
+
+public:
+  ~MMapedData() { munmap(_mmap_base, _mmap_size); }
+
+public:
+  size_t size(void) const override { return _size; }
+  const uint8_t *base(void) const override { return _base; }
+
+private:
+  void *_mmap_base;
+  size_t _mmap_size;
+  const uint8_t *_base;
+  const size_t _size;
+};
+
 } // namespace ir
 } // namespace onert
 
@@ -37,6 +37,7 @@ enum class DataType
   UINT8 = 5,
   QUANT8_SYMM = 6,
   FLOAT16 = 7,
+  QUANT8_ASYMM_SIGNED = 8,
 };
 
 inline size_t sizeOfDataType(DataType data_type)
@@ -54,6 +55,7 @@ inline size_t sizeOfDataType(DataType data_type)
     case DataType::UINT8:
       return sizeof(uint8_t);
     case DataType::QUANT8_SYMM:
+    case DataType::QUANT8_ASYMM_SIGNED:
       return sizeof(int8_t);
     case DataType::FLOAT16:
       return sizeof(float16);
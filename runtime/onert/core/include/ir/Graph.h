@@ -34,6 +34,7 @@ namespace custom
 {
 class IKernelBuilder;
 } // namespace custom
+class SharedContext;
 } // namespace backend
 } // namespace onert
 
@@ -88,6 +89,21 @@ public:
 private:
   std::shared_ptr<backend::custom::IKernelBuilder> _kernel_builder;
 
+  // Resources shared with graphs of other sessions
+public:
+  void bindSharedContext(const std::shared_ptr<backend::SharedContext> &shared_context)
+  {
+    _shared_context = shared_context;
+  }
+
+  const std::shared_ptr<backend::SharedContext> &getSharedContext() const
+  {
+    return _shared_context;
+  }
+
+private:
+  std::shared_ptr<backend::SharedContext> _shared_context;
+
   // Accessors
 public:
   const OperandIndexSequence &getInputs() const { return _inputs; }
@@ -17,7 +17,9 @@
 #ifndef __ONERT_IR_LAYOUT_H__
 #define __ONERT_IR_LAYOUT_H__
 
+#include <cstdint>
 #include <functional>
+#include <stdexcept>
 #include <string>
 
 namespace onert
@@ -29,9 +31,15 @@ enum class Layout
 {
   UNKNOWN = 0,
   NHWC,
-  NCHW
+  NCHW,
+  // NHWC with channels split into blocks of NCHWC_BLOCK, stored as [N, C/block, H, W, block]
+  // Shapes and coordinates of this layout are of NHWC, and only offsets in memory differ.
+  NCHWc
 };
 
+// Channels in a block of Layout::NCHWc
+constexpr int32_t NCHWC_BLOCK = 8;
+
 inline std::string to_string(Layout layout)
 {
   switch (layout)
@@ -40,6 +48,8 @@ inline std::string to_string(Layout layout)
       return std::string{"NHWC"};
     case Layout::NCHW:
       return std::string{"NCHW"};
+    case Layout::NCHWc:
+      return std::string{"NCHWc"};
     case Layout::UNKNOWN:
       return std::string{"UNKNOWN"};
     default:
@@ -56,6 +56,7 @@ public:
   std::shared_ptr<ir::OperationIndexMap<int64_t>> indexed_ranks() { return _indexed_ranks; }
 
 private:
+  void fallbackUnsupportedOperations(const compiler::CompilerOptions &options);
   void makeOpSequences(OperandIndexMap<std::unique_ptr<operand::LowerInfo>> &operands_lower_info,
                        const compiler::CompilerOptions &options);
 
@@ -18,6 +18,7 @@
 #define __ONERT_IR_TYPEINFO_H__
 
 #include <cstdint>
+#include <vector>
 
 #include "ir/DataType.h"
 
@@ -40,14 +41,35 @@ public:
   DataType type() const { return _type; }
   float scale() const { return _scale; }
   int32_t offset() const { return _offset; }
+  /**
+   * @brief  Get per-channel quantization scales
+   * @return Scales of each channel along quantizedDimension(), empty if quantized per-tensor
+   */
+  const std::vector<float> &scales() const { return _scales; }
+  int32_t quantizedDimension() const { return _quantized_dimension; }
+  bool isPerChannel() const { return !_scales.empty(); }
 
 public:
   void type(const DataType type) { _type = type; }
+  /**
+   * @brief Set per-channel quantization parameters
+   * @param[in] scales              Scale of each channel
+   * @param[in] quantized_dimension Dimension which the channels are placed along
+   * @note  scale() returns the first channel's scale after this is called
+   */
+  void perChannel(const std::vector<float> &scales, int32_t quantized_dimension)
+  {
+    _scales = scales;
+    _quantized_dimension = quantized_dimension;
+    _scale = _scales.empty() ? 0.f : _scales.front();
+  }
 
 private:
   DataType _type;
   float _scale;
   int32_t _offset;
+  std::vector<float> _scales;
+  int32_t _quantized_dimension{0};
 };
 
 bool operator==(const TypeInfo &lhs, const TypeInfo &rhs);
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  MemoryProfiler.h
+ * @brief This file contains MemoryProfiler class to attribute heap usage of a session to compile
+ *        phases and kernels
+ */
+
+#ifndef __ONERT_UTIL_MEMORY_PROFILER_H__
+#define __ONERT_UTIL_MEMORY_PROFILER_H__
+
+#include "ir/Index.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace onert
+{
+namespace util
+{
+
+/**
+ * @brief Class to record heap usage at the boundaries of scopes, which are compile phases(load,
+ *        lower, plan, ...), model executions and kernels, and the peak within each of them
+ *
+ * Heap usage is read from heap_trace(runtime/contrib/heap_trace) when it is preloaded with
+ * LD_PRELOAD, which tracks every allocation so that peaks are exact. Otherwise it is read from
+ * mallinfo() of C library, where a peak is the highest usage sampled at the boundaries.
+ *
+ * Records are written as Chrome trace JSON with a heap counter, and as a summary table when the
+ * profiler is destroyed.
+ *
+ * heap_trace keeps a single peak for the process, which each sample resets. A peak read by a
+ * profiler is passed to all the other live profilers as well, so that each of them has its own
+ * peak even when sessions are profiled at once.
+ *
+ * @note  Scopes are expected to be nested, so kernels running in parallel are not attributed
+ *        correctly
+ */
+class MemoryProfiler
+{
+public:
+  using ScopeId = uint32_t;
+
+public:
+  /**
+   * @brief Construct a new MemoryProfiler object
+   * @param[in] filepath File path to save Chrome trace, and summary with ".summary" suffix
+   *                     Nothing is saved if it is empty.
+   */
+  MemoryProfiler(const std::string &filepath);
+  ~MemoryProfiler();
+
+public:
+  /**
+   * @brief  Register a compile phase, or return the one registered with the same name
+   * @return Id of the phase, which is used to mark its beginning and end
+   */
+  ScopeId registerPhase(const std::string &name);
+  /**
+   * @brief  Register a kernel of an operation
+   * @param[in] prepare Whether the scope is for IFunction::prepare() rather than runs
+   * @return Id of the kernel, which is used to mark its beginning and end
+   */
+  ScopeId registerKernel(ir::OperationIndex index, const std::string &name,
+                         const std::string &backend, bool prepare = false);
+
+  void begin(ScopeId id);
+  void end(ScopeId id);
+
+  /**
+   * @brief Whether heap usage comes from heap_trace, which makes peaks exact
+   */
+  bool exact() const { return _heap_trace_usage != nullptr; }
+
+  void writeChromeTrace(std::ostream &os);
+  void writeSummary(std::ostream &os);
+
+private:
+  enum class Kind
+  {
+    PHASE,
+    KERNEL
+  };
+
+  struct Scope
+  {
+    Kind kind;
+    std::string tid;
+    std::string label;
+    uint64_t count;
+    int64_t total_delta; //< Sum of heap usage at the end minus the one at the beginning
+    uint64_t max_peak;   //< Highest peak over heap usage at the beginning
+  };
+
+  struct OpenScope
+  {
+    ScopeId id;
+    uint64_t in_use;
+    uint64_t peak;
+  };
+
+  struct Record
+  {
+    ScopeId id;
+    bool begin;
+    uint64_t ts;
+    uint64_t in_use;
+  };
+
+private:
+  ScopeId registerScope(Kind kind, const std::string &tid, const std::string &label);
+  uint64_t sample();
+  // Raise the peak which is taken at the next sample, called by other profilers
+  void raisePeak(uint64_t peak) { _pending_peak = std::max(_pending_peak, peak); }
+
+private:
+  std::string _filepath;
+  void (*_heap_trace_usage)(size_t *, size_t *);
+  void (*_heap_trace_reset)(void);
+  uint64_t _max_peak;
+  uint64_t _pending_peak; //< Guarded by the lock over live profilers rather than _mutex
+  std::mutex _mutex;
+  std::vector<Scope> _scopes;
+  std::vector<OpenScope> _open;
+  std::vector<Record> _records;
+};
+
+/**
+ * @brief Helper class to mark a compile phase, which ends at end() or destruction
+ *        It does nothing if the profiler is nullptr.
+ */
+class MemoryProfilePhase
+{
+public:
+  MemoryProfilePhase(MemoryProfiler *profiler, const std::string &name);
+  ~MemoryProfilePhase() { end(); }
+
+  void end();
+
+private:
+  MemoryProfiler *_profiler;
+  MemoryProfiler::ScopeId _id;
+};
+
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_MEMORY_PROFILER_H__
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __ONERT_UTIL_FEATURE_NCHWC_VIEW_H__
+#define __ONERT_UTIL_FEATURE_NCHWC_VIEW_H__
+
+#include <cassert>
+#include <cstring>
+
+#include "backend/ITensor.h"
+#include "ir/Layout.h"
+#include "misc/feature/Reader.h"
+#include "misc/feature/Shape.h"
+
+namespace onert
+{
+namespace util
+{
+namespace feature
+{
+namespace nchwc
+{
+
+/**
+ * @brief View of a backend tensor in ir::Layout::NCHWc, whose channels are split into blocks
+ *        of ir::NCHWC_BLOCK as [N, C/block, H, W, block]
+ * @note  Channels beyond C in the last block are cleared on construction, as kernels of this
+ *        layout read whole blocks
+ */
+template <typename T> class View final : public nnfw::misc::feature::Reader<T>
+{
+public:
+  // Construct for backend tensor
+  View(backend::ITensor *tensor) : _ptr{reinterpret_cast<T *>(tensor->buffer())}
+  {
+    assert(tensor->layout() == ir::Layout::NCHWc);
+
+    _shape.N = tensor->dimension(0);
+    _shape.H = tensor->dimension(1);
+    _shape.W = tensor->dimension(2);
+    _shape.C = tensor->dimension(3);
+
+    if (_shape.C % ir::NCHWC_BLOCK != 0)
+      std::memset(tensor->buffer(), 0, tensor->total_size());
+  }
+
+public:
+  T at(uint32_t row, uint32_t col, uint32_t ch) const override
+  {
+    return _ptr[feature_index_to_offset(0, row, col, ch)];
+  }
+  T at(uint32_t batch, uint32_t row, uint32_t col, uint32_t ch) const override
+  {
+    return _ptr[feature_index_to_offset(batch, row, col, ch)];
+  }
+
+  T &at(uint32_t row, uint32_t col, uint32_t ch)
+  {
+    return _ptr[feature_index_to_offset(0, row, col, ch)];
+  }
+  T &at(uint32_t batch, uint32_t row, uint32_t col, uint32_t ch)
+  {
+    return _ptr[feature_index_to_offset(batch, row, col, ch)];
+  }
+
+private:
+  size_t feature_index_to_offset(uint32_t batch, uint32_t row, uint32_t col, uint32_t ch) const
+  {
+    assert(1u * _shape.N > batch); // shape.N > batch
+    assert(1u * _shape.H > row);   // shape.H > row
+    assert(1u * _shape.W > col);   // shape.W > col
+    assert(1u * _shape.C > ch);    // shape.C > ch
+
+    const uint32_t blocks = (_shape.C + ir::NCHWC_BLOCK - 1) / ir::NCHWC_BLOCK;
+    size_t res = batch * blocks + ch / ir::NCHWC_BLOCK;
+    res = (res * _shape.H + row) * _shape.W + col;
+    return res * ir::NCHWC_BLOCK + ch % ir::NCHWC_BLOCK;
+  }
+
+private:
+  nnfw::misc::feature::Shape _shape;
+  T *_ptr;
+};
+
+} // namespace nchwc
+} // namespace feature
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_FEATURE_NCHWC_VIEW_H__
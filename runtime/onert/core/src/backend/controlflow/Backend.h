@@ -68,7 +68,7 @@ public:
     auto tb = std::make_shared<TensorBuilder>();
     context->tensor_builder = tb;
     context->constant_initializer = std::make_shared<ConstantInitializer>(operands, tb);
-    context->kernel_gen = std::make_shared<KernelGenerator>(operands);
+    context->kernel_gen = std::make_shared<KernelGenerator>(graph);
     context->shape_fixer = std::shared_ptr<IShapeFixer>(std::make_shared<EmptyShapeFixer>());
     context->tensor_register = nullptr;
     context->optimizer = nullptr;
@@ -93,6 +93,13 @@ private:
     {
       // DO NOTHING
     }
+#define INTERP_OP(InternalName)                            \
+  void visit(const ir::operation::InternalName &) override \
+  {                                                        \
+    /* DO NOTHING */                                       \
+  }
+#include "interp/InterpOps.lst"
+#undef INTERP_OP
   };
 
 private:
@@ -27,6 +27,13 @@ std::string Config::ID = "controlflow";
 
 bool Config::initialize() { return true; }
 
+bool Config::supportOperation(const ir::Operation &node, const ir::Operands &)
+{
+  const auto opcode = node.opcode();
+  return opcode == ir::OpCode::If || opcode == ir::OpCode::While ||
+         opcode == ir::OpCode::Permute;
+}
+
 ir::Layout Config::supportLayout(const ir::Operation &, ir::Layout frontend_layout)
 {
   return frontend_layout;
@@ -42,6 +42,8 @@ public:
     return false;
   }
   bool supportFP16() override { return false; }
+  // Other operations run on this backend only when they fall back to interpreter kernels
+  bool supportOperation(const ir::Operation &node, const ir::Operands &) override;
 
   std::unique_ptr<util::ITimer> timer() override { return std::make_unique<util::CPUTimer>(); }
 };
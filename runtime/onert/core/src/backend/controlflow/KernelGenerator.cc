@@ -21,6 +21,8 @@
 #include "kernel/IfLayer.h"
 #include "kernel/WhileLayer.h"
 #include "kernel/PermuteLayer.h"
+#include "kernel/InterpLayer.h"
+#include "interp/Registration.h"
 
 namespace onert
 {
@@ -29,8 +31,9 @@ namespace backend
 namespace controlflow
 {
 
-KernelGenerator::KernelGenerator(const ir::Operands &operand_ctx)
-    : _operand_ctx{operand_ctx}, _tensor_builder_set{nullptr}, _executor_map{nullptr}
+KernelGenerator::KernelGenerator(const ir::Graph &graph)
+    : _graph{graph}, _operand_ctx{graph.operands()}, _tensor_builder_set{nullptr},
+      _executor_map{nullptr}
 {
   UNUSED_RELEASE(_operand_ctx);
   UNUSED_RELEASE(_tensor_builder_set);
@@ -127,6 +130,34 @@ void KernelGenerator::visit(const ir::operation::While &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visitInterpOp(const ir::Operation &node)
+{
+  const auto interp_kernel = interp::getKernel(node.opcode());
+  assert(interp_kernel != nullptr);
+
+  std::vector<kernel::InterpLayer::IndexedTensor> input_tensors;
+  for (const auto input_index : node.getInputs())
+  {
+    // Skip optional input which is not given
+    if (!input_index.valid() || !_operand_ctx.exist(input_index))
+      continue;
+
+    input_tensors.emplace_back(input_index, getTensor(input_index));
+  }
+
+  std::vector<kernel::InterpLayer::IndexedTensor> output_tensors;
+  for (const auto output_index : node.getOutputs())
+  {
+    output_tensors.emplace_back(output_index, getTensor(output_index));
+  }
+
+  auto fn = std::make_unique<kernel::InterpLayer>(_graph, node, *interp_kernel,
+                                                  std::move(input_tensors),
+                                                  std::move(output_tensors));
+
+  _return_fn = std::move(fn);
+}
+
 std::shared_ptr<backend::ITensor> KernelGenerator::getTensor(const ir::OperandIndex &index)
 {
   std::shared_ptr<backend::ITensor> ret;
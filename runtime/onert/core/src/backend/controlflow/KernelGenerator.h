@@ -20,7 +20,7 @@
 #include <backend/IKernelGenerator.h>
 #include <backend/ITensorBuilder.h>
 #include <exec/IExecutor.h>
-#include <ir/Operands.h>
+#include <ir/Graph.h>
 
 namespace onert
 {
@@ -32,7 +32,7 @@ namespace controlflow
 class KernelGenerator : public IKernelGenerator
 {
 public:
-  KernelGenerator(const ir::Operands &operand_ctx);
+  KernelGenerator(const ir::Graph &graph);
 
   void setTensorBuilderSet(const TensorBuilderSet &tensor_builder_set)
   {
@@ -50,10 +50,18 @@ public:
   void visit(const ir::operation::Permute &) override;
   void visit(const ir::operation::While &) override;
 
+  // Operations which other backends do not support run on interpreter kernels
+#define INTERP_OP(InternalName) \
+  void visit(const ir::operation::InternalName &node) override { visitInterpOp(node); }
+#include "interp/InterpOps.lst"
+#undef INTERP_OP
+
 private:
+  void visitInterpOp(const ir::Operation &node);
   std::shared_ptr<backend::ITensor> getTensor(const ir::OperandIndex &index);
 
 private:
+  const ir::Graph &_graph;
   const ir::Operands &_operand_ctx;
   TensorBuilderSet _tensor_builder_set;
   std::shared_ptr<exec::ExecutorMap> _executor_map;
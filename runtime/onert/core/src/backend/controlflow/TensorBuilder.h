@@ -59,6 +59,7 @@ public:
   void prepare(void) override;
   void allocate() override;
   void postFunctionPrepare() override { /* DO NOTHING */}
+  void postAllFunctionsPrepare() override { /* DO NOTHING */}
 
   std::shared_ptr<ITensor> tensorAt(const ir::OperandIndex &ind) override;
 
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "InterpLayer.h"
+
+#include "interp/Buffer.h"
+#include "interp/ExecEnv.h"
+#include "interp/Registration.h"
+
+namespace onert
+{
+namespace backend
+{
+namespace controlflow
+{
+namespace kernel
+{
+
+InterpLayer::InterpLayer(const ir::Graph &graph, const ir::Operation &node,
+                         const interp::OpKernel &kernel, std::vector<IndexedTensor> input_tensors,
+                         std::vector<IndexedTensor> output_tensors)
+    : _graph{graph}, _node{node}, _kernel{kernel}, _input_tensors{std::move(input_tensors)},
+      _output_tensors{std::move(output_tensors)}
+{
+  // DO NOTHING
+}
+
+void InterpLayer::run()
+{
+  interp::ExecEnv env{_graph};
+
+  for (const auto &input : _input_tensors)
+  {
+    const auto &index = input.first;
+    const auto &tensor = input.second;
+    auto interp_tensor = std::make_shared<interp::ROTensor>(_graph.operands().at(index).info());
+    interp_tensor->setData(
+        std::make_shared<interp::ExternalBuffer>(tensor->buffer(), tensor->total_size()));
+    env.assignTensor(index, interp_tensor);
+  }
+
+  // Outputs are allocated by kernel's prepare on the buffers given here
+  for (const auto &output : _output_tensors)
+  {
+    const auto &tensor = output.second;
+    env.assignExternalBuffer(output.first, std::make_shared<interp::ExternalBuffer>(
+                                               tensor->buffer(), tensor->total_size()));
+  }
+
+  if (_kernel.prepare != nullptr)
+  {
+    _kernel.prepare(&env, _node);
+  }
+  _kernel.invoke(&env, _node);
+}
+
+} // namespace kernel
+} // namespace controlflow
+} // namespace backend
+} // namespace onert
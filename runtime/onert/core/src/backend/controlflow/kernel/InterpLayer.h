@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CONTROLFLOW_KERNEL_INTERP_LAYER_H__
+#define __ONERT_BACKEND_CONTROLFLOW_KERNEL_INTERP_LAYER_H__
+
+#include <backend/ITensor.h>
+#include <exec/IFunction.h>
+#include <ir/Graph.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace onert
+{
+namespace interp
+{
+struct OpKernel;
+} // namespace interp
+} // namespace onert
+
+namespace onert
+{
+namespace backend
+{
+namespace controlflow
+{
+namespace kernel
+{
+
+/**
+ * @brief Kernel running an operation, which any other backend does not support, with interpreter
+ *
+ * This makes hybrid execution possible: only unsupported operations run on interpreter kernels
+ * while the others run on compiled backends. Interpreter tensors are made on each run as views of
+ * the backend tensors, so no data is copied.
+ */
+class InterpLayer : public ::onert::exec::IFunction
+{
+public:
+  using IndexedTensor = std::pair<ir::OperandIndex, std::shared_ptr<backend::ITensor>>;
+
+public:
+  InterpLayer(const ir::Graph &graph, const ir::Operation &node, const interp::OpKernel &kernel,
+              std::vector<IndexedTensor> input_tensors, std::vector<IndexedTensor> output_tensors);
+
+public:
+  void run() override;
+
+  void runSync() override
+  {
+    // this abstract method is used just for profiling and called for
+    // backend::acl_common::AclFunction
+    run();
+  }
+
+private:
+  const ir::Graph &_graph;
+  const ir::Operation &_node;
+  const interp::OpKernel &_kernel;
+  const std::vector<IndexedTensor> _input_tensors;
+  const std::vector<IndexedTensor> _output_tensors;
+};
+
+} // namespace kernel
+} // namespace controlflow
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CONTROLFLOW_KERNEL_INTERP_LAYER_H__
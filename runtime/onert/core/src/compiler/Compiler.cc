@@ -27,15 +27,20 @@
 #include "compiler/ManualScheduler.h"
 #include "compiler/HEScheduler.h"
 #include "exec/ExecTime.h"
+#include "exec/AdaptiveExecutor.h"
 #include "ir/operation/LowerInfo.h"
 #include "dumper/dot/DotDumper.h"
 #include "compiler/Linear.h"
 #include "interp/InterpExecutor.h"
 #include "util/ConfigSource.h"
 #include "util/logging.h"
+#include "util/MemoryProfiler.h"
 #include "ir/OperationDumper.h"
 #include "misc/string_helpers.h"
 
+#include <algorithm>
+#include <thread>
+
 namespace onert
 {
 
@@ -77,11 +82,17 @@ CompilerOptions fetchCompilerOptionsFromGlobalConfig(const ir::Subgraphs &subgs)
   }
 
   options.trace_filepath = util::getConfigString(util::config::TRACE_FILEPATH);
+  options.kernel_profile_filepath = util::getConfigString(util::config::KERNEL_PROFILE_FILEPATH);
   options.graph_dump_level = util::getConfigInt(util::config::GRAPH_DOT_DUMP);
   options.op_seq_max_node = util::getConfigInt(util::config::OP_SEQ_MAX_NODE);
   options.executor = util::getConfigString(util::config::EXECUTOR);
+  options.parallel_workers = util::getConfigInt(util::config::PARALLEL_WORKERS);
+  options.parallel_cores = util::getConfigInt(util::config::PARALLEL_CORES);
   options.he_scheduler = util::getConfigBool(util::config::USE_SCHEDULER);
   options.he_profiling_mode = util::getConfigBool(util::config::PROFILING_MODE);
+  options.he_adaptive = util::getConfigBool(util::config::ADAPTIVE_SCHEDULER);
+  options.he_adaptive_period = util::getConfigInt(util::config::ADAPTIVE_SCHED_PERIOD);
+  options.he_adaptive_sampling = util::getConfigInt(util::config::ADAPTIVE_SCHED_SAMPLING);
   options.disable_compile = util::getConfigBool(util::config::DISABLE_COMPILE);
   options.fp16_enable = util::getConfigBool(util::config::FP16_ENABLE);
 
@@ -149,6 +160,33 @@ void setInputToDynamicTensor(const std::shared_ptr<onert::ir::Graph> &primary_su
   }
 }
 
+/**
+ * @brief Lower a graph and convert it to fp16 if requested and all its backends support
+ */
+std::unique_ptr<ir::LoweredGraph> lowerGraph(const ir::Graph &graph,
+                                             const CompilerOptions &options)
+{
+  util::MemoryProfilePhase phase{options.memory_profiler.get(), "lower"};
+
+  auto lowered_graph = std::make_unique<ir::LoweredGraph>(graph, options);
+
+  // Check backend(s) for subgraph support FP16
+  bool backends_support_fp16 = true;
+  auto &contexts = lowered_graph->backend_contexts();
+  for (auto it = contexts.begin(); it != contexts.end(); it++)
+  {
+    backends_support_fp16 &= it->first->config()->supportFP16();
+  }
+
+  if (options.fp16_enable && backends_support_fp16)
+  {
+    // NOTE: the only acl_cl backend enables fp16 mode
+    Fp32ToFp16Converter(*lowered_graph).run();
+  }
+
+  return lowered_graph;
+}
+
 Compiler::Compiler(const std::shared_ptr<ir::Subgraphs> &subgs)
     : _subgraphs{subgs}, _executors{nullptr}, _state{State::CREATED}
 {
@@ -179,12 +217,17 @@ void Compiler::compile(void)
                                           _options.backend_list.end(), "/")
                       << std::endl;
     VERBOSE(Compiler) << "trace_filepath           : " << _options.trace_filepath << std::endl;
+    VERBOSE(Compiler) << "kernel_profile_filepath  : " << _options.kernel_profile_filepath
+                      << std::endl;
     VERBOSE(Compiler) << "graph_dump_level         : " << _options.graph_dump_level << std::endl;
     VERBOSE(Compiler) << "op_seq_max_node          : " << _options.op_seq_max_node << std::endl;
     VERBOSE(Compiler) << "executor                 : " << _options.executor << std::endl;
+    VERBOSE(Compiler) << "parallel_workers         : " << _options.parallel_workers << std::endl;
+    VERBOSE(Compiler) << "parallel_cores           : " << _options.parallel_cores << std::endl;
     VERBOSE(Compiler) << "manual_scheduler_options : (Too many things to print)" << std::endl;
     VERBOSE(Compiler) << "he_scheduler             : " << _options.he_scheduler << std::endl;
     VERBOSE(Compiler) << "he_profiling_mode        : " << _options.he_profiling_mode << std::endl;
+    VERBOSE(Compiler) << "he_adaptive              : " << _options.he_adaptive << std::endl;
     VERBOSE(Compiler) << "disable_compile          : " << _options.disable_compile << std::endl;
     VERBOSE(Compiler) << "fp16_enable              : " << _options.fp16_enable << std::endl;
     VERBOSE(Compiler) << std::noboolalpha;
@@ -198,8 +241,9 @@ void Compiler::compile(void)
   setInputToDynamicTensor(_subgraphs->primary());
 
   // Compilable check
-  // TODO: Support hybrid execution -
-  //       execution between interpreter and compiled executor (including control flow)
+  // NOTE Operations that the assigned backend does not support run with interpreter kernels on
+  //      controlflow backend(see LoweredGraph), so whole model falls back to interpreter only
+  //      when compile is disabled
   if (!checkCompilable())
   {
     _executors = std::make_shared<exec::ExecutorMap>();
@@ -211,8 +255,34 @@ void Compiler::compile(void)
   }
 
   // Mode check
+  // 0 means all the cores, and as many workers as cores
+  if (_options.parallel_cores < 0 || _options.parallel_workers < 0)
+    throw std::runtime_error("Parallel executor cannot have negative number of cores or workers");
+  if (_options.parallel_cores == 0)
+    _options.parallel_cores = std::max(1u, std::thread::hardware_concurrency());
+  if (_options.parallel_workers == 0)
+    _options.parallel_workers = _options.parallel_cores;
   if (_options.he_profiling_mode)
     checkProfilerConditions();
+  if (_options.he_adaptive)
+  {
+    checkAdaptiveConditions();
+
+    // Measurements are shared by the scheduler and the executors of every compilation
+    auto &backend_manager = BackendManager::get();
+    std::vector<const backend::Backend *> backends;
+    for (const auto &backend_str : _options.backend_list)
+    {
+      backend_manager.loadBackend(backend_str);
+      auto backend = backend_manager.get(backend_str);
+      if (backend)
+        backends.push_back(backend);
+    }
+    _options.he_exec_time = std::make_shared<exec::ExecTime>(backends);
+    // Prefer recent measurements to older ones so as to follow changes of load, giving 3/4 of
+    // the weight to a new measurement
+    _options.he_exec_time->setDecay(0.25);
+  }
 
   /***************************************************
    * Backend independent analysis & optimization phase
@@ -226,25 +296,16 @@ void Compiler::compile(void)
     dot_dumper.dump(nnfw::misc::str("before_lower_subg-", index.value()));
 
     // Lower: Assign backend
-    lowered_subgs[index] = std::make_unique<ir::LoweredGraph>(subg, _options);
-
-    // Check backend(s) for subgraph support FP16
-    bool backends_support_fp16 = true;
-    auto &contexts = (*lowered_subgs[index]).backend_contexts();
-    for (auto it = contexts.begin(); it != contexts.end(); it++)
-    {
-      backends_support_fp16 &= it->first->config()->supportFP16();
-    }
-
-    if (_options.fp16_enable && backends_support_fp16)
-    {
-      // NOTE: the only acl_cl backend enables fp16 mode
-      Fp32ToFp16Converter(*lowered_subgs[index]).run();
-    }
+    lowered_subgs[index] = lowerGraph(subg, _options);
 
     subg.setSubgraphs(nullptr);
   });
 
+  // Adaptive mode lowers the graph again later with new measurements
+  std::shared_ptr<ir::Graph> adaptive_graph;
+  if (_options.he_adaptive)
+    adaptive_graph = primary_subgraph();
+
   _subgraphs.reset();
 
   /*************************************************************
@@ -278,12 +339,49 @@ void Compiler::compile(void)
     _executors->insert(std::make_pair(subg_index, std::move(executor)));
   }
 
+  if (adaptive_graph)
+  {
+    const auto primary_index = ir::SubgraphIndex{0};
+    const auto options = _options;
+    auto recompile = [adaptive_graph, options]() {
+      // Keep measurements so that they survive restart
+      options.he_exec_time->uploadOperationsExecTime();
+
+      auto lowered_graph = lowerGraph(*adaptive_graph, options);
+      compiler::OperationValidator{lowered_graph->graph()}();
+      auto indexed_ranks = lowered_graph->indexed_ranks();
+      auto executor = std::unique_ptr<exec::IExecutor>{ExecutorFactory::get().create(
+          std::move(lowered_graph), options, std::make_shared<exec::ExecutorMap>())};
+      executor->setIndexedRanks(indexed_ranks);
+      return executor;
+    };
+    auto executor = std::make_unique<exec::AdaptiveExecutor>(
+        adaptive_graph, std::move(_executors->at(primary_index)), recompile,
+        _options.he_adaptive_period);
+    _executors->at(primary_index) = std::move(executor);
+  }
+
   /********************************
    * Code generation phase finished
    ********************************/
   _state = State::COMPILED;
 }
 
+void Compiler::checkAdaptiveConditions()
+{
+  if (!_options.he_scheduler)
+    throw std::runtime_error("Heterogeneous scheduler must be enabled for adaptive scheduling.");
+
+  if (_options.he_profiling_mode)
+    throw std::runtime_error("Adaptive scheduling cannot be used with profiling mode");
+
+  if (_subgraphs->count() != 1)
+    throw std::runtime_error("Adaptive scheduling supports a model with single subgraph only");
+
+  if (_options.he_adaptive_period <= 0 || _options.he_adaptive_sampling <= 0)
+    throw std::runtime_error("Adaptive scheduling period and sampling rate must be positive");
+}
+
 bool Compiler::checkCompilable()
 {
   // Disable compile phase
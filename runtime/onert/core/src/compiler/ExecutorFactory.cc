@@ -21,6 +21,8 @@
 #include "exec/LinearExecutor.h"
 #include "exec/DataflowExecutor.h"
 #include "exec/ParallelExecutor.h"
+#include "exec/ProfiledFunction.h"
+#include "exec/MemoryProfiledFunction.h"
 #include "compiler/BackendManager.h"
 #include "compiler/ExecutionBuilder.h"
 #include "exec/ExecTime.h"
@@ -32,6 +34,8 @@
 #include "backend/ITensorRegister.h"
 #include "backend/controlflow/Config.h"
 #include "backend/controlflow/KernelGenerator.h"
+#include "ir/OperationCostEstimator.h"
+#include "util/logging.h"
 #include <memory>
 
 namespace onert
@@ -147,6 +151,68 @@ void ExecutorFactory::runTensorRegistration(ir::LoweredGraph *lowered_graph,
   }
 }
 
+std::shared_ptr<exec::KernelProfiler>
+ExecutorFactory::createKernelProfiler(const ir::LoweredGraph &lowered_graph,
+                                      compiler::CodeMap &code_map)
+{
+  auto profiler = std::make_shared<exec::KernelProfiler>();
+  ir::OperationCostEstimator cost_estimator{lowered_graph.graph().operands()};
+
+  for (auto &it : code_map)
+  {
+    const auto &op_seq = *it.second.op_seq;
+    auto &fn_seq = it.second.fn_seq;
+    const auto backend_id = it.second.lower_info->backend()->config()->id();
+
+    // Kernels can be mapped to operations only when each operation has its own kernel
+    if (fn_seq->size() != op_seq.size())
+    {
+      VERBOSE(ExecutorFactory) << "Cannot profile kernels of OpSequence " << it.first.value()
+                               << " : " << fn_seq->size() << " kernels for " << op_seq.size()
+                               << " operations" << std::endl;
+      continue;
+    }
+
+    auto op_iter = op_seq.begin();
+    fn_seq->wrap([&](std::unique_ptr<exec::IFunction> &&fn) -> std::unique_ptr<exec::IFunction> {
+      const auto &element = *op_iter++;
+      const auto cost = cost_estimator.estimate(*element.node);
+      auto id = profiler->registerKernel(
+          {element.index, element.node->name(), backend_id, cost.flops, cost.bytes});
+      return std::make_unique<exec::ProfiledFunction>(std::move(fn), profiler, id);
+    });
+  }
+
+  return profiler;
+}
+
+void ExecutorFactory::wrapMemoryProfiler(compiler::CodeMap &code_map,
+                                         const std::shared_ptr<util::MemoryProfiler> &profiler)
+{
+  for (auto &it : code_map)
+  {
+    const auto &op_seq = *it.second.op_seq;
+    auto &fn_seq = it.second.fn_seq;
+    const auto backend_id = it.second.lower_info->backend()->config()->id();
+    if (op_seq.size() == 0)
+      continue;
+
+    // Kernels that cannot be mapped to operations are attributed to the first one
+    const bool per_operation = fn_seq->size() == op_seq.size();
+    auto op_iter = op_seq.begin();
+    fn_seq->wrap([&](std::unique_ptr<exec::IFunction> &&fn) -> std::unique_ptr<exec::IFunction> {
+      const auto &element = per_operation ? *op_iter++ : *op_seq.begin();
+      auto name = element.node->name();
+      if (!per_operation && op_seq.size() > 1)
+        name += " (+" + std::to_string(op_seq.size() - 1) + ")";
+      auto run_id = profiler->registerKernel(element.index, name, backend_id);
+      auto prepare_id = profiler->registerKernel(element.index, name, backend_id, true);
+      return std::make_unique<exec::MemoryProfiledFunction>(std::move(fn), profiler, run_id,
+                                                            prepare_id);
+    });
+  }
+}
+
 exec::IExecutor *
 ExecutorFactory::createLinearExecutor(std::unique_ptr<ir::LoweredGraph> lowered_graph,
                                       const compiler::CompilerOptions &options,
@@ -183,6 +249,9 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<ir::LoweredGraph> lowered_
    * Code generation phase
    ***********************/
 
+  auto *memory_profiler = options.memory_profiler.get();
+  util::MemoryProfilePhase plan_phase{memory_profiler, "plan"};
+
   auto order = Linear::linearize(*lowered_graph);
   runTensorRegistration(lowered_graph.get(), order);
   Linear::dump(*lowered_graph, order);
@@ -199,6 +268,9 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<ir::LoweredGraph> lowered_
     tensor_builder->prepare();
   }
 
+  plan_phase.end();
+  util::MemoryProfilePhase generate_phase{memory_profiler, "kernel generation"};
+
   ExecutionBuilder builder;
 
   // Generate kernels
@@ -217,6 +289,9 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<ir::LoweredGraph> lowered_
     builder.append(op_seq_index, {&op_seq, lower_info, std::move(fn_seq)});
   });
 
+  generate_phase.end();
+  util::MemoryProfilePhase allocate_phase{memory_profiler, "allocate"};
+
   for (auto &tensor_builder : tensor_builders)
   {
     tensor_builder->allocate();
@@ -230,8 +305,17 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<ir::LoweredGraph> lowered_
   lowered_graph->graph().operands().iterate(
       [](const ir::OperandIndex &, ir::Operand &obj) { obj.releaseData(); });
 
+  allocate_phase.end();
+
   auto code_map = builder.releaseCodeMap();
 
+  if (options.memory_profiler)
+  {
+    wrapMemoryProfiler(code_map, options.memory_profiler);
+  }
+
+  util::MemoryProfilePhase prepare_phase{memory_profiler, "kernel prepare"};
+
   for (auto &it : code_map)
   {
     auto op_seq_index = it.first;
@@ -245,6 +329,19 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<ir::LoweredGraph> lowered_
     });
   }
 
+  for (auto &tensor_builder : tensor_builders)
+  {
+    tensor_builder->postAllFunctionsPrepare();
+  }
+
+  prepare_phase.end();
+
+  std::shared_ptr<exec::KernelProfiler> kernel_profiler;
+  if (!options.kernel_profile_filepath.empty())
+  {
+    kernel_profiler = createKernelProfiler(*lowered_graph, code_map);
+  }
+
   auto exec = new exec::LinearExecutor{std::move(lowered_graph), tensor_builders,
                                        std::move(code_map), order};
 
@@ -255,6 +352,27 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<ir::LoweredGraph> lowered_
     exec->addObserver(std::move(ctp));
   }
 
+  if (kernel_profiler)
+  {
+    std::unique_ptr<exec::IExecutionObserver> kpo = std::make_unique<exec::KernelProfileObserver>(
+        options.kernel_profile_filepath, kernel_profiler);
+    exec->addObserver(std::move(kpo));
+  }
+
+  if (options.memory_profiler)
+  {
+    std::unique_ptr<exec::IExecutionObserver> mpo =
+        std::make_unique<exec::MemoryProfileObserver>(options.memory_profiler);
+    exec->addObserver(std::move(mpo));
+  }
+
+  if (options.he_adaptive && options.he_exec_time)
+  {
+    std::unique_ptr<exec::IExecutionObserver> spo = std::make_unique<exec::SampledProfileObserver>(
+        options.he_exec_time, options.he_adaptive_sampling);
+    exec->addObserver(std::move(spo));
+  }
+
   return exec;
 }
 
@@ -271,6 +389,9 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
     pair.second->fixShapes();
   }
 
+  auto *memory_profiler = options.memory_profiler.get();
+  util::MemoryProfilePhase plan_phase{memory_profiler, "plan"};
+
   auto order = Linear::linearize(*lowered_graph);
   runTensorRegistration(lowered_graph.get(), order);
 
@@ -297,6 +418,9 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
     tensor_builder->prepare();
   }
 
+  plan_phase.end();
+  util::MemoryProfilePhase generate_phase{memory_profiler, "kernel generation"};
+
   ExecutionBuilder builder;
 
   // Generate kernels
@@ -316,6 +440,9 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
     builder.append(op_seq_index, {&op_seq, lower_info, std::move(fn_seq)});
   });
 
+  generate_phase.end();
+  util::MemoryProfilePhase allocate_phase{memory_profiler, "allocate"};
+
   for (const auto &tensor_builder : tensor_builders)
   {
     tensor_builder->allocate();
@@ -329,8 +456,18 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
   lowered_graph->graph().operands().iterate(
       [](const ir::OperandIndex &, ir::Operand &obj) { obj.releaseData(); });
 
+  allocate_phase.end();
+
   auto code_map = builder.releaseCodeMap();
 
+  // Scopes of kernels running at the same time would overlap
+  if (options.memory_profiler && !parallel)
+  {
+    wrapMemoryProfiler(code_map, options.memory_profiler);
+  }
+
+  util::MemoryProfilePhase prepare_phase{memory_profiler, "kernel prepare"};
+
   for (auto &it : code_map)
   {
     auto op_seq_index = it.first;
@@ -344,11 +481,26 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
     });
   }
 
+  for (auto &tensor_builder : tensor_builders)
+  {
+    tensor_builder->postAllFunctionsPrepare();
+  }
+
+  prepare_phase.end();
+
+  std::shared_ptr<exec::KernelProfiler> kernel_profiler;
+  if (!options.kernel_profile_filepath.empty())
+  {
+    kernel_profiler = createKernelProfiler(*lowered_graph, code_map);
+  }
+
   exec::ExecutorBase *exec = nullptr;
   if (parallel)
   {
-    exec =
-        new exec::ParallelExecutor{std::move(lowered_graph), tensor_builders, std::move(code_map)};
+    exec = new exec::ParallelExecutor{std::move(lowered_graph), tensor_builders,
+                                      std::move(code_map),
+                                      static_cast<uint32_t>(options.parallel_workers),
+                                      static_cast<uint32_t>(options.parallel_cores)};
   }
   else
   {
@@ -376,6 +528,27 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
     exec->addObserver(std::move(ctp));
   }
 
+  if (kernel_profiler)
+  {
+    std::unique_ptr<exec::IExecutionObserver> kpo = std::make_unique<exec::KernelProfileObserver>(
+        options.kernel_profile_filepath, kernel_profiler);
+    exec->addObserver(std::move(kpo));
+  }
+
+  if (options.memory_profiler)
+  {
+    std::unique_ptr<exec::IExecutionObserver> mpo =
+        std::make_unique<exec::MemoryProfileObserver>(options.memory_profiler);
+    exec->addObserver(std::move(mpo));
+  }
+
+  if (options.he_adaptive && options.he_exec_time)
+  {
+    std::unique_ptr<exec::IExecutionObserver> spo = std::make_unique<exec::SampledProfileObserver>(
+        options.he_exec_time, options.he_adaptive_sampling);
+    exec->addObserver(std::move(spo));
+  }
+
   return exec;
 }
 
@@ -20,7 +20,11 @@
 #include <unordered_map>
 
 #include "exec/IExecutor.h"
+#include "exec/FunctionSequence.h"
+#include "exec/KernelProfiler.h"
 #include "ir/LoweredGraph.h"
+#include "compiler/CodeMap.h"
+#include "util/MemoryProfiler.h"
 
 namespace onert
 {
@@ -44,6 +48,10 @@ private:
   static void initializeBackendContext(ir::LoweredGraph *lowered_graph);
   static void runTensorRegistration(ir::LoweredGraph *lowered_graph,
                                     const std::vector<ir::OpSequenceIndex> &order);
+  static std::shared_ptr<exec::KernelProfiler>
+  createKernelProfiler(const ir::LoweredGraph &lowered_graph, compiler::CodeMap &code_map);
+  static void wrapMemoryProfiler(compiler::CodeMap &code_map,
+                                 const std::shared_ptr<util::MemoryProfiler> &profiler);
   static exec::IExecutor *
   createLinearExecutor(std::unique_ptr<ir::LoweredGraph> lowered_graph,
                        const compiler::CompilerOptions &options,
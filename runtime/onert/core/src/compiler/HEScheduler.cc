@@ -283,7 +283,7 @@ int64_t HEScheduler::getPermuteTime(const backend::Backend *src_backend,
 int64_t HEScheduler::tryBackend(const ir::Operation &node, const backend::Backend *backend)
 {
   // if there is no profiling info don't use this backend during scheduling
-  if (!_is_profiling_mode)
+  if (!_is_profiling_mode && !_is_adaptive_mode)
   {
     VERBOSE(HEScheduler::tryBackend)
         << "Trying to HE schedule while there is no profiling info for " << node.name()
@@ -53,7 +53,7 @@ public:
   HEScheduler(const backend::BackendContexts &backend_contexts, const CompilerOptions &options)
       : _backend_contexts{backend_contexts}, _is_supported{}, _backends_avail_time{}, _ops_eft{},
         _op_to_rank{std::make_shared<ir::OperationIndexMap<int64_t>>()},
-        _is_profiling_mode{options.he_profiling_mode},
+        _is_profiling_mode{options.he_profiling_mode}, _is_adaptive_mode{options.he_adaptive},
         _is_linear_exec{options.executor == "Linear"},
         _is_parallel_exec{options.executor == "Parallel"}
   {
@@ -62,7 +62,8 @@ public:
       _all_backends.push_back(entry.first);
     }
     _backend_resolver = std::make_unique<compiler::BackendResolver>();
-    _exec_time = std::make_unique<exec::ExecTime>(_all_backends);
+    _exec_time = options.he_exec_time ? options.he_exec_time
+                                       : std::make_shared<exec::ExecTime>(_all_backends);
 
     // Find cpu backend
     auto cpu_backend_it = std::find_if(
@@ -169,12 +170,14 @@ private:
   std::multimap<int64_t, ir::OperationIndex, std::greater<int64_t>> _rank_to_op;
   std::shared_ptr<ir::OperationIndexMap<int64_t>> _op_to_rank;
   std::unique_ptr<compiler::BackendResolver> _backend_resolver;
-  std::unique_ptr<exec::ExecTime> _exec_time;
+  std::shared_ptr<exec::ExecTime> _exec_time;
   const ir::Graph *_graph{nullptr};
   std::vector<const backend::Backend *>
       _all_backends; // TODO Remove this and use _backend_contexts instead
   const backend::Backend *_cpu_backend{nullptr};
   bool _is_profiling_mode;
+  // Adaptive mode also tries backends without measurement like profiling mode
+  bool _is_adaptive_mode;
   bool _is_linear_exec;
   bool _is_parallel_exec;
 };
@@ -24,13 +24,16 @@
 #include "util/logging.h"
 #include "misc/string_helpers.h"
 
+#include <algorithm>
+
 namespace onert
 {
 namespace compiler
 {
 
-ManualScheduler::ManualScheduler(const compiler::ManualSchedulerOptions &options)
-    : _options{options}
+ManualScheduler::ManualScheduler(const std::vector<std::string> &backend_list,
+                                 const compiler::ManualSchedulerOptions &options)
+    : _backend_list{backend_list}, _options{options}
 {
 }
 
@@ -40,16 +43,36 @@ std::unique_ptr<BackendResolver> ManualScheduler::schedule(const ir::Graph &grap
 
   // 1. Backend for All operations
   const backend::Backend *backend_all = BackendManager::get().get(_options.backend_for_all);
-  if (!backend_all)
+  if (backend_all)
   {
-    backend_all = BackendManager::get().getAll().at(0);
+    VERBOSE(ManualScheduler) << "Default backend for all ops: " << _options.backend_for_all
+                             << std::endl;
+
+    graph.operations().iterate([&](const ir::OperationIndex &index, const ir::Operation &) {
+      backend_resolver->setBackend(index, backend_all);
+    });
   }
-  VERBOSE(ManualScheduler) << "Default backend for all ops: " << _options.backend_for_all
-                           << std::endl;
+  else
+  {
+    // The first backend in BACKENDS that supports each operation
+    std::vector<const backend::Backend *> backends;
+    for (const auto &backend_str : _backend_list)
+    {
+      auto backend = BackendManager::get().get(backend_str);
+      if (backend)
+        backends.push_back(backend);
+    }
+    // Operations that no backend supports go to the first one, which reports them later
+    const backend::Backend *backend_default =
+        backends.empty() ? BackendManager::get().getAll().at(0) : backends.front();
 
-  graph.operations().iterate([&](const ir::OperationIndex &index, const ir::Operation &) {
-    backend_resolver->setBackend(index, backend_all);
-  });
+    graph.operations().iterate([&](const ir::OperationIndex &index, const ir::Operation &op) {
+      auto found = std::find_if(backends.begin(), backends.end(), [&](const backend::Backend *b) {
+        return b->config()->supportOperation(op, graph.operands());
+      });
+      backend_resolver->setBackend(index, found != backends.end() ? *found : backend_default);
+    });
+  }
 
   // 2. Backend per operation type
   std::unordered_map<ir::OpCode, backend::Backend *> op_type_map;
@@ -28,10 +28,15 @@ namespace compiler
 class ManualScheduler : public IScheduler
 {
 public:
-  ManualScheduler(const compiler::ManualSchedulerOptions &options);
+  /**
+   * @param backend_list Backends in order of preference, which is BACKENDS
+   */
+  ManualScheduler(const std::vector<std::string> &backend_list,
+                  const compiler::ManualSchedulerOptions &options);
   std::unique_ptr<BackendResolver> schedule(const ir::Graph &graph) override;
 
 private:
+  std::vector<std::string> _backend_list;
   compiler::ManualSchedulerOptions _options;
 };
 
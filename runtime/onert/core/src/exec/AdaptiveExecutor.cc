@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "AdaptiveExecutor.h"
+
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+
+namespace onert
+{
+namespace exec
+{
+
+AdaptiveExecutor::AdaptiveExecutor(std::shared_ptr<ir::Graph> graph,
+                                   std::unique_ptr<IExecutor> executor, const CompileFn &compile,
+                                   uint32_t period)
+    : _graph{std::move(graph)}, _executor{std::move(executor)}, _compile{compile}, _period{period}
+{
+  assert(_period > 0);
+}
+
+AdaptiveExecutor::~AdaptiveExecutor()
+{
+  // Do not leave the background compilation running with destroyed members
+  if (_compiled.valid())
+    _compiled.wait();
+}
+
+void AdaptiveExecutor::changeInputShape(const ir::OperandIndex &index,
+                                        const ir::Shape &new_shape)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  _input_shapes[index] = new_shape;
+  _executor->changeInputShape(index, new_shape);
+}
+
+void AdaptiveExecutor::setIndexedRanks(std::shared_ptr<ir::OperationIndexMap<int64_t>> ranks)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  _executor->setIndexedRanks(ranks);
+}
+
+void AdaptiveExecutor::execute(const IODescription &desc)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  swapIfCompiled();
+
+  _executor->execute(desc);
+
+  if (++_run_count % _period == 0 && !_compiled.valid())
+  {
+    VERBOSE(AdaptiveExecutor) << "Start recompilation after " << _run_count << " runs"
+                              << std::endl;
+    _compiled = std::async(std::launch::async, _compile);
+  }
+}
+
+void AdaptiveExecutor::collectMetrics(RuntimeMetricsSnapshot &snapshot) const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  _executor->collectMetrics(snapshot);
+
+  snapshot.run_count += _retired_metrics.run_count;
+  snapshot.run_time_total_us += _retired_metrics.run_time_total_us;
+  snapshot.run_time_max_us = std::max(snapshot.run_time_max_us, _retired_metrics.run_time_max_us);
+  for (uint32_t i = 0; i < RuntimeMetricsSnapshot::NUM_LATENCY_BUCKETS; ++i)
+  {
+    snapshot.latency_histogram[i] += _retired_metrics.latency_histogram[i];
+  }
+  snapshot.permute_bytes += _retired_metrics.permute_bytes;
+}
+
+void AdaptiveExecutor::swapIfCompiled()
+{
+  if (!_compiled.valid() ||
+      _compiled.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+    return;
+
+  std::unique_ptr<IExecutor> executor;
+  try
+  {
+    executor = _compiled.get();
+    for (const auto &input_shape : _input_shapes)
+    {
+      executor->changeInputShape(input_shape.first, input_shape.second);
+    }
+  }
+  catch (const std::exception &e)
+  {
+    // Keep running with the current executor
+    VERBOSE(AdaptiveExecutor) << "Recompilation failed : " << e.what() << std::endl;
+    return;
+  }
+
+  // Memory of the replaced executor is released, so only run statistics are kept
+  _executor->collectMetrics(_retired_metrics);
+  _retired_metrics.arena_bytes = 0;
+  _retired_metrics.dynamic_alloc_bytes = 0;
+
+  _executor = std::move(executor);
+  VERBOSE(AdaptiveExecutor) << "Executor is replaced with recompiled one" << std::endl;
+}
+
+} // namespace exec
+} // namespace onert
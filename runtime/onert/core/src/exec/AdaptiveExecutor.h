@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  AdaptiveExecutor.h
+ * @brief This file contains AdaptiveExecutor class to replace executor with recompiled one
+ */
+
+#ifndef __ONERT_EXEC_ADAPTIVE_EXECUTOR_H__
+#define __ONERT_EXEC_ADAPTIVE_EXECUTOR_H__
+
+#include "exec/IExecutor.h"
+#include "exec/RuntimeMetrics.h"
+
+#include <functional>
+#include <future>
+#include <mutex>
+#include <unordered_map>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Executor that periodically recompiles the graph in background and swaps the executor
+ *        with the new one between runs
+ *
+ * Recompilation is expected to use measurements collected by the running executor, so that
+ * backend assignment follows the changes of input sizes and load.
+ */
+class AdaptiveExecutor final : public IExecutor
+{
+public:
+  using CompileFn = std::function<std::unique_ptr<IExecutor>()>;
+
+public:
+  /**
+   * @brief     Construct a new AdaptiveExecutor object
+   * @param[in] graph     Graph before lowering, which is shared by all recompiled executors
+   * @param[in] executor  Executor to run until the first recompilation is done
+   * @param[in] compile   Function to compile the graph again
+   * @param[in] period    Number of runs between recompilations
+   */
+  AdaptiveExecutor(std::shared_ptr<ir::Graph> graph, std::unique_ptr<IExecutor> executor,
+                   const CompileFn &compile, uint32_t period);
+  ~AdaptiveExecutor();
+
+public:
+  const ir::Graph &graph() override { return *_graph; }
+  void changeInputShape(const ir::OperandIndex &index, const ir::Shape &new_shape) override;
+  void setIndexedRanks(std::shared_ptr<ir::OperationIndexMap<int64_t>> ranks) override;
+  void execute(const IODescription &desc) override;
+  void collectMetrics(RuntimeMetricsSnapshot &snapshot) const override;
+
+private:
+  void swapIfCompiled();
+
+private:
+  std::shared_ptr<ir::Graph> _graph;
+  std::unique_ptr<IExecutor> _executor;
+  CompileFn _compile;
+  uint32_t _period;
+  uint64_t _run_count{0};
+  std::future<std::unique_ptr<IExecutor>> _compiled;
+  // Input shapes changed by user, which are applied to recompiled executor as well
+  std::unordered_map<ir::OperandIndex, ir::Shape> _input_shapes;
+  // Run counts and times of executors that have been replaced
+  RuntimeMetricsSnapshot _retired_metrics;
+  mutable std::mutex _mutex;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_ADAPTIVE_EXECUTOR_H__
@@ -30,6 +30,8 @@ int64_t ExecTime::getOperationExecTime(const backend::Backend *backend,
                                        const std::string &operation, bool quant,
                                        uint32_t op_size) const
 {
+  std::lock_guard<std::mutex> lock{_mutex};
+
   auto found_backend = _measurements.find(backend);
   if (found_backend == _measurements.end())
     return NOT_FOUND; // no execution time for this backend
@@ -98,6 +100,8 @@ void ExecTime::updateOperationExecTime(const backend::Backend *backend,
                                        const std::string &operation, bool quant, uint32_t op_size,
                                        int64_t time)
 {
+  std::lock_guard<std::mutex> lock{_mutex};
+
   // If the op is not implemented for some input, it should not be scheduled
   const auto &recs = _measurements[backend][operation][quant];
   if (time == getMax() ||
@@ -112,9 +116,9 @@ void ExecTime::updateOperationExecTime(const backend::Backend *backend,
     auto it = _measurements[backend][operation][quant].emplace(op_size, time);
     if (!it.second)
     {
-      // affect of the last measurement is bigger than the previous ones:
-      //   this prefers new metrics than older once, so will adapt backend changes
-      it.first->second = (it.first->second + time) / 2;
+      // _decay is the weight of the existing record, so the last measurement affects more than
+      // the previous ones when it is below 0.5, which adapts to backend changes faster
+      it.first->second = static_cast<int64_t>(it.first->second * _decay + time * (1.0 - _decay));
     }
   }
 }
@@ -158,5 +158,24 @@ void Execution::waitFinish()
 
 bool Execution::isFinished(void) const { return finished; }
 
+void Execution::collectMetrics(RuntimeMetricsSnapshot &snapshot) const
+{
+  snapshot = RuntimeMetricsSnapshot{};
+  for (const auto &pair : *_executors)
+  {
+    if (pair.first == ir::SubgraphIndex{0})
+    {
+      pair.second->collectMetrics(snapshot);
+      continue;
+    }
+
+    RuntimeMetricsSnapshot subg_snapshot;
+    pair.second->collectMetrics(subg_snapshot);
+    snapshot.arena_bytes += subg_snapshot.arena_bytes;
+    snapshot.dynamic_alloc_bytes += subg_snapshot.dynamic_alloc_bytes;
+    snapshot.permute_bytes += subg_snapshot.permute_bytes;
+  }
+}
+
 } // namespace exec
 } // namespace onert
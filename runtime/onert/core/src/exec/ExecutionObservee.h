@@ -45,6 +45,10 @@ public:
                       const backend::Backend *backend);
   void notifyJobEnd(IExecutor *executor, const ir::OpSequence *op_seq,
                     const backend::Backend *backend);
+  /**
+   * @brief Whether no observer is registered, so that notifying is nothing
+   */
+  bool empty() const { return _observers.empty(); }
 
 private:
   std::list<std::unique_ptr<IExecutionObserver>> _observers;
@@ -29,25 +29,16 @@ namespace onert
 namespace exec
 {
 
-void ProfileObserver::handleBegin(onert::exec::IExecutor *, const ir::OpSequence *,
-                                  const onert::backend::Backend *backend)
+namespace
 {
-  _timer = backend->config()->timer();
-  if (_timer == nullptr)
-    throw std::runtime_error("To profile backend timer() method must be implemented");
-  _timer->handleBegin();
-}
 
-void ProfileObserver::handleEnd(IExecutor *exec, const ir::OpSequence *op_seq,
-                                const backend::Backend *backend)
+void updateExecTime(ExecTime &et, IExecutor *exec, const ir::OpSequence *op_seq,
+                    const backend::Backend *backend, int64_t time)
 {
-  _timer->handleEnd();
-  const auto timer_res = _timer->getTime();
-
   // NOTE This assumes there is just one operation in a op_seq
   auto node = op_seq->operations().at(0).node;
   auto node_name = node->name();
-  VERBOSE(ProfileInfo) << "Time for " << node_name << " : " << timer_res << std::endl;
+  VERBOSE(ProfileInfo) << "Time for " << node_name << " : " << time << std::endl;
 
   // fill ExecTime:
   bool is_quantized = exec->graph().operands().at(node->getInputs().at(0)).typeInfo().type() ==
@@ -61,14 +52,66 @@ void ProfileObserver::handleEnd(IExecutor *exec, const ir::OpSequence *op_seq,
   if (node_name == "Permute")
   {
     // TODO Change it to updateOperationExecTime()
-    _et->updatePermuteTime(backend, backend, is_quantized, size, timer_res);
+    et.updatePermuteTime(backend, backend, is_quantized, size, time);
   }
   else
   {
-    _et->updateOperationExecTime(backend, node_name, is_quantized, size, timer_res);
+    et.updateOperationExecTime(backend, node_name, is_quantized, size, time);
   }
+}
+
+} // namespace
+
+void ProfileObserver::handleBegin(onert::exec::IExecutor *, const ir::OpSequence *,
+                                  const onert::backend::Backend *backend)
+{
+  _timer = backend->config()->timer();
+  if (_timer == nullptr)
+    throw std::runtime_error("To profile backend timer() method must be implemented");
+  _timer->handleBegin();
+}
+
+void ProfileObserver::handleEnd(IExecutor *exec, const ir::OpSequence *op_seq,
+                                const backend::Backend *backend)
+{
+  _timer->handleEnd();
+  const auto timer_res = _timer->getTime();
+
+  updateExecTime(*_et, exec, op_seq, backend, timer_res);
 };
 
+void SampledProfileObserver::handleBegin(IExecutor *)
+{
+  _sampling = (_run_count++ % _sampling_period) == 0;
+}
+
+void SampledProfileObserver::handleBegin(IExecutor *, const ir::OpSequence *op_seq,
+                                         const backend::Backend *)
+{
+  if (!_sampling)
+    return;
+
+  const auto now = std::chrono::steady_clock::now();
+  std::lock_guard<std::mutex> lock{_mutex};
+  _begin[op_seq] = now;
+}
+
+void SampledProfileObserver::handleEnd(IExecutor *exec, const ir::OpSequence *op_seq,
+                                       const backend::Backend *backend)
+{
+  if (!_sampling)
+    return;
+
+  const auto now = std::chrono::steady_clock::now();
+  std::chrono::steady_clock::time_point begin;
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    begin = _begin.at(op_seq);
+  }
+  const auto time = std::chrono::duration_cast<std::chrono::microseconds>(now - begin).count();
+  updateExecTime(*_et, exec, op_seq, backend, time);
+}
+
 ChromeTracingObserver::ChromeTracingObserver(const std::string &filepath)
     : _ofs{filepath, std::ofstream::out}, _recorder{}, _collector{&_recorder}
 {
@@ -102,6 +145,24 @@ void ChromeTracingObserver::handleEnd(IExecutor *)
   _collector.onEvent(EventCollector::Event{EventCollector::Edge::END, "runtime", "Graph"});
 }
 
+KernelProfileObserver::KernelProfileObserver(const std::string &filepath,
+                                             std::shared_ptr<KernelProfiler> profiler)
+    : _filepath{filepath}, _profiler{std::move(profiler)}
+{
+}
+
+KernelProfileObserver::~KernelProfileObserver()
+{
+  if (_profiler->numRuns() == 0)
+    return;
+
+  std::ofstream trace_ofs{_filepath, std::ofstream::out};
+  _profiler->writeChromeTrace(trace_ofs);
+
+  std::ofstream summary_ofs{_filepath + ".summary", std::ofstream::out};
+  _profiler->writeSummary(summary_ofs);
+}
+
 std::string ChromeTracingObserver::opSequenceTag(const ir::OpSequence *op_seq)
 {
   if (op_seq->size() == 0)
@@ -17,6 +17,8 @@
 #include "ExecutorBase.h"
 #include "util/logging.h"
 
+#include <chrono>
+
 namespace onert
 {
 namespace exec
@@ -24,7 +26,8 @@ namespace exec
 
 ExecutorBase::ExecutorBase(std::unique_ptr<ir::LoweredGraph> &&lowered_graph,
                            const backend::TensorBuilderSet &tensor_builders)
-    : _lowered_graph{std::move(lowered_graph)}, _graph{_lowered_graph->graph()}, _mutex()
+    : _lowered_graph{std::move(lowered_graph)}, _graph{_lowered_graph->graph()}, _mutex(),
+      _metrics{}, _permute_bytes_per_run{0}
 {
   auto build_input_tensor_list = [&](const onert::ir::OperandIndexSequence &ind_seq) {
     std::vector<std::shared_ptr<backend::ITensor>> list;
@@ -70,6 +73,18 @@ ExecutorBase::ExecutorBase(std::unique_ptr<ir::LoweredGraph> &&lowered_graph,
   _input_tensors = build_input_tensor_list(_graph.getInputs());
   _output_tensors = build_output_tensor_list(_graph.getOutputs());
 
+  // Permute operations copy whole tensors, so the amount is fixed unless the shape is dynamic
+  _graph.operations().iterate([&](const ir::OperationIndex &, const ir::Operation &op) {
+    if (op.opcode() != ir::OpCode::Permute)
+      return;
+    for (const auto &ind : op.getOutputs())
+    {
+      const auto &info = _graph.operands().at(ind).info();
+      if (!info.shape().hasUnknownDim())
+        _permute_bytes_per_run += info.total_size();
+    }
+  });
+
   // Prepare each TensorManager on each backend
   for (auto &tensor_builder : tensor_builders)
   {
@@ -104,6 +119,7 @@ std::unique_ptr<ISource> ExecutorBase::source(const ir::IOIndex &index, const ir
     case DataType::UINT8:
       return source<uint8_t>(index, buffer, length, io_layout);
     case DataType::QUANT8_SYMM:
+    case DataType::QUANT8_ASYMM_SIGNED:
       return source<int8_t>(index, buffer, length, io_layout);
     default:
       throw std::runtime_error("Not supported yet");
@@ -127,6 +143,7 @@ std::unique_ptr<ISink> ExecutorBase::sink(const ir::IOIndex &index, const ir::Ty
     case DataType::UINT8:
       return sink<uint8_t>(index, buffer, length, io_layout);
     case DataType::QUANT8_SYMM:
+    case DataType::QUANT8_ASYMM_SIGNED:
       return sink<int8_t>(index, buffer, length, io_layout);
     default:
       throw std::runtime_error("Not supported yet");
@@ -154,6 +171,29 @@ void ExecutorBase::changeInputShape(const ir::OperandIndex &index, const ir::Sha
                            "check if the tensor's backend supports dynamic tensor.");
 }
 
+void ExecutorBase::executeWithMetrics()
+{
+  const auto begin = std::chrono::steady_clock::now();
+
+  executeImpl();
+
+  const auto end = std::chrono::steady_clock::now();
+  _metrics.addRun(std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count());
+  _metrics.addPermuteBytes(_permute_bytes_per_run);
+}
+
+void ExecutorBase::collectMetrics(RuntimeMetricsSnapshot &snapshot) const
+{
+  _metrics.snapshot(snapshot);
+
+  for (const auto &tensor_mgr : _tensor_mgrs)
+  {
+    const auto stats = tensor_mgr->memoryStats();
+    snapshot.arena_bytes += stats.arena_bytes;
+    snapshot.dynamic_alloc_bytes += stats.dynamic_alloc_bytes;
+  }
+}
+
 void ExecutorBase::execute()
 {
   // For thread-safe, use mutex
@@ -162,7 +202,7 @@ void ExecutorBase::execute()
   // Deadlock occurs when an Executor is called recursively.
   std::lock_guard<std::mutex> lock(_mutex);
 
-  executeImpl();
+  executeWithMetrics();
 }
 
 void ExecutorBase::execute(const IODescription &desc)
@@ -219,7 +259,7 @@ void ExecutorBase::execute(const IODescription &desc)
     _input_tensors[n]->access(setter);
   }
 
-  executeImpl();
+  executeWithMetrics();
 
   // Get output(s)
   for (uint32_t n = 0; n < _graph.getOutputs().size(); ++n)
@@ -34,6 +34,7 @@
 #include "backend/ITensorManager.h"
 #include "backend/ITensorBuilder.h"
 #include "exec/ExecutionObservee.h"
+#include "exec/RuntimeMetrics.h"
 #include <list>
 
 namespace onert
@@ -63,6 +64,8 @@ public:
 
   void execute(const IODescription &desc) final;
 
+  void collectMetrics(RuntimeMetricsSnapshot &snapshot) const override;
+
   // Used only in Dataflow and Parallel Executors
   void setIndexedRanks(std::shared_ptr<ir::OperationIndexMap<int64_t>> ranks) final
   {
@@ -81,6 +84,8 @@ public:
   }
 
 private:
+  void executeWithMetrics();
+
   std::unique_ptr<ISource> source(const ir::IOIndex &index, const ir::TypeInfo &type,
                                   const void *buffer, size_t length, ir::Layout io_layout);
   std::unique_ptr<ISink> sink(const ir::IOIndex &index, const ir::TypeInfo &type, void *buffer,
@@ -101,6 +106,13 @@ private:
     {
       return std::make_unique<PermutateSource<T>>(buffer, length, operand.shape(), io_layout);
     }
+    if (tensor_layout == ir::Layout::NCHWc)
+    {
+      // Blocked layout of a backend is converted here, so that users see no difference
+      return std::make_unique<PermutateSource<T>>(
+          buffer, length, operand.shape(),
+          io_layout == ir::Layout::NCHW ? ir::Layout::NCHW : ir::Layout::NHWC);
+    }
     // TODO Change this to return error
     assert(io_layout != ir::Layout::UNKNOWN ||
            (tensor_layout != ir::Layout::NCHW && tensor_layout != ir::Layout::NCHW));
@@ -122,6 +134,13 @@ private:
     {
       return std::make_unique<PermutateSink<T>>(buffer, length, operand.shape(), io_layout);
     }
+    if (tensor_layout == ir::Layout::NCHWc)
+    {
+      // Blocked layout of a backend is converted here, so that users see no difference
+      return std::make_unique<PermutateSink<T>>(
+          buffer, length, operand.shape(),
+          io_layout == ir::Layout::NCHW ? ir::Layout::NCHW : ir::Layout::NHWC);
+    }
     // TODO Change this to return error
     assert(io_layout != ir::Layout::UNKNOWN ||
            (tensor_layout != ir::Layout::NCHW && tensor_layout != ir::Layout::NCHW));
@@ -156,6 +175,9 @@ protected:
   std::unordered_map<std::shared_ptr<backend::ITensor>, DynAllocInfo> _input_to_dyn_alloc_info;
   backend::TensorManagerSet _tensor_mgrs;
   std::mutex _mutex;
+  RuntimeMetrics _metrics;
+  /// @brief Bytes copied by Permute operations for each execution
+  uint64_t _permute_bytes_per_run;
 };
 
 } // namespace exec
@@ -64,6 +64,15 @@ void FunctionSequence::iterate(const std::function<void(IFunction &)> &fn)
   }
 }
 
+void FunctionSequence::wrap(
+    const std::function<std::unique_ptr<IFunction>(std::unique_ptr<IFunction> &&)> &fn)
+{
+  for (auto &func : _functions)
+  {
+    func = fn(std::move(func));
+  }
+}
+
 void FunctionSequenceForDynamicBackend::run()
 {
   if (_op_seq.size() != _functions.size())
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/KernelProfiler.h"
+
+#include "misc/EventRecorder.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <iomanip>
+#include <numeric>
+
+namespace
+{
+
+// Timestamp in microseconds which Chrome trace format uses
+std::string timestamp(uint64_t ns)
+{
+  std::stringstream ss;
+  ss << ns / 1000 << "." << std::setw(3) << std::setfill('0') << ns % 1000;
+  return ss.str();
+}
+
+DurationEvent durationEvent(const std::string &tid, const std::string &name, const std::string &ph,
+                            uint64_t ns)
+{
+  DurationEvent evt;
+  evt.name = name;
+  evt.tid = tid;
+  evt.ph = ph;
+  evt.ts = timestamp(ns);
+  return evt;
+}
+
+// Nearest-rank percentile of sorted values
+uint64_t percentile(const std::vector<uint64_t> &sorted, uint32_t p)
+{
+  assert(!sorted.empty());
+  size_t rank = (sorted.size() * p + 99) / 100;
+  return sorted.at(std::max<size_t>(rank, 1) - 1);
+}
+
+} // namespace
+
+namespace onert
+{
+namespace exec
+{
+
+KernelProfiler::KernelId KernelProfiler::registerKernel(const KernelInfo &info)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  _kernels.emplace_back(info);
+  _durations.emplace_back();
+  return _kernels.size() - 1;
+}
+
+void KernelProfiler::beginRun()
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  _runs.push_back(Run{now(), 0});
+}
+
+void KernelProfiler::endRun()
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  assert(!_runs.empty());
+  _runs.back().end = now();
+}
+
+void KernelProfiler::record(KernelId id, uint64_t begin, uint64_t end)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  auto res = _thread_ids.emplace(std::this_thread::get_id(), _thread_ids.size());
+  _records.push_back(Record{id, res.first->second, begin, end});
+  _durations.at(id).push_back(end - begin);
+}
+
+uint32_t KernelProfiler::numRuns() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _runs.size();
+}
+
+uint64_t KernelProfiler::now()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void KernelProfiler::writeChromeTrace(std::ostream &os)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  EventRecorder recorder;
+  for (const auto &run : _runs)
+  {
+    recorder.emit(durationEvent("runtime", "Graph", "B", run.begin));
+    if (run.end != 0)
+      recorder.emit(durationEvent("runtime", "Graph", "E", run.end));
+  }
+
+  for (const auto &record : _records)
+  {
+    const auto &kernel = _kernels.at(record.id);
+    std::string tid = kernel.backend;
+    if (record.tid != 0)
+      tid += " #" + std::to_string(record.tid);
+    const auto label = "$" + std::to_string(kernel.index.value()) + " " + kernel.name;
+    recorder.emit(durationEvent(tid, label, "B", record.begin));
+    recorder.emit(durationEvent(tid, label, "E", record.end));
+  }
+
+  recorder.writeToFile(os);
+}
+
+void KernelProfiler::writeSummary(std::ostream &os)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  struct Row
+  {
+    KernelId id;
+    uint64_t count;
+    uint64_t total;
+    uint64_t p50;
+    uint64_t p90;
+    uint64_t p99;
+  };
+
+  std::vector<Row> rows;
+  uint64_t grand_total = 0;
+  for (KernelId id = 0; id < _kernels.size(); ++id)
+  {
+    auto durations = _durations.at(id);
+    if (durations.empty())
+      continue;
+
+    std::sort(durations.begin(), durations.end());
+    const auto total = std::accumulate(durations.begin(), durations.end(), uint64_t{0});
+    rows.push_back(Row{id, durations.size(), total, percentile(durations, 50),
+                       percentile(durations, 90), percentile(durations, 99)});
+    grand_total += total;
+  }
+
+  std::sort(rows.begin(), rows.end(),
+            [](const Row &lhs, const Row &rhs) { return lhs.total > rhs.total; });
+
+  const auto us = [](uint64_t ns) { return static_cast<double>(ns) / 1000.0; };
+
+  os << "Kernel profile over " << _runs.size() << " run(s)" << std::endl;
+  os << std::left << std::setw(8) << "Index" << std::setw(24) << "Operation" << std::setw(12)
+     << "Backend" << std::right << std::setw(8) << "Count" << std::setw(12) << "Mean(us)"
+     << std::setw(12) << "p50(us)" << std::setw(12) << "p90(us)" << std::setw(12) << "p99(us)"
+     << std::setw(8) << "%" << std::setw(12) << "MFLOPs" << std::setw(10) << "GFLOP/s"
+     << std::setw(12) << "KBytes" << std::setw(10) << "GB/s" << std::endl;
+
+  os << std::fixed << std::setprecision(2);
+  for (const auto &row : rows)
+  {
+    const auto &kernel = _kernels.at(row.id);
+    const auto mean = static_cast<double>(row.total) / row.count;
+    const auto ratio = grand_total == 0 ? 0.0 : 100.0 * row.total / grand_total;
+    // FLOPs per nanosecond is equal to GFLOP/s, and so for bytes
+    const auto gflops = row.p50 == 0 ? 0.0 : static_cast<double>(kernel.flops) / row.p50;
+    const auto gbps = row.p50 == 0 ? 0.0 : static_cast<double>(kernel.bytes) / row.p50;
+
+    os << std::left << std::setw(8) << ("$" + std::to_string(kernel.index.value()))
+       << std::setw(24) << kernel.name << std::setw(12) << kernel.backend << std::right
+       << std::setw(8) << row.count << std::setw(12) << us(mean) << std::setw(12) << us(row.p50)
+       << std::setw(12) << us(row.p90) << std::setw(12) << us(row.p99) << std::setw(8) << ratio
+       << std::setw(12) << kernel.flops / 1e6 << std::setw(10) << gflops << std::setw(12)
+       << kernel.bytes / 1e3 << std::setw(10) << gbps << std::endl;
+  }
+
+  os << "Total kernel time : " << us(grand_total) / 1000.0 << " ms" << std::endl;
+  os.unsetf(std::ios_base::floatfield);
+}
+
+} // namespace exec
+} // namespace onert
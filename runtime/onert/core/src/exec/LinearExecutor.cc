@@ -37,8 +37,51 @@ char *seq_to_label(const onert::ir::OpSequence *op_seq)
 } // namespace
 #endif
 
+void LinearExecutor::flatten()
+{
+#ifdef RUY_PROFILER
+  // Each sequence needs a profiler label
+  return;
+#endif
+  bool has_dynamic = false;
+  _graph.operands().iterate([&](const ir::OperandIndex &, const ir::Operand &operand) {
+    has_dynamic = has_dynamic || operand.info().isDynamic();
+  });
+  if (has_dynamic)
+    return;
+
+  for (auto &&code : _code)
+  {
+    code.fn_seq->iterate([&](IFunction &fn) { _flat_functions.emplace_back(&fn); });
+  }
+}
+
+bool LinearExecutor::canRunFlat() const
+{
+  if (_flat_functions.empty() || !_subject.empty())
+    return false;
+
+  for (const auto &input_tensor : _input_tensors)
+  {
+    if (input_tensor->is_dynamic())
+      return false;
+  }
+  return true;
+}
+
 void LinearExecutor::executeImpl()
 {
+  // Small models spend much of a run in dispatching, so run kernels directly if nothing else is
+  // required
+  if (canRunFlat())
+  {
+    for (auto fn : _flat_functions)
+    {
+      fn->run();
+    }
+    return;
+  }
+
   _subject.notifyModelBegin(this);
   for (auto &&code : _code)
   {
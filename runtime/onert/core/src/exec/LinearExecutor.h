@@ -55,13 +55,30 @@ public:
     {
       _code.emplace_back(std::move(code_map.at(index)));
     }
+    flatten();
   }
 
 public:
   void executeImpl(void) override;
 
+private:
+  /**
+   * @brief Collect functions of all sequences into a flat array, if the graph has no dynamic
+   *        tensor at compile time
+   */
+  void flatten();
+  /**
+   * @brief Whether the flat array of functions can be run for this execution
+   *
+   * It skips notifying observers and shape inference of FunctionSequenceForDynamicBackend, so
+   * it is allowed only if no observer is registered and no input is dynamic.
+   */
+  bool canRunFlat() const;
+
 private:
   std::vector<compiler::CodeAndInfo> _code;
+  /// @brief Functions of all sequences in order, which is empty if it cannot be used
+  std::vector<IFunction *> _flat_functions;
 };
 
 } // namespace exec
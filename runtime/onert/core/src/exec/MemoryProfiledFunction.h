@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __ONERT_EXEC_MEMORY_PROFILED_FUNCTION_H__
+#define __ONERT_EXEC_MEMORY_PROFILED_FUNCTION_H__
+
+#include "exec/IFunction.h"
+#include "util/MemoryProfiler.h"
+
+#include <memory>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief IFunction decorator that records heap usage of the wrapped kernel, separately for
+ *        prepare() and runs
+ *
+ * @note  The wrapped kernel is always run with runSync() so that allocations of asynchronous
+ *        backends are attributed to the kernel
+ */
+class MemoryProfiledFunction : public IFunction
+{
+public:
+  MemoryProfiledFunction(std::unique_ptr<IFunction> &&fn,
+                         std::shared_ptr<util::MemoryProfiler> profiler,
+                         util::MemoryProfiler::ScopeId run_id,
+                         util::MemoryProfiler::ScopeId prepare_id)
+      : _fn{std::move(fn)}, _profiler{std::move(profiler)}, _run_id{run_id},
+        _prepare_id{prepare_id}
+  {
+  }
+
+public:
+  void run() override { runSync(); }
+
+  void runSync() override
+  {
+    _profiler->begin(_run_id);
+    _fn->runSync();
+    _profiler->end(_run_id);
+  }
+
+  void prepare() override
+  {
+    _profiler->begin(_prepare_id);
+    _fn->prepare();
+    _profiler->end(_prepare_id);
+  }
+
+private:
+  std::unique_ptr<IFunction> _fn;
+  std::shared_ptr<util::MemoryProfiler> _profiler;
+  util::MemoryProfiler::ScopeId _run_id;
+  util::MemoryProfiler::ScopeId _prepare_id;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_MEMORY_PROFILED_FUNCTION_H__
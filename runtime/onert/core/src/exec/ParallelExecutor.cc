@@ -20,6 +20,7 @@
 
 #include "util/logging.h"
 #include "exec/IFunction.h"
+#include "ir/OperationCostEstimator.h"
 
 namespace onert
 {
@@ -55,6 +56,10 @@ void ParallelExecutor::notify(uint32_t finished_job_id)
   std::unique_lock<std::mutex> lock{_mu_jobs};
 
   DataflowExecutor::notify(finished_job_id);
+  assert(_num_running_jobs > 0);
+  --_num_running_jobs;
+  _thread_budget.release(_job_threads[finished_job_id]);
+  _job_threads[finished_job_id] = 0;
 
   lock.unlock();
   _cv_jobs.notify_all();
@@ -62,23 +67,40 @@ void ParallelExecutor::notify(uint32_t finished_job_id)
 
 ParallelExecutor::ParallelExecutor(std::unique_ptr<ir::LoweredGraph> lowered_graph,
                                    const backend::TensorBuilderSet &tensor_builders,
-                                   compiler::CodeMap &&code_map)
-    : DataflowExecutor{std::move(lowered_graph), tensor_builders, std::move(code_map)}
+                                   compiler::CodeMap &&code_map, uint32_t num_workers,
+                                   uint32_t num_cores)
+    : DataflowExecutor{std::move(lowered_graph), tensor_builders, std::move(code_map)},
+      _num_workers{num_workers}, _thread_budget{num_cores}
 {
-  VERBOSE(ParallelExecutor) << "Constructing Parallel Executor" << std::endl;
-}
+  VERBOSE(ParallelExecutor) << "Constructing Parallel Executor with " << _num_workers
+                            << " worker(s) per backend on " << num_cores << " core(s)"
+                            << std::endl;
+
+  ir::OperationCostEstimator cost_estimator{_lowered_graph->graph().operands()};
+  _job_costs.resize(_finished_jobs.size(), 0);
+  _job_threads.resize(_finished_jobs.size(), 0);
+  for (const auto &pair : _job_to_op_seq)
+  {
+    for (const auto &element : _lowered_graph->op_seqs().at(pair.second))
+    {
+      const auto cost = cost_estimator.estimate(*element.node);
+      _job_costs[pair.first] += cost.flops + cost.bytes;
+    }
+  }
 
-void ParallelExecutor::executeImpl()
-{
-  // Init scheduler
+  // Worker threads are kept over runs, so that per-thread resources of kernels(e.g. GEMM
+  // contexts) are not created again for every run
   // TODO Consider to have distinct backend set in LowerInfoMap
   ir::BackendSet backends;
   for (auto &itr : _lowered_graph->getLowerInfo()->op_seq)
   {
     backends.add(itr.second->backend());
   }
-  _scheduler = std::make_unique<ParallelScheduler>(backends);
+  _scheduler = std::make_unique<ParallelScheduler>(backends, _num_workers);
+}
 
+void ParallelExecutor::executeImpl()
+{
   assert(noWaitingJobs());
 
   // Execution setup
@@ -111,18 +133,36 @@ void ParallelExecutor::executeImpl()
       }
     }
 
+    // Dispatch only when a core is free so that running jobs are not oversubscribed
+    _cv_jobs.wait(lock, [this] { return _thread_budget.available() > 0; });
+
     auto job = std::move(_ready_jobs.begin()->second);
     _ready_jobs.erase(_ready_jobs.begin());
+    ++_num_running_jobs;
+
+    auto job_index = job->index();
+    uint64_t pending_cost = 0;
+    for (const auto &pair : _ready_jobs)
+    {
+      pending_cost += _job_costs[pair.second->index()];
+    }
+    const auto num_threads =
+        _thread_budget.acquire(_job_costs[job_index], pending_cost, _ready_jobs.size());
+    assert(num_threads > 0);
+    _job_threads[job_index] = num_threads;
 
     lock.unlock();
 
-    VERBOSE(ParallelExecutor) << "Assigning fn #" << job->index() << std::endl;
+    VERBOSE(ParallelExecutor) << "Assigning fn #" << job_index << " with " << num_threads
+                              << " thread(s)" << std::endl;
 
-    auto job_index = job->index();
     auto op_sequence_index = _job_to_op_seq[job_index];
     auto op_seq = &_lowered_graph->op_seqs().at(op_sequence_index);
     auto backend = _lowered_graph->getLowerInfo()->op_seq.at(op_sequence_index)->backend();
-    auto setup = [&, op_seq, backend]() { _subject.notifyJobBegin(this, op_seq, backend); };
+    auto setup = [&, op_seq, backend, num_threads]() {
+      backend->config()->setIntraOpThreads(num_threads);
+      _subject.notifyJobBegin(this, op_seq, backend);
+    };
     auto teardown = [&, job_index, op_seq, backend]() {
       _subject.notifyJobEnd(this, op_seq, backend);
       notify(job_index);
@@ -135,7 +175,10 @@ void ParallelExecutor::executeImpl()
   assert(noWaitingJobs());
 
   // Wait for all the jobs done
-  _scheduler->finish();
+  {
+    std::unique_lock<std::mutex> lock{_mu_jobs};
+    _cv_jobs.wait(lock, [this] { return _num_running_jobs == 0; });
+  }
   _subject.notifyModelEnd(this);
 
   // Reset input info for the next execution
@@ -28,6 +28,7 @@
 #include <memory>
 #include "exec/DataflowExecutor.h"
 #include "ParallelScheduler.h"
+#include "ThreadBudget.h"
 
 namespace onert
 {
@@ -49,9 +50,12 @@ public:
    * @param lowered_graph LoweredGraph object
    * @param tensor_builders Tensor builders that are currently used
    * @param code_map OpSequence and its code map
+   * @param num_workers Number of worker threads per backend
+   * @param num_cores Number of cores shared by jobs running at the same time
    */
   ParallelExecutor(std::unique_ptr<ir::LoweredGraph> lowered_graph,
-                   const backend::TensorBuilderSet &tensor_builders, compiler::CodeMap &&code_map);
+                   const backend::TensorBuilderSet &tensor_builders, compiler::CodeMap &&code_map,
+                   uint32_t num_workers = 1, uint32_t num_cores = 1);
 
   void executeImpl() override;
 
@@ -59,6 +63,13 @@ private:
   std::condition_variable _cv_jobs;
   std::mutex _mu_jobs;
   std::unique_ptr<ParallelScheduler> _scheduler;
+  uint32_t _num_workers;
+  uint32_t _num_running_jobs = 0;
+  ThreadBudget _thread_budget;
+  /// @brief Estimated cost of each job to divide cores
+  std::vector<uint64_t> _job_costs;
+  /// @brief Number of threads given to each running job
+  std::vector<uint32_t> _job_threads;
 };
 
 } // namespace exec
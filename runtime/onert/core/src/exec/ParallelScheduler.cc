@@ -26,13 +26,13 @@ namespace onert
 namespace exec
 {
 
-ParallelScheduler::ParallelScheduler(const ir::BackendSet &backends)
+ParallelScheduler::ParallelScheduler(const ir::BackendSet &backends, uint32_t num_threads)
 {
   assert(!backends.empty());
 
   for (auto backend : backends)
   {
-    _thread_pools[backend] = std::make_unique<ThreadPool>();
+    _thread_pools[backend] = std::make_unique<ThreadPool>(num_threads);
   }
 }
 
@@ -36,8 +36,9 @@ public:
    * @brief Constructs ParallelScheduler object
    *
    * @param backends Backend set
+   * @param num_threads Number of threads for each backend
    */
-  ParallelScheduler(const ir::BackendSet &backends);
+  ParallelScheduler(const ir::BackendSet &backends, uint32_t num_threads = 1);
   /**
    * @brief Assign a task to the given backend
    *
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_PROFILED_FUNCTION_H__
+#define __ONERT_EXEC_PROFILED_FUNCTION_H__
+
+#include "exec/IFunction.h"
+#include "exec/KernelProfiler.h"
+
+#include <memory>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief IFunction decorator that records execution time of the wrapped kernel
+ *
+ * @note  The wrapped kernel is always run with runSync() so that asynchronous backends report
+ *        the time actually spent on the kernel
+ */
+class ProfiledFunction : public IFunction
+{
+public:
+  ProfiledFunction(std::unique_ptr<IFunction> &&fn, std::shared_ptr<KernelProfiler> profiler,
+                   KernelProfiler::KernelId id)
+      : _fn{std::move(fn)}, _profiler{std::move(profiler)}, _id{id}
+  {
+  }
+
+public:
+  void run() override { runSync(); }
+
+  void runSync() override
+  {
+    const auto begin = KernelProfiler::now();
+    _fn->runSync();
+    _profiler->record(_id, begin, KernelProfiler::now());
+  }
+
+  void prepare() override { _fn->prepare(); }
+
+private:
+  std::unique_ptr<IFunction> _fn;
+  std::shared_ptr<KernelProfiler> _profiler;
+  KernelProfiler::KernelId _id;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_PROFILED_FUNCTION_H__
@@ -22,6 +22,7 @@
 #include <memory>
 #include "util/feature/nchw/Reader.h"
 #include "util/feature/nchw/View.h"
+#include "util/feature/nchwc/Reader.h"
 #include "util/feature/nhwc/Reader.h"
 #include "util/feature/nhwc/View.h"
 #include "util/Utils.h"
@@ -53,7 +54,8 @@ protected:
   void pullUnif(onert::backend::ITensor &tensor) const
   {
     assert(((_io_layout == ir::Layout::NHWC && tensor.layout() == ir::Layout::NCHW) ||
-            (_io_layout == ir::Layout::NCHW && tensor.layout() == ir::Layout::NHWC)) ||
+            (_io_layout == ir::Layout::NCHW && tensor.layout() == ir::Layout::NHWC) ||
+            tensor.layout() == ir::Layout::NCHWc) ||
            _copy);
     auto input_buffer = tensor.buffer();
     auto rank = _shape.rank();
@@ -125,7 +127,27 @@ protected:
         {
           const auto shape = _shape.asFeature(_io_layout);
 
-          if (_io_layout == ir::Layout::NHWC)
+          if (tensor.layout() == ir::Layout::NCHWc)
+          {
+            const util::feature::nchwc::Reader<T> from(&tensor);
+            if (_io_layout == ir::Layout::NCHW)
+            {
+              util::feature::nchw::View<T> into(shape, _output_buffer, _output_size);
+              ::nnfw::misc::feature::iterate(shape)
+                  << [&](uint32_t batch, uint32_t ch, uint32_t row, uint32_t col) {
+                       into.at(batch, ch, row, col) = from.at(batch, row, col, ch);
+                     };
+            }
+            else
+            {
+              util::feature::nhwc::View<T> into(shape, _output_buffer, _output_size);
+              ::nnfw::misc::feature::iterate(shape)
+                  << [&](uint32_t batch, uint32_t ch, uint32_t row, uint32_t col) {
+                       into.at(batch, row, col, ch) = from.at(batch, row, col, ch);
+                     };
+            }
+          }
+          else if (_io_layout == ir::Layout::NHWC)
           {
             const util::feature::nchw::Reader<T> from(&tensor);
             util::feature::nhwc::View<T> into(shape, _output_buffer, _output_size);
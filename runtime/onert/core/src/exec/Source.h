@@ -22,6 +22,7 @@
 #include <memory>
 #include "util/feature/nchw/Reader.h"
 #include "util/feature/nchw/View.h"
+#include "util/feature/nchwc/View.h"
 #include "util/feature/nhwc/Reader.h"
 #include "util/feature/nhwc/View.h"
 #include "util/Utils.h"
@@ -58,7 +59,8 @@ protected:
   void pushUnif(onert::backend::ITensor &tensor) const
   {
     assert(((_io_layout == ir::Layout::NHWC && tensor.layout() == ir::Layout::NCHW) ||
-            (_io_layout == ir::Layout::NCHW && tensor.layout() == ir::Layout::NHWC)) ||
+            (_io_layout == ir::Layout::NCHW && tensor.layout() == ir::Layout::NHWC) ||
+            tensor.layout() == ir::Layout::NCHWc) ||
            _copy);
     auto output_buffer = tensor.buffer();
     auto rank = _shape.rank();
@@ -130,7 +132,27 @@ protected:
         {
           const auto shape = _shape.asFeature(_io_layout);
 
-          if (_io_layout == ir::Layout::NCHW)
+          if (tensor.layout() == ir::Layout::NCHWc)
+          {
+            util::feature::nchwc::View<T> into(&tensor);
+            if (_io_layout == ir::Layout::NCHW)
+            {
+              const util::feature::nchw::Reader<T> from(shape, _input_buffer, _input_size);
+              ::nnfw::misc::feature::iterate(shape)
+                  << [&](uint32_t batch, uint32_t ch, uint32_t row, uint32_t col) {
+                       into.at(batch, row, col, ch) = from.at(batch, ch, row, col);
+                     };
+            }
+            else
+            {
+              const util::feature::nhwc::Reader<T> from(shape, _input_buffer, _input_size);
+              ::nnfw::misc::feature::iterate(shape)
+                  << [&](uint32_t batch, uint32_t ch, uint32_t row, uint32_t col) {
+                       into.at(batch, row, col, ch) = from.at(batch, row, col, ch);
+                     };
+            }
+          }
+          else if (_io_layout == ir::Layout::NCHW)
           {
             const util::feature::nchw::Reader<T> from(shape, _input_buffer, _input_size);
             util::feature::nhwc::View<T> into(&tensor);
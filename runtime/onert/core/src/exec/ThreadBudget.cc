@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ThreadBudget.h"
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+namespace onert
+{
+namespace exec
+{
+
+ThreadBudget::ThreadBudget(uint32_t num_cores) : _num_cores{num_cores}
+{
+  if (num_cores == 0)
+    throw std::runtime_error{"ThreadBudget: Number of cores must be positive"};
+}
+
+uint32_t ThreadBudget::acquire(uint64_t cost, uint64_t pending_cost, uint32_t num_pending)
+{
+  const uint32_t available = this->available();
+  if (available == 0)
+    return 0;
+
+  // Leave a core for each of the other runnable jobs as far as possible
+  const uint32_t max_threads = available - std::min(num_pending, available - 1);
+
+  // Share of the available cores in proportion to cost, rounded up
+  const uint64_t total_cost = cost + pending_cost;
+  uint64_t share = available;
+  if (total_cost != 0)
+    share = (static_cast<uint64_t>(available) * cost + total_cost - 1) / total_cost;
+
+  const auto num_threads =
+      static_cast<uint32_t>(std::max<uint64_t>(1, std::min<uint64_t>(share, max_threads)));
+  _in_use += num_threads;
+  return num_threads;
+}
+
+void ThreadBudget::release(uint32_t num_threads)
+{
+  assert(num_threads <= _in_use);
+  _in_use -= num_threads;
+}
+
+} // namespace exec
+} // namespace onert
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_THREAD_BUDGET_H__
+#define __ONERT_EXEC_THREAD_BUDGET_H__
+
+#include <cstdint>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Class to share a fixed number of cores among jobs running at the same time
+ *
+ * Each job gets threads for its kernels in proportion to its cost among the runnable jobs, while
+ * leaving at least one core for each of the others. So a job of a narrow graph gets all the cores
+ * for intra-op parallelism, and jobs of a wide graph run side by side with fewer threads each.
+ *
+ * @note  This is not thread-safe. The owner must synchronize calls.
+ */
+class ThreadBudget
+{
+public:
+  /**
+   * @brief     Construct a new ThreadBudget object
+   * @param[in] num_cores Number of cores to share, at least 1
+   */
+  explicit ThreadBudget(uint32_t num_cores);
+
+public:
+  uint32_t numCores() const { return _num_cores; }
+  uint32_t available() const { return _num_cores - _in_use; }
+
+  /**
+   * @brief     Take threads for a job to be dispatched
+   * @param[in] cost         Cost of the job
+   * @param[in] pending_cost Total cost of the other runnable jobs, which are not dispatched yet
+   * @param[in] num_pending  Number of the other runnable jobs
+   * @return    Number of threads the job may use, 0 if no core is available
+   */
+  uint32_t acquire(uint64_t cost, uint64_t pending_cost, uint32_t num_pending);
+  /**
+   * @brief Return threads taken by acquire() when the job is done
+   */
+  void release(uint32_t num_threads);
+
+private:
+  uint32_t _num_cores;
+  uint32_t _in_use = 0;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_THREAD_BUDGET_H__
@@ -126,7 +126,16 @@ public:
       return;
     }
 
-    tensor->setBuffer(std::make_shared<InternalBuffer>(tensor->total_size()));
+    // Buffer planned in the arena, if it can hold the tensor
+    auto planned = _planned_buffers.find(index);
+    if (planned != _planned_buffers.end() && planned->second->size() >= tensor->total_size())
+    {
+      tensor->setBuffer(planned->second);
+    }
+    else
+    {
+      tensor->setBuffer(std::make_shared<InternalBuffer>(tensor->total_size()));
+    }
     assignTensor(index, tensor);
     _buffers.insert(index);
   }
@@ -189,6 +198,16 @@ public:
     _external_buffers.emplace(index, buffer);
   }
 
+  /**
+   * @brief     Assign buffer which allocateIfNeeded uses instead of allocating a new one
+   * @param[in] index   Tensor index
+   * @param[in] buffer  Buffer in the arena planned by Schedule
+   */
+  void assignPlannedBuffer(const ir::OperandIndex index, std::shared_ptr<ExternalBuffer> buffer)
+  {
+    _planned_buffers.emplace(index, buffer);
+  }
+
 private:
   bool isExtBuffer(const ir::OperandIndex index)
   {
@@ -204,6 +223,8 @@ private:
   std::unordered_set<ir::OperandIndex> _buffers;
   // Tensor buffer from external
   std::unordered_map<ir::OperandIndex, std::shared_ptr<ExternalBuffer>> _external_buffers;
+  // Tensor buffer planned in the arena
+  std::unordered_map<ir::OperandIndex, std::shared_ptr<ExternalBuffer>> _planned_buffers;
 };
 
 } // namespace interp
@@ -17,6 +17,7 @@
 #include "interp/InterpExecutor.h"
 #include "interp/ExecEnv.h"
 #include "interp/Interpreter.h"
+#include "interp/Schedule.h"
 
 #include "util/logging.h"
 
@@ -27,8 +28,38 @@ namespace onert
 namespace interp
 {
 
+InterpExecutor::InterpExecutor(const ir::Graph &graph)
+    : _graph(graph), _schedule{std::make_unique<Schedule>(graph)}
+{
+  if (_schedule->arenaSize() > 0)
+  {
+    _arena = std::make_unique<uint8_t[]>(_schedule->arenaSize());
+  }
+
+  // Allocate constant tensor
+  _graph.operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &obj) {
+    if (obj.isConstant())
+    {
+      VERBOSE(INTERPRETER) << "Allocate and assign constant tensor. operand index:" << ind.value()
+                           << std::endl;
+
+      assert(obj.data());
+      auto const_tensor = std::make_shared<ROTensor>(obj.info());
+      // Assume that interpreter's tensor layout is same with model (NHWC)
+      const_tensor->setData(
+          std::make_shared<ir::ExternalData>(obj.data()->base(), obj.info().total_size()));
+      _tensor_map[ind] = const_tensor;
+    }
+  });
+}
+
+InterpExecutor::~InterpExecutor() = default;
+
 void InterpExecutor::execute(const exec::IODescription &desc)
 {
+  // The arena is shared by all runs
+  std::lock_guard<std::mutex> lock(_mutex);
+
   /************************************************************************
    * Prepare execution model (submodel)
      It may execute divided model
@@ -90,27 +121,25 @@ void InterpExecutor::execute(const exec::IODescription &desc)
                                                        output->size));
   }
 
-  // Allocate constant tensor
-  _graph.operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &obj) {
-    if (obj.isConstant())
-    {
-      VERBOSE(INTERPRETER) << "Allocate and assign constant tensor. operand index:" << ind.value()
-                           << std::endl;
+  // Assign buffers planned in the arena
+  for (const auto &slot : _schedule->slots())
+  {
+    interp_env->assignPlannedBuffer(
+        slot.first, std::make_shared<ExternalBuffer>(_arena.get() + slot.second.offset,
+                                                     slot.second.size));
+  }
 
-      assert(obj.data());
-      auto const_tensor = std::make_shared<ROTensor>(obj.info());
-      // Assume that interpreter's tensor layout is same with model (NHWC)
-      const_tensor->setData(
-          std::make_shared<ir::ExternalData>(obj.data()->base(), obj.info().total_size()));
-      interp_env->assignTensor(ind, const_tensor);
-    }
-  });
+  // Assign constant tensors
+  for (const auto &e : _tensor_map)
+  {
+    interp_env->assignTensor(e.first, e.second);
+  }
 
   /*****************************************************************************
    * Invoke interpreter
    ****************************************************************************/
 
-  interp::Interpreter interp(std::move(interp_env));
+  interp::Interpreter interp(std::move(interp_env), *_schedule);
   interp.run();
 
   /*****************************************************************************
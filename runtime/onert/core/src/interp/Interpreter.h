@@ -22,6 +22,7 @@
 #define __ONERT_INTERP_INTERPRETER_H__
 
 #include "ExecEnv.h"
+#include "Schedule.h"
 
 namespace onert
 {
@@ -41,21 +42,24 @@ public:
   Interpreter() = delete;
   /**
    * @brief     Construct a new Interpreter object
-   * @param[in] env Execution environment variable for interpreter object
+   * @param[in] env       Execution environment variable for interpreter object
+   * @param[in] schedule  Precomputed execution order of the graph in @c env
    */
-  Interpreter(std::unique_ptr<ExecEnv> env) : _env{std::move(env)}
+  Interpreter(std::unique_ptr<ExecEnv> env, const Schedule &schedule)
+      : _env{std::move(env)}, _schedule{schedule}
   {
     // DO NOTHING
   }
 
 public:
   /**
-   * @brief Run interpreter until there is no operation to execute
+   * @brief Run every operation of the schedule in order
    */
   void run();
 
 private:
   std::unique_ptr<ExecEnv> _env;
+  const Schedule &_schedule;
 };
 
 } // namespace interp
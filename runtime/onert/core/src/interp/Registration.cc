@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Registration.h"
+
+namespace onert
+{
+namespace interp
+{
+
+OpKernel *getKernel(ir::OpCode opcode)
+{
+  switch (opcode)
+  {
+#define INTERP_OP(InternalName)   \
+  case ir::OpCode::InternalName: \
+    return get##InternalName();
+#include "InterpOps.lst"
+#undef INTERP_OP
+    default:
+      return nullptr;
+  }
+}
+
+} // namespace interp
+} // namespace onert
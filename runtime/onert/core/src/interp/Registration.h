@@ -37,6 +37,12 @@ struct OpKernel
 #include "InterpOps.lst"
 #undef INTERP_OP
 
+/**
+ * @brief  Get interpreter kernel of an operation type
+ * @return Kernel of @c opcode, or @c nullptr if interpreter does not support it
+ */
+OpKernel *getKernel(ir::OpCode opcode);
+
 } // namespace interp
 } // namespace onert
 
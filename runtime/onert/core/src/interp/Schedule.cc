@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Schedule.h"
+
+#include "Registration.h"
+#include "ir/OperationIndexMap.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <map>
+#include <queue>
+#include <unordered_set>
+
+namespace
+{
+
+using namespace onert;
+
+// Alignment of each planned buffer in the arena
+constexpr size_t kArenaAlignment = 64;
+
+size_t alignUp(size_t size)
+{
+  return (size + kArenaAlignment - 1) / kArenaAlignment * kArenaAlignment;
+}
+
+// Operand indices of a sequence without duplication and invalid(optional) indices
+std::vector<ir::OperandIndex> uniqueOperands(const ir::OperandIndexSequence &seq)
+{
+  std::vector<ir::OperandIndex> ret;
+  for (const auto &ind : seq)
+  {
+    if (ind.valid() && std::find(ret.begin(), ret.end(), ind) == ret.end())
+      ret.push_back(ind);
+  }
+  return ret;
+}
+
+} // namespace
+
+namespace onert
+{
+namespace interp
+{
+
+Schedule::Schedule(const ir::Graph &graph)
+{
+  buildOrder(graph);
+  buildBufferPlan(graph);
+}
+
+void Schedule::buildOrder(const ir::Graph &graph)
+{
+  // Model inputs and constants are ready before any operation runs
+  std::unordered_set<ir::OperandIndex> ready;
+  for (const auto &ind : graph.getInputs())
+    ready.insert(ind);
+  graph.operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &obj) {
+    if (obj.isConstant())
+      ready.insert(ind);
+  });
+
+  // Kahn's algorithm on the number of inputs that are not ready yet
+  ir::OperationIndexMap<uint32_t> pending;
+  std::queue<ir::OperationIndex> ready_ops;
+  graph.operations().iterate([&](const ir::OperationIndex &ind, const ir::Operation &node) {
+    uint32_t count = 0;
+    for (const auto &input : uniqueOperands(node.getInputs()))
+    {
+      if (ready.find(input) == ready.end())
+        count++;
+    }
+    pending[ind] = count;
+    if (count == 0)
+      ready_ops.push(ind);
+  });
+
+  while (!ready_ops.empty())
+  {
+    const auto ind = ready_ops.front();
+    ready_ops.pop();
+
+    const auto &node = graph.operations().at(ind);
+    auto kernel = getKernel(node.opcode());
+    if (kernel == nullptr)
+    {
+      throw std::runtime_error{"Interpreter: NYI for " + node.name() + " operation"};
+    }
+    _steps.push_back(Step{ind, &node, kernel, {}});
+
+    for (const auto &output : uniqueOperands(node.getOutputs()))
+    {
+      if (!ready.insert(output).second)
+        continue;
+
+      const auto &uses = graph.operands().at(output).getUses().list();
+      std::unordered_set<ir::OperationIndex> use_ops{uses.begin(), uses.end()};
+      for (const auto &use_op : use_ops)
+      {
+        assert(pending.at(use_op) > 0);
+        if (--pending.at(use_op) == 0)
+          ready_ops.push(use_op);
+      }
+    }
+  }
+
+  if (_steps.size() != pending.size())
+  {
+    VERBOSE(INTERPRETER) << "Schedule: " << pending.size() - _steps.size()
+                         << " operation(s) never get all inputs ready" << std::endl;
+  }
+
+  // Operands are dead after their last use, or right after definition if nobody uses them
+  ir::OperandIndexMap<size_t> last_step;
+  for (size_t s = 0; s < _steps.size(); ++s)
+  {
+    for (const auto &output : uniqueOperands(_steps[s].node->getOutputs()))
+      last_step[output] = s;
+    for (const auto &input : uniqueOperands(_steps[s].node->getInputs()))
+      last_step[input] = s;
+  }
+  for (const auto &entry : last_step)
+  {
+    _steps[entry.second].dead_operands.push_back(entry.first);
+  }
+}
+
+void Schedule::buildBufferPlan(const ir::Graph &graph)
+{
+  const auto &graph_inputs = graph.getInputs();
+  const auto &graph_outputs = graph.getOutputs();
+
+  // Reshape kernel shares data of input with output instead of copying,
+  // so output is an alias and lifetime of input is extended to the one of output
+  ir::OperandIndexMap<ir::OperandIndex> alias_root;
+  ir::OperandIndexMap<size_t> def_step;
+  ir::OperandIndexMap<size_t> end_step;
+  for (size_t s = 0; s < _steps.size(); ++s)
+  {
+    const auto &node = *_steps[s].node;
+    for (const auto &input : uniqueOperands(node.getInputs()))
+      end_step[input] = s;
+    for (const auto &output : uniqueOperands(node.getOutputs()))
+    {
+      def_step[output] = s;
+      end_step[output] = s;
+    }
+
+    if (node.opcode() == ir::OpCode::Reshape)
+    {
+      const auto input = node.getInputs().at(0);
+      const auto output = node.getOutputs().at(0);
+      if (!graph_outputs.contains(output))
+      {
+        auto root = alias_root.find(input);
+        alias_root[output] = (root == alias_root.end()) ? input : root->second;
+      }
+    }
+  }
+  for (const auto &alias : alias_root)
+  {
+    auto &root_end = end_step[alias.second];
+    root_end = std::max(root_end, end_step.at(alias.first));
+  }
+
+  auto plannable = [&](const ir::OperandIndex &ind) {
+    const auto &obj = graph.operands().at(ind);
+    return !obj.isConstant() && !obj.info().isDynamic() && obj.info().total_size() != 0 &&
+           !graph_inputs.contains(ind) && !graph_outputs.contains(ind) &&
+           alias_root.find(ind) == alias_root.end();
+  };
+
+  // First-fit allocation in execution order
+  std::map<size_t, size_t> live; // offset -> aligned size
+  std::vector<std::vector<ir::OperandIndex>> releases(_steps.size());
+  for (size_t s = 0; s < _steps.size(); ++s)
+  {
+    for (const auto &output : uniqueOperands(_steps[s].node->getOutputs()))
+    {
+      if (def_step.at(output) != s || !plannable(output))
+        continue;
+
+      const auto size = graph.operands().at(output).info().total_size();
+      const auto aligned_size = alignUp(size);
+      size_t offset = 0;
+      for (const auto &block : live)
+      {
+        if (block.first >= offset + aligned_size)
+          break;
+        offset = std::max(offset, block.first + block.second);
+      }
+
+      live.emplace(offset, aligned_size);
+      _slots[output] = Slot{offset, size};
+      _arena_size = std::max(_arena_size, offset + aligned_size);
+      releases[end_step.at(output)].push_back(output);
+    }
+
+    for (const auto &ind : releases[s])
+    {
+      live.erase(_slots.at(ind).offset);
+    }
+  }
+
+  VERBOSE(INTERPRETER) << "Schedule: " << _steps.size() << " step(s), " << _slots.size()
+                       << " planned buffer(s), arena size " << _arena_size << std::endl;
+}
+
+} // namespace interp
+} // namespace onert
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  Schedule.h
+ * @brief This file contains Schedule class for precomputed interpreter execution order
+ */
+#ifndef __ONERT_INTERP_SCHEDULE_H__
+#define __ONERT_INTERP_SCHEDULE_H__
+
+#include "ir/Graph.h"
+#include "ir/OperandIndexMap.h"
+
+#include <vector>
+
+namespace onert
+{
+namespace interp
+{
+
+struct OpKernel;
+
+/**
+ * @brief Class to keep execution order and buffer plan of a graph for interpreter
+ *
+ * It is computed once per graph so that each run does not need to search ready operations by
+ * use-def chain. Intermediate operands with static shape are assigned to an offset of an arena,
+ * and operands whose lifetimes do not overlap share the same area.
+ */
+class Schedule
+{
+public:
+  struct Step
+  {
+    ir::OperationIndex index;
+    const ir::Operation *node;
+    OpKernel *kernel;
+    // Operands that are not used after this step
+    std::vector<ir::OperandIndex> dead_operands;
+  };
+
+  struct Slot
+  {
+    size_t offset;
+    size_t size;
+  };
+
+public:
+  /**
+   * @brief     Construct a new Schedule object
+   * @param[in] graph Graph to execute by interpreter
+   */
+  explicit Schedule(const ir::Graph &graph);
+
+public:
+  const std::vector<Step> &steps() const { return _steps; }
+  /**
+   * @brief  Return planned area of intermediate operands in the arena
+   */
+  const ir::OperandIndexMap<Slot> &slots() const { return _slots; }
+  size_t arenaSize() const { return _arena_size; }
+
+private:
+  void buildOrder(const ir::Graph &graph);
+  void buildBufferPlan(const ir::Graph &graph);
+
+private:
+  std::vector<Step> _steps;
+  ir::OperandIndexMap<Slot> _slots;
+  size_t _arena_size = 0;
+};
+
+} // namespace interp
+} // namespace onert
+
+#endif // __ONERT_INTERP_SCHEDULE_H__
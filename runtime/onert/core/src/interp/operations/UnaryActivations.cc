@@ -14,7 +14,8 @@
  * limitations under the License.
  */
 
-#include <cmath>
+#include <cker/operation/ReLU.h>
+#include <cker/operation/Tanh.h>
 
 #include "OperationUtil.h"
 
@@ -25,6 +26,8 @@
 #include "ir/operation/ReLU6.h"
 #include "ir/operation/Tanh.h"
 
+#include <algorithm>
+
 namespace onert
 {
 namespace interp
@@ -69,34 +72,37 @@ void prepare(ExecEnv *env, const ir::Operation &node)
   }
 }
 
+void clampFloat(const float *input_ptr, float *output_ptr, uint64_t num_elements, float min,
+                float max)
+{
+  for (uint64_t i = 0; i < num_elements; i++)
+  {
+    output_ptr[i] = std::min(std::max(min, input_ptr[i]), max);
+  }
+}
+
 template <ActivationType act_type>
 void evalFloat(const float *input_ptr, float *output_ptr, uint64_t num_elements)
 {
-  std::function<float(const float &)> fn = [](const float &) { return std::nanf(""); };
+  const nnfw::cker::Shape shape{static_cast<int>(num_elements)};
   switch (act_type)
   {
     case ActivationType::ReLU:
-      fn = [](const float &in) { return std::max(0.f, in); };
+      nnfw::cker::ReLU(shape, input_ptr, shape, output_ptr);
       break;
     case ActivationType::ReLU1:
-      fn = [](const float &in) { return std::min(std::max(-1.f, in), 1.f); };
+      clampFloat(input_ptr, output_ptr, num_elements, -1.f, 1.f);
       break;
     case ActivationType::ReLU6:
-      fn = [](const float &in) { return std::min(std::max(0.f, in), 6.f); };
+      clampFloat(input_ptr, output_ptr, num_elements, 0.f, 6.f);
       break;
     case ActivationType::Tanh:
-      fn = [](const float &in) { return std::tanh(in); };
+      nnfw::cker::Tanh(shape, input_ptr, shape, output_ptr);
       break;
     default:
       throw std::runtime_error{"Interp(Activations): NYI - Unsupported activation"};
       break;
   }
-
-  const float *input_end = input_ptr + num_elements;
-  for (; input_ptr < input_end; input_ptr++, output_ptr++)
-  {
-    *output_ptr = fn(*input_ptr);
-  }
 }
 
 template <ActivationType act_type> void invoke(const ExecEnv *env, const ir::Operation &node)
@@ -27,6 +27,12 @@ Coordinates convertCoordinates(const Coordinates &from_coordinates, Layout from_
                                Layout to_layout)
 {
   assert(from_coordinates.size() == 4);
+  // Coordinates of NCHWc are of NHWC
+  if (from_layout == Layout::NCHWc)
+    from_layout = Layout::NHWC;
+  if (to_layout == Layout::NCHWc)
+    to_layout = Layout::NHWC;
+
   Coordinates to{from_coordinates};
   if (from_layout == Layout::NHWC && to_layout == Layout::NCHW)
   {
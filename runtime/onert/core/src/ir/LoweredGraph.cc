@@ -24,12 +24,16 @@
 #include "pass/PermutationOperationPass.h"
 #include "pass/PermutationInsertionPass.h"
 #include "ir/GraphIterator.h"
+#include "ir/OpSequenceCostModel.h"
 #include "verifier/Verifier.h"
 #include "backend/Backend.h"
 #include "backend/IConfig.h"
+#include "backend/IShapeFixer.h"
 #include "compiler/BackendResolver.h"
 #include "compiler/ManualScheduler.h"
 #include "compiler/HEScheduler.h"
+#include "backend/controlflow/Config.h"
+#include "interp/Registration.h"
 #include "util/ShapeInference.h"
 
 namespace onert
@@ -72,10 +76,13 @@ LoweredGraph::LoweredGraph(const Graph &graph, const compiler::CompilerOptions &
   }
   else
   {
-    auto scheduler = compiler::ManualScheduler(options.manual_scheduler_options);
+    auto scheduler =
+        compiler::ManualScheduler(options.backend_list, options.manual_scheduler_options);
     _backend_resolver = scheduler.schedule(_graph);
   }
 
+  fallbackUnsupportedOperations(options);
+
   {
     // operand::LowerInfo holder
     OperandIndexMap<std::unique_ptr<operand::LowerInfo>> operands_lower_info;
@@ -208,6 +215,45 @@ OpSequenceIndex LoweredGraph::appendFreshSingleOpSequence(const OperationIndex &
   return _op_seqs.emplace(std::move(op_seq));
 }
 
+void LoweredGraph::fallbackUnsupportedOperations(const compiler::CompilerOptions &options)
+{
+  auto &backend_manager = compiler::BackendManager::get();
+  _graph.operations().iterate([&](const OperationIndex &index, const Operation &node) {
+    const auto backend = _backend_resolver->getBackend(index);
+    if (backend->config()->id() == backend::controlflow::Config::ID)
+      return;
+
+    // ShapeFixer of a backend throws NotSupportedError for the operations that the backend does
+    // not support, and other errors are real ones of the model
+    try
+    {
+      node.accept(*_backend_contexts.at(backend)->shape_fixer);
+      return;
+    }
+    catch (backend::NotSupportedError &e)
+    {
+      if (interp::getKernel(node.opcode()) == nullptr)
+        throw;
+
+      VERBOSE(Lower) << "NODE#" << index.value() << "(" << node.name() << ") is not supported by "
+                     << backend->config()->id() << " backend (" << e.what()
+                     << "), so it runs with interpreter kernel" << std::endl;
+    }
+
+    // Interpreter kernels run on controlflow backend, and Permute operations are inserted between
+    // the other backends and it later
+    backend_manager.loadBackend(backend::controlflow::Config::ID);
+    auto controlflow_backend = backend_manager.get(backend::controlflow::Config::ID);
+    if (_backend_contexts.find(controlflow_backend) == _backend_contexts.end())
+    {
+      _backend_contexts.emplace(controlflow_backend,
+                                controlflow_backend->newContext(_graph, _graph.getKernelBuilder(),
+                                                                options.executor == "Linear"));
+    }
+    _backend_resolver->setBackend(index, controlflow_backend);
+  });
+}
+
 void LoweredGraph::makeOpSequences(
     OperandIndexMap<std::unique_ptr<operand::LowerInfo>> &operands_lower_info,
     const compiler::CompilerOptions &options)
@@ -216,10 +262,25 @@ void LoweredGraph::makeOpSequences(
   const int op_seq_max_node = options.op_seq_max_node;
   assert(op_seq_max_node >= 0);
 
-  bool is_profiling = options.he_profiling_mode;
+  // Adaptive scheduling also measures each node separately
+  bool is_profiling = options.he_profiling_mode || options.he_adaptive;
   OpSequence *op_seq = nullptr;
   OpSequenceIndex op_seq_index;
 
+  // Parallel executor needs OpSequences of balanced cost and ranks to prioritize critical path
+  // NOTE The limit on number of nodes takes precedence as it is set explicitly
+  std::unique_ptr<OpSequenceCostModel> cost_model;
+  uint64_t op_seq_cost = 0;
+  if (options.executor == "Parallel" && op_seq_max_node == 0 && !is_profiling)
+  {
+    cost_model = std::make_unique<OpSequenceCostModel>(_graph, options.parallel_workers);
+    VERBOSE(Lower) << "OpSequence granularity : " << cost_model->granularity() << " of "
+                   << cost_model->totalCost() << std::endl;
+    // HEScheduler's ranks are based on measured times
+    if (!_indexed_ranks)
+      _indexed_ranks = cost_model->ranks();
+  }
+
   // NOTE: The below method appends nodes while making one op_seq if needed. If something better
   // ways, happy to update this code.
   PostDfsConstIterator{}.iterate(
@@ -232,7 +293,8 @@ void LoweredGraph::makeOpSequences(
 
         // The layout of each backend should be set at another place
         // TODO Change setting layout of each backend at another place
-        auto backend_layout = backend->config()->supportLayout(node, frontend_layout);
+        auto backend_layout =
+            backend->config()->supportLayout(node, _graph.operands(), frontend_layout);
 
         for (auto operand : node.getInputs())
         {
@@ -247,7 +309,8 @@ void LoweredGraph::makeOpSequences(
 
         bool new_op_seq = (op_seq == nullptr ||
                            (op_seq_max_node != 0 &&
-                            op_seq->operations().size() >= static_cast<size_t>(op_seq_max_node)));
+                            op_seq->operations().size() >= static_cast<size_t>(op_seq_max_node)) ||
+                           (cost_model && cost_model->exceeds(op_seq_cost, node_index)));
 
         // for profiling each op_seq must contain just one node,
         // so that we can measure a node separately
@@ -261,6 +324,7 @@ void LoweredGraph::makeOpSequences(
 
           op_seq_index = new_op_seq_index;
           op_seq = &(_op_seqs.at(new_op_seq_index));
+          op_seq_cost = 0;
 
           VERBOSE(Lower) << "OpSequence#" << op_seq_index.value() << " is created for "
                          << "NODE#" << node_index.value() << "(" << node.name() << ")" << std::endl;
@@ -273,6 +337,9 @@ void LoweredGraph::makeOpSequences(
           VERBOSE(Lower) << "OpSequence#" << op_seq_index.value() << " merges "
                          << "NODE#" << node_index.value() << "(" << node.name() << ")" << std::endl;
         }
+
+        if (cost_model)
+          op_seq_cost += cost_model->cost(node_index);
       });
 }
 
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpSequenceCostModel.h"
+
+#include "OperationCostEstimator.h"
+#include "ir/GraphIterator.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace onert
+{
+namespace ir
+{
+
+OpSequenceCostModel::OpSequenceCostModel(const Graph &graph, uint32_t num_workers)
+    : _ranks{std::make_shared<OperationIndexMap<int64_t>>()}
+{
+  OperationCostEstimator estimator{graph.operands()};
+  graph.operations().iterate([&](const OperationIndex &index, const Operation &node) {
+    const auto op_cost = estimator.estimate(node);
+    // Every operation costs at least 1 so that dispatching is never free
+    const auto cost = std::max<uint64_t>(op_cost.flops + op_cost.bytes, 1);
+    _costs[index] = cost;
+    _total_cost += cost;
+  });
+
+  // With one worker there is nothing to balance
+  if (num_workers > 1)
+    _granularity = std::max<uint64_t>(_total_cost / (num_workers * CHUNKS_PER_WORKER), 1);
+
+  // Post-DFS visits an operation after all of its uses
+  const auto max_rank = static_cast<uint64_t>(std::numeric_limits<int64_t>::max() / 2);
+  PostDfsConstIterator{}.iterate(graph, [&](const OperationIndex &index, const Operation &node) {
+    uint64_t successor_rank = 0;
+    for (const auto &output : node.getOutputs())
+    {
+      for (const auto &use : graph.operands().at(output).getUses().list())
+      {
+        successor_rank = std::max<uint64_t>(successor_rank, _ranks->at(use));
+      }
+    }
+    (*_ranks)[index] = std::min(successor_rank + cost(index), max_rank);
+  });
+}
+
+} // namespace ir
+} // namespace onert
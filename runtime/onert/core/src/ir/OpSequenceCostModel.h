@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_IR_OP_SEQUENCE_COST_MODEL_H__
+#define __ONERT_IR_OP_SEQUENCE_COST_MODEL_H__
+
+#include "ir/Graph.h"
+#include "ir/OperationIndexMap.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace onert
+{
+namespace ir
+{
+
+/**
+ * @brief Cost model to decide granularity of OpSequences for parallel execution
+ *
+ * Cost of an operation is its estimated FLOPs plus bytes moved(see OperationCostEstimator).
+ * An OpSequence is closed once it reaches the granularity, which is the total cost divided into
+ * a few chunks per worker. Long chains are then split into pieces of comparable cost, so that
+ * a worker is not held by a single chain while a job on the critical path is waiting.
+ */
+class OpSequenceCostModel
+{
+public:
+  /**
+   * @brief Number of OpSequences per worker to aim for
+   */
+  static constexpr uint32_t CHUNKS_PER_WORKER = 4;
+
+public:
+  /**
+   * @brief     Construct a new OpSequenceCostModel object
+   * @param[in] graph       Graph to be partitioned
+   * @param[in] num_workers Number of threads running OpSequences at the same time
+   */
+  OpSequenceCostModel(const Graph &graph, uint32_t num_workers);
+
+public:
+  uint64_t cost(const OperationIndex &index) const { return _costs.at(index); }
+  uint64_t totalCost() const { return _total_cost; }
+  /**
+   * @brief Maximum cost of an OpSequence, 0 if there is no limit
+   */
+  uint64_t granularity() const { return _granularity; }
+  /**
+   * @brief Whether an OpSequence of @c op_seq_cost becomes too large with operation @c index
+   */
+  bool exceeds(uint64_t op_seq_cost, const OperationIndex &index) const
+  {
+    return _granularity != 0 && op_seq_cost != 0 && op_seq_cost + cost(index) > _granularity;
+  }
+  /**
+   * @brief Rank of each operation for executors to prioritize ready jobs
+   *        Rank is the largest cost of paths from the operation to the end of the graph, so
+   *        operations on the critical path have higher ranks.
+   */
+  std::shared_ptr<OperationIndexMap<int64_t>> ranks() const { return _ranks; }
+
+private:
+  OperationIndexMap<uint64_t> _costs;
+  uint64_t _total_cost = 0;
+  uint64_t _granularity = 0;
+  std::shared_ptr<OperationIndexMap<int64_t>> _ranks;
+};
+
+} // namespace ir
+} // namespace onert
+
+#endif // __ONERT_IR_OP_SEQUENCE_COST_MODEL_H__
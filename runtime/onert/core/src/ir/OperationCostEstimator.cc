@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OperationCostEstimator.h"
+
+namespace onert
+{
+namespace ir
+{
+
+using namespace operation;
+
+OperationCost OperationCostEstimator::estimate(const Operation &node)
+{
+  OperationCost cost;
+
+  for (const auto &ind : node.getInputs() + node.getOutputs())
+  {
+    if (!ind.valid() || !_operands.exist(ind))
+      continue;
+
+    const auto &info = _operands.at(ind).info();
+    if (info.shape().hasUnknownDim())
+      continue;
+
+    cost.bytes += info.total_size();
+  }
+
+  // Default : one operation per output element
+  _flops = 0;
+  for (const auto &ind : node.getOutputs())
+  {
+    _flops += numElements(ind);
+  }
+
+  node.accept(*this);
+  cost.flops = _flops;
+
+  return cost;
+}
+
+uint64_t OperationCostEstimator::numElements(const OperandIndex &index) const
+{
+  if (!index.valid() || !_operands.exist(index))
+    return 0;
+
+  const auto &shape = _operands.at(index).shape();
+  if (shape.hasUnknownDim())
+    return 0;
+
+  return shape.num_elements();
+}
+
+void OperationCostEstimator::visit(const AvgPool2D &node)
+{
+  const auto &param = node.param();
+  _flops = numElements(node.getOutputs().at(0)) * param.kh * param.kw;
+}
+
+void OperationCostEstimator::visit(const Conv2D &node)
+{
+  // Kernel format is [depth_out, kernel_height, kernel_width, depth_in].
+  const auto &ker_shape = _operands.at(node.getInputs().at(Conv2D::Input::KERNEL)).shape();
+  if (ker_shape.rank() != 4)
+    return;
+
+  const uint64_t macs_per_output = static_cast<uint64_t>(ker_shape.dim(1)) * ker_shape.dim(2) *
+                                   ker_shape.dim(3);
+  _flops = 2 * numElements(node.getOutputs().at(0)) * macs_per_output;
+}
+
+void OperationCostEstimator::visit(const DepthwiseConv2D &node)
+{
+  // Kernel format is [1, kernel_height, kernel_width, depth_out].
+  const auto &ker_shape =
+      _operands.at(node.getInputs().at(DepthwiseConv2D::Input::KERNEL)).shape();
+  if (ker_shape.rank() != 4)
+    return;
+
+  const uint64_t macs_per_output = static_cast<uint64_t>(ker_shape.dim(1)) * ker_shape.dim(2);
+  _flops = 2 * numElements(node.getOutputs().at(0)) * macs_per_output;
+}
+
+void OperationCostEstimator::visit(const FullyConnected &node)
+{
+  // Weight format is [num_units, input_size].
+  const auto &weight_shape =
+      _operands.at(node.getInputs().at(FullyConnected::Input::WEIGHT)).shape();
+  if (weight_shape.rank() != 2)
+    return;
+
+  _flops = 2 * numElements(node.getOutputs().at(0)) * weight_shape.dim(1);
+}
+
+void OperationCostEstimator::visit(const L2Pool2D &node)
+{
+  const auto &param = node.param();
+  _flops = 2 * numElements(node.getOutputs().at(0)) * param.kh * param.kw;
+}
+
+void OperationCostEstimator::visit(const MaxPool2D &node)
+{
+  const auto &param = node.param();
+  _flops = numElements(node.getOutputs().at(0)) * param.kh * param.kw;
+}
+
+void OperationCostEstimator::visit(const TransposeConv &node)
+{
+  // Kernel format is [depth_out, kernel_height, kernel_width, depth_in].
+  const auto &ker_shape = _operands.at(node.getInputs().at(TransposeConv::Input::KERNEL)).shape();
+  if (ker_shape.rank() != 4)
+    return;
+
+  const uint64_t macs_per_input = static_cast<uint64_t>(ker_shape.dim(0)) * ker_shape.dim(1) *
+                                  ker_shape.dim(2);
+  _flops = 2 * numElements(node.getInputs().at(TransposeConv::Input::INPUT)) * macs_per_input;
+}
+
+} // namespace ir
+} // namespace onert
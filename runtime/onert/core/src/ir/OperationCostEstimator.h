@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_IR_OPERATION_COST_ESTIMATOR_H__
+#define __ONERT_IR_OPERATION_COST_ESTIMATOR_H__
+
+#include "ir/OperationVisitor.h"
+#include "ir/Operands.h"
+
+#include <cstdint>
+
+namespace onert
+{
+namespace ir
+{
+
+/**
+ * @brief Static cost of an operation, computed from operand shapes only
+ */
+struct OperationCost
+{
+  uint64_t flops = 0; //< Number of floating point (or MAC x 2) operations
+  uint64_t bytes = 0; //< Number of bytes read from inputs and written to outputs
+};
+
+/**
+ * @brief Estimate FLOPs and bytes moved of an operation
+ *
+ * @note  Operations that are not handled specially are assumed to do one operation per output
+ *        element. Operands with unknown dimensions are not counted.
+ */
+class OperationCostEstimator : public OperationVisitor
+{
+public:
+  OperationCostEstimator(const Operands &operands) : _operands(operands) {}
+
+public:
+  OperationCost estimate(const Operation &node);
+
+public:
+  void visit(const operation::AvgPool2D &node) override;
+  void visit(const operation::Conv2D &node) override;
+  void visit(const operation::DepthwiseConv2D &node) override;
+  void visit(const operation::FullyConnected &node) override;
+  void visit(const operation::L2Pool2D &node) override;
+  void visit(const operation::MaxPool2D &node) override;
+  void visit(const operation::TransposeConv &node) override;
+
+private:
+  uint64_t numElements(const OperandIndex &index) const;
+
+private:
+  const Operands &_operands;
+  uint64_t _flops = 0;
+};
+
+} // namespace ir
+} // namespace onert
+
+#endif // __ONERT_IR_OPERATION_COST_ESTIMATOR_H__
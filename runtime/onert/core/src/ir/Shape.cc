@@ -30,7 +30,8 @@ FeatureShape Shape::asFeature(Layout layout) const
 {
   assert(rank() == 4);
 
-  if (layout == Layout::NHWC)
+  // Shape of NCHWc is of NHWC
+  if (layout == Layout::NHWC || layout == Layout::NCHWc)
   {
     // Feature Map in NHWC layout
     //  - Dimension(0) -> Batch
@@ -84,6 +85,12 @@ uint64_t Shape::num_elements() const
 Shape permuteShape(const Shape &shape, Layout frontend_layout, Layout backend_layout)
 {
   assert(shape.rank() <= 4);
+  // Shape of NCHWc is of NHWC
+  if (frontend_layout == Layout::NCHWc)
+    frontend_layout = Layout::NHWC;
+  if (backend_layout == Layout::NCHWc)
+    backend_layout = Layout::NHWC;
+
   Shape backend_shape{shape};
   if (shape.rank() == 4 && frontend_layout == Layout::NHWC && backend_layout == Layout::NCHW)
   {
@@ -38,6 +38,11 @@ bool operator==(const TypeInfo &lhs, const TypeInfo &rhs)
     return false;
   }
 
+  if (lhs.scales() != rhs.scales() || lhs.quantizedDimension() != rhs.quantizedDimension())
+  {
+    return false;
+  }
+
   return true;
 }
 
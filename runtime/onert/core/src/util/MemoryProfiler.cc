@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/MemoryProfiler.h"
+
+#include "misc/EventRecorder.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include <dlfcn.h>
+#include <malloc.h>
+
+namespace
+{
+
+// Timestamp in microseconds which Chrome trace format uses
+std::string timestamp(uint64_t ns)
+{
+  std::stringstream ss;
+  ss << ns / 1000 << "." << std::setw(3) << std::setfill('0') << ns % 1000;
+  return ss.str();
+}
+
+uint64_t now()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// Bytes allocated by malloc, which does not count memory kept in free lists of the allocator
+uint64_t mallocInUse()
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+  const auto info = mallinfo2();
+  return info.uordblks + info.hblkhd;
+#elif defined(__GLIBC__)
+  // Fields of int wrap around over 4GB
+  const auto info = mallinfo();
+  return static_cast<uint32_t>(info.uordblks) + static_cast<uint32_t>(info.hblkhd);
+#elif defined(__ANDROID__)
+  const auto info = mallinfo();
+  return info.uordblks + info.hblkhd;
+#else
+  return 0;
+#endif
+}
+
+double kbytes(int64_t bytes) { return static_cast<double>(bytes) / 1024.0; }
+
+// Live profilers, which share the peak of heap_trace
+std::mutex &profilersMutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::vector<onert::util::MemoryProfiler *> &profilers()
+{
+  static std::vector<onert::util::MemoryProfiler *> profilers;
+  return profilers;
+}
+
+} // namespace
+
+namespace onert
+{
+namespace util
+{
+
+MemoryProfiler::MemoryProfiler(const std::string &filepath)
+    : _filepath{filepath}, _heap_trace_usage{nullptr}, _heap_trace_reset{nullptr}, _max_peak{0},
+      _pending_peak{0}
+{
+  // Functions of heap_trace are found only if it is preloaded
+  _heap_trace_usage = reinterpret_cast<void (*)(size_t *, size_t *)>(
+      dlsym(RTLD_DEFAULT, "heap_trace_get_cpu_usage"));
+  _heap_trace_reset =
+      reinterpret_cast<void (*)(void)>(dlsym(RTLD_DEFAULT, "heap_trace_reset_cpu_peak"));
+  if (_heap_trace_usage == nullptr || _heap_trace_reset == nullptr)
+  {
+    _heap_trace_usage = nullptr;
+    _heap_trace_reset = nullptr;
+  }
+
+  VERBOSE(MemoryProfiler) << "Heap usage from " << (exact() ? "heap_trace" : "mallinfo")
+                          << std::endl;
+
+  std::lock_guard<std::mutex> lock{profilersMutex()};
+  profilers().push_back(this);
+}
+
+MemoryProfiler::~MemoryProfiler()
+{
+  {
+    std::lock_guard<std::mutex> lock{profilersMutex()};
+    auto &all = profilers();
+    all.erase(std::remove(all.begin(), all.end(), this), all.end());
+  }
+
+  if (_filepath.empty() || _records.empty())
+    return;
+
+  std::ofstream trace_ofs{_filepath, std::ofstream::out};
+  writeChromeTrace(trace_ofs);
+
+  std::ofstream summary_ofs{_filepath + ".summary", std::ofstream::out};
+  writeSummary(summary_ofs);
+}
+
+MemoryProfiler::ScopeId MemoryProfiler::registerPhase(const std::string &name)
+{
+  return registerScope(Kind::PHASE, "session", name);
+}
+
+MemoryProfiler::ScopeId MemoryProfiler::registerKernel(ir::OperationIndex index,
+                                                       const std::string &name,
+                                                       const std::string &backend,
+                                                       bool prepare)
+{
+  auto label = "$" + std::to_string(index.value()) + " " + name;
+  if (prepare)
+    label += " (prepare)";
+  return registerScope(Kind::KERNEL, backend, label);
+}
+
+MemoryProfiler::ScopeId MemoryProfiler::registerScope(Kind kind, const std::string &tid,
+                                                      const std::string &label)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  auto it = std::find_if(_scopes.begin(), _scopes.end(), [&](const Scope &scope) {
+    return scope.kind == kind && scope.tid == tid && scope.label == label;
+  });
+  if (it != _scopes.end())
+    return it - _scopes.begin();
+
+  _scopes.push_back(Scope{kind, tid, label, 0, 0, 0});
+  return _scopes.size() - 1;
+}
+
+uint64_t MemoryProfiler::sample()
+{
+  size_t in_use = 0;
+  size_t peak = 0;
+  if (exact())
+  {
+    // NOTE This is always locked after _mutex of a profiler, not before, which avoids deadlock
+    std::lock_guard<std::mutex> lock{profilersMutex()};
+    _heap_trace_usage(&in_use, &peak);
+    _heap_trace_reset();
+    for (auto profiler : profilers())
+    {
+      if (profiler != this)
+        profiler->raisePeak(peak);
+    }
+    peak = std::max<uint64_t>(peak, _pending_peak);
+    _pending_peak = 0;
+  }
+  else
+  {
+    in_use = mallocInUse();
+    peak = in_use;
+  }
+
+  _max_peak = std::max<uint64_t>(_max_peak, peak);
+  for (auto &open : _open)
+    open.peak = std::max<uint64_t>(open.peak, peak);
+
+  return in_use;
+}
+
+void MemoryProfiler::begin(ScopeId id)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  // Grow records before sampling not to count it in the scope
+  _records.push_back(Record{id, true, 0, 0});
+  _open.reserve(_open.size() + 1);
+
+  auto &record = _records.back();
+  record.in_use = sample();
+  record.ts = now();
+  _open.push_back(OpenScope{id, record.in_use, record.in_use});
+}
+
+void MemoryProfiler::end(ScopeId id)
+{
+  const auto ts = now();
+  std::lock_guard<std::mutex> lock{_mutex};
+  const auto in_use = sample();
+
+  auto it = std::find_if(_open.rbegin(), _open.rend(),
+                         [&](const OpenScope &open) { return open.id == id; });
+  assert(it != _open.rend());
+  if (it == _open.rend())
+    return;
+
+  auto &scope = _scopes.at(id);
+  scope.count++;
+  scope.total_delta += static_cast<int64_t>(in_use) - static_cast<int64_t>(it->in_use);
+  scope.max_peak = std::max(scope.max_peak, it->peak - it->in_use);
+  _open.erase(std::next(it).base());
+
+  _records.push_back(Record{id, false, ts, in_use});
+}
+
+void MemoryProfiler::writeChromeTrace(std::ostream &os)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  EventRecorder recorder;
+  for (const auto &record : _records)
+  {
+    const auto &scope = _scopes.at(record.id);
+    const auto ts = timestamp(record.ts);
+
+    DurationEvent duration;
+    duration.name = scope.label;
+    duration.tid = scope.tid;
+    duration.ph = record.begin ? "B" : "E";
+    duration.ts = ts;
+    recorder.emit(duration);
+
+    CounterEvent counter;
+    counter.name = "heap";
+    counter.tid = scope.tid;
+    counter.ph = "C";
+    counter.ts = ts;
+    counter.values["in_use"] = std::to_string(record.in_use);
+    recorder.emit(counter);
+  }
+
+  recorder.writeToFile(os);
+}
+
+void MemoryProfiler::writeSummary(std::ostream &os)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  std::vector<ScopeId> phases;
+  std::vector<ScopeId> kernels;
+  for (ScopeId id = 0; id < _scopes.size(); ++id)
+  {
+    const auto &scope = _scopes.at(id);
+    if (scope.count == 0)
+      continue;
+    (scope.kind == Kind::PHASE ? phases : kernels).push_back(id);
+  }
+  std::sort(kernels.begin(), kernels.end(), [&](ScopeId lhs, ScopeId rhs) {
+    return _scopes.at(lhs).max_peak > _scopes.at(rhs).max_peak;
+  });
+
+  os << "Memory profile with heap usage from "
+     << (exact() ? "heap_trace" : "mallinfo, where peaks are sampled at scope boundaries")
+     << std::endl;
+  os << "Peak(KB) is the highest heap usage over the one at the beginning of a scope, and "
+        "Delta(KB) is the sum of changes from the beginning to the end"
+     << std::endl
+     << std::endl;
+
+  os << std::fixed << std::setprecision(1);
+  os << std::left << std::setw(36) << "Phase" << std::right << std::setw(8) << "Count"
+     << std::setw(14) << "Peak(KB)" << std::setw(14) << "Delta(KB)" << std::endl;
+  for (auto id : phases)
+  {
+    const auto &scope = _scopes.at(id);
+    os << std::left << std::setw(36) << scope.label << std::right << std::setw(8) << scope.count
+       << std::setw(14) << kbytes(scope.max_peak) << std::setw(14) << kbytes(scope.total_delta)
+       << std::endl;
+  }
+  os << std::endl;
+
+  os << std::left << std::setw(36) << "Kernel" << std::setw(12) << "Backend" << std::right
+     << std::setw(8) << "Count" << std::setw(14) << "Peak(KB)" << std::setw(14) << "Delta(KB)"
+     << std::endl;
+  for (auto id : kernels)
+  {
+    const auto &scope = _scopes.at(id);
+    os << std::left << std::setw(36) << scope.label << std::setw(12) << scope.tid << std::right
+       << std::setw(8) << scope.count << std::setw(14) << kbytes(scope.max_peak) << std::setw(14)
+       << kbytes(scope.total_delta) << std::endl;
+  }
+  os << std::endl;
+
+  os << "Peak heap usage : " << kbytes(_max_peak) << " KB" << std::endl;
+  os.unsetf(std::ios_base::floatfield);
+}
+
+MemoryProfilePhase::MemoryProfilePhase(MemoryProfiler *profiler, const std::string &name)
+    : _profiler{profiler}, _id{0}
+{
+  if (_profiler)
+  {
+    _id = _profiler->registerPhase(name);
+    _profiler->begin(_id);
+  }
+}
+
+void MemoryProfilePhase::end()
+{
+  if (_profiler)
+  {
+    _profiler->end(_id);
+    _profiler = nullptr;
+  }
+}
+
+} // namespace util
+} // namespace onert
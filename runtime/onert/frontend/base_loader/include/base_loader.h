@@ -20,11 +20,17 @@
 #include "ir/Graph.h"
 #include "ir/Operations.Include.h"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <fstream>
 #include <limits>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 namespace onert
 {
 namespace base_loader
@@ -53,7 +59,10 @@ public:
    *
    * @param graph reference on subgraphs
    */
-  explicit BaseLoader(std::unique_ptr<ir::Subgraphs> &subgs) : _subgraphs(subgs), _model{nullptr} {}
+  explicit BaseLoader(std::unique_ptr<ir::Subgraphs> &subgs)
+      : _base{nullptr}, _size{0}, _fd{-1}, _subgraphs(subgs), _model{nullptr}
+  {
+  }
 
   /**
    * @brief Load a model from file
@@ -63,7 +72,7 @@ public:
   void loadFromFile(const char *file_path);
 
 protected:
-  ~BaseLoader() = default;
+  ~BaseLoader();
 
   void loadModel();
 
@@ -73,6 +82,8 @@ protected:
 
   // Create operands form tflite::Tensor
   ir::OperandIndex loadOperand(const Tensor *tensor, ir::Graph &subg);
+  // Create data of constant operands from Buffer (nullptr if there is no data)
+  std::unique_ptr<ir::Data> loadBuffer(const Buffer *buffer);
   void loadOperationIO(const Operator *op, ir::OperandIndexSequence &inputs,
                        ir::OperandIndexSequence &outputs);
   // Create operations from Operator
@@ -151,8 +162,11 @@ protected:
   void loadLogicalOr(const Operator *op, ir::Graph &subg);
 
 protected:
-  // Buffer for loading (if needed)
-  std::vector<char> _buffer;
+  // Model file mapped in memory
+  uint8_t *_base;
+  size_t _size;
+  // Descriptor of the model file, to map data of buffers in memory separately
+  int _fd;
   // Reference on loadable subgraphs
   std::unique_ptr<ir::Subgraphs> &_subgraphs;
   const Model *_model;
@@ -163,11 +177,19 @@ protected:
 };
 
 template <typename LoaderDomain, typename SpecificLoader>
-void BaseLoader<LoaderDomain, SpecificLoader>::BaseLoader::loadFromFile(const char *file_path)
+BaseLoader<LoaderDomain, SpecificLoader>::~BaseLoader()
 {
-  std::ifstream stream(file_path, std::fstream::in | std::fstream::binary);
+  if (_base != nullptr)
+    munmap(_base, _size);
+  if (_fd != -1)
+    close(_fd);
+}
 
-  if (!stream)
+template <typename LoaderDomain, typename SpecificLoader>
+void BaseLoader<LoaderDomain, SpecificLoader>::BaseLoader::loadFromFile(const char *file_path)
+{
+  _fd = open(file_path, O_RDONLY);
+  if (_fd < 0)
   {
     std::string msg = "Failed to open file `";
     msg += file_path;
@@ -175,18 +197,24 @@ void BaseLoader<LoaderDomain, SpecificLoader>::BaseLoader::loadFromFile(const ch
     throw std::runtime_error{msg};
   }
 
-  stream.seekg(0, stream.end);
-  auto size = stream.tellg();
-  stream.seekg(0, stream.beg);
-
-  _buffer.resize(size);
-  stream.read(_buffer.data(), size);
+  struct stat file_stat;
+  if (fstat(_fd, &file_stat) != 0)
+    throw std::runtime_error{"Failed to get size of model file"};
+  _size = static_cast<size_t>(file_stat.st_size);
 
-  stream.close();
+  // The file is mapped in memory rather than read, as only the part of the file which is used
+  // (e.g. the flatbuffer, not data out of it) is read from disk
+  void *base = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, _fd, 0);
+  if (base == MAP_FAILED)
+    throw std::runtime_error{"Failed to map model file in memory"};
+  _base = static_cast<uint8_t *>(base);
 
   // Prepare verifier
-  _verifier = std::make_unique<Verifier>(reinterpret_cast<const std::uint8_t *>(_buffer.data()),
-                                         _buffer.size());
+  // NOTE Data out of the flatbuffer may exceed the limit of size of the flatbuffer, which is
+  //      addressed by 32-bit signed offsets
+  const size_t verify_size =
+      std::min(_size, static_cast<size_t>(std::numeric_limits<int32_t>::max() - 1));
+  _verifier = std::make_unique<Verifier>(_base, verify_size);
 
   loadModel();
 }
@@ -227,6 +255,8 @@ BaseLoader<LoaderDomain, SpecificLoader>::BaseLoader::tensorTypeToDataType(const
       return ir::DataType::BOOL8;
     case TensorType::TensorType_UINT8:
       return ir::DataType::QUANT8_ASYMM;
+    case TensorType::TensorType_INT8:
+      return ir::DataType::QUANT8_ASYMM_SIGNED;
     default:
       throw std::runtime_error(
           std::string("Unsupported tensor type: ").append(EnumNameTensorType(type)));
@@ -265,24 +295,35 @@ ir::OperandIndex BaseLoader<LoaderDomain, SpecificLoader>::loadOperand(const Ten
   auto q_params = tensor->quantization();
   float scale = 0.0;
   long zero_point = 0;
+  std::vector<float> scales;
   if (q_params != nullptr)
   {
-    if (q_params->scale())
+    if (q_params->scale() && q_params->scale()->size() > 0)
     {
+      scale = q_params->scale()->Get(0);
       if (q_params->scale()->size() != 1)
       {
-        throw std::runtime_error("Only 1 scale for a tensor is supported.");
+        // Per-channel quantization is supported only for symmetric int8 weights and int32 biases
+        // of them, whose scale of each channel is input_scale * weight_scale of the channel
+        if (data_type != ir::DataType::QUANT8_ASYMM_SIGNED && data_type != ir::DataType::INT32)
+          throw std::runtime_error("Only 1 scale for a tensor is supported.");
+        scales.assign(q_params->scale()->begin(), q_params->scale()->end());
       }
-      scale = q_params->scale()->Get(0);
     }
 
-    if (q_params->zero_point())
+    if (q_params->zero_point() && q_params->zero_point()->size() > 0)
     {
-      if (q_params->zero_point()->size() != 1)
-      {
+      zero_point = q_params->zero_point()->Get(0);
+      if (q_params->zero_point()->size() != 1 && scales.empty())
         throw std::runtime_error("Only 1 zero_point value for a tensor is supported.");
+      if (!scales.empty())
+      {
+        for (const auto zp : *q_params->zero_point())
+        {
+          if (zp != 0)
+            throw std::runtime_error("Per-channel quantization must be symmetric.");
+        }
       }
-      zero_point = q_params->zero_point()->Get(0);
       // zero_point is long while TypeInfo.zero_point is defined as int32_t.
       assert(zero_point >= std::numeric_limits<int32_t>::min());
       assert(zero_point <= std::numeric_limits<int32_t>::max());
@@ -293,15 +334,19 @@ ir::OperandIndex BaseLoader<LoaderDomain, SpecificLoader>::loadOperand(const Ten
   }
   // Create TypeInfo
   ir::TypeInfo type_info(data_type, scale, zero_point);
+  if (!scales.empty())
+  {
+    type_info.perChannel(scales, q_params->quantized_dimension());
+  }
   // Create operand
   const auto operand_index = subg.addOperand(shape, type_info);
 
   // Constant tensors are indicated by non-empty data.
-  const auto *data = _model->buffers()->Get(tensor->buffer())->data();
+  const auto *buffer = _model->buffers()->Get(tensor->buffer());
+  auto data = static_cast<SpecificLoader *>(this)->loadBuffer(buffer);
   if (data != nullptr)
   {
-    auto ptr = std::make_unique<ir::CachedData>(data->data(), data->size());
-    subg.setOperandValue(operand_index, std::move(ptr));
+    subg.setOperandValue(operand_index, std::move(data));
   }
 
   // Name unused
@@ -313,6 +358,17 @@ ir::OperandIndex BaseLoader<LoaderDomain, SpecificLoader>::loadOperand(const Ten
   return operand_index;
 }
 
+template <typename LoaderDomain, typename SpecificLoader>
+std::unique_ptr<ir::Data>
+BaseLoader<LoaderDomain, SpecificLoader>::loadBuffer(const Buffer *buffer)
+{
+  const auto *data = buffer->data();
+  if (data == nullptr)
+    return nullptr;
+
+  return std::make_unique<ir::CachedData>(data->data(), data->size());
+}
+
 template <typename LoaderDomain, typename SpecificLoader>
 void BaseLoader<LoaderDomain, SpecificLoader>::loadOperationIO(const Operator *op,
                                                                ir::OperandIndexSequence &inputs,
@@ -374,6 +430,14 @@ void BaseLoader<LoaderDomain, SpecificLoader>::loadConv2D(const Operator *op, ir
 
   loadOperationIO(op, inputs, outputs);
 
+  const auto &input_operand = subg.operands().at(inputs.at(ir::operation::Conv2D::INPUT));
+  auto &kernel_operand = subg.operands().at(inputs.at(ir::operation::Conv2D::KERNEL));
+  if (input_operand.typeInfo().type() == ir::DataType::FLOAT32 &&
+      kernel_operand.typeInfo().type() == ir::DataType::QUANT8_ASYMM_SIGNED)
+  {
+    kernel_operand.type(ir::DataType::QUANT8_SYMM);
+  }
+
   ir::operation::Conv2D::Param param;
   const auto *options = op->builtin_options_as_Conv2DOptions();
   param.activation = convertActivation(options->fused_activation_function());
@@ -547,7 +611,8 @@ void BaseLoader<LoaderDomain, SpecificLoader>::loadFC(const Operator *op, ir::Gr
   const auto &input_operand = subg.operands().at(inputs.at(ir::operation::FullyConnected::INPUT));
   auto &weights_operand = subg.operands().at(inputs.at(ir::operation::FullyConnected::WEIGHT));
   if (input_operand.typeInfo().type() == ir::DataType::FLOAT32 &&
-      weights_operand.typeInfo().type() == ir::DataType::QUANT8_ASYMM)
+      (weights_operand.typeInfo().type() == ir::DataType::QUANT8_ASYMM ||
+       weights_operand.typeInfo().type() == ir::DataType::QUANT8_ASYMM_SIGNED))
   {
     weights_operand.type(ir::DataType::QUANT8_SYMM);
   }
@@ -1712,7 +1777,7 @@ template <typename LoaderDomain, typename SpecificLoader>
 void BaseLoader<LoaderDomain, SpecificLoader>::loadModel()
 {
   LoaderDomain::VerifyModelBuffer(*_verifier.get());
-  _model = LoaderDomain::GetModel(_buffer.data());
+  _model = LoaderDomain::GetModel(_base);
   // Version unused
   // const auto version = _model->version();
   // Description unused
@@ -104,6 +104,21 @@ public:
     return subg;
   }
 
+  std::unique_ptr<ir::Data> loadBuffer(const circle::Buffer *buffer)
+  {
+    // Data out of the flatbuffer is mapped in memory from the file rather than copied
+    const auto offset = buffer->offset();
+    if (offset > 1)
+    {
+      const auto size = buffer->size();
+      if (size == 0 || offset > _size || size > _size - offset)
+        throw std::runtime_error("Invalid data location of buffer");
+      return std::make_unique<ir::MMapedData>(_fd, offset, size);
+    }
+
+    return BaseLoader::loadBuffer(buffer);
+  }
+
   void loadOperation(const circle::Operator *op, ir::Graph &subg)
   {
     const auto builtin_op = _model->operator_codes()->Get(op->opcode_index())->builtin_code();
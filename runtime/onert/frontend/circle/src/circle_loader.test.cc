@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "circle_loader.h"
+#include "circle_schema_generated.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+
+const std::vector<float> inline_data{1.f, 2.f, 3.f, 4.f};
+const std::vector<float> external_data{-1.f, 0.5f, 8.f, 16.f};
+
+// Model: t = Add(input, const_inline), output = Add(t, const_external)
+// The data of const_external is stored out of the flatbuffer, at the given offset of the file
+flatbuffers::DetachedBuffer buildModel(uint64_t external_offset, uint64_t external_size)
+{
+  flatbuffers::FlatBufferBuilder fbb;
+
+  std::vector<flatbuffers::Offset<circle::Buffer>> buffers;
+  buffers.push_back(circle::CreateBuffer(fbb));
+  buffers.push_back(circle::CreateBuffer(
+      fbb, fbb.CreateVector(reinterpret_cast<const uint8_t *>(inline_data.data()),
+                            inline_data.size() * sizeof(float))));
+  buffers.push_back(circle::CreateBuffer(fbb, 0, external_offset, external_size));
+
+  const std::vector<int32_t> shape{1, 2, 2, 1};
+  std::vector<flatbuffers::Offset<circle::Tensor>> tensors;
+  tensors.push_back(circle::CreateTensorDirect(fbb, &shape, circle::TensorType_FLOAT32, 0, "in"));
+  tensors.push_back(circle::CreateTensorDirect(fbb, &shape, circle::TensorType_FLOAT32, 1, "a"));
+  tensors.push_back(circle::CreateTensorDirect(fbb, &shape, circle::TensorType_FLOAT32, 2, "b"));
+  tensors.push_back(circle::CreateTensorDirect(fbb, &shape, circle::TensorType_FLOAT32, 0, "t"));
+  tensors.push_back(circle::CreateTensorDirect(fbb, &shape, circle::TensorType_FLOAT32, 0, "out"));
+
+  std::vector<flatbuffers::Offset<circle::Operator>> operators;
+  const std::vector<int32_t> add0_inputs{0, 1}, add0_outputs{3};
+  const std::vector<int32_t> add1_inputs{3, 2}, add1_outputs{4};
+  operators.push_back(circle::CreateOperatorDirect(fbb, 0, &add0_inputs, &add0_outputs,
+                                                   circle::BuiltinOptions_AddOptions,
+                                                   circle::CreateAddOptions(fbb).Union()));
+  operators.push_back(circle::CreateOperatorDirect(fbb, 0, &add1_inputs, &add1_outputs,
+                                                   circle::BuiltinOptions_AddOptions,
+                                                   circle::CreateAddOptions(fbb).Union()));
+
+  const std::vector<int32_t> inputs{0}, outputs{4};
+  std::vector<flatbuffers::Offset<circle::SubGraph>> subgraphs;
+  subgraphs.push_back(
+      circle::CreateSubGraphDirect(fbb, &tensors, &inputs, &outputs, &operators, "main"));
+
+  std::vector<flatbuffers::Offset<circle::OperatorCode>> operator_codes;
+  operator_codes.push_back(circle::CreateOperatorCode(fbb, circle::BuiltinOperator_ADD));
+
+  auto model = circle::CreateModelDirect(fbb, 0, &operator_codes, &subgraphs, "test", &buffers);
+  circle::FinishModelBuffer(fbb, model);
+  return fbb.Release();
+}
+
+// Create an empty temporary file and return the path of it
+std::string createFile()
+{
+  std::string path = "circle_loader_test_XXXXXX";
+  const int fd = mkstemp(&path[0]);
+  if (fd < 0)
+    throw std::runtime_error("Failed to create a temporary file");
+  close(fd);
+  return path;
+}
+
+// Write the model and external data after it, and return the path of the file
+std::string writeModel(uint64_t external_offset, uint64_t external_size)
+{
+  const auto model = buildModel(external_offset, external_size);
+
+  const auto path = createFile();
+  std::ofstream file(path, std::ios::binary);
+  file.write(reinterpret_cast<const char *>(model.data()), model.size());
+  const std::vector<char> padding(external_offset - model.size(), 0);
+  file.write(padding.data(), padding.size());
+  file.write(reinterpret_cast<const char *>(external_data.data()),
+             external_data.size() * sizeof(float));
+  return path;
+}
+
+// External data is aligned at 64 bytes right after the flatbuffer
+uint64_t externalOffset()
+{
+  // The size of the flatbuffer does not depend on the value of non-default offset
+  const auto size = buildModel(1, external_data.size() * sizeof(float)).size();
+  return (size + 63) / 64 * 64;
+}
+
+const std::vector<float> filter_scales{0.5f, 0.25f};
+const float input_scale = 0.1f;
+
+// Model: output = Conv2D(input, filter, bias) of int8, where filter and bias are quantized per
+// channel along the output channel, as TFLite/circle int8 models do
+// The scale of bias of each channel is input_scale * filter_scale of the channel
+std::string writePerChannelConvModel(const std::vector<int64_t> &bias_zero_points)
+{
+  flatbuffers::FlatBufferBuilder fbb;
+
+  const std::vector<int8_t> filter_data{127, -64};
+  const std::vector<int32_t> bias_data{10, -20};
+  std::vector<flatbuffers::Offset<circle::Buffer>> buffers;
+  buffers.push_back(circle::CreateBuffer(fbb));
+  buffers.push_back(circle::CreateBuffer(
+      fbb, fbb.CreateVector(reinterpret_cast<const uint8_t *>(filter_data.data()),
+                            filter_data.size() * sizeof(int8_t))));
+  buffers.push_back(circle::CreateBuffer(
+      fbb, fbb.CreateVector(reinterpret_cast<const uint8_t *>(bias_data.data()),
+                            bias_data.size() * sizeof(int32_t))));
+
+  const std::vector<float> in_scale{input_scale}, out_scale{0.2f};
+  const std::vector<int64_t> in_zero_point{3}, out_zero_point{-1};
+  std::vector<float> bias_scales;
+  for (const auto filter_scale : filter_scales)
+    bias_scales.push_back(input_scale * filter_scale);
+  const std::vector<int64_t> filter_zero_points(filter_scales.size(), 0);
+
+  const std::vector<int32_t> in_shape{1, 2, 2, 1}, filter_shape{2, 1, 1, 1}, bias_shape{2},
+      out_shape{1, 2, 2, 2};
+  std::vector<flatbuffers::Offset<circle::Tensor>> tensors;
+  tensors.push_back(circle::CreateTensorDirect(
+      fbb, &in_shape, circle::TensorType_INT8, 0, "in",
+      circle::CreateQuantizationParametersDirect(fbb, nullptr, nullptr, &in_scale,
+                                                 &in_zero_point)));
+  tensors.push_back(circle::CreateTensorDirect(
+      fbb, &filter_shape, circle::TensorType_INT8, 1, "filter",
+      circle::CreateQuantizationParametersDirect(fbb, nullptr, nullptr, &filter_scales,
+                                                 &filter_zero_points,
+                                                 circle::QuantizationDetails_NONE, 0, 0)));
+  tensors.push_back(circle::CreateTensorDirect(
+      fbb, &bias_shape, circle::TensorType_INT32, 2, "bias",
+      circle::CreateQuantizationParametersDirect(fbb, nullptr, nullptr, &bias_scales,
+                                                 &bias_zero_points,
+                                                 circle::QuantizationDetails_NONE, 0, 0)));
+  tensors.push_back(circle::CreateTensorDirect(
+      fbb, &out_shape, circle::TensorType_INT8, 0, "out",
+      circle::CreateQuantizationParametersDirect(fbb, nullptr, nullptr, &out_scale,
+                                                 &out_zero_point)));
+
+  const std::vector<int32_t> conv_inputs{0, 1, 2}, conv_outputs{3};
+  std::vector<flatbuffers::Offset<circle::Operator>> operators;
+  operators.push_back(circle::CreateOperatorDirect(
+      fbb, 0, &conv_inputs, &conv_outputs, circle::BuiltinOptions_Conv2DOptions,
+      circle::CreateConv2DOptions(fbb, circle::Padding_VALID, 1, 1).Union()));
+
+  const std::vector<int32_t> inputs{0}, outputs{3};
+  std::vector<flatbuffers::Offset<circle::SubGraph>> subgraphs;
+  subgraphs.push_back(
+      circle::CreateSubGraphDirect(fbb, &tensors, &inputs, &outputs, &operators, "main"));
+
+  std::vector<flatbuffers::Offset<circle::OperatorCode>> operator_codes;
+  operator_codes.push_back(circle::CreateOperatorCode(fbb, circle::BuiltinOperator_CONV_2D));
+
+  auto model = circle::CreateModelDirect(fbb, 0, &operator_codes, &subgraphs, "test", &buffers);
+  circle::FinishModelBuffer(fbb, model);
+
+  const auto path = createFile();
+  std::ofstream file(path, std::ios::binary);
+  file.write(reinterpret_cast<const char *>(fbb.GetBufferPointer()), fbb.GetSize());
+  return path;
+}
+
+} // namespace
+
+using namespace onert;
+
+TEST(CircleLoader, inline_and_external_buffers)
+{
+  const auto path = writeModel(externalOffset(), external_data.size() * sizeof(float));
+  const auto subgs = circle_loader::loadModel(path.c_str());
+  std::remove(path.c_str());
+
+  const auto &operands = subgs->primary()->operands();
+
+  // Data within the flatbuffer is copied
+  const auto *inline_buffer = operands.at(ir::OperandIndex{1}).data();
+  ASSERT_NE(inline_buffer, nullptr);
+  EXPECT_EQ(dynamic_cast<const ir::MMapedData *>(inline_buffer), nullptr);
+  ASSERT_EQ(inline_buffer->size(), inline_data.size() * sizeof(float));
+  EXPECT_EQ(std::memcmp(inline_buffer->base(), inline_data.data(), inline_buffer->size()), 0);
+
+  // Data out of the flatbuffer is mapped in memory
+  const auto *external_buffer = operands.at(ir::OperandIndex{2}).data();
+  ASSERT_NE(external_buffer, nullptr);
+  EXPECT_NE(dynamic_cast<const ir::MMapedData *>(external_buffer), nullptr);
+  ASSERT_EQ(external_buffer->size(), external_data.size() * sizeof(float));
+  EXPECT_EQ(std::memcmp(external_buffer->base(), external_data.data(), external_buffer->size()),
+            0);
+
+  // Buffer of no data
+  EXPECT_EQ(operands.at(ir::OperandIndex{0}).data(), nullptr);
+}
+
+TEST(CircleLoader, neg_external_buffer_out_of_file)
+{
+  const auto offset = externalOffset();
+  // The size of data exceeds the end of the file
+  const auto path = writeModel(offset, external_data.size() * sizeof(float) + 4);
+  EXPECT_THROW(circle_loader::loadModel(path.c_str()), std::runtime_error);
+  std::remove(path.c_str());
+}
+
+TEST(CircleLoader, per_channel_conv2d)
+{
+  const auto path = writePerChannelConvModel({0, 0});
+  const auto subgs = circle_loader::loadModel(path.c_str());
+  std::remove(path.c_str());
+
+  const auto &operands = subgs->primary()->operands();
+
+  const auto &filter_type = operands.at(ir::OperandIndex{1}).typeInfo();
+  EXPECT_EQ(filter_type.type(), ir::DataType::QUANT8_ASYMM_SIGNED);
+  ASSERT_TRUE(filter_type.isPerChannel());
+  EXPECT_EQ(filter_type.scales(), filter_scales);
+  EXPECT_EQ(filter_type.quantizedDimension(), 0);
+
+  const auto &bias_type = operands.at(ir::OperandIndex{2}).typeInfo();
+  EXPECT_EQ(bias_type.type(), ir::DataType::INT32);
+  ASSERT_TRUE(bias_type.isPerChannel());
+  ASSERT_EQ(bias_type.scales().size(), filter_scales.size());
+  for (size_t c = 0; c < filter_scales.size(); ++c)
+    EXPECT_FLOAT_EQ(bias_type.scales()[c], input_scale * filter_scales[c]);
+  EXPECT_EQ(bias_type.offset(), 0);
+
+  const auto &input_type = operands.at(ir::OperandIndex{0}).typeInfo();
+  EXPECT_FALSE(input_type.isPerChannel());
+  EXPECT_FLOAT_EQ(input_type.scale(), input_scale);
+  EXPECT_EQ(input_type.offset(), 3);
+}
+
+TEST(CircleLoader, neg_per_channel_asymmetric_bias)
+{
+  const auto path = writePerChannelConvModel({0, 1});
+  EXPECT_THROW(circle_loader::loadModel(path.c_str()), std::runtime_error);
+  std::remove(path.c_str());
+}
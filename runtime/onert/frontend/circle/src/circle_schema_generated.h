@@ -9182,16 +9182,21 @@ struct Buffer FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table
 {
   enum
   {
-    VT_DATA = 4
+    VT_DATA = 4,
+    VT_OFFSET = 6,
+    VT_SIZE = 8
   };
   const flatbuffers::Vector<uint8_t> *data() const
   {
     return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_DATA);
   }
+  uint64_t offset() const { return GetField<uint64_t>(VT_OFFSET, 0); }
+  uint64_t size() const { return GetField<uint64_t>(VT_SIZE, 0); }
   bool Verify(flatbuffers::Verifier &verifier) const
   {
     return VerifyTableStart(verifier) && VerifyOffset(verifier, VT_DATA) &&
-           verifier.VerifyVector(data()) && verifier.EndTable();
+           verifier.VerifyVector(data()) && VerifyField<uint64_t>(verifier, VT_OFFSET) &&
+           VerifyField<uint64_t>(verifier, VT_SIZE) && verifier.EndTable();
   }
 };
 
@@ -9203,6 +9208,8 @@ struct BufferBuilder
   {
     fbb_.AddOffset(Buffer::VT_DATA, data);
   }
+  void add_offset(uint64_t offset) { fbb_.AddElement<uint64_t>(Buffer::VT_OFFSET, offset, 0); }
+  void add_size(uint64_t size) { fbb_.AddElement<uint64_t>(Buffer::VT_SIZE, size, 0); }
   explicit BufferBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb)
   {
     start_ = fbb_.StartTable();
@@ -9218,17 +9225,21 @@ struct BufferBuilder
 
 inline flatbuffers::Offset<Buffer>
 CreateBuffer(flatbuffers::FlatBufferBuilder &_fbb,
-             flatbuffers::Offset<flatbuffers::Vector<uint8_t>> data = 0)
+             flatbuffers::Offset<flatbuffers::Vector<uint8_t>> data = 0, uint64_t offset = 0,
+             uint64_t size = 0)
 {
   BufferBuilder builder_(_fbb);
+  builder_.add_size(size);
+  builder_.add_offset(offset);
   builder_.add_data(data);
   return builder_.Finish();
 }
 
 inline flatbuffers::Offset<Buffer> CreateBufferDirect(flatbuffers::FlatBufferBuilder &_fbb,
-                                                      const std::vector<uint8_t> *data = nullptr)
+                                                      const std::vector<uint8_t> *data = nullptr,
+                                                      uint64_t offset = 0, uint64_t size = 0)
 {
-  return circle::CreateBuffer(_fbb, data ? _fbb.CreateVector<uint8_t>(*data) : 0);
+  return circle::CreateBuffer(_fbb, data ? _fbb.CreateVector<uint8_t>(*data) : 0, offset, size);
 }
 
 struct Metadata FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "compiler/BackendManager.h"
+#include "compiler/ManualScheduler.h"
+#include "ir/Graph.h"
+#include "ir/operation/Add.h"
+#include "ir/operation/If.h"
+
+namespace
+{
+
+using namespace onert;
+using namespace onert::ir;
+
+// Model: Add followed by If, which controlflow backend runs
+//   add_out <= (lhs + rhs)
+//   if_out  <= If(cond, add_out)
+std::shared_ptr<Graph> createGraph(OperationIndex &add_index, OperationIndex &if_index)
+{
+  auto graph = std::make_shared<Graph>();
+  Shape shape{1, 2, 2, 1};
+  TypeInfo float_type{DataType::FLOAT32};
+  auto lhs = graph->addOperand(shape, float_type);
+  auto rhs = graph->addOperand(shape, float_type);
+  auto add_out = graph->addOperand(shape, float_type);
+  auto cond = graph->addOperand(Shape{1}, TypeInfo{DataType::BOOL8});
+  auto if_out = graph->addOperand(shape, float_type);
+
+  operation::Add::Param add_param;
+  add_param.activation = Activation::NONE;
+  add_index = graph->addOperation(std::make_unique<operation::Add>(
+      OperandIndexSequence{lhs, rhs}, OperandIndexSequence{add_out}, add_param));
+
+  operation::If::Param if_param{SubgraphIndex{1}, SubgraphIndex{2}};
+  if_index = graph->addOperation(std::make_unique<operation::If>(
+      OperandIndexSequence{cond, add_out}, OperandIndexSequence{if_out}, if_param));
+  return graph;
+}
+
+TEST(ManualScheduler, first_supporting_backend)
+{
+  compiler::BackendManager::get().loadBackend("cpu");
+  compiler::BackendManager::get().loadBackend("controlflow");
+
+  OperationIndex add_index, if_index;
+  auto graph = createGraph(add_index, if_index);
+
+  // controlflow backend takes only its own operations even if it comes first
+  compiler::ManualScheduler scheduler{{"controlflow", "cpu"}, compiler::ManualSchedulerOptions{}};
+  auto resolver = scheduler.schedule(*graph);
+  EXPECT_EQ(resolver->getBackend(add_index)->config()->id(), "cpu");
+  EXPECT_EQ(resolver->getBackend(if_index)->config()->id(), "controlflow");
+}
+
+TEST(ManualScheduler, backend_for_all_and_per_opcode)
+{
+  compiler::BackendManager::get().loadBackend("cpu");
+  compiler::BackendManager::get().loadBackend("controlflow");
+
+  OperationIndex add_index, if_index;
+  auto graph = createGraph(add_index, if_index);
+
+  // OP_BACKEND_ALLOPS disables the search, and per-opcode backends override it
+  compiler::ManualSchedulerOptions options;
+  options.backend_for_all = "cpu";
+  options.opcode_to_backend[OpCode::If] = "controlflow";
+  compiler::ManualScheduler scheduler{{"cpu", "controlflow"}, options};
+  auto resolver = scheduler.schedule(*graph);
+  EXPECT_EQ(resolver->getBackend(add_index)->config()->id(), "cpu");
+  EXPECT_EQ(resolver->getBackend(if_index)->config()->id(), "controlflow");
+}
+
+} // namespace
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ir/Graph.h"
+#include "ir/OpSequenceCostModel.h"
+#include "ir/operation/Add.h"
+
+namespace
+{
+
+using namespace onert::ir;
+
+// Diamond of four adds
+// a <= in + in
+// b <= a + a, c <= a + a
+// out <= b + c
+struct DiamondGraph
+{
+  DiamondGraph()
+  {
+    Shape shape{1, 4};
+    TypeInfo type{DataType::FLOAT32};
+    auto in = graph.addOperand(shape, type);
+    auto a = graph.addOperand(shape, type);
+    auto b = graph.addOperand(shape, type);
+    auto c = graph.addOperand(shape, type);
+    auto out = graph.addOperand(shape, type);
+
+    operation::Add::Param param;
+    param.activation = Activation::NONE;
+    add_a = graph.addOperation(std::make_unique<operation::Add>(OperandIndexSequence{in, in},
+                                                                OperandIndexSequence{a}, param));
+    add_b = graph.addOperation(std::make_unique<operation::Add>(OperandIndexSequence{a, a},
+                                                                OperandIndexSequence{b}, param));
+    add_c = graph.addOperation(std::make_unique<operation::Add>(OperandIndexSequence{a, a},
+                                                                OperandIndexSequence{c}, param));
+    add_out = graph.addOperation(std::make_unique<operation::Add>(
+        OperandIndexSequence{b, c}, OperandIndexSequence{out}, param));
+    graph.addInput(in);
+    graph.addOutput(out);
+    graph.finishBuilding();
+  }
+
+  Graph graph;
+  OperationIndex add_a, add_b, add_c, add_out;
+};
+
+// Each add does 4 operations and moves 3 * 16 bytes
+constexpr uint64_t ADD_COST = 4 + 48;
+
+TEST(OpSequenceCostModel, ranks)
+{
+  DiamondGraph diamond;
+  OpSequenceCostModel model{diamond.graph, 1};
+
+  ASSERT_EQ(model.cost(diamond.add_a), ADD_COST);
+  ASSERT_EQ(model.totalCost(), 4 * ADD_COST);
+
+  auto ranks = model.ranks();
+  ASSERT_EQ(ranks->at(diamond.add_out), ADD_COST);
+  ASSERT_EQ(ranks->at(diamond.add_b), 2 * ADD_COST);
+  ASSERT_EQ(ranks->at(diamond.add_c), 2 * ADD_COST);
+  ASSERT_EQ(ranks->at(diamond.add_a), 3 * ADD_COST);
+}
+
+TEST(OpSequenceCostModel, granularity)
+{
+  DiamondGraph diamond;
+
+  // Single worker does not limit OpSequences
+  OpSequenceCostModel single{diamond.graph, 1};
+  ASSERT_EQ(single.granularity(), 0);
+  ASSERT_FALSE(single.exceeds(100 * ADD_COST, diamond.add_a));
+
+  OpSequenceCostModel dual{diamond.graph, 2};
+  ASSERT_EQ(dual.granularity(), 4 * ADD_COST / (2 * OpSequenceCostModel::CHUNKS_PER_WORKER));
+  // An empty OpSequence accepts an operation whatever its cost is
+  ASSERT_FALSE(dual.exceeds(0, diamond.add_a));
+  ASSERT_TRUE(dual.exceeds(ADD_COST, diamond.add_b));
+}
+
+} // namespace
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/AdaptiveExecutor.h"
+
+#include <gtest/gtest.h>
+#include <thread>
+
+namespace
+{
+using namespace onert;
+using namespace exec;
+
+struct MockExecutor : public IExecutor
+{
+  MockExecutor(const ir::Graph &graph, std::shared_ptr<uint32_t> runs)
+      : _graph{graph}, _runs{std::move(runs)}
+  {
+  }
+  const ir::Graph &graph() override { return _graph; }
+  void setIndexedRanks(std::shared_ptr<ir::OperationIndexMap<int64_t>>) override {}
+  void execute(const IODescription &) override { (*_runs)++; }
+  void collectMetrics(RuntimeMetricsSnapshot &snapshot) const override
+  {
+    snapshot.run_count += *_runs;
+  }
+
+  const ir::Graph &_graph;
+  std::shared_ptr<uint32_t> _runs;
+};
+
+TEST(AdaptiveExecutor, swap)
+{
+  auto graph = std::make_shared<ir::Graph>();
+  auto first_runs = std::make_shared<uint32_t>(0);
+  auto second_runs = std::make_shared<uint32_t>(0);
+  uint32_t num_compiles = 0;
+
+  AdaptiveExecutor executor{graph, std::make_unique<MockExecutor>(*graph, first_runs),
+                            [&]() -> std::unique_ptr<IExecutor> {
+                              num_compiles++;
+                              return std::make_unique<MockExecutor>(*graph, second_runs);
+                            },
+                            2};
+  ASSERT_EQ(&executor.graph(), graph.get());
+
+  IODescription desc;
+  executor.execute(desc);
+  executor.execute(desc);
+  ASSERT_EQ(*first_runs, 2);
+
+  // Recompilation runs in background, and the executor is swapped between runs once it is done
+  for (int i = 0; i < 1000 && *second_runs == 0; ++i)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    executor.execute(desc);
+  }
+  ASSERT_GT(*second_runs, 0);
+  ASSERT_GE(num_compiles, 1);
+
+  RuntimeMetricsSnapshot snapshot;
+  executor.collectMetrics(snapshot);
+  ASSERT_EQ(snapshot.run_count, *first_runs + *second_runs);
+}
+
+} // namespace
@@ -99,4 +99,25 @@ TEST(ExecTime, structure)
   // clean up
   EXPECT_EQ(remove("exec_time.json"), 0);
 }
+
+TEST(ExecTime, decay)
+{
+  const auto *b = new MockBackend();
+  std::vector<const Backend *> bs = {b};
+  ExecTime et(bs);
+
+  // Default decay averages the previous record and the new measurement
+  et.updateOperationExecTime(b, "op1", false, 100, 100);
+  et.updateOperationExecTime(b, "op1", false, 100, 300);
+  ASSERT_EQ(et.getOperationExecTime(b, "op1", false, 100), 200);
+
+  et.setDecay(0.75);
+  et.updateOperationExecTime(b, "op1", false, 100, 600);
+  ASSERT_EQ(et.getOperationExecTime(b, "op1", false, 100), 300);
+
+  // Lower decay follows the new measurement
+  et.setDecay(0.25);
+  et.updateOperationExecTime(b, "op1", false, 100, 700);
+  ASSERT_EQ(et.getOperationExecTime(b, "op1", false, 100), 600);
+}
 } // unnamed namespace
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "exec/IPermuteFunction.h"
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+
+using namespace onert;
+
+// Dense float tensor of rank 4, whose dimensions are of NCHW if the layout is NCHW and of NHWC
+// otherwise
+class MockTensor : public backend::ITensor
+{
+public:
+  MockTensor(const std::vector<size_t> &dims, ir::Layout layout) : _dims(dims), _layout(layout)
+  {
+    size_t size = _dims[0] * _dims[1] * _dims[2];
+    size *= _layout == ir::Layout::NCHWc ? blocks() * ir::NCHWC_BLOCK : _dims[3];
+    _data.resize(size, -1.f);
+  }
+
+public:
+  uint8_t *buffer() const override
+  {
+    return reinterpret_cast<uint8_t *>(const_cast<float *>(_data.data()));
+  }
+  size_t total_size() const override { return _data.size() * sizeof(float); }
+  size_t dimension(size_t index) const override { return _dims.at(index); }
+  size_t num_dimensions() const override { return _dims.size(); }
+  size_t calcOffset(const ir::Coordinates &coords) const override
+  {
+    return index(coords[0], coords[1], coords[2], coords[3]) * sizeof(float);
+  }
+  ir::Layout layout() const override { return _layout; }
+  ir::DataType data_type() const override { return ir::DataType::FLOAT32; }
+  bool has_padding() const override { return false; }
+  void access(const std::function<void(ITensor &tensor)> &fn) override { fn(*this); }
+
+public:
+  // Element of a feature map, regardless of the layout
+  float &at(size_t n, size_t h, size_t w, size_t c)
+  {
+    if (_layout == ir::Layout::NCHW)
+      return _data[index(n, c, h, w)];
+    return _data[index(n, h, w, c)];
+  }
+  const std::vector<float> &data() const { return _data; }
+
+private:
+  size_t blocks() const { return (_dims[3] + ir::NCHWC_BLOCK - 1) / ir::NCHWC_BLOCK; }
+  size_t index(size_t d0, size_t d1, size_t d2, size_t d3) const
+  {
+    if (_layout == ir::Layout::NCHWc)
+    {
+      const size_t offset = d0 * blocks() + d3 / ir::NCHWC_BLOCK;
+      return ((offset * _dims[1] + d1) * _dims[2] + d2) * ir::NCHWC_BLOCK +
+             d3 % ir::NCHWC_BLOCK;
+    }
+    return ((d0 * _dims[1] + d1) * _dims[2] + d2) * _dims[3] + d3;
+  }
+
+private:
+  std::vector<size_t> _dims;
+  ir::Layout _layout;
+  std::vector<float> _data;
+};
+
+class MockPermuteFunction : public exec::IPermuteFunction
+{
+public:
+  MockPermuteFunction(const std::shared_ptr<backend::ITensor> &src,
+                      const std::shared_ptr<backend::ITensor> &dst)
+  {
+    _src_tensors.emplace_back(src);
+    _dst_tensors.emplace_back(dst);
+    _ranks.emplace_back(4);
+  }
+
+  void optimize() override {}
+};
+
+const size_t N = 2, H = 3, W = 2, C = 11;
+
+std::shared_ptr<MockTensor> createTensor(ir::Layout layout)
+{
+  if (layout == ir::Layout::NCHW)
+    return std::make_shared<MockTensor>(std::vector<size_t>{N, C, H, W}, layout);
+  return std::make_shared<MockTensor>(std::vector<size_t>{N, H, W, C}, layout);
+}
+
+float value(size_t n, size_t h, size_t w, size_t c)
+{
+  return static_cast<float>(((n * H + h) * W + w) * C + c);
+}
+
+void testPermute(ir::Layout from, ir::Layout to)
+{
+  auto src = createTensor(from);
+  auto dst = createTensor(to);
+  for (size_t n = 0; n < N; ++n)
+    for (size_t h = 0; h < H; ++h)
+      for (size_t w = 0; w < W; ++w)
+        for (size_t c = 0; c < C; ++c)
+          src->at(n, h, w, c) = value(n, h, w, c);
+
+  MockPermuteFunction permute{src, dst};
+  permute.run();
+
+  for (size_t n = 0; n < N; ++n)
+    for (size_t h = 0; h < H; ++h)
+      for (size_t w = 0; w < W; ++w)
+        for (size_t c = 0; c < C; ++c)
+          EXPECT_EQ(dst->at(n, h, w, c), value(n, h, w, c))
+              << "at " << n << ", " << h << ", " << w << ", " << c;
+
+  if (to == ir::Layout::NCHWc)
+  {
+    // Padding channels of the last block are zero, as kernels of NCHWc read whole blocks
+    size_t num_padding = 0;
+    for (const auto v : dst->data())
+    {
+      if (v == 0.f)
+        ++num_padding;
+    }
+    // One more zero is value(0, 0, 0, 0)
+    EXPECT_EQ(num_padding, N * H * W * (2 * ir::NCHWC_BLOCK - C) + 1);
+  }
+}
+
+} // namespace
+
+TEST(IPermuteFunction, nhwc_nchwc)
+{
+  testPermute(ir::Layout::NHWC, ir::Layout::NCHWc);
+  testPermute(ir::Layout::NCHWc, ir::Layout::NHWC);
+}
+
+TEST(IPermuteFunction, nchw_nchwc)
+{
+  testPermute(ir::Layout::NCHW, ir::Layout::NCHWc);
+  testPermute(ir::Layout::NCHWc, ir::Layout::NCHW);
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "backend/IShapeFixer.h"
+#include "ir/Graph.h"
+#include "compiler/Compiler.h"
+#include "exec/Execution.h"
+#include "interp/Registration.h"
+#include "ir/operation/Add.h"
+#include "ir/operation/ReLU6.h"
+
+namespace
+{
+
+using namespace onert::ir;
+
+TEST(InterpFallback, getKernel)
+{
+  ASSERT_NE(onert::interp::getKernel(OpCode::ReLU6), nullptr);
+  ASSERT_NE(onert::interp::getKernel(OpCode::TransposeConv), nullptr);
+  ASSERT_EQ(onert::interp::getKernel(OpCode::Permute), nullptr);
+}
+
+TEST(InterpFallback, not_supported_error)
+{
+  // Only operations that a ShapeFixer does not support fall back to interpreter kernels
+  struct MockShapeFixer : public onert::backend::IShapeFixer
+  {
+  };
+  MockShapeFixer shape_fixer;
+  operation::ReLU6 node{OperandIndexSequence{OperandIndex{0}},
+                        OperandIndexSequence{OperandIndex{1}}};
+  EXPECT_THROW(node.accept(shape_fixer), onert::backend::NotSupportedError);
+}
+
+TEST(InterpFallback, mixed_execution)
+{
+  // Model: Add is run by cpu backend, ReLU6 falls back to interpreter kernel
+  // result1 <= (lhs + rhs)
+  // result2 <= ReLU6(result1)
+  auto graph = std::make_shared<Graph>();
+  Shape shape{1, 2, 2, 1};
+  TypeInfo type{DataType::FLOAT32};
+  auto operand_lhs = graph->addOperand(shape, type);
+  auto operand_rhs = graph->addOperand(shape, type);
+  auto operand_result1 = graph->addOperand(shape, type);
+  auto operand_result2 = graph->addOperand(shape, type);
+
+  operation::Add::Param param;
+  param.activation = Activation::NONE;
+  graph->addOperation(std::make_unique<operation::Add>(
+      OperandIndexSequence{operand_lhs, operand_rhs}, OperandIndexSequence{operand_result1},
+      param));
+  graph->addOperation(std::make_unique<operation::ReLU6>(OperandIndexSequence{operand_result1},
+                                                         OperandIndexSequence{operand_result2}));
+  graph->addInput(operand_lhs);
+  graph->addInput(operand_rhs);
+  graph->addOutput(operand_result2);
+  graph->finishBuilding();
+
+  auto subgs = std::make_shared<Subgraphs>();
+  subgs->push(SubgraphIndex{0}, graph);
+  onert::compiler::Compiler compiler{subgs};
+  compiler.compile();
+  std::shared_ptr<onert::exec::ExecutorMap> executors;
+  compiler.release(executors);
+
+  const float lhs_buffer[4] = {1, 4, -3, 2};
+  const float rhs_buffer[4] = {1, 4, 1, 2};
+  float output_buffer[4] = {};
+  const float output_expected[4] = {2, 6, 0, 4};
+
+  onert::exec::Execution execution{executors};
+  execution.setInput(IOIndex{0}, reinterpret_cast<const void *>(lhs_buffer), 16);
+  execution.setInput(IOIndex{1}, reinterpret_cast<const void *>(rhs_buffer), 16);
+  execution.setOutput(IOIndex{0}, reinterpret_cast<void *>(output_buffer), 16);
+  execution.execute();
+
+  for (auto i = 0; i < 4; i++)
+  {
+    EXPECT_EQ(output_buffer[i], output_expected[i]);
+  }
+}
+
+} // namespace
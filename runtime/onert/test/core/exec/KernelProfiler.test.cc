@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/KernelProfiler.h"
+
+#include <gtest/gtest.h>
+#include <sstream>
+
+namespace
+{
+using namespace onert;
+using namespace exec;
+
+TEST(KernelProfiler, summary)
+{
+  KernelProfiler profiler;
+  auto conv = profiler.registerKernel({ir::OperationIndex{0}, "Conv2D", "cpu", 2000, 1000});
+  auto relu = profiler.registerKernel({ir::OperationIndex{1}, "ReLU", "cpu", 10, 80});
+
+  for (uint64_t n = 1; n <= 100; ++n)
+  {
+    profiler.beginRun();
+    profiler.record(conv, 0, n * 1000);
+    profiler.record(relu, 0, 10);
+    profiler.endRun();
+  }
+  ASSERT_EQ(profiler.numRuns(), 100);
+
+  std::stringstream ss;
+  profiler.writeSummary(ss);
+
+  std::string line;
+  std::getline(ss, line); // title
+  std::getline(ss, line); // header
+
+  // The most time consuming kernel comes first
+  std::getline(ss, line);
+  std::stringstream conv_row{line};
+  std::string index, name, backend;
+  uint64_t count;
+  double mean, p50, p90, p99;
+  conv_row >> index >> name >> backend >> count >> mean >> p50 >> p90 >> p99;
+  ASSERT_EQ(index, "$0");
+  ASSERT_EQ(name, "Conv2D");
+  ASSERT_EQ(backend, "cpu");
+  ASSERT_EQ(count, 100);
+  ASSERT_DOUBLE_EQ(mean, 50.5);
+  ASSERT_DOUBLE_EQ(p50, 50.0);
+  ASSERT_DOUBLE_EQ(p90, 90.0);
+  ASSERT_DOUBLE_EQ(p99, 99.0);
+
+  std::getline(ss, line);
+  std::stringstream relu_row{line};
+  relu_row >> index >> name;
+  ASSERT_EQ(index, "$1");
+  ASSERT_EQ(name, "ReLU");
+}
+
+TEST(KernelProfiler, chrome_trace)
+{
+  KernelProfiler profiler;
+  auto id = profiler.registerKernel({ir::OperationIndex{3}, "Add", "cpu", 4, 48});
+
+  profiler.beginRun();
+  profiler.record(id, 1000, 2500);
+  profiler.endRun();
+
+  std::stringstream ss;
+  profiler.writeChromeTrace(ss);
+  const auto trace = ss.str();
+
+  ASSERT_NE(trace.find("traceEvents"), std::string::npos);
+  ASSERT_NE(trace.find("\"$3 Add\""), std::string::npos);
+  ASSERT_NE(trace.find("\"1.000\""), std::string::npos);
+  ASSERT_NE(trace.find("\"2.500\""), std::string::npos);
+}
+
+} // namespace
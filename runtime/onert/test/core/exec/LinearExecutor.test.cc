@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ir/Graph.h"
+#include "compiler/Compiler.h"
+#include "exec/Execution.h"
+#include "exec/ExecutorBase.h"
+#include "ir/operation/Add.h"
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+
+using namespace onert::ir;
+
+/**
+ * @brief Model of a chain of Add operations on tiny tensors, where most of a run is dispatching
+ *        kernels rather than computing
+ */
+class AddChainModel
+{
+public:
+  AddChainModel(uint32_t num_ops, int32_t size)
+      : _graph{std::make_shared<Graph>()}, _size{size}
+  {
+    TypeInfo type{DataType::FLOAT32};
+    const std::vector<float> one_data(size, 1.0f);
+    auto value = _graph->addOperand(Shape{1, _size}, type);
+    _graph->addInput(value);
+    for (uint32_t i = 0; i < num_ops; ++i)
+    {
+      auto one = _graph->addOperand(Shape{1, _size}, type);
+      _graph->operands().at(one).data(std::make_unique<CachedData>(
+          reinterpret_cast<const uint8_t *>(one_data.data()), one_data.size() * sizeof(float)));
+      auto output = _graph->addOperand(Shape{1, _size}, type);
+
+      operation::Add::Param param;
+      param.activation = Activation::NONE;
+      _graph->addOperation(std::make_unique<operation::Add>(OperandIndexSequence{value, one},
+                                                            OperandIndexSequence{output}, param));
+      value = output;
+    }
+    _graph->addOutput(value);
+    _graph->finishBuilding();
+  }
+
+  std::shared_ptr<Graph> graph() { return _graph; }
+  size_t size() const { return static_cast<size_t>(_size); }
+
+private:
+  std::shared_ptr<Graph> _graph;
+  int32_t _size;
+};
+
+/**
+ * @brief Observer which only counts sequences run
+ */
+class CountObserver : public onert::exec::IExecutionObserver
+{
+public:
+  explicit CountObserver(uint32_t *count) : _count{count} {}
+
+  void handleBegin(onert::exec::IExecutor *, const OpSequence *,
+                   const onert::backend::Backend *) override
+  {
+    (*_count)++;
+  }
+  void handleEnd(onert::exec::IExecutor *, const OpSequence *,
+                 const onert::backend::Backend *) override
+  {
+    // DO NOTHING
+  }
+
+private:
+  uint32_t *_count;
+};
+
+std::shared_ptr<onert::exec::ExecutorMap> compile(AddChainModel &model)
+{
+  auto subgs = std::make_shared<Subgraphs>();
+  subgs->push(SubgraphIndex{0}, model.graph());
+  onert::compiler::Compiler compiler{subgs};
+  compiler.options().backend_list = {"cpu"};
+  compiler.options().executor = "Linear";
+  compiler.compile();
+  std::shared_ptr<onert::exec::ExecutorMap> executors;
+  compiler.release(executors);
+  return executors;
+}
+
+void addObserver(const std::shared_ptr<onert::exec::ExecutorMap> &executors, uint32_t *count)
+{
+  auto executor =
+      dynamic_cast<onert::exec::ExecutorBase *>(executors->at(SubgraphIndex{0}).get());
+  ASSERT_NE(executor, nullptr);
+  executor->addObserver(std::make_unique<CountObserver>(count));
+}
+
+void run(const std::shared_ptr<onert::exec::ExecutorMap> &executors,
+         const std::vector<float> &input, std::vector<float> &output)
+{
+  onert::exec::Execution execution{executors};
+  execution.setInput(IOIndex{0}, input.data(), input.size() * sizeof(float));
+  execution.setOutput(IOIndex{0}, output.data(), output.size() * sizeof(float));
+  execution.execute();
+}
+
+TEST(LinearExecutor, same_result_without_observer)
+{
+  constexpr uint32_t NUM_OPS = 8;
+  AddChainModel model{NUM_OPS, 4};
+  auto executors = compile(model);
+
+  const std::vector<float> input{0.0f, 1.0f, 2.0f, 3.0f};
+  std::vector<float> output(model.size());
+
+  // Kernels run without any dispatch to observers
+  run(executors, input, output);
+  for (size_t i = 0; i < output.size(); ++i)
+    ASSERT_FLOAT_EQ(output[i], input[i] + NUM_OPS);
+
+  // Every sequence is notified once an observer is registered
+  uint32_t count = 0;
+  addObserver(executors, &count);
+  std::fill(output.begin(), output.end(), 0.0f);
+  run(executors, input, output);
+  for (size_t i = 0; i < output.size(); ++i)
+    ASSERT_FLOAT_EQ(output[i], input[i] + NUM_OPS);
+  ASSERT_GT(count, 0u);
+}
+
+// Benchmark of dispatch overhead per operation of LinearExecutor
+// Run with --gtest_also_run_disabled_tests --gtest_filter=*benchmark*
+TEST(LinearExecutor, DISABLED_benchmark_dispatch_overhead)
+{
+  constexpr uint32_t NUM_OPS = 200;
+  constexpr int32_t SIZE = 4;
+  constexpr int NUM_RUNS = 2000;
+
+  uint32_t count = 0;
+  auto measure = [&](bool observed) {
+    AddChainModel model{NUM_OPS, SIZE};
+    auto executors = compile(model);
+    if (observed)
+      addObserver(executors, &count);
+    const std::vector<float> input(model.size(), 0.0f);
+    std::vector<float> output(model.size());
+
+    run(executors, input, output); // Warm up
+    const auto begin = std::chrono::steady_clock::now();
+    for (int n = 0; n < NUM_RUNS; ++n)
+      run(executors, input, output);
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - begin).count() / NUM_RUNS / NUM_OPS;
+  };
+
+  // Run with an observer takes the path of sequences, observers and dynamic shape inference
+  const auto observed_ns = measure(true);
+  const auto flat_ns = measure(false);
+  std::cout << "Add of " << SIZE << " floats with observer    : " << observed_ns << " ns/op"
+            << std::endl;
+  std::cout << "Add of " << SIZE << " floats without observer : " << flat_ns << " ns/op"
+            << std::endl;
+}
+
+} // namespace
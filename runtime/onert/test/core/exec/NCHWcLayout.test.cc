@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ir/Graph.h"
+#include "compiler/Compiler.h"
+#include "exec/Execution.h"
+#include "ir/operation/Add.h"
+#include "ir/operation/Concat.h"
+#include "ir/operation/Conv2D.h"
+#include "ir/operation/MaxPool2D.h"
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using namespace onert::ir;
+
+const int32_t H = 5, W = 4, C = 11;
+
+// Model: conv = Conv2D(input), pool = MaxPool2D(conv), add = Add(conv, pool),
+//        output = Concat(add, pool) along channels
+// Feature maps have 11 channels, which are not a multiple of blocks of NCHWc
+std::shared_ptr<Graph> createGraph()
+{
+  auto graph = std::make_shared<Graph>();
+  TypeInfo type{DataType::FLOAT32};
+  const Shape feature_shape{1, H, W, C};
+
+  auto input = graph->addOperand(feature_shape, type);
+  auto kernel = graph->addOperand(Shape{C, 3, 3, C}, type);
+  auto bias = graph->addOperand(Shape{C}, type);
+  auto conv = graph->addOperand(feature_shape, type);
+  auto pool = graph->addOperand(feature_shape, type);
+  auto add = graph->addOperand(feature_shape, type);
+  auto output = graph->addOperand(Shape{1, H, W, 2 * C}, type);
+
+  std::vector<float> kernel_data(C * 3 * 3 * C);
+  for (size_t i = 0; i < kernel_data.size(); ++i)
+    kernel_data[i] = static_cast<float>(static_cast<int>(i * 7 % 13) - 6) / 16;
+  std::vector<float> bias_data(C);
+  for (size_t i = 0; i < bias_data.size(); ++i)
+    bias_data[i] = static_cast<float>(i) / 4 - 1;
+  graph->operands().at(kernel).data(std::make_unique<CachedData>(
+      reinterpret_cast<const uint8_t *>(kernel_data.data()), kernel_data.size() * sizeof(float)));
+  graph->operands().at(bias).data(std::make_unique<CachedData>(
+      reinterpret_cast<const uint8_t *>(bias_data.data()), bias_data.size() * sizeof(float)));
+
+  operation::Conv2D::Param conv_param;
+  conv_param.stride = Stride{1, 1};
+  conv_param.padding = Padding{PaddingType::SAME};
+  conv_param.activation = Activation::NONE;
+  graph->addOperation(std::make_unique<operation::Conv2D>(
+      OperandIndexSequence{input, kernel, bias}, OperandIndexSequence{conv}, conv_param));
+
+  operation::MaxPool2D::Param pool_param;
+  pool_param.kh = 3;
+  pool_param.kw = 3;
+  pool_param.stride = Stride{1, 1};
+  pool_param.padding = Padding{PaddingType::SAME};
+  pool_param.activation = Activation::NONE;
+  graph->addOperation(std::make_unique<operation::MaxPool2D>(
+      OperandIndexSequence{conv}, OperandIndexSequence{pool}, pool_param));
+
+  operation::Add::Param add_param;
+  add_param.activation = Activation::RELU;
+  graph->addOperation(std::make_unique<operation::Add>(OperandIndexSequence{conv, pool},
+                                                       OperandIndexSequence{add}, add_param));
+
+  operation::Concat::Param concat_param;
+  concat_param.axis = 3;
+  concat_param.rank = 4;
+  graph->addOperation(std::make_unique<operation::Concat>(
+      OperandIndexSequence{add, pool}, OperandIndexSequence{output}, concat_param));
+
+  graph->addInput(input);
+  graph->addOutput(output);
+  graph->finishBuilding();
+  return graph;
+}
+
+std::vector<float> run(const std::string &cpu_layout, const std::vector<float> &input)
+{
+  const char *original = std::getenv("CPU_LAYOUT");
+  const std::string original_layout = original ? original : "";
+  setenv("CPU_LAYOUT", cpu_layout.c_str(), true);
+
+  auto subgs = std::make_shared<onert::ir::Subgraphs>();
+  subgs->push(onert::ir::SubgraphIndex{0}, createGraph());
+  onert::compiler::Compiler compiler{subgs};
+  compiler.compile();
+  std::shared_ptr<onert::exec::ExecutorMap> executors;
+  compiler.release(executors);
+
+  if (original)
+    setenv("CPU_LAYOUT", original_layout.c_str(), true);
+  else
+    unsetenv("CPU_LAYOUT");
+
+  std::vector<float> output(H * W * 2 * C);
+  onert::exec::Execution execution{executors};
+  execution.setInput(IOIndex{0}, input.data(), input.size() * sizeof(float));
+  execution.setOutput(IOIndex{0}, output.data(), output.size() * sizeof(float));
+  execution.execute();
+  return output;
+}
+
+} // namespace
+
+TEST(NCHWcLayout, conv_pool_add_concat)
+{
+  std::vector<float> input(H * W * C);
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>(static_cast<int>(i * 5 % 17) - 8) / 8;
+
+  const auto expected = run("NHWC", input);
+  const auto output = run("NCHWc", input);
+
+  ASSERT_EQ(output.size(), expected.size());
+  for (size_t i = 0; i < output.size(); ++i)
+  {
+    EXPECT_NEAR(output[i], expected[i], 1e-4f) << "at " << i;
+  }
+}
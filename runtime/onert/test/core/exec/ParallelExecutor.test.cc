@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ir/Graph.h"
+#include "compiler/Compiler.h"
+#include "exec/Execution.h"
+#include "ir/operation/Concat.h"
+#include "ir/operation/Conv2D.h"
+#include "ir/operation/MaxPool2D.h"
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+
+using namespace onert::ir;
+
+/**
+ * @brief Model of Inception-v3 style modules
+ *
+ * Each module has four branches which are concatenated along channels
+ *  - 1x1 conv
+ *  - 1x1 conv - 3x3 conv
+ *  - 1x1 conv - 3x3 conv - 3x3 conv
+ *  - 3x3 max pool - 1x1 conv
+ */
+class InceptionLikeModel
+{
+public:
+  InceptionLikeModel(uint32_t num_modules, int32_t size, int32_t channels)
+      : _graph{std::make_shared<Graph>()}, _size{size}, _channels{channels}
+  {
+    auto value = addFeature(_channels);
+    _graph->addInput(value);
+    for (uint32_t i = 0; i < num_modules; ++i)
+    {
+      value = addModule(value);
+    }
+    _graph->addOutput(value);
+    _graph->finishBuilding();
+  }
+
+  std::shared_ptr<Graph> graph() { return _graph; }
+  size_t featureSize() const { return static_cast<size_t>(_size) * _size * _channels; }
+
+private:
+  OperandIndex addFeature(int32_t channels)
+  {
+    return _graph->addOperand(Shape{1, _size, _size, channels}, TypeInfo{DataType::FLOAT32});
+  }
+
+  OperandIndex addConv(const OperandIndex &input, int32_t in_channels, int32_t out_channels,
+                       int32_t kernel_size)
+  {
+    TypeInfo type{DataType::FLOAT32};
+    auto kernel = _graph->addOperand(Shape{out_channels, kernel_size, kernel_size, in_channels},
+                                     type);
+    auto bias = _graph->addOperand(Shape{out_channels}, type);
+    auto output = addFeature(out_channels);
+
+    // Small weights keep values bounded over modules
+    std::vector<float> kernel_data(out_channels * kernel_size * kernel_size * in_channels);
+    for (size_t i = 0; i < kernel_data.size(); ++i)
+      kernel_data[i] = static_cast<float>(static_cast<int>(i % 7) - 3) / kernel_data.size();
+    std::vector<float> bias_data(out_channels, 0.5f);
+    setData(kernel, kernel_data);
+    setData(bias, bias_data);
+
+    operation::Conv2D::Param param;
+    param.stride = Stride{1, 1};
+    param.padding = Padding{PaddingType::SAME};
+    param.activation = Activation::RELU;
+    _graph->addOperation(std::make_unique<operation::Conv2D>(
+        OperandIndexSequence{input, kernel, bias}, OperandIndexSequence{output}, param));
+    return output;
+  }
+
+  OperandIndex addModule(const OperandIndex &input)
+  {
+    const auto branch_channels = _channels / 4;
+
+    auto branch1 = addConv(input, _channels, branch_channels, 1);
+
+    auto branch2 = addConv(input, _channels, branch_channels, 1);
+    branch2 = addConv(branch2, branch_channels, branch_channels, 3);
+
+    auto branch3 = addConv(input, _channels, branch_channels, 1);
+    branch3 = addConv(branch3, branch_channels, branch_channels, 3);
+    branch3 = addConv(branch3, branch_channels, branch_channels, 3);
+
+    auto pooled = addFeature(_channels);
+    operation::MaxPool2D::Param pool_param;
+    pool_param.kh = 3;
+    pool_param.kw = 3;
+    pool_param.stride = Stride{1, 1};
+    pool_param.padding = Padding{PaddingType::SAME};
+    pool_param.activation = Activation::NONE;
+    _graph->addOperation(std::make_unique<operation::MaxPool2D>(
+        OperandIndexSequence{input}, OperandIndexSequence{pooled}, pool_param));
+    auto branch4 = addConv(pooled, _channels, branch_channels, 1);
+
+    auto output = addFeature(_channels);
+    operation::Concat::Param concat_param;
+    concat_param.axis = 3;
+    concat_param.rank = 4;
+    _graph->addOperation(std::make_unique<operation::Concat>(
+        OperandIndexSequence{branch1, branch2, branch3, branch4}, OperandIndexSequence{output},
+        concat_param));
+    return output;
+  }
+
+  void setData(const OperandIndex &index, const std::vector<float> &data)
+  {
+    _graph->operands().at(index).data(std::make_unique<CachedData>(
+        reinterpret_cast<const uint8_t *>(data.data()), data.size() * sizeof(float)));
+  }
+
+private:
+  std::shared_ptr<Graph> _graph;
+  int32_t _size;
+  int32_t _channels;
+};
+
+std::shared_ptr<onert::exec::ExecutorMap> compile(InceptionLikeModel &model,
+                                                  const std::string &executor, int workers)
+{
+  auto subgs = std::make_shared<Subgraphs>();
+  subgs->push(SubgraphIndex{0}, model.graph());
+  onert::compiler::Compiler compiler{subgs};
+  compiler.options().backend_list = {"cpu"};
+  compiler.options().executor = executor;
+  compiler.options().parallel_workers = workers;
+  compiler.compile();
+  std::shared_ptr<onert::exec::ExecutorMap> executors;
+  compiler.release(executors);
+  return executors;
+}
+
+void run(const std::shared_ptr<onert::exec::ExecutorMap> &executors,
+         const std::vector<float> &input, std::vector<float> &output)
+{
+  onert::exec::Execution execution{executors};
+  execution.setInput(IOIndex{0}, input.data(), input.size() * sizeof(float));
+  execution.setOutput(IOIndex{0}, output.data(), output.size() * sizeof(float));
+  execution.execute();
+}
+
+std::vector<float> makeInput(size_t size)
+{
+  std::vector<float> input(size);
+  for (size_t i = 0; i < size; ++i)
+    input[i] = static_cast<float>(i % 13) / 13.0f;
+  return input;
+}
+
+TEST(ParallelExecutor, same_result_as_linear)
+{
+  InceptionLikeModel linear_model{2, 8, 16};
+  InceptionLikeModel parallel_model{2, 8, 16};
+  auto linear = compile(linear_model, "Linear", 1);
+  auto parallel = compile(parallel_model, "Parallel", 4);
+
+  const auto input = makeInput(linear_model.featureSize());
+  std::vector<float> expected(linear_model.featureSize());
+  std::vector<float> output(parallel_model.featureSize());
+  run(linear, input, expected);
+
+  // Run several times as worker threads are kept over runs
+  for (int n = 0; n < 3; ++n)
+  {
+    std::fill(output.begin(), output.end(), 0.0f);
+    run(parallel, input, output);
+    for (size_t i = 0; i < output.size(); ++i)
+    {
+      ASSERT_FLOAT_EQ(output[i], expected[i]);
+    }
+  }
+}
+
+// Benchmark of ParallelExecutor speedup over LinearExecutor
+// Run with --gtest_also_run_disabled_tests --gtest_filter=*benchmark*
+TEST(ParallelExecutor, DISABLED_benchmark_inception_like)
+{
+  constexpr uint32_t NUM_MODULES = 4;
+  constexpr int32_t SIZE = 35;
+  constexpr int32_t CHANNELS = 128;
+  constexpr int NUM_RUNS = 20;
+
+  auto measure = [&](const std::string &executor, int workers) {
+    InceptionLikeModel model{NUM_MODULES, SIZE, CHANNELS};
+    auto executors = compile(model, executor, workers);
+    const auto input = makeInput(model.featureSize());
+    std::vector<float> output(model.featureSize());
+
+    run(executors, input, output); // Warm up
+    const auto begin = std::chrono::steady_clock::now();
+    for (int n = 0; n < NUM_RUNS; ++n)
+      run(executors, input, output);
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - begin).count() / NUM_RUNS;
+  };
+
+  const auto linear_ms = measure("Linear", 1);
+  std::cout << "Linear              : " << linear_ms << " ms" << std::endl;
+  for (int workers : {1, 2, 4})
+  {
+    const auto parallel_ms = measure("Parallel", workers);
+    std::cout << "Parallel(" << workers << " workers) : " << parallel_ms << " ms, speedup x"
+              << linear_ms / parallel_ms << std::endl;
+  }
+}
+
+} // namespace
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/ThreadBudget.h"
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+namespace
+{
+using namespace onert::exec;
+
+TEST(ThreadBudget, narrow)
+{
+  ThreadBudget budget{8};
+
+  // A job without others runnable takes all the cores
+  ASSERT_EQ(budget.acquire(100, 0, 0), 8);
+  ASSERT_EQ(budget.available(), 0);
+  ASSERT_EQ(budget.acquire(100, 0, 0), 0);
+  budget.release(8);
+  ASSERT_EQ(budget.available(), 8);
+}
+
+TEST(ThreadBudget, wide)
+{
+  ThreadBudget budget{8};
+
+  // Four jobs of the same cost share cores equally
+  ASSERT_EQ(budget.acquire(100, 300, 3), 2);
+  ASSERT_EQ(budget.acquire(100, 200, 2), 2);
+  ASSERT_EQ(budget.acquire(100, 100, 1), 2);
+  ASSERT_EQ(budget.acquire(100, 0, 0), 2);
+  ASSERT_EQ(budget.available(), 0);
+}
+
+TEST(ThreadBudget, weighted)
+{
+  ThreadBudget budget{4};
+
+  // A heavy job takes most of the cores, but leaves one for the light one
+  ASSERT_EQ(budget.acquire(900, 100, 1), 3);
+  ASSERT_EQ(budget.acquire(100, 0, 0), 1);
+}
+
+TEST(ThreadBudget, zero_cores) { ASSERT_THROW(ThreadBudget{0}, std::runtime_error); }
+
+} // namespace
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ir/Graph.h"
+#include "interp/Schedule.h"
+#include "ir/operation/Add.h"
+
+namespace
+{
+
+using namespace onert::ir;
+
+TEST(InterpSchedule, chain)
+{
+  // Model: chain of four elementwise add operations
+  // t1 <= (in + rhs), t2 <= (t1 + rhs), t3 <= (t2 + rhs), out <= (t3 + rhs)
+  // Lifetimes of t1 and t3 do not overlap, so they share the same area
+  Graph graph;
+  Shape shape{1, 4, 4, 4};
+  TypeInfo type{DataType::FLOAT32};
+  auto in = graph.addOperand(shape, type);
+  auto rhs = graph.addOperand(shape, type);
+  auto t1 = graph.addOperand(shape, type);
+  auto t2 = graph.addOperand(shape, type);
+  auto t3 = graph.addOperand(shape, type);
+  auto out = graph.addOperand(shape, type);
+
+  operation::Add::Param param;
+  param.activation = Activation::NONE;
+  // Add operations in reverse order to check that schedule does not depend on it
+  graph.addOperation(std::make_unique<operation::Add>(OperandIndexSequence{t3, rhs},
+                                                     OperandIndexSequence{out}, param));
+  graph.addOperation(std::make_unique<operation::Add>(OperandIndexSequence{t2, rhs},
+                                                     OperandIndexSequence{t3}, param));
+  graph.addOperation(std::make_unique<operation::Add>(OperandIndexSequence{t1, rhs},
+                                                     OperandIndexSequence{t2}, param));
+  graph.addOperation(std::make_unique<operation::Add>(OperandIndexSequence{in, rhs},
+                                                     OperandIndexSequence{t1}, param));
+  graph.addInput(in);
+  graph.addInput(rhs);
+  graph.addOutput(out);
+  graph.finishBuilding();
+
+  onert::interp::Schedule schedule{graph};
+
+  const auto &steps = schedule.steps();
+  ASSERT_EQ(steps.size(), 4);
+  ASSERT_EQ(steps.at(0).node->getOutputs().at(0), t1);
+  ASSERT_EQ(steps.at(1).node->getOutputs().at(0), t2);
+  ASSERT_EQ(steps.at(2).node->getOutputs().at(0), t3);
+  ASSERT_EQ(steps.at(3).node->getOutputs().at(0), out);
+
+  const auto &slots = schedule.slots();
+  ASSERT_EQ(slots.size(), 3);
+  ASSERT_EQ(slots.count(out), 0);
+  ASSERT_NE(slots.at(t1).offset, slots.at(t2).offset);
+  ASSERT_NE(slots.at(t2).offset, slots.at(t3).offset);
+  ASSERT_EQ(slots.at(t1).offset, slots.at(t3).offset);
+  ASSERT_EQ(schedule.arenaSize(), 2 * 256);
+}
+
+} // namespace
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ir/Coordinates.h"
+#include "ir/Shape.h"
+
+using onert::ir::Coordinates;
+using onert::ir::Layout;
+using onert::ir::Shape;
+
+namespace
+{
+
+void expectShape(const Shape &shape, const Shape &expected)
+{
+  ASSERT_EQ(shape.rank(), expected.rank());
+  for (int i = 0; i < shape.rank(); ++i)
+    EXPECT_EQ(shape.dim(i), expected.dim(i)) << "at " << i;
+}
+
+void expectCoordinates(const Coordinates &coords, const Coordinates &expected)
+{
+  ASSERT_EQ(coords.size(), expected.size());
+  for (size_t i = 0; i < coords.size(); ++i)
+    EXPECT_EQ(coords[i], expected[i]) << "at " << i;
+}
+
+} // namespace
+
+TEST(graph_operand_Shape, permute_shape_nchwc)
+{
+  const Shape nhwc{2, 3, 4, 11};
+  const Shape nchw{2, 11, 3, 4};
+
+  // Shape of NCHWc is of NHWC
+  expectShape(permuteShape(nhwc, Layout::NHWC, Layout::NCHWc), nhwc);
+  expectShape(permuteShape(nhwc, Layout::NCHWc, Layout::NHWC), nhwc);
+  expectShape(permuteShape(nhwc, Layout::NCHWc, Layout::NCHWc), nhwc);
+  expectShape(permuteShape(nhwc, Layout::NCHWc, Layout::NCHW), nchw);
+  expectShape(permuteShape(nchw, Layout::NCHW, Layout::NCHWc), nhwc);
+
+  // Feature shape reads NCHWc as NHWC
+  const auto feature = nhwc.asFeature(Layout::NCHWc);
+  EXPECT_EQ(feature.N, 2);
+  EXPECT_EQ(feature.H, 3);
+  EXPECT_EQ(feature.W, 4);
+  EXPECT_EQ(feature.C, 11);
+}
+
+TEST(graph_operand_Shape, convert_coordinates_nchwc)
+{
+  const Coordinates nhwc{1, 2, 3, 10};
+  const Coordinates nchw{1, 10, 2, 3};
+
+  // Coordinates of NCHWc are of NHWC
+  expectCoordinates(convertCoordinates(nhwc, Layout::NHWC, Layout::NCHWc), nhwc);
+  expectCoordinates(convertCoordinates(nhwc, Layout::NCHWc, Layout::NHWC), nhwc);
+  expectCoordinates(convertCoordinates(nhwc, Layout::NCHWc, Layout::NCHW), nchw);
+  expectCoordinates(convertCoordinates(nchw, Layout::NCHW, Layout::NCHWc), nhwc);
+}
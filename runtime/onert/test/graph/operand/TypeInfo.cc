@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include "ir/TypeInfo.h"
+
+using namespace onert::ir;
+
+TEST(graph_operand_TypeInfo, per_tensor)
+{
+  TypeInfo type{DataType::QUANT8_ASYMM_SIGNED, 0.5f, -3};
+
+  ASSERT_FALSE(type.isPerChannel());
+  ASSERT_TRUE(type.scales().empty());
+  ASSERT_EQ(type.scale(), 0.5f);
+  ASSERT_EQ(type.offset(), -3);
+  ASSERT_EQ(sizeOfDataType(type.type()), 1);
+}
+
+TEST(graph_operand_TypeInfo, per_channel)
+{
+  TypeInfo type{DataType::QUANT8_ASYMM_SIGNED};
+  type.perChannel({0.1f, 0.2f, 0.3f}, 0);
+
+  ASSERT_TRUE(type.isPerChannel());
+  ASSERT_EQ(type.scales().size(), 3);
+  ASSERT_EQ(type.quantizedDimension(), 0);
+  ASSERT_EQ(type.scale(), 0.1f);
+
+  TypeInfo other{DataType::QUANT8_ASYMM_SIGNED};
+  other.perChannel({0.1f, 0.2f, 0.3f}, 3);
+  ASSERT_NE(type, other);
+
+  other.perChannel({0.1f, 0.2f, 0.3f}, 0);
+  ASSERT_EQ(type, other);
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "util/MemoryProfiler.h"
+
+#include <algorithm>
+#include <sstream>
+
+using namespace onert;
+
+namespace
+{
+
+// Heap usage reported by heap_trace below, which is in bytes
+size_t fake_in_use = 1024;
+size_t fake_peak = 1024;
+
+} // namespace
+
+// Functions of heap_trace, which profilers find as the test is linked with exported symbols
+extern "C" void heap_trace_get_cpu_usage(size_t *in_use, size_t *peak)
+{
+  *in_use = fake_in_use;
+  *peak = fake_peak;
+}
+
+extern "C" void heap_trace_reset_cpu_peak(void) { fake_peak = fake_in_use; }
+
+namespace
+{
+
+size_t count(const std::string &str, const std::string &pattern)
+{
+  size_t n = 0;
+  for (auto pos = str.find(pattern); pos != std::string::npos; pos = str.find(pattern, pos + 1))
+    ++n;
+  return n;
+}
+
+} // namespace
+
+TEST(MemoryProfiler, register_same_scope)
+{
+  util::MemoryProfiler profiler{""};
+
+  auto lower0 = profiler.registerPhase("lower");
+  auto lower1 = profiler.registerPhase("lower");
+  auto plan = profiler.registerPhase("plan");
+  auto kernel = profiler.registerKernel(ir::OperationIndex{0}, "Conv2D", "cpu");
+  auto prepare = profiler.registerKernel(ir::OperationIndex{0}, "Conv2D", "cpu", true);
+
+  ASSERT_EQ(lower0, lower1);
+  ASSERT_NE(lower0, plan);
+  ASSERT_NE(kernel, prepare);
+}
+
+TEST(MemoryProfiler, nested_scopes)
+{
+  util::MemoryProfiler profiler{""};
+
+  auto run = profiler.registerPhase("run");
+  auto kernel = profiler.registerKernel(ir::OperationIndex{3}, "Conv2D", "cpu");
+  for (int i = 0; i < 2; ++i)
+  {
+    profiler.begin(run);
+    profiler.begin(kernel);
+    std::vector<char> scratch(1 << 20, 1);
+    ASSERT_EQ(std::count(scratch.begin(), scratch.end(), 1), 1 << 20);
+    profiler.end(kernel);
+    profiler.end(run);
+  }
+  {
+    util::MemoryProfilePhase phase{&profiler, "load"};
+  }
+  {
+    // Nothing is recorded without profiler
+    util::MemoryProfilePhase phase{nullptr, "lower"};
+  }
+
+  std::stringstream trace;
+  profiler.writeChromeTrace(trace);
+  ASSERT_EQ(count(trace.str(), "\"ph\" : \"B\""), 5);
+  ASSERT_EQ(count(trace.str(), "\"ph\" : \"E\""), 5);
+  ASSERT_EQ(count(trace.str(), "\"name\" : \"heap\""), 10);
+  ASSERT_EQ(count(trace.str(), "\"$3 Conv2D\""), 4);
+
+  std::stringstream summary;
+  profiler.writeSummary(summary);
+  ASSERT_NE(summary.str().find("load"), std::string::npos);
+  ASSERT_NE(summary.str().find("run"), std::string::npos);
+  ASSERT_NE(summary.str().find("$3 Conv2D"), std::string::npos);
+  ASSERT_EQ(summary.str().find("lower"), std::string::npos);
+}
+
+TEST(MemoryProfiler, peak_of_concurrent_profilers)
+{
+  util::MemoryProfiler profiler0{""};
+  util::MemoryProfiler profiler1{""};
+  ASSERT_TRUE(profiler0.exact());
+
+  auto run0 = profiler0.registerPhase("run");
+  auto run1 = profiler1.registerPhase("run");
+  profiler0.begin(run0);
+  profiler1.begin(run1);
+  fake_peak = 10 * 1024;
+  // The peak is read and reset by profiler0, which profiler1 must not miss
+  profiler0.end(run0);
+  profiler1.end(run1);
+
+  for (auto profiler : {&profiler0, &profiler1})
+  {
+    std::stringstream summary;
+    profiler->writeSummary(summary);
+    ASSERT_NE(summary.str().find("Peak heap usage : 10.0 KB"), std::string::npos)
+        << summary.str();
+  }
+}
@@ -29,4 +29,10 @@ TEST_F(ValidationTestAddModelLoaded, neg_run_001)
   ASSERT_EQ(nnfw_run(_session), NNFW_STATUS_ERROR);
 }
 
+TEST_F(ValidationTestAddModelLoaded, neg_query_metrics_001)
+{
+  nnfw_metrics metrics;
+  ASSERT_EQ(nnfw_query_metrics(_session, &metrics), NNFW_STATUS_ERROR);
+}
+
 TEST_F(ValidationTest, neg_prepare_001) { ASSERT_EQ(nnfw_prepare(nullptr), NNFW_STATUS_ERROR); }
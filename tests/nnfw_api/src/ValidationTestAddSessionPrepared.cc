@@ -42,4 +42,45 @@ TEST_F(ValidationTestAddSessionPrepared, run_001)
   ASSERT_EQ(nnfw_run(_session), NNFW_STATUS_NO_ERROR);
 }
 
+TEST_F(ValidationTestAddSessionPrepared, query_metrics_001)
+{
+  nnfw_tensorinfo ti_input;
+  std::vector<float> input_buffer;
+  ASSERT_EQ(nnfw_input_tensorinfo(_session, 0, &ti_input), NNFW_STATUS_NO_ERROR);
+  uint64_t input_elements = num_elems(&ti_input);
+  input_buffer.resize(input_elements);
+  ASSERT_EQ(nnfw_set_input(_session, 0, ti_input.dtype, input_buffer.data(),
+                           sizeof(float) * input_elements),
+            NNFW_STATUS_NO_ERROR);
+
+  nnfw_tensorinfo ti_output;
+  std::vector<float> output_buffer;
+  ASSERT_EQ(nnfw_output_tensorinfo(_session, 0, &ti_output), NNFW_STATUS_NO_ERROR);
+  uint64_t output_elements = num_elems(&ti_output);
+  output_buffer.resize(output_elements);
+  ASSERT_EQ(nnfw_set_output(_session, 0, ti_output.dtype, output_buffer.data(),
+                            sizeof(float) * output_elements),
+            NNFW_STATUS_NO_ERROR);
+
+  nnfw_metrics metrics;
+  ASSERT_EQ(nnfw_query_metrics(_session, &metrics), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(metrics.run_count, 0);
+
+  ASSERT_EQ(nnfw_run(_session), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_run(_session), NNFW_STATUS_NO_ERROR);
+
+  ASSERT_EQ(nnfw_query_metrics(_session, &metrics), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(metrics.run_count, 2);
+  ASSERT_GE(metrics.run_time_total_us, metrics.run_time_max_us);
+  uint64_t histogram_count = 0;
+  for (uint32_t i = 0; i < NNFW_METRICS_LATENCY_BUCKETS; ++i)
+    histogram_count += metrics.latency_histogram[i];
+  ASSERT_EQ(histogram_count, 2);
+}
+
+TEST_F(ValidationTestAddSessionPrepared, neg_query_metrics_001)
+{
+  ASSERT_EQ(nnfw_query_metrics(_session, nullptr), NNFW_STATUS_ERROR);
+}
+
 // TODO Validation check when "nnfw_run" is called without input & output tensor setting
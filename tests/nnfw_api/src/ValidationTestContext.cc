@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "fixtures.h"
+#include "circle_schema_generated.h"
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+
+const int32_t kSmallBatch = 1;
+const int32_t kLargeBatch = 64;
+
+const std::vector<float> weights{0.5f, -1.f, 2.f, 0.25f};
+
+// Model: out = Add(Add(Add(in, w), w), w) of in [batch, 4], with the same w for any batch
+// Intermediate tensors of a larger batch take a larger arena
+flatbuffers::DetachedBuffer buildModel(int32_t batch)
+{
+  flatbuffers::FlatBufferBuilder fbb;
+
+  std::vector<flatbuffers::Offset<circle::Buffer>> buffers;
+  buffers.push_back(circle::CreateBuffer(fbb));
+  buffers.push_back(circle::CreateBuffer(
+      fbb, fbb.CreateVector(reinterpret_cast<const uint8_t *>(weights.data()),
+                            weights.size() * sizeof(float))));
+
+  const std::vector<int32_t> shape{batch, 4};
+  const std::vector<int32_t> weights_shape{4};
+  std::vector<flatbuffers::Offset<circle::Tensor>> tensors;
+  tensors.push_back(circle::CreateTensorDirect(fbb, &shape, circle::TensorType_FLOAT32, 0, "in"));
+  tensors.push_back(
+      circle::CreateTensorDirect(fbb, &weights_shape, circle::TensorType_FLOAT32, 1, "w"));
+  tensors.push_back(circle::CreateTensorDirect(fbb, &shape, circle::TensorType_FLOAT32, 0, "t0"));
+  tensors.push_back(circle::CreateTensorDirect(fbb, &shape, circle::TensorType_FLOAT32, 0, "t1"));
+  tensors.push_back(circle::CreateTensorDirect(fbb, &shape, circle::TensorType_FLOAT32, 0, "out"));
+
+  std::vector<flatbuffers::Offset<circle::Operator>> operators;
+  for (int32_t i = 0; i < 3; ++i)
+  {
+    const std::vector<int32_t> inputs{i == 0 ? 0 : i + 1, 1};
+    const std::vector<int32_t> outputs{i + 2};
+    operators.push_back(circle::CreateOperatorDirect(fbb, 0, &inputs, &outputs,
+                                                     circle::BuiltinOptions_AddOptions,
+                                                     circle::CreateAddOptions(fbb).Union()));
+  }
+
+  const std::vector<int32_t> inputs{0}, outputs{4};
+  std::vector<flatbuffers::Offset<circle::SubGraph>> subgraphs;
+  subgraphs.push_back(
+      circle::CreateSubGraphDirect(fbb, &tensors, &inputs, &outputs, &operators, "main"));
+
+  std::vector<flatbuffers::Offset<circle::OperatorCode>> operator_codes;
+  operator_codes.push_back(circle::CreateOperatorCode(fbb, circle::BuiltinOperator_ADD));
+
+  auto model = circle::CreateModelDirect(fbb, 0, &operator_codes, &subgraphs, "test", &buffers);
+  circle::FinishModelBuffer(fbb, model);
+  return fbb.Release();
+}
+
+// nnpackage of the model above in a temporary directory
+class TempPackage
+{
+public:
+  explicit TempPackage(int32_t batch) : _path{"nnfw_api_test_XXXXXX"}
+  {
+    if (mkdtemp(&_path[0]) == nullptr || mkdir(metadataPath().c_str(), 0700) != 0)
+      throw std::runtime_error("Failed to create a temporary nnpackage");
+
+    const auto model = buildModel(batch);
+    std::ofstream model_file(modelPath(), std::ios::binary);
+    model_file.write(reinterpret_cast<const char *>(model.data()), model.size());
+
+    std::ofstream manifest_file(manifestPath());
+    manifest_file << R"({ "models" : [ "model.circle" ], "model-types" : [ "circle" ] })";
+  }
+
+  ~TempPackage()
+  {
+    std::remove(manifestPath().c_str());
+    std::remove(modelPath().c_str());
+    rmdir(metadataPath().c_str());
+    rmdir(_path.c_str());
+  }
+
+public:
+  const std::string &path(void) const { return _path; }
+
+private:
+  std::string metadataPath(void) const { return _path + "/metadata"; }
+  std::string manifestPath(void) const { return _path + "/metadata/MANIFEST"; }
+  std::string modelPath(void) const { return _path + "/model.circle"; }
+
+private:
+  std::string _path;
+};
+
+std::vector<float> makeInput(int32_t batch)
+{
+  std::vector<float> input(batch * 4);
+  for (size_t n = 0; n < input.size(); ++n)
+    input[n] = static_cast<float>(static_cast<int>(n * 7 % 13) - 6) / 4.f;
+  return input;
+}
+
+std::vector<float> run(nnfw_session *session, int32_t batch)
+{
+  auto input = makeInput(batch);
+  std::vector<float> output(input.size());
+  EXPECT_EQ(nnfw_set_input(session, 0, NNFW_TYPE_TENSOR_FLOAT32, input.data(),
+                           sizeof(float) * input.size()),
+            NNFW_STATUS_NO_ERROR);
+  EXPECT_EQ(nnfw_set_output(session, 0, NNFW_TYPE_TENSOR_FLOAT32, output.data(),
+                            sizeof(float) * output.size()),
+            NNFW_STATUS_NO_ERROR);
+  EXPECT_EQ(nnfw_run(session), NNFW_STATUS_NO_ERROR);
+  return output;
+}
+
+} // namespace
+
+class ValidationTestContext : public ValidationTest
+{
+protected:
+  void SetUp() override
+  {
+    ValidationTest::SetUp();
+    _small = std::make_unique<TempPackage>(kSmallBatch);
+    _large = std::make_unique<TempPackage>(kLargeBatch);
+  }
+
+  void TearDown() override
+  {
+    _small.reset();
+    _large.reset();
+    ValidationTest::TearDown();
+  }
+
+  // Run the packages in a context, preparing the small one first or not, and sessions of their own
+  void runInContext(bool small_first)
+  {
+    nnfw_context *context = nullptr;
+    ASSERT_EQ(nnfw_create_context(&context), NNFW_STATUS_NO_ERROR);
+
+    nnfw_session *small = nullptr, *large = nullptr;
+    ASSERT_EQ(nnfw_create_session(&small), NNFW_STATUS_NO_ERROR);
+    ASSERT_EQ(nnfw_create_session(&large), NNFW_STATUS_NO_ERROR);
+    ASSERT_EQ(nnfw_set_context(small, context), NNFW_STATUS_NO_ERROR);
+    ASSERT_EQ(nnfw_set_context(large, context), NNFW_STATUS_NO_ERROR);
+    ASSERT_EQ(nnfw_load_model_from_file(small, _small->path().c_str()), NNFW_STATUS_NO_ERROR);
+    ASSERT_EQ(nnfw_load_model_from_file(large, _large->path().c_str()), NNFW_STATUS_NO_ERROR);
+
+    // The arena is reallocated on preparing the large one after the small one
+    for (auto session : small_first ? std::vector<nnfw_session *>{small, large}
+                                    : std::vector<nnfw_session *>{large, small})
+      ASSERT_EQ(nnfw_prepare(session), NNFW_STATUS_NO_ERROR);
+
+    // Sessions keep the resources of the context until they are closed
+    ASSERT_EQ(nnfw_close_context(context), NNFW_STATUS_NO_ERROR);
+
+    // Run them alternately, so that each run overwrites the arena of the other
+    std::vector<float> small_outputs[2], large_outputs[2];
+    for (int n = 0; n < 2; ++n)
+    {
+      small_outputs[n] = run(small, kSmallBatch);
+      large_outputs[n] = run(large, kLargeBatch);
+    }
+
+    ASSERT_EQ(nnfw_close_session(small), NNFW_STATUS_NO_ERROR);
+    ASSERT_EQ(nnfw_close_session(large), NNFW_STATUS_NO_ERROR);
+
+    for (int n = 0; n < 2; ++n)
+    {
+      expectSameAsAlone(_small->path(), kSmallBatch, small_outputs[n]);
+      expectSameAsAlone(_large->path(), kLargeBatch, large_outputs[n]);
+    }
+  }
+
+  void expectSameAsAlone(const std::string &package, int32_t batch,
+                         const std::vector<float> &outputs)
+  {
+    nnfw_session *session = nullptr;
+    ASSERT_EQ(nnfw_create_session(&session), NNFW_STATUS_NO_ERROR);
+    ASSERT_EQ(nnfw_load_model_from_file(session, package.c_str()), NNFW_STATUS_NO_ERROR);
+    ASSERT_EQ(nnfw_prepare(session), NNFW_STATUS_NO_ERROR);
+    const auto expected = run(session, batch);
+    ASSERT_EQ(nnfw_close_session(session), NNFW_STATUS_NO_ERROR);
+
+    const auto input = makeInput(batch);
+    ASSERT_EQ(outputs.size(), expected.size());
+    for (size_t n = 0; n < outputs.size(); ++n)
+    {
+      EXPECT_FLOAT_EQ(expected[n], input[n] + 3 * weights[n % 4]) << "at " << n;
+      EXPECT_FLOAT_EQ(outputs[n], expected[n]) << "batch " << batch << ", at " << n;
+    }
+  }
+
+protected:
+  std::unique_ptr<TempPackage> _small;
+  std::unique_ptr<TempPackage> _large;
+};
+
+TEST_F(ValidationTestContext, prepare_small_first)
+{
+  runInContext(true);
+}
+
+TEST_F(ValidationTestContext, prepare_large_first)
+{
+  runInContext(false);
+}
+
+TEST_F(ValidationTestContext, neg_set_context_after_load)
+{
+  nnfw_context *context = nullptr;
+  nnfw_session *session = nullptr;
+  ASSERT_EQ(nnfw_create_context(&context), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_create_session(&session), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_load_model_from_file(session, _small->path().c_str()), NNFW_STATUS_NO_ERROR);
+  EXPECT_EQ(nnfw_set_context(session, context), NNFW_STATUS_ERROR);
+  ASSERT_EQ(nnfw_close_context(context), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_close_session(session), NNFW_STATUS_NO_ERROR);
+}
@@ -49,9 +49,28 @@ void Args::Initialize(void)
          "e.g. nnpackage_run-UNIT_Add_000-acl_cl.csv.\n"
          "{nnpkg} name may be changed to realpath if you use symbolic-link.")
     ;
+
+  // Load generator options
+  po::options_description load("Load generator options", 100);
+
+  load.add_options()
+    ("load_mode", po::value<std::string>()->default_value(""),
+         "Generate load instead of sequential runs\n"
+         "closed: each thread runs again as soon as the previous run is done\n"
+         "open: runs are requested at the rate of load_qps, regardless of threads being busy")
+    ("load_threads", po::value<int>()->default_value(1), "The number of threads running at once")
+    ("load_shared_session", po::value<bool>()->default_value(false),
+         "Let threads share one session, whose runs are serialized\n"
+         "Otherwise each thread has its own session.")
+    ("load_qps", po::value<double>()->default_value(0.0), "Target rate of runs per second (open)")
+    ("load_duration", po::value<double>()->default_value(10.0), "Duration of load in seconds")
+    ("load_report", po::value<std::string>()->default_value(""),
+         "Write throughput, latency percentiles/histogram and memory of load to JSON file")
+    ;
   // clang-format on
 
   _options.add(general);
+  _options.add(load);
   _positional.add("nnpackage", 1);
 }
 
@@ -144,6 +163,36 @@ void Args::Parse(const int argc, char **argv)
   {
     _write_report = vm["write_report"].as<bool>();
   }
+
+  if (vm.count("load_mode"))
+  {
+    _load_mode = vm["load_mode"].as<std::string>();
+  }
+
+  if (vm.count("load_threads"))
+  {
+    _load_threads = vm["load_threads"].as<int>();
+  }
+
+  if (vm.count("load_shared_session"))
+  {
+    _load_shared_session = vm["load_shared_session"].as<bool>();
+  }
+
+  if (vm.count("load_qps"))
+  {
+    _load_qps = vm["load_qps"].as<double>();
+  }
+
+  if (vm.count("load_duration"))
+  {
+    _load_duration = vm["load_duration"].as<double>();
+  }
+
+  if (vm.count("load_report"))
+  {
+    _load_report_filename = vm["load_report"].as<std::string>();
+  }
 }
 
 } // end of namespace nnpkg_run
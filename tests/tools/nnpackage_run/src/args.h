@@ -40,6 +40,12 @@ public:
   const bool getMemoryPoll(void) const { return _mem_poll; }
   const bool getWriteReport(void) const { return _write_report; }
   const bool printVersion(void) const { return _print_version; }
+  const std::string &getLoadMode(void) const { return _load_mode; }
+  const int getLoadThreads(void) const { return _load_threads; }
+  const bool getLoadSharedSession(void) const { return _load_shared_session; }
+  const double getLoadQps(void) const { return _load_qps; }
+  const double getLoadDuration(void) const { return _load_duration; }
+  const std::string &getLoadReportFilename(void) const { return _load_report_filename; }
 
 private:
   void Initialize();
@@ -58,6 +64,12 @@ private:
   bool _mem_poll;
   bool _write_report;
   bool _print_version = false;
+  std::string _load_mode;
+  int _load_threads;
+  bool _load_shared_session;
+  double _load_qps;
+  double _load_duration;
+  std::string _load_report_filename;
 };
 
 } // end of namespace nnpkg_run
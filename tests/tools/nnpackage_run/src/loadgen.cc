@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "loadgen.h"
+
+#include "benchmark/MemoryPoller.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+double microsBetween(Clock::time_point from, Clock::time_point to)
+{
+  return std::chrono::duration<double, std::micro>(to - from).count();
+}
+
+const double kPercentiles[] = {50.0, 90.0, 99.0, 99.9};
+
+} // namespace
+
+namespace nnpkg_run
+{
+
+double LoadResult::throughput() const
+{
+  if (elapsed_us <= 0.0)
+    return 0.0;
+  return latencies.size() / (elapsed_us / 1e6);
+}
+
+double LoadResult::percentile(double p) const
+{
+  if (latencies.empty())
+    return 0.0;
+  const auto rank = static_cast<size_t>(std::ceil(p / 100.0 * latencies.size()));
+  return latencies[std::min(latencies.size(), std::max<size_t>(rank, 1)) - 1];
+}
+
+LoadGenerator::LoadGenerator(const LoadConfig &config) : _config(config)
+{
+  if (_config.num_workers == 0)
+    throw std::runtime_error("The number of load threads must be positive");
+  if (_config.mode == LoadMode::OPEN && _config.qps <= 0.0)
+    throw std::runtime_error("Open loop load needs a positive target QPS");
+  if (_config.duration_sec <= 0.0)
+    throw std::runtime_error("Load duration must be positive");
+}
+
+LoadResult LoadGenerator::run(const RunFunc &run_func) const
+{
+  const auto start = Clock::now();
+  const auto deadline =
+      start + std::chrono::duration_cast<Clock::duration>(
+                  std::chrono::duration<double>(_config.duration_sec));
+  const auto interval = std::chrono::duration_cast<Clock::duration>(
+      std::chrono::duration<double>(_config.mode == LoadMode::OPEN ? 1.0 / _config.qps : 0.0));
+
+  // Index of the next request to be scheduled (OPEN)
+  std::atomic<uint64_t> next_request{0};
+  std::atomic<bool> failed{false};
+  std::exception_ptr error;
+  std::mutex mutex;
+  std::vector<std::vector<double>> latencies(_config.num_workers);
+  std::vector<Clock::time_point> last_done(_config.num_workers, start);
+
+  auto work = [&](uint32_t worker) {
+    try
+    {
+      while (!failed)
+      {
+        Clock::time_point issued;
+        if (_config.mode == LoadMode::OPEN)
+        {
+          // Requests are scheduled regardless of workers being busy
+          issued = start + interval * next_request++;
+          if (issued >= deadline)
+            break;
+          std::this_thread::sleep_until(issued);
+        }
+        else
+        {
+          issued = Clock::now();
+          if (issued >= deadline)
+            break;
+        }
+
+        run_func(worker);
+
+        const auto done = Clock::now();
+        latencies[worker].push_back(microsBetween(issued, done));
+        last_done[worker] = done;
+      }
+    }
+    catch (...)
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (!error)
+        error = std::current_exception();
+      failed = true;
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (uint32_t worker = 1; worker < _config.num_workers; ++worker)
+    threads.emplace_back(work, worker);
+  work(0);
+  for (auto &thread : threads)
+    thread.join();
+
+  if (error)
+    std::rethrow_exception(error);
+
+  LoadResult result;
+  for (const auto &worker_latencies : latencies)
+    result.latencies.insert(result.latencies.end(), worker_latencies.begin(),
+                            worker_latencies.end());
+  std::sort(result.latencies.begin(), result.latencies.end());
+  result.elapsed_us = microsBetween(start, *std::max_element(last_done.begin(), last_done.end()));
+  return result;
+}
+
+LoadMode toLoadMode(const std::string &mode)
+{
+  if (mode == "closed")
+    return LoadMode::CLOSED;
+  if (mode == "open")
+    return LoadMode::OPEN;
+  throw std::runtime_error("Unknown load mode: " + mode);
+}
+
+std::string getLoadModeString(LoadMode mode)
+{
+  switch (mode)
+  {
+    case LoadMode::CLOSED:
+      return "closed";
+    case LoadMode::OPEN:
+      return "open";
+    default:
+      throw std::runtime_error("Unknown load mode");
+  }
+}
+
+void printLoadResult(const LoadConfig &config, const LoadResult &result)
+{
+  std::cout << "===================================" << std::endl;
+  std::cout << "LOAD (" << getLoadModeString(config.mode) << " loop, " << config.num_workers
+            << " threads";
+  if (config.mode == LoadMode::OPEN)
+    std::cout << ", target " << config.qps << " qps";
+  std::cout << ")" << std::endl;
+  std::cout << "- Requests:   " << result.latencies.size() << std::endl;
+  std::cout << "- Throughput: " << result.throughput() << " qps" << std::endl;
+  for (auto p : kPercentiles)
+    std::cout << "- p" << p << ": " << result.percentile(p) / 1e3 << " ms" << std::endl;
+  if (!result.latencies.empty())
+    std::cout << "- Max:  " << result.latencies.back() / 1e3 << " ms" << std::endl;
+  std::cout << "===================================" << std::endl;
+}
+
+void writeLoadResultJson(const std::string &filename, const std::string &nnpkg_name,
+                         const LoadConfig &config, const LoadResult &result,
+                         const benchmark::MemoryPoller *mp)
+{
+  std::ofstream ofs(filename);
+  if (!ofs.is_open())
+    throw std::runtime_error("Failed to open " + filename);
+
+  ofs << "{\n";
+  ofs << "  \"nnpackage\": \"" << nnpkg_name << "\",\n";
+  ofs << "  \"mode\": \"" << getLoadModeString(config.mode) << "\",\n";
+  ofs << "  \"threads\": " << config.num_workers << ",\n";
+  ofs << "  \"target_qps\": " << (config.mode == LoadMode::OPEN ? config.qps : 0.0) << ",\n";
+  ofs << "  \"duration_sec\": " << config.duration_sec << ",\n";
+  ofs << "  \"requests\": " << result.latencies.size() << ",\n";
+  ofs << "  \"throughput_qps\": " << result.throughput() << ",\n";
+
+  ofs << "  \"latency_us\": {";
+  for (auto p : kPercentiles)
+    ofs << "\"p" << p << "\": " << result.percentile(p) << ", ";
+  ofs << "\"max\": " << (result.latencies.empty() ? 0.0 : result.latencies.back()) << "},\n";
+
+  // Histogram with buckets of latency doubling from 16us, each of which counts requests done
+  // in the latency up to its bound
+  ofs << "  \"histogram\": [";
+  double bound = 16.0;
+  size_t begin = 0;
+  bool first = true;
+  while (begin < result.latencies.size())
+  {
+    const auto end = static_cast<size_t>(
+        std::upper_bound(result.latencies.begin() + begin, result.latencies.end(), bound) -
+        result.latencies.begin());
+    if (end > begin)
+    {
+      ofs << (first ? "" : ", ") << "{\"le_us\": " << bound << ", \"count\": " << (end - begin)
+          << "}";
+      first = false;
+    }
+    begin = end;
+    bound *= 2.0;
+  }
+  ofs << "]";
+
+  if (mp != nullptr)
+  {
+    // In kilobytes, as polled during each phase
+    auto writePhases = [&ofs](const std::unordered_map<benchmark::Phase, uint32_t> &map) {
+      bool first = true;
+      ofs << "{";
+      for (const auto &phase : {benchmark::Phase::MODEL_LOAD, benchmark::Phase::PREPARE,
+                                benchmark::Phase::EXECUTE})
+      {
+        auto it = map.find(phase);
+        if (it == map.end())
+          continue;
+        ofs << (first ? "" : ", ") << "\"" << benchmark::getPhaseString(phase)
+            << "\": " << it->second;
+        first = false;
+      }
+      ofs << "}";
+    };
+    ofs << ",\n  \"rss_kb\": ";
+    writePhases(mp->getRssMap());
+    ofs << ",\n  \"hwm_kb\": ";
+    writePhases(mp->getHwmMap());
+  }
+  ofs << "\n}\n";
+}
+
+} // end of namespace nnpkg_run
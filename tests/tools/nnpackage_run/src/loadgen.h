@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNPACKAGE_RUN_LOADGEN_H__
+#define __NNPACKAGE_RUN_LOADGEN_H__
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace benchmark
+{
+class MemoryPoller;
+} // namespace benchmark
+
+namespace nnpkg_run
+{
+
+enum class LoadMode
+{
+  // Each worker sends a request as soon as the previous one is done
+  CLOSED,
+  // Requests arrive at a fixed rate regardless of how fast they are done
+  OPEN,
+};
+
+struct LoadConfig
+{
+  LoadMode mode = LoadMode::CLOSED;
+  uint32_t num_workers = 1;
+  // Target rate of requests per second (only for OPEN)
+  double qps = 0.0;
+  double duration_sec = 10.0;
+};
+
+struct LoadResult
+{
+  // Latencies of requests in microseconds, sorted
+  std::vector<double> latencies;
+  // Time from the first request to the last response in microseconds
+  double elapsed_us = 0.0;
+
+  double throughput() const;
+  // Latency below which 'p' percent of requests are done (nearest rank)
+  double percentile(double p) const;
+};
+
+/**
+ * @brief Generates load of inference requests with workers running concurrently
+ *
+ * For OPEN mode, latency is measured from when a request is scheduled rather than when it is
+ * started, so that time waiting for a free worker is included.
+ */
+class LoadGenerator
+{
+public:
+  // Runs one inference on the session of 'worker', which throws on failure
+  using RunFunc = std::function<void(uint32_t worker)>;
+
+public:
+  LoadGenerator(const LoadConfig &config);
+
+public:
+  // Exception thrown by run_func on any thread stops all of them and is rethrown
+  LoadResult run(const RunFunc &run_func) const;
+
+private:
+  LoadConfig _config;
+};
+
+LoadMode toLoadMode(const std::string &mode);
+std::string getLoadModeString(LoadMode mode);
+
+void printLoadResult(const LoadConfig &config, const LoadResult &result);
+void writeLoadResultJson(const std::string &filename, const std::string &nnpkg_name,
+                         const LoadConfig &config, const LoadResult &result,
+                         const benchmark::MemoryPoller *mp);
+
+} // end of namespace nnpkg_run
+
+#endif // __NNPACKAGE_RUN_LOADGEN_H__
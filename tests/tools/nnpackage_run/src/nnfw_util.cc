@@ -39,6 +39,7 @@ uint64_t bufsize_for(const nnfw_tensorinfo *ti)
       sizeof(uint8_t), /* NNFW_TYPE_TENSOR_QUANT8_ASYMM */
       sizeof(bool),    /* NNFW_TYPE_TENSOR_BOOL = 3 */
       sizeof(uint8_t), /* NNFW_TYPE_TENSOR_UINT8 = 4 */
+      sizeof(int8_t),  /* NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED = 5 */
   };
   return elmsize[ti->dtype] * num_elems(ti);
 }
@@ -19,6 +19,9 @@
 
 #include "nnfw.h"
 
+#include <stdexcept>
+#include <string>
+
 #define NNPR_ENSURE_STATUS(a)        \
   do                                 \
   {                                  \
@@ -28,6 +31,16 @@
     }                                \
   } while (0)
 
+// Throw rather than exit where the caller handles the error, ex: threads of LoadGenerator
+#define NNPR_THROW_IF_ERROR(a)                               \
+  do                                                         \
+  {                                                          \
+    if ((a) != NNFW_STATUS_NO_ERROR)                         \
+    {                                                        \
+      throw std::runtime_error(std::string{#a} + " failed"); \
+    }                                                        \
+  } while (0)
+
 namespace nnpkg_run
 {
 uint64_t num_elems(const nnfw_tensorinfo *ti);
@@ -18,6 +18,7 @@
 #include "args.h"
 #include "benchmark.h"
 #include "h5formatter.h"
+#include "loadgen.h"
 #include "tflite/Diff.h"
 #include "nnfw.h"
 #include "nnfw_util.h"
@@ -29,7 +30,10 @@
 #include <cassert>
 #include <chrono>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <unordered_map>
 #include <vector>
@@ -68,6 +72,64 @@ NNFW_STATUS resolve_op_backend(nnfw_session *session)
   return NNFW_STATUS_NO_ERROR;
 }
 
+void setOutputs(nnfw_session *session, std::vector<nnpkg_run::Allocation> &outputs)
+{
+  using namespace nnpkg_run;
+
+  uint32_t num_outputs = 0;
+  NNPR_ENSURE_STATUS(nnfw_output_size(session, &num_outputs));
+  outputs = std::vector<Allocation>(num_outputs);
+
+  for (uint32_t i = 0; i < num_outputs; i++)
+  {
+    nnfw_tensorinfo ti;
+    NNPR_ENSURE_STATUS(nnfw_output_tensorinfo(session, i, &ti));
+    auto output_size_in_bytes = bufsize_for(&ti);
+    outputs[i].alloc(output_size_in_bytes);
+    NNPR_ENSURE_STATUS(
+        nnfw_set_output(session, i, ti.dtype, outputs[i].data(), output_size_in_bytes));
+    NNPR_ENSURE_STATUS(nnfw_set_output_layout(session, i, NNFW_LAYOUT_CHANNELS_LAST));
+  }
+}
+
+// Session of a load generator thread, which runs with the same inputs as the main session
+struct WorkerSession
+{
+  WorkerSession(const std::string &nnpackage_path, const char *available_backends,
+                const std::vector<nnpkg_run::Allocation> &src_inputs)
+  {
+    using namespace nnpkg_run;
+
+    NNPR_ENSURE_STATUS(nnfw_create_debug_session(&session));
+    if (available_backends)
+      NNPR_ENSURE_STATUS(nnfw_set_available_backends(session, available_backends));
+    NNPR_ENSURE_STATUS(resolve_op_backend(session));
+    NNPR_ENSURE_STATUS(nnfw_load_model_from_file(session, nnpackage_path.c_str()));
+    NNPR_ENSURE_STATUS(nnfw_prepare(session));
+
+    inputs = std::vector<Allocation>(src_inputs.size());
+    for (uint32_t i = 0; i < src_inputs.size(); ++i)
+    {
+      nnfw_tensorinfo ti;
+      NNPR_ENSURE_STATUS(nnfw_input_tensorinfo(session, i, &ti));
+      auto input_size_in_bytes = bufsize_for(&ti);
+      inputs[i].alloc(input_size_in_bytes);
+      std::memcpy(inputs[i].data(), src_inputs[i].data(), input_size_in_bytes);
+      NNPR_ENSURE_STATUS(
+          nnfw_set_input(session, i, ti.dtype, inputs[i].data(), input_size_in_bytes));
+      NNPR_ENSURE_STATUS(nnfw_set_input_layout(session, i, NNFW_LAYOUT_CHANNELS_LAST));
+    }
+
+    setOutputs(session, outputs);
+  }
+
+  ~WorkerSession() { nnfw_close_session(session); }
+
+  nnfw_session *session = nullptr;
+  std::vector<nnpkg_run::Allocation> inputs;
+  std::vector<nnpkg_run::Allocation> outputs;
+};
+
 int main(const int argc, char **argv)
 {
   using namespace nnpkg_run;
@@ -128,7 +190,7 @@ int main(const int argc, char **argv)
     {
       nnfw_tensorinfo ti;
       NNPR_ENSURE_STATUS(nnfw_input_tensorinfo(session, i, &ti));
-      if (ti.dtype < NNFW_TYPE_TENSOR_FLOAT32 || ti.dtype > NNFW_TYPE_TENSOR_UINT8)
+      if (ti.dtype < NNFW_TYPE_TENSOR_FLOAT32 || ti.dtype > NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED)
       {
         std::cerr << "E: not supported input type" << std::endl;
         exit(-1);
@@ -144,7 +206,7 @@ int main(const int argc, char **argv)
     {
       nnfw_tensorinfo ti;
       NNPR_ENSURE_STATUS(nnfw_output_tensorinfo(session, i, &ti));
-      if (ti.dtype < NNFW_TYPE_TENSOR_FLOAT32 || ti.dtype > NNFW_TYPE_TENSOR_UINT8)
+      if (ti.dtype < NNFW_TYPE_TENSOR_FLOAT32 || ti.dtype > NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED)
       {
         std::cerr << "E: not supported output type" << std::endl;
         exit(-1);
@@ -191,6 +253,7 @@ int main(const int argc, char **argv)
           randomData<bool>(randgen, inputs[i].data(), num_elems(&ti));
           break;
         case NNFW_TYPE_TENSOR_UINT8:
+        case NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED:
           randomData<uint8_t>(randgen, inputs[i].data(), num_elems(&ti));
           break;
         case NNFW_TYPE_TENSOR_INT32:
@@ -212,19 +275,81 @@ int main(const int argc, char **argv)
 
   // prepare output
 
-  uint32_t num_outputs = 0;
-  NNPR_ENSURE_STATUS(nnfw_output_size(session, &num_outputs));
-  std::vector<Allocation> outputs(num_outputs);
+  std::vector<Allocation> outputs;
+  setOutputs(session, outputs);
 
-  for (uint32_t i = 0; i < num_outputs; i++)
+  if (!args.getLoadMode().empty())
   {
-    nnfw_tensorinfo ti;
-    NNPR_ENSURE_STATUS(nnfw_output_tensorinfo(session, i, &ti));
-    auto output_size_in_bytes = bufsize_for(&ti);
-    outputs[i].alloc(output_size_in_bytes);
-    NNPR_ENSURE_STATUS(
-        nnfw_set_output(session, i, ti.dtype, outputs[i].data(), output_size_in_bytes));
-    NNPR_ENSURE_STATUS(nnfw_set_output_layout(session, i, NNFW_LAYOUT_CHANNELS_LAST));
+    try
+    {
+      LoadConfig config;
+      config.mode = toLoadMode(args.getLoadMode());
+      config.num_workers = args.getLoadThreads() > 0 ? args.getLoadThreads() : 0;
+      config.qps = args.getLoadQps();
+      config.duration_sec = args.getLoadDuration();
+      LoadGenerator load_generator(config);
+
+      // The main session is used by the first thread, or shared by all the threads
+      std::vector<std::unique_ptr<WorkerSession>> worker_sessions;
+      std::vector<nnfw_session *> sessions{session};
+      if (!args.getLoadSharedSession())
+      {
+        for (uint32_t n = 1; n < config.num_workers; ++n)
+        {
+          worker_sessions.emplace_back(
+              new WorkerSession(nnpackage_path, available_backends, inputs));
+          sessions.push_back(worker_sessions.back()->session);
+        }
+      }
+
+      for (auto s : sessions)
+      {
+        for (int i = 0; i < args.getWarmupRuns(); i++)
+          NNPR_THROW_IF_ERROR(nnfw_run(s));
+      }
+
+      // A session cannot run on multiple threads at once
+      std::mutex shared_mutex;
+      auto run = [&](uint32_t worker) {
+        if (args.getLoadSharedSession())
+        {
+          std::lock_guard<std::mutex> lock(shared_mutex);
+          NNPR_THROW_IF_ERROR(nnfw_run(session));
+        }
+        else
+        {
+          NNPR_THROW_IF_ERROR(nnfw_run(sessions[worker]));
+        }
+      };
+
+      if (mp)
+        mp->start(benchmark::Phase::EXECUTE);
+      auto load_result = load_generator.run(run);
+      if (mp)
+        mp->end(benchmark::Phase::EXECUTE);
+
+      worker_sessions.clear();
+      NNPR_ENSURE_STATUS(nnfw_close_session(session));
+
+      printLoadResult(config, load_result);
+
+      if (!args.getLoadReportFilename().empty())
+      {
+        std::string nnpkg_name = nnpackage_path;
+        char buf[1024];
+        if (realpath(nnpackage_path.c_str(), buf))
+          nnpkg_name = basename(buf);
+        writeLoadResultJson(args.getLoadReportFilename(), nnpkg_name, config, load_result,
+                            mp.get());
+      }
+    }
+    catch (const std::runtime_error &error)
+    {
+      std::cerr << error.what() << std::endl;
+      return 1;
+    }
+
+    return 0;
   }
 
   // poll memories before warming up